@@ -0,0 +1,45 @@
+# Helpers for building the Google Benchmark executables of the BSW modules.
+#
+# Every benchmark executable added with openbsw_add_benchmark() is collected by the target
+# bsw-benchmarks, which builds and runs them one after the other. The results of each executable
+# are written as JSON to ${OPENBSW_BENCHMARK_RESULT_DIR}/<name>.json. Additional arguments for
+# all executables, e.g. --benchmark_repetitions=5, can be passed in OPENBSW_BENCHMARK_ARGS.
+
+find_package(benchmark REQUIRED)
+
+set(OPENBSW_BENCHMARK_RESULT_DIR
+    "${CMAKE_BINARY_DIR}/benchmarks"
+    CACHE PATH "Directory for the JSON results of the benchmarks")
+set(OPENBSW_BENCHMARK_ARGS
+    ""
+    CACHE STRING "Additional arguments passed to all benchmark executables")
+
+add_custom_target(bsw-benchmarks)
+
+function (openbsw_add_benchmark NAME)
+    cmake_parse_arguments(ARG "" "" "SOURCES;LIBRARIES" ${ARGN})
+
+    add_executable(${NAME} ${ARG_SOURCES})
+    target_link_libraries(${NAME} PRIVATE ${ARG_LIBRARIES} benchmark::benchmark_main)
+
+    separate_arguments(_args NATIVE_COMMAND "${OPENBSW_BENCHMARK_ARGS}")
+    add_custom_target(
+        ${NAME}Run
+        COMMAND ${CMAKE_COMMAND} -E make_directory "${OPENBSW_BENCHMARK_RESULT_DIR}"
+        COMMAND
+            $<TARGET_FILE:${NAME}>
+            --benchmark_out=${OPENBSW_BENCHMARK_RESULT_DIR}/${NAME}.json
+            --benchmark_out_format=json ${_args}
+        DEPENDS ${NAME}
+        USES_TERMINAL
+        COMMENT "Running ${NAME}")
+
+    # Run the benchmarks one after the other, parallel runs would distort the results.
+    get_property(_previous GLOBAL PROPERTY OPENBSW_LAST_BENCHMARK_RUN)
+    if (_previous)
+        add_dependencies(${NAME}Run ${_previous})
+    endif ()
+    set_property(GLOBAL PROPERTY OPENBSW_LAST_BENCHMARK_RUN ${NAME}Run)
+
+    add_dependencies(bsw-benchmarks ${NAME}Run)
+endfunction ()
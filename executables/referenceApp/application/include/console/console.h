@@ -2,12 +2,27 @@
 
 #pragma once
 
+#include <etl/delegate.h>
+
 namespace console
 {
+using LineProcessedFunctionType = ::etl::delegate<void()>;
+
 void enable();
 void disable();
 
 void init();
 void run();
 
+/**
+ * Returns true while a line read by run() is processed, no input is read meanwhile.
+ */
+bool isProcessingLine();
+
+/**
+ * Set a function that is called after a line has been processed. Commands may complete in any
+ * task, so the function may be called from another task than run().
+ */
+void setLineProcessedFunction(LineProcessedFunctionType const& lineProcessedFunction);
+
 } // namespace console
@@ -4,8 +4,20 @@
 
 namespace logger
 {
+class ILoggerListener;
+
 void init();
-void run();
+
+/**
+ * Output the next buffered log entry.
+ * \return true if an entry has been output, i.e. further entries may be pending
+ */
+bool run();
 void flush();
 
+/**
+ * Add a listener that is notified whenever a log entry has been buffered.
+ */
+void addListener(ILoggerListener& listener);
+
 } // namespace logger
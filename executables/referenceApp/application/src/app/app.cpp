@@ -43,6 +43,13 @@
 #include <async/AsyncBinding.h>
 #include <lifecycle/LifecycleLogger.h>
 #include <lifecycle/LifecycleManager.h>
+#ifdef SUPPORT_POSIX
+#include <logger/ILoggerListener.h>
+#include <systems/FileDescriptorWatcher.h>
+
+#include <sys/stat.h>
+#include <unistd.h>
+#endif // SUPPORT_POSIX
 
 #include <cstdio>
 
@@ -88,6 +95,10 @@ using ::util::logger::Logger;
 using AsyncAdapter        = ::async::AsyncBinding::AdapterType;
 using AsyncRuntimeMonitor = ::async::AsyncBinding::RuntimeMonitorType;
 using AsyncContextHook    = ::async::AsyncBinding::ContextHookType;
+#if ASYNC_CONFIG_RUNNABLE_MONITOR
+using AsyncRunnableMonitor = ::async::AsyncBinding::RunnableMonitorType;
+using AsyncRunnableHook    = ::async::AsyncBinding::RunnableHookType;
+#endif
 
 constexpr size_t MaxNumComponents         = 16;
 constexpr size_t MaxNumLevels             = 8;
@@ -130,10 +141,17 @@ LifecycleManager lifecycleManager{
 class LifecycleMonitor : private ::lifecycle::ILifecycleListener
 {
 public:
+    using ReadyForResetFunctionType = ::etl::delegate<void()>;
+
     explicit LifecycleMonitor(LifecycleManager& manager) { manager.addLifecycleListener(*this); }
 
     bool isReadyForReset() const { return _isReadyForReset; }
 
+    void setReadyForResetFunction(ReadyForResetFunctionType const& readyForResetFunction)
+    {
+        _readyForResetFunction = readyForResetFunction;
+    }
+
 private:
     void lifecycleLevelReached(
         uint8_t const level,
@@ -142,18 +160,34 @@ private:
         if (0 == level)
         {
             _isReadyForReset = true;
+            if (_readyForResetFunction.is_valid())
+            {
+                _readyForResetFunction();
+            }
         }
     }
 
 private:
     bool _isReadyForReset = false;
+    ReadyForResetFunctionType _readyForResetFunction;
 };
 
 LifecycleMonitor lifecycleMonitor(lifecycleManager);
 
-class IdleHandler : private ::async::RunnableType
+class IdleHandler
+: private ::async::RunnableType
+#ifdef SUPPORT_POSIX
+, private ::logger::ILoggerListener
+#endif // SUPPORT_POSIX
 {
 public:
+#ifdef SUPPORT_POSIX
+    IdleHandler()
+    : _stdinWatcher(::systems::FileDescriptorWatcher::ReadyFunctionType::
+                        create<IdleHandler, &IdleHandler::trigger>(*this))
+    {}
+#endif // SUPPORT_POSIX
+
     void init()
     {
         ::logger::init();
@@ -162,12 +196,30 @@ public:
         ::console::enable();
     }
 
-    void start() { ::async::execute(AsyncAdapter::TASK_IDLE, *this); }
+    void start()
+    {
+#ifdef SUPPORT_POSIX
+        // the idle task of a native thread shall not occupy a host core, so it only runs if
+        // entries have been logged, input is available or a console line has been processed
+        ::logger::addListener(*this);
+        ::console::setLineProcessedFunction(
+            ::console::LineProcessedFunctionType::create<IdleHandler, &IdleHandler::trigger>(
+                *this));
+        lifecycleMonitor.setReadyForResetFunction(
+            LifecycleMonitor::ReadyForResetFunctionType::
+                create<IdleHandler, &IdleHandler::trigger>(*this));
+        if (isWatchable(STDIN_FILENO))
+        {
+            (void)_stdinWatcher.start(STDIN_FILENO);
+        }
+#endif // SUPPORT_POSIX
+        trigger();
+    }
 
 private:
     void execute() override
     {
-        ::logger::run();
+        bool const isLogPending = ::logger::run();
         ::console::run();
 #ifdef PLATFORM_SUPPORT_ROM_CHECK
         RomCheck.idle();
@@ -178,10 +230,24 @@ private:
         }
         else
         {
-            ::async::execute(AsyncAdapter::TASK_IDLE, *this);
+#ifdef SUPPORT_POSIX
+            if (!::console::isProcessingLine())
+            {
+                _stdinWatcher.rearm();
+            }
+            if (isLogPending)
+            {
+                trigger();
+            }
+#else
+            (void)isLogPending;
+            trigger();
+#endif // SUPPORT_POSIX
         }
     }
 
+    void trigger() { ::async::execute(AsyncAdapter::TASK_IDLE, *this); }
+
     void shutdown()
     {
         Logger::info(LIFECYCLE, "Lifecycle shutdown complete");
@@ -189,6 +255,27 @@ private:
 
         softwareSystemReset();
     }
+
+#ifdef SUPPORT_POSIX
+    void logAvailable() override { trigger(); }
+
+    /**
+     * Regular files and character devices like /dev/null are always readable, watching them
+     * would keep the idle task busy.
+     */
+    static bool isWatchable(int const fileDescriptor)
+    {
+        struct stat status;
+        if (fstat(fileDescriptor, &status) != 0)
+        {
+            return false;
+        }
+        return S_ISFIFO(status.st_mode) || S_ISSOCK(status.st_mode)
+               || (isatty(fileDescriptor) != 0);
+    }
+
+    ::systems::FileDescriptorWatcher _stdinWatcher;
+#endif // SUPPORT_POSIX
 };
 
 IdleHandler idleHandler;
@@ -318,4 +405,9 @@ SafetyTask safetyTask{"safety", safetyStack};
 
 AsyncContextHook contextHook{runtimeMonitor};
 
+#if ASYNC_CONFIG_RUNNABLE_MONITOR
+AsyncRunnableMonitor runnableMonitor;
+AsyncRunnableHook runnableHook{runnableMonitor};
+#endif
+
 } // namespace app
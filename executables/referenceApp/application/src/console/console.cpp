@@ -4,6 +4,7 @@
 
 #include <console/AsyncConsole.h>
 #include <console/StdioConsoleInput.h>
+#include <etl/atomic.h>
 
 namespace console
 {
@@ -13,15 +14,38 @@ bool enableShmemConsole = false;
 ::console::StdioConsoleInput stdioConsoleInput(" ", "\r\n");
 ::console::AsyncConsole asyncConsole;
 
+StdioConsoleInput::OnLineProcessed onStdioLineProcessed;
+LineProcessedFunctionType onLineProcessedFunction;
+::etl::atomic<bool> isLineProcessing(false);
+
+void onLineProcessed()
+{
+    onStdioLineProcessed();
+    isLineProcessing.store(false);
+    if (onLineProcessedFunction.is_valid())
+    {
+        onLineProcessedFunction();
+    }
+}
+
+void onLineReceived(
+    ::util::stream::ISharedOutputStream& outputStream,
+    ::etl::istring const& line,
+    StdioConsoleInput::OnLineProcessed const& onProcessed)
+{
+    onStdioLineProcessed = onProcessed;
+    isLineProcessing.store(true);
+    asyncConsole.onLineReceived(
+        outputStream, line, AsyncConsole::OnLineProcessed::create<&onLineProcessed>());
+}
+
 void enable() { enableStdioConsole = true; }
 
 void disable() { enableStdioConsole = false; }
 
 void init()
 {
-    stdioConsoleInput.init(
-        StdioConsoleInput::OnLineReceived::create<AsyncConsole, &AsyncConsole::onLineReceived>(
-            asyncConsole));
+    stdioConsoleInput.init(StdioConsoleInput::OnLineReceived::create<&onLineReceived>());
 }
 
 void run()
@@ -32,4 +56,11 @@ void run()
     }
 }
 
+bool isProcessingLine() { return isLineProcessing.load(); }
+
+void setLineProcessedFunction(LineProcessedFunctionType const& lineProcessedFunction)
+{
+    onLineProcessedFunction = lineProcessedFunction;
+}
+
 } // namespace console
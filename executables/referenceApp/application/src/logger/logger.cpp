@@ -92,7 +92,7 @@ void init()
             loggerComponentConfig));
 }
 
-void run() { loggerComposition.run(); }
+bool run() { return loggerComposition.run(); }
 
 void flush()
 {
@@ -101,6 +101,8 @@ void flush()
             loggerComponentConfig));
 }
 
+void addListener(ILoggerListener& listener) { loggerComposition.addListener(listener); }
+
 using ::util::logger::Logger;
 using ::util::logger::LWIP;
 
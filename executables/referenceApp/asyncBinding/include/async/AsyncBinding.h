@@ -3,7 +3,9 @@
 #pragma once
 
 #include <async/Config.h>
+#include <async/RunnableHook.h>
 #include <async/StaticContextHook.h>
+#include <runtime/RunnableMonitor.h>
 #include <runtime/RuntimeMonitor.h>
 #include <runtime/RuntimeStatistics.h>
 
@@ -13,6 +15,8 @@
 #include <async/FreeRtosAdapter.h>
 #elif defined(SUPPORT_THREADX)
 #include <async/ThreadXAdapter.h>
+#elif defined(SUPPORT_POSIX)
+#include <async/PosixAdapter.h>
 #endif
 
 namespace async
@@ -25,6 +29,8 @@ struct AsyncBinding : public Config
     using AdapterType = FreeRtosAdapter<AsyncBinding>;
 #elif defined(SUPPORT_THREADX)
     using AdapterType = ThreadXAdapter<AsyncBinding>;
+#elif defined(SUPPORT_POSIX)
+    using AdapterType = PosixAdapter<AsyncBinding>;
 #endif
 
     using RuntimeMonitorType = ::runtime::declare::RuntimeMonitor<
@@ -34,6 +40,11 @@ struct AsyncBinding : public Config
         ISR_GROUP_COUNT>;
 
     using ContextHookType = StaticContextHook<RuntimeMonitorType>;
+
+    // only used if ASYNC_CONFIG_RUNNABLE_MONITOR is enabled
+    using RunnableMonitorType = ::runtime::declare::RunnableMonitor<32U>;
+
+    using RunnableHookType = StaticRunnableHook<RunnableMonitorType>;
 };
 
 using AsyncBindingType = AsyncBinding;
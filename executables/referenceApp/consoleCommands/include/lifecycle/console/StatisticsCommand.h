@@ -29,10 +29,19 @@ private:
     using IsrGroupStatistics
         = ::runtime::declare::StatisticsContainer<::runtime::RuntimeStatistics, ISR_GROUP_COUNT>;
 
+#if ASYNC_CONFIG_RUNNABLE_MONITOR
+    using RunnableStatistics = ::runtime::declare::StatisticsContainer<
+        ::runtime::RunnableStatistics,
+        ::async::AsyncBindingType::RunnableMonitorType::ENTRY_COUNT>;
+#endif
+
     ::async::AsyncBinding::RuntimeMonitorType& _runtimeMonitor;
 
     TaskStatistics _taskStatistics;
     IsrGroupStatistics _isrGroupStatistics;
+#if ASYNC_CONFIG_RUNNABLE_MONITOR
+    RunnableStatistics _runnableStatistics;
+#endif
 
     ::etl::optional<uint32_t> _ticksPerUs;
     uint32_t _totalRuntime;
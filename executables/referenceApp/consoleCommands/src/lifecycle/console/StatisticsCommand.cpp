@@ -19,6 +19,51 @@ void format(
     statisticsWriter.writeRuntime("max ", 6U, statistics.getMaxRuntime());
 }
 
+#if ASYNC_CONFIG_RUNNABLE_MONITOR
+void formatRunnable(
+    ::runtime::StatisticsWriter& statisticsWriter, ::runtime::RunnableStatistics const& statistics)
+{
+    statisticsWriter.writeRuntimePercentage("%", statistics.getTotalRuntime());
+    statisticsWriter.writeNumber("runs ", 6U, statistics.getTotalRunCount());
+    statisticsWriter.writeRuntime("avg ", 6U, statistics.getAverageRuntime());
+    statisticsWriter.writeRuntime("min ", 6U, statistics.getMinRuntime());
+    statisticsWriter.writeRuntime("max ", 6U, statistics.getMaxRuntime());
+    statisticsWriter.writeRuntime("avg delay ", 6U, statistics.getDelay().getAverageRuntime());
+    statisticsWriter.writeRuntime("max delay ", 6U, statistics.getDelay().getMaxRuntime());
+    statisticsWriter.writeNumber("late us ", 6U, statistics.getMaxLateness());
+    statisticsWriter.writeNumber("misses ", 4U, statistics.getDeadlineMissCount());
+}
+
+template<typename R>
+void printRunnables(
+    ::util::command::CommandContext& context,
+    R const& runnableStatistics,
+    ::etl::optional<uint32_t> const& ticksPerUs,
+    uint32_t const totalRuntime)
+{
+    ::util::format::SharedStringWriter writer(context);
+
+    if (!ticksPerUs.has_value())
+    {
+        writer.printf("cannot print runnable statistics, ticksPerUs is unknown\n");
+        return;
+    }
+
+    ::runtime::StatisticsWriter statisticsWriter(writer, totalRuntime, *ticksPerUs);
+
+    typedef ::runtime::StatisticsWriter::FormatStatistics<::runtime::RunnableStatistics>::Type
+        FormatStatisticsType;
+
+    statisticsWriter.formatStatisticsGroup(
+        FormatStatisticsType::create<&formatRunnable>(),
+        "runnable",
+        20U,
+        runnableStatistics.getIterator());
+
+    statisticsWriter.writeEol();
+}
+#endif
+
 template<typename T, typename I>
 void printCpu(
     ::util::command::CommandContext& context,
@@ -79,6 +124,9 @@ enum Id
 {
     ID_CPU,
     ID_STACK,
+#if ASYNC_CONFIG_RUNNABLE_MONITOR
+    ID_RUNNABLES,
+#endif
     ID_ALL
 };
 
@@ -89,6 +137,9 @@ namespace lifecycle
 DEFINE_COMMAND_GROUP_GET_INFO_BEGIN(StatisticsCommand, "stats", "lifecycle statistics command")
 COMMAND_GROUP_COMMAND(ID_CPU, "cpu", "prints CPU statistics")
 COMMAND_GROUP_COMMAND(ID_STACK, "stack", "prints stack statistics")
+#if ASYNC_CONFIG_RUNNABLE_MONITOR
+COMMAND_GROUP_COMMAND(ID_RUNNABLES, "runnables", "prints runnable statistics")
+#endif
 COMMAND_GROUP_COMMAND(ID_ALL, "all", "prints all statistics")
 DEFINE_COMMAND_GROUP_GET_INFO_END
 
@@ -96,6 +147,9 @@ StatisticsCommand::StatisticsCommand(::async::AsyncBinding::RuntimeMonitorType&
 : _runtimeMonitor(runtimeMonitor)
 , _taskStatistics()
 , _isrGroupStatistics()
+#if ASYNC_CONFIG_RUNNABLE_MONITOR
+, _runnableStatistics()
+#endif
 , _ticksPerUs()
 , _totalRuntime(0)
 {}
@@ -107,6 +161,11 @@ void StatisticsCommand::cyclic_1000ms()
     ::async::Lock const lock;
     _taskStatistics.copyFrom(_runtimeMonitor.getTaskStatistics());
     _isrGroupStatistics.copyFrom(_runtimeMonitor.getIsrGroupStatistics());
+#if ASYNC_CONFIG_RUNNABLE_MONITOR
+    using RunnableHookType = ::async::AsyncBindingType::RunnableHookType;
+    _runnableStatistics.copyFrom(RunnableHookType::instance().getStatistics());
+    RunnableHookType::instance().reset();
+#endif
     _totalRuntime = _runtimeMonitor.reset();
 }
 
@@ -124,9 +183,19 @@ void StatisticsCommand::executeCommand(::util::command::CommandContext& context,
             printStack(context, _runtimeMonitor);
             break;
         }
+#if ASYNC_CONFIG_RUNNABLE_MONITOR
+        case ID_RUNNABLES:
+        {
+            printRunnables(context, _runnableStatistics, _ticksPerUs, _totalRuntime);
+            break;
+        }
+#endif
         case ID_ALL:
         {
             printCpu(context, _taskStatistics, _isrGroupStatistics, _ticksPerUs, _totalRuntime);
+#if ASYNC_CONFIG_RUNNABLE_MONITOR
+            printRunnables(context, _runnableStatistics, _ticksPerUs, _totalRuntime);
+#endif
             printStack(context, _runtimeMonitor);
             break;
         }
@@ -28,6 +28,7 @@ public:
     // [PUBLIC_API_END]
 private:
     void execute() final;
+    void trigger();
 
 private:
     ::async::TimeoutType _timeout;
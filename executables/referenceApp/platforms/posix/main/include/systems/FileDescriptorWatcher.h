@@ -0,0 +1,62 @@
+// Copyright 2025 Accenture.
+
+#pragma once
+
+#include <etl/delegate.h>
+
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+namespace systems
+{
+
+/**
+ * Watches a file descriptor for readable data on a thread of its own, so a system doesn't need
+ * to poll it cyclically.
+ *
+ * The ready function is called from the watcher thread as soon as data can be read. Afterwards
+ * the file descriptor isn't watched until rearm() is called, typically after the data has been
+ * read in the context of the system. The ready function therefore must be callable from a native
+ * thread, as ::async::execute() of the asyncPosix backend is.
+ */
+class FileDescriptorWatcher
+{
+public:
+    using ReadyFunctionType = ::etl::delegate<void()>;
+
+    explicit FileDescriptorWatcher(ReadyFunctionType readyFunction);
+    FileDescriptorWatcher(FileDescriptorWatcher const&)            = delete;
+    FileDescriptorWatcher& operator=(FileDescriptorWatcher const&) = delete;
+    ~FileDescriptorWatcher();
+
+    /**
+     * Start watching a file descriptor.
+     * \return false if the watcher couldn't be started
+     */
+    bool start(int fileDescriptor);
+
+    /**
+     * Stop watching and join the watcher thread.
+     */
+    void stop();
+
+    /**
+     * Watch the file descriptor again after the ready function has been called.
+     */
+    void rearm();
+
+private:
+    void run();
+
+    ReadyFunctionType _readyFunction;
+    ::std::thread _thread;
+    ::std::mutex _mutex;
+    ::std::condition_variable _condition;
+    int _fileDescriptor;
+    int _stopFileDescriptor;
+    bool _isArmed;
+    bool _isStopped;
+};
+
+} // namespace systems
@@ -7,6 +7,9 @@
 #include <ethernet/EthernetLogger.h>
 #include <lifecycle/AsyncLifecycleComponent.h>
 #include <systems/IEthernetDriverSystem.h>
+#ifdef SUPPORT_POSIX
+#include <systems/FileDescriptorWatcher.h>
+#endif // SUPPORT_POSIX
 
 namespace systems
 {
@@ -41,6 +44,12 @@ public:
     ::async::ContextType _context;
     ::async::TimeoutType _rxTimeout;
     ::ethernet::TapEthernetDriver _driver;
+#ifdef SUPPORT_POSIX
+    FileDescriptorWatcher _rxWatcher;
+
+private:
+    void trigger();
+#endif // SUPPORT_POSIX
 };
 
 } // namespace systems
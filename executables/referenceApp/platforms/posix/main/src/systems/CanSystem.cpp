@@ -21,7 +21,9 @@ namespace
 } // namespace
 
 CanSystem::CanSystem(::async::ContextType context)
-: _timeout(), _context(context), _canTransceiver(canConfig)
+: _timeout()
+, _context(context)
+, _canTransceiver(canConfig)
 {
     setTransitionContext(context);
 }
@@ -31,9 +33,25 @@ void CanSystem::init() { transitionDone(); }
 void CanSystem::run()
 {
     _canTransceiver.init();
+#ifdef SUPPORT_POSIX
+    // native threads may wake up the CAN task directly, no need to poll the socket
+    _canTransceiver.setTxPendingFunction(
+        ::can::SocketCanTransceiver::TxPendingFunctionType::create<CanSystem, &CanSystem::trigger>(
+            *this));
+    _canTransceiver.open();
+    // frames are received by the I/O thread of the transceiver, which wakes the CAN task
+    using IoReadyFunctionType = ::can::SocketCanTransceiver::IoReadyFunctionType;
+    if (!_canTransceiver.startIoThread(
+            IoReadyFunctionType::create<CanSystem, &CanSystem::trigger>(*this)))
+    {
+        ::async::scheduleAtFixedRate(
+            _context, *this, _timeout, TIMEOUT_CAN_SYSTEM_IN_MS, ::async::TimeUnit::MILLISECONDS);
+    }
+#else
     _canTransceiver.open();
     ::async::scheduleAtFixedRate(
         _context, *this, _timeout, TIMEOUT_CAN_SYSTEM_IN_MS, ::async::TimeUnit::MILLISECONDS);
+#endif // SUPPORT_POSIX
     transitionDone();
 }
 
@@ -54,6 +72,12 @@ void CanSystem::shutdown()
     return nullptr;
 }
 
-void CanSystem::execute() { _canTransceiver.run(MAX_SENT_PER_RUN, MAX_RECEIVED_PER_RUN); }
+void CanSystem::execute()
+{
+    // with the I/O thread, run() requests further runs itself if it left frames behind
+    _canTransceiver.run(MAX_SENT_PER_RUN, MAX_RECEIVED_PER_RUN);
+}
+
+void CanSystem::trigger() { ::async::execute(_context, *this); }
 
 } // namespace systems
@@ -0,0 +1,119 @@
+// Copyright 2025 Accenture.
+
+#include "systems/FileDescriptorWatcher.h"
+
+#include <poll.h>
+#include <signal.h>
+#include <sys/eventfd.h>
+#include <unistd.h>
+
+#include <cstdint>
+
+namespace systems
+{
+
+FileDescriptorWatcher::FileDescriptorWatcher(ReadyFunctionType const readyFunction)
+: _readyFunction(readyFunction)
+, _thread()
+, _mutex()
+, _condition()
+, _fileDescriptor(-1)
+, _stopFileDescriptor(-1)
+, _isArmed(false)
+, _isStopped(false)
+{}
+
+FileDescriptorWatcher::~FileDescriptorWatcher() { stop(); }
+
+bool FileDescriptorWatcher::start(int const fileDescriptor)
+{
+    if ((fileDescriptor < 0) || _thread.joinable())
+    {
+        return false;
+    }
+    _stopFileDescriptor = eventfd(0U, EFD_CLOEXEC);
+    if (_stopFileDescriptor < 0)
+    {
+        return false;
+    }
+    _fileDescriptor = fileDescriptor;
+    _isArmed        = true;
+    _isStopped      = false;
+    _thread         = ::std::thread(&FileDescriptorWatcher::run, this);
+    return true;
+}
+
+void FileDescriptorWatcher::stop()
+{
+    if (!_thread.joinable())
+    {
+        return;
+    }
+    {
+        ::std::lock_guard<::std::mutex> const lock(_mutex);
+        _isStopped = true;
+    }
+    _condition.notify_one();
+    uint64_t const value = 1U;
+    (void)::write(_stopFileDescriptor, &value, sizeof(value));
+    _thread.join();
+    (void)::close(_stopFileDescriptor);
+    _stopFileDescriptor = -1;
+}
+
+void FileDescriptorWatcher::rearm()
+{
+    {
+        ::std::lock_guard<::std::mutex> const lock(_mutex);
+        _isArmed = true;
+    }
+    _condition.notify_one();
+}
+
+void FileDescriptorWatcher::run()
+{
+    // signals are left to the threads of the application
+    sigset_t set;
+    sigfillset(&set);
+    (void)pthread_sigmask(SIG_SETMASK, &set, nullptr);
+
+    pollfd pollFds[2];
+    pollFds[0].fd     = _fileDescriptor;
+    pollFds[0].events = POLLIN;
+    pollFds[1].fd     = _stopFileDescriptor;
+    pollFds[1].events = POLLIN;
+    while (true)
+    {
+        {
+            ::std::unique_lock<::std::mutex> lock(_mutex);
+            _condition.wait(lock, [this] { return _isArmed || _isStopped; });
+            if (_isStopped)
+            {
+                return;
+            }
+        }
+        if (poll(pollFds, 2U, -1) <= 0)
+        {
+            continue;
+        }
+        if ((pollFds[1].revents & POLLIN) != 0)
+        {
+            return;
+        }
+        if ((pollFds[0].revents & POLLIN) != 0)
+        {
+            {
+                ::std::lock_guard<::std::mutex> const lock(_mutex);
+                _isArmed = false;
+            }
+            _readyFunction();
+        }
+        else if ((pollFds[0].revents & (POLLERR | POLLHUP | POLLNVAL)) != 0)
+        {
+            // nothing will ever become readable, stop watching instead of spinning
+            return;
+        }
+    }
+}
+
+} // namespace systems
@@ -10,7 +10,14 @@ namespace systems
 {
 
 TapEthernetSystem::TapEthernetSystem(::async::ContextType const context)
-: _context(context), _rxTimeout(), _driver(ethX::MAC_ADDRESS)
+: _context(context)
+, _rxTimeout()
+, _driver(ethX::MAC_ADDRESS)
+#ifdef SUPPORT_POSIX
+, _rxWatcher(FileDescriptorWatcher::ReadyFunctionType::create<
+             TapEthernetSystem,
+             &TapEthernetSystem::trigger>(*this))
+#endif // SUPPORT_POSIX
 {}
 
 void TapEthernetSystem::init() { transitionDone(); }
@@ -25,14 +32,23 @@ void TapEthernetSystem::run()
     else
     {
         ::util::logger::Logger::info(::util::logger::ETHERNET, "TapEthernetDriver started!");
-        ::async::scheduleAtFixedRate(
-            _context, *this, _rxTimeout, 1, ::async::TimeUnitType::MILLISECONDS);
+#ifdef SUPPORT_POSIX
+        // native threads may wake up the ethernet task directly, no need to poll the interface
+        if (!_rxWatcher.start(_driver.getTapInterfaceFd()))
+#endif // SUPPORT_POSIX
+        {
+            ::async::scheduleAtFixedRate(
+                _context, *this, _rxTimeout, 1, ::async::TimeUnitType::MILLISECONDS);
+        }
     }
     transitionDone();
 }
 
 void TapEthernetSystem::shutdown()
 {
+#ifdef SUPPORT_POSIX
+    _rxWatcher.stop();
+#endif // SUPPORT_POSIX
     _rxTimeout.cancel();
     transitionDone();
 }
@@ -49,8 +65,15 @@ void TapEthernetSystem::execute()
             _driver.readFrame();
         }
     }
+#ifdef SUPPORT_POSIX
+    _rxWatcher.rearm();
+#endif // SUPPORT_POSIX
 }
 
+#ifdef SUPPORT_POSIX
+void TapEthernetSystem::trigger() { ::async::execute(_context, *this); }
+#endif // SUPPORT_POSIX
+
 bool TapEthernetSystem::getLinkStatus(size_t const /*port*/) { return true; }
 
 bool TapEthernetSystem::writeFrame(netif* /*ni*/, pbuf* pb) { return _driver.writeFrame(pb); }
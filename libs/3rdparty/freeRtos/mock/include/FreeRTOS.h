@@ -8,6 +8,8 @@ typedef int32_t BaseType_t;
 typedef uint32_t UBaseType_t;
 typedef uint32_t TickType_t;
 
+#define portMAX_DELAY (TickType_t)0xffffffffUL
+
 enum eBoolean
 {
     pdFALSE = 0,
@@ -16,6 +16,16 @@ namespace async
  */
 void execute(ContextType context, RunnableType& runnable);
 
+/**
+ * Execute the given runnable within a priority lane of the context, non-blocking call. Runnables
+ * of higher lanes are executed before runnables of lower lanes of the same context. Priorities
+ * exceeding the highest lane of the context are limited to it.
+ * \param context Context of execution
+ * \param runnable Runnable to execute
+ * \param priority Priority lane, 0 is the lowest priority
+ */
+void execute(ContextType context, RunnableType& runnable, size_t priority);
+
 /**
  * Execute runnable after specified delay, non-blocking call
  * \param context Context of execution
@@ -0,0 +1,570 @@
+// Copyright 2025 Accenture.
+
+/**
+ * \ingroup async
+ */
+#pragma once
+
+#if (__cplusplus < 202002L) || !defined(__cpp_impl_coroutine)
+#error "async/Coroutine.h requires C++20 coroutine support"
+#endif
+
+#include "async/Async.h"
+
+#include <coroutine>
+#include <cstddef>
+#include <exception>
+#include <type_traits>
+
+namespace async
+{
+/**
+ * Arena providing the frames of all coroutine tasks of a single context.
+ *
+ * Frames are fixed size blocks kept in a free list, so allocating and releasing a frame takes
+ * constant time and no heap is involved. An arena registers itself on construction and is looked
+ * up by the context a task is created for. Declare arenas statically with `StaticFrameArena`.
+ */
+class FrameArena
+{
+public:
+    FrameArena(FrameArena const&)            = delete;
+    FrameArena& operator=(FrameArena const&) = delete;
+
+    ContextType getContext() const;
+
+    /// Returns the maximum size of a single coroutine frame.
+    size_t getFrameSize() const;
+
+    /// Returns the number of frames that are currently not in use.
+    size_t getFreeCount() const;
+
+    /**
+     * Allocates a frame from the arena registered for a context.
+     * \param context context of the arena
+     * \param size size of the frame in bytes
+     * \return pointer to the frame, nullptr if no arena or no frame of the given size is available
+     */
+    static void* allocate(ContextType context, size_t size);
+
+    /**
+     * Returns a frame to the arena it has been allocated from.
+     * \param frame pointer returned by allocate()
+     */
+    static void release(void* frame);
+
+protected:
+    static size_t const ALIGNMENT   = alignof(::std::max_align_t);
+    static size_t const HEADER_SIZE = ALIGNMENT;
+
+    FrameArena(ContextType context, uint8_t* storage, size_t blockSize, size_t blockCount);
+    ~FrameArena();
+
+private:
+    /// Header in front of each frame, pointing to the arena while the frame is in use.
+    union Block
+    {
+        FrameArena* _arena;
+        Block* _next;
+    };
+
+    static FrameArena* _first;
+
+    FrameArena* _next;
+    Block* _freeBlocks;
+    size_t _blockSize;
+    size_t _freeCount;
+    ContextType _context;
+};
+
+/**
+ * Frame arena with static storage.
+ *
+ * \tparam FrameSize maximum size of a single coroutine frame in bytes
+ * \tparam FrameCount maximum number of coroutine tasks existing at the same time in the context
+ */
+template<size_t FrameSize, size_t FrameCount>
+class StaticFrameArena : public FrameArena
+{
+    static_assert(FrameCount > 0U, "arena must hold at least one frame");
+
+public:
+    explicit StaticFrameArena(ContextType context);
+
+private:
+    static size_t const BLOCK_SIZE
+        = HEADER_SIZE + (((FrameSize + ALIGNMENT) - 1U) / ALIGNMENT) * ALIGNMENT;
+
+    alignas(::std::max_align_t) uint8_t _storage[BLOCK_SIZE * FrameCount];
+};
+
+/**
+ * Return type of coroutines implementing multi-step flows within an async context.
+ *
+ * A coroutine returning `Task` takes the context it is executed in as first parameter (following
+ * the object for member functions and lambdas). Its frame is allocated from the `FrameArena` of
+ * this context. If no frame is available, the returned task is invalid and won't run.
+ *
+ * The task is lazy: the body is executed within its context after calling `start()`, or when it
+ * is awaited from another task. The awaiting task is resumed once the awaited task has finished,
+ * directly if both are executed within the same context. The frame is released as soon as the
+ * body has finished. A task that is destroyed without being started releases its frame.
+ *
+ * \code
+ * ::async::Task blink(::async::ContextType context, Led& led)
+ * {
+ *     while (true)
+ *     {
+ *         led.toggle();
+ *         co_await ::async::sleep(context, 500U);
+ *     }
+ * }
+ *
+ * blink(TASK_DEMO, led).start();
+ * \endcode
+ */
+class [[nodiscard]] Task
+{
+public:
+    class promise_type;
+    using HandleType = ::std::coroutine_handle<promise_type>;
+
+    Task() = default;
+    Task(Task&& other) noexcept;
+    Task& operator=(Task&& other) = delete;
+    ~Task();
+
+    bool isValid() const;
+
+    /// Starts the execution of the task within its context. The task becomes invalid.
+    void start();
+
+    auto operator co_await() && noexcept;
+
+private:
+    class Awaiter;
+
+    explicit Task(HandleType handle);
+
+    HandleType _handle;
+};
+
+/**
+ * The promise of a task is the runnable resuming the task within its context.
+ */
+class Task::promise_type : public RunnableType
+{
+public:
+    template<class... Args>
+    explicit promise_type(ContextType context, Args const&... /* args */);
+
+    // Member functions and lambdas pass their object first. Some compilers deduce a reference type
+    // for the object, therefore the reference is removed before checking the type.
+    template<class T, class... Args>
+        requires ::std::is_class_v<::std::remove_reference_t<T>>
+    promise_type(T const& /* object */, ContextType context, Args const&... /* args */);
+
+    // The allocation functions are always inlined, otherwise GCC reports a mismatch with the
+    // (non template) deallocation function.
+    template<class... Args>
+    [[gnu::always_inline]] static void*
+    operator new(size_t size, ContextType context, Args const&... /* args */) noexcept;
+
+    template<class T, class... Args>
+        requires ::std::is_class_v<::std::remove_reference_t<T>>
+    [[gnu::always_inline]] static void* operator new(
+        size_t size,
+        T const& /* object */,
+        ContextType context,
+        Args const&... /* args */) noexcept;
+
+    /// Frames are allocated from arenas only, coroutines need a context parameter.
+    static void* operator new(size_t size) = delete;
+
+    static void operator delete(void* frame) noexcept;
+
+    static Task get_return_object_on_allocation_failure() noexcept;
+
+    Task get_return_object() noexcept;
+
+    ::std::suspend_always initial_suspend() const noexcept;
+
+    auto final_suspend() noexcept;
+
+    void return_void() const noexcept;
+
+    [[noreturn]] void unhandled_exception() const noexcept;
+
+    ContextType getContext() const;
+
+    /**
+     * Moves the task to another context. The task is resumed within this context afterwards.
+     * Must only be called from an awaiter while suspending the task.
+     */
+    void setContext(ContextType context);
+
+    /**
+     * Resumes the suspended task within its context. This is the completion function for
+     * awaiters that are notified from any context, e.g. by a callback.
+     */
+    void resume();
+
+private:
+    friend class Task;
+
+    void execute() override;
+
+    /// Task to resume after this task has finished.
+    promise_type* _continuation = nullptr;
+    /// Finished task awaited by this task whose frame hasn't been released yet.
+    HandleType _finished        = nullptr;
+    ContextType _context;
+    bool _isFinished            = false;
+};
+
+/**
+ * Awaitable resuming the awaiting task within the given context. The task then stays in this
+ * context.
+ */
+class ResumeOnAwaiter
+{
+public:
+    explicit ResumeOnAwaiter(ContextType context);
+
+    bool await_ready() const noexcept;
+    void await_suspend(Task::HandleType handle) const;
+    void await_resume() const noexcept;
+
+private:
+    ContextType _context;
+};
+
+/**
+ * Awaitable resuming the awaiting task within the given context after a delay. The task then
+ * stays in this context.
+ */
+class SleepAwaiter
+{
+public:
+    SleepAwaiter(ContextType context, uint32_t delay, TimeUnitType unit);
+
+    SleepAwaiter(SleepAwaiter const&)            = delete;
+    SleepAwaiter& operator=(SleepAwaiter const&) = delete;
+
+    bool await_ready() const noexcept;
+    void await_suspend(Task::HandleType handle);
+    void await_resume() const noexcept;
+
+private:
+    TimeoutType _timeout;
+    uint32_t _delay;
+    TimeUnitType _unit;
+    ContextType _context;
+};
+
+/**
+ * Continue the awaiting task within a context.
+ * \param context Context of execution
+ */
+ResumeOnAwaiter resumeOn(ContextType context);
+
+/**
+ * Continue the awaiting task within a context after a delay, built on `async::schedule()`.
+ * \param context Context of execution
+ * \param delay Delay in time units
+ * \param unit Time unit, a scaling factor for delay
+ */
+SleepAwaiter sleep(ContextType context, uint32_t delay, TimeUnitType unit = TimeUnit::MILLISECONDS);
+
+/**
+ * Inline implementations.
+ */
+inline FrameArena* FrameArena::_first = nullptr;
+
+inline FrameArena::FrameArena(
+    ContextType const context,
+    uint8_t* const storage,
+    size_t const blockSize,
+    size_t const blockCount)
+: _next(nullptr)
+, _freeBlocks(nullptr)
+, _blockSize(blockSize)
+, _freeCount(blockCount)
+, _context(context)
+{
+    for (size_t idx = blockCount; idx > 0U; --idx)
+    {
+        Block* const block = reinterpret_cast<Block*>(storage + ((idx - 1U) * blockSize));
+        block->_next       = _freeBlocks;
+        _freeBlocks        = block;
+    }
+    LockType const lock;
+    _next  = _first;
+    _first = this;
+}
+
+inline FrameArena::~FrameArena()
+{
+    LockType const lock;
+    for (FrameArena** arena = &_first; *arena != nullptr; arena = &(*arena)->_next)
+    {
+        if (*arena == this)
+        {
+            *arena = _next;
+            break;
+        }
+    }
+}
+
+inline ContextType FrameArena::getContext() const { return _context; }
+
+inline size_t FrameArena::getFrameSize() const { return _blockSize - HEADER_SIZE; }
+
+inline size_t FrameArena::getFreeCount() const
+{
+    LockType const lock;
+    return _freeCount;
+}
+
+inline void* FrameArena::allocate(ContextType const context, size_t const size)
+{
+    LockType const lock;
+    for (FrameArena* arena = _first; arena != nullptr; arena = arena->_next)
+    {
+        if (arena->_context == context)
+        {
+            Block* const block = arena->_freeBlocks;
+            if ((block == nullptr) || (size > arena->getFrameSize()))
+            {
+                return nullptr;
+            }
+            arena->_freeBlocks = block->_next;
+            --arena->_freeCount;
+            block->_arena = arena;
+            return reinterpret_cast<uint8_t*>(block) + HEADER_SIZE;
+        }
+    }
+    return nullptr;
+}
+
+inline void FrameArena::release(void* const frame)
+{
+    Block* const block = reinterpret_cast<Block*>(static_cast<uint8_t*>(frame) - HEADER_SIZE);
+    LockType const lock;
+    FrameArena* const arena = block->_arena;
+    block->_next            = arena->_freeBlocks;
+    arena->_freeBlocks      = block;
+    ++arena->_freeCount;
+}
+
+template<size_t FrameSize, size_t FrameCount>
+StaticFrameArena<FrameSize, FrameCount>::StaticFrameArena(ContextType const context)
+: FrameArena(context, _storage, BLOCK_SIZE, FrameCount)
+{}
+
+class Task::Awaiter
+{
+public:
+    explicit Awaiter(HandleType handle) : _handle(handle) {}
+
+    Awaiter(Awaiter const&)            = delete;
+    Awaiter& operator=(Awaiter const&) = delete;
+
+    bool await_ready() const noexcept { return !_handle; }
+
+    ::std::coroutine_handle<> await_suspend(HandleType const continuation) noexcept
+    {
+        _continuation         = &continuation.promise();
+        promise_type& promise = _handle.promise();
+        promise._continuation = _continuation;
+        if (promise._context == continuation.promise()._context)
+        {
+            // no need to go through the queue of the context, transfer control directly
+            return _handle;
+        }
+        ::async::execute(promise._context, promise);
+        return ::std::noop_coroutine();
+    }
+
+    void await_resume() const noexcept
+    {
+        if ((_continuation != nullptr) && _continuation->_finished)
+        {
+            _continuation->_finished.destroy();
+            _continuation->_finished = nullptr;
+        }
+    }
+
+private:
+    HandleType _handle;
+    promise_type* _continuation = nullptr;
+};
+
+inline Task::Task(HandleType const handle) : _handle(handle) {}
+
+inline Task::Task(Task&& other) noexcept : _handle(other._handle) { other._handle = nullptr; }
+
+inline Task::~Task()
+{
+    if (_handle)
+    {
+        _handle.destroy();
+    }
+}
+
+inline bool Task::isValid() const { return static_cast<bool>(_handle); }
+
+inline void Task::start()
+{
+    if (_handle)
+    {
+        promise_type& promise = _handle.promise();
+        _handle               = nullptr;
+        ::async::execute(promise._context, promise);
+    }
+}
+
+inline auto Task::operator co_await() && noexcept
+{
+    HandleType const handle = _handle;
+    _handle                 = nullptr;
+    return Awaiter(handle);
+}
+
+template<class... Args>
+inline Task::promise_type::promise_type(ContextType const context, Args const&...)
+: _context(context)
+{}
+
+template<class T, class... Args>
+    requires ::std::is_class_v<::std::remove_reference_t<T>>
+inline Task::promise_type::promise_type(T const&, ContextType const context, Args const&...)
+: _context(context)
+{}
+
+template<class... Args>
+inline void* Task::promise_type::operator new(
+    size_t const size, ContextType const context, Args const&...) noexcept
+{
+    return FrameArena::allocate(context, size);
+}
+
+template<class T, class... Args>
+    requires ::std::is_class_v<::std::remove_reference_t<T>>
+inline void* Task::promise_type::operator new(
+    size_t const size, T const&, ContextType const context, Args const&...) noexcept
+{
+    return FrameArena::allocate(context, size);
+}
+
+inline void Task::promise_type::operator delete(void* const frame) noexcept
+{
+    FrameArena::release(frame);
+}
+
+inline Task Task::promise_type::get_return_object_on_allocation_failure() noexcept
+{
+    return Task();
+}
+
+inline Task Task::promise_type::get_return_object() noexcept
+{
+    return Task(HandleType::from_promise(*this));
+}
+
+inline ::std::suspend_always Task::promise_type::initial_suspend() const noexcept { return {}; }
+
+inline auto Task::promise_type::final_suspend() noexcept
+{
+    class FinalAwaiter
+    {
+    public:
+        explicit FinalAwaiter(promise_type& promise) : _promise(promise) {}
+
+        /// A started task without continuation just releases its frame.
+        bool await_ready() const noexcept { return _promise._continuation == nullptr; }
+
+        ::std::coroutine_handle<> await_suspend(HandleType const handle) const noexcept
+        {
+            promise_type& continuation = *_promise._continuation;
+            if (continuation._context == _promise._context)
+            {
+                // the awaiting task releases the frame when it continues
+                continuation._finished = handle;
+                return HandleType::from_promise(continuation);
+            }
+            // Resuming the continuation right away may let another thread release the frame
+            // while it's still in use. The frame is released within this context afterwards.
+            _promise._isFinished = true;
+            _promise.resume();
+            return ::std::noop_coroutine();
+        }
+
+        void await_resume() const noexcept {}
+
+    private:
+        promise_type& _promise;
+    };
+
+    return FinalAwaiter(*this);
+}
+
+inline void Task::promise_type::return_void() const noexcept {}
+
+inline void Task::promise_type::unhandled_exception() const noexcept { ::std::terminate(); }
+
+inline ContextType Task::promise_type::getContext() const { return _context; }
+
+inline void Task::promise_type::setContext(ContextType const context) { _context = context; }
+
+inline void Task::promise_type::resume() { ::async::execute(_context, *this); }
+
+inline void Task::promise_type::execute()
+{
+    if (_isFinished)
+    {
+        promise_type* const continuation = _continuation;
+        HandleType::from_promise(*this).destroy();
+        continuation->resume();
+    }
+    else
+    {
+        HandleType::from_promise(*this).resume();
+    }
+}
+
+inline ResumeOnAwaiter::ResumeOnAwaiter(ContextType const context) : _context(context) {}
+
+inline bool ResumeOnAwaiter::await_ready() const noexcept { return false; }
+
+inline void ResumeOnAwaiter::await_suspend(Task::HandleType const handle) const
+{
+    handle.promise().setContext(_context);
+    handle.promise().resume();
+}
+
+inline void ResumeOnAwaiter::await_resume() const noexcept {}
+
+inline SleepAwaiter::SleepAwaiter(
+    ContextType const context, uint32_t const delay, TimeUnitType const unit)
+: _timeout(), _delay(delay), _unit(unit), _context(context)
+{}
+
+inline bool SleepAwaiter::await_ready() const noexcept { return false; }
+
+inline void SleepAwaiter::await_suspend(Task::HandleType const handle)
+{
+    handle.promise().setContext(_context);
+    ::async::schedule(_context, handle.promise(), _timeout, _delay, _unit);
+}
+
+inline void SleepAwaiter::await_resume() const noexcept {}
+
+inline ResumeOnAwaiter resumeOn(ContextType const context) { return ResumeOnAwaiter(context); }
+
+inline SleepAwaiter sleep(ContextType const context, uint32_t const delay, TimeUnitType const unit)
+{
+    return SleepAwaiter(context, delay, unit);
+}
+
+} // namespace async
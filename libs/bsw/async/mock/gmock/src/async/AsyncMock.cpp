@@ -11,6 +11,11 @@ void execute(ContextType const context, RunnableType& runnable)
     ::etl::singleton_base<AsyncMock>::instance().execute(context, runnable);
 }
 
+void execute(ContextType const context, RunnableType& runnable, size_t const priority)
+{
+    ::etl::singleton_base<AsyncMock>::instance().execute(context, runnable, priority);
+}
+
 void schedule(
     ContextType const context,
     RunnableType& runnable,
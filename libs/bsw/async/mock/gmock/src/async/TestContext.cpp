@@ -32,6 +32,9 @@ void TestContext::handleExecute()
 {
     EXPECT_CALL(AsyncMock::instance(), execute(_context, _))
         .WillRepeatedly(ExecuteHelperAction(&_runnableQueue));
+    // priority lanes are not modelled, prioritized runnables are executed in order of execution
+    EXPECT_CALL(AsyncMock::instance(), execute(_context, _, _))
+        .WillRepeatedly(ExecuteHelperAction(&_runnableQueue));
 }
 
 void TestContext::handleSchedule()
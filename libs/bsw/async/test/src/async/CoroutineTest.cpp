@@ -0,0 +1,270 @@
+// Copyright 2025 Accenture.
+
+#include "async/Coroutine.h"
+
+#include "async/AsyncMock.h"
+#include "async/TestContext.h"
+
+#include <etl/vector.h>
+
+#include <gmock/gmock.h>
+
+namespace
+{
+using namespace ::async;
+using namespace ::testing;
+
+ContextType const CONTEXT_1 = 1U;
+ContextType const CONTEXT_2 = 2U;
+ContextType const CONTEXT_3 = 3U;
+
+using StepsType = ::etl::vector<uint32_t, 16U>;
+
+Task singleStep(ContextType const /* context */, StepsType& steps, uint32_t const step)
+{
+    steps.push_back(step);
+    co_return;
+}
+
+Task sleepingSteps(ContextType const context, StepsType& steps)
+{
+    steps.push_back(1U);
+    co_await ::async::sleep(context, 10U);
+    steps.push_back(2U);
+    co_await ::async::sleep(context, 20U, TimeUnit::MICROSECONDS);
+    steps.push_back(3U);
+}
+
+Task awaitingSteps(
+    ContextType const /* context */, ContextType const childContext, StepsType& steps)
+{
+    steps.push_back(1U);
+    co_await singleStep(childContext, steps, 2U);
+    steps.push_back(3U);
+    co_await singleStep(childContext, steps, 4U);
+    steps.push_back(5U);
+}
+
+Task hoppingSteps(ContextType const /* context */, ContextType const otherContext, StepsType& steps)
+{
+    steps.push_back(1U);
+    co_await ::async::resumeOn(otherContext);
+    steps.push_back(2U);
+}
+
+Task countingLoop(ContextType const context, uint32_t& count, uint32_t const loops)
+{
+    for (uint32_t i = 0U; i < loops; ++i)
+    {
+        co_await [](ContextType const, uint32_t& value) -> Task
+        {
+            ++value;
+            co_return;
+        }(context, count);
+    }
+}
+
+class Flow
+{
+public:
+    Task run(ContextType const /* context */)
+    {
+        ++_runs;
+        co_return;
+    }
+
+    uint32_t _runs = 0U;
+};
+
+class CoroutineTest : public Test
+{
+public:
+    CoroutineTest()
+    : _context1(CONTEXT_1)
+    , _context2(CONTEXT_2)
+    , _arena1(CONTEXT_1)
+    , _arena2(CONTEXT_2)
+    , _freeCount1(_arena1.getFreeCount())
+    , _freeCount2(_arena2.getFreeCount())
+    {
+        _context1.handleAll();
+        _context2.handleAll();
+    }
+
+    ~CoroutineTest() override
+    {
+        EXPECT_EQ(_freeCount1, _arena1.getFreeCount());
+        EXPECT_EQ(_freeCount2, _arena2.getFreeCount());
+    }
+
+protected:
+    NiceMock<AsyncMock> _asyncMock;
+    TestContext _context1;
+    TestContext _context2;
+    StaticFrameArena<256U, 4U> _arena1;
+    StaticFrameArena<256U, 2U> _arena2;
+    size_t _freeCount1;
+    size_t _freeCount2;
+    StepsType _steps;
+};
+
+/**
+ * \desc
+ * A task is lazy: its body is executed within its context after starting it.
+ */
+TEST_F(CoroutineTest, testTaskIsExecutedWithinContextAfterStart)
+{
+    Task cut = singleStep(CONTEXT_1, _steps, 1U);
+    EXPECT_TRUE(cut.isValid());
+    EXPECT_EQ(3U, _arena1.getFreeCount());
+    _context1.execute();
+    EXPECT_TRUE(_steps.empty());
+
+    cut.start();
+    EXPECT_FALSE(cut.isValid());
+    EXPECT_TRUE(_steps.empty());
+    _context1.execute();
+    EXPECT_THAT(_steps, ElementsAre(1U));
+    EXPECT_EQ(4U, _arena1.getFreeCount());
+}
+
+/**
+ * \desc
+ * A task that is never started releases its frame without executing its body.
+ */
+TEST_F(CoroutineTest, testTaskNotStartedReleasesFrame)
+{
+    {
+        Task cut = singleStep(CONTEXT_1, _steps, 1U);
+        EXPECT_EQ(3U, _arena1.getFreeCount());
+    }
+    EXPECT_EQ(4U, _arena1.getFreeCount());
+    _context1.execute();
+    EXPECT_TRUE(_steps.empty());
+}
+
+/**
+ * \desc
+ * A task is invalid if there's no arena for its context or the arena is exhausted.
+ */
+TEST_F(CoroutineTest, testTaskIsInvalidWithoutFrame)
+{
+    Task noArena = singleStep(CONTEXT_3, _steps, 1U);
+    EXPECT_FALSE(noArena.isValid());
+    noArena.start();
+
+    Task first  = singleStep(CONTEXT_2, _steps, 1U);
+    Task second = singleStep(CONTEXT_2, _steps, 2U);
+    Task third  = singleStep(CONTEXT_2, _steps, 3U);
+    EXPECT_TRUE(first.isValid());
+    EXPECT_TRUE(second.isValid());
+    EXPECT_FALSE(third.isValid());
+    EXPECT_EQ(0U, _arena2.getFreeCount());
+}
+
+/**
+ * \desc
+ * Frames exceeding the frame size of the arena are rejected.
+ */
+TEST_F(CoroutineTest, testTaskIsInvalidIfFrameIsTooLarge)
+{
+    StaticFrameArena<8U, 1U> arena(CONTEXT_3);
+    EXPECT_EQ(16U, arena.getFrameSize());
+    Task cut = singleStep(CONTEXT_3, _steps, 1U);
+    EXPECT_FALSE(cut.isValid());
+    EXPECT_EQ(1U, arena.getFreeCount());
+}
+
+/**
+ * \desc
+ * Sleeping suspends the task until the delay has elapsed within the context.
+ */
+TEST_F(CoroutineTest, testSleep)
+{
+    sleepingSteps(CONTEXT_1, _steps).start();
+    _context1.execute();
+    EXPECT_THAT(_steps, ElementsAre(1U));
+    _context1.elapse(9999U);
+    _context1.expire();
+    EXPECT_THAT(_steps, ElementsAre(1U));
+    _context1.elapse(1U);
+    _context1.expire();
+    EXPECT_THAT(_steps, ElementsAre(1U, 2U));
+    _context1.elapse(20U);
+    _context1.expire();
+    EXPECT_THAT(_steps, ElementsAre(1U, 2U, 3U));
+}
+
+/**
+ * \desc
+ * Awaiting a task of the same context transfers control without going through the context.
+ */
+TEST_F(CoroutineTest, testAwaitTaskWithinSameContext)
+{
+    awaitingSteps(CONTEXT_1, CONTEXT_1, _steps).start();
+    EXPECT_CALL(_asyncMock, execute(CONTEXT_1, _)).Times(0);
+    _context1.execute();
+    EXPECT_THAT(_steps, ElementsAre(1U, 2U, 3U, 4U, 5U));
+}
+
+/**
+ * \desc
+ * An awaited task of another context is executed within its context, the awaiting task continues
+ * within its own context afterwards.
+ */
+TEST_F(CoroutineTest, testAwaitTaskWithinOtherContext)
+{
+    awaitingSteps(CONTEXT_1, CONTEXT_2, _steps).start();
+    _context1.execute();
+    EXPECT_THAT(_steps, ElementsAre(1U));
+    EXPECT_EQ(1U, _arena2.getFreeCount());
+    _context2.execute();
+    EXPECT_THAT(_steps, ElementsAre(1U, 2U));
+    EXPECT_EQ(2U, _arena2.getFreeCount());
+    _context1.execute();
+    EXPECT_THAT(_steps, ElementsAre(1U, 2U, 3U));
+    _context2.execute();
+    _context1.execute();
+    EXPECT_THAT(_steps, ElementsAre(1U, 2U, 3U, 4U, 5U));
+}
+
+/**
+ * \desc
+ * Awaiting tasks in a loop neither exhausts the arena nor needs to go through the context.
+ */
+TEST_F(CoroutineTest, testAwaitTasksInLoop)
+{
+    uint32_t count = 0U;
+    countingLoop(CONTEXT_1, count, 1000U).start();
+    _context1.execute();
+    EXPECT_EQ(1000U, count);
+}
+
+/**
+ * \desc
+ * A task continues within another context after resuming on it.
+ */
+TEST_F(CoroutineTest, testResumeOn)
+{
+    hoppingSteps(CONTEXT_1, CONTEXT_2, _steps).start();
+    _context1.execute();
+    EXPECT_THAT(_steps, ElementsAre(1U));
+    _context1.execute();
+    EXPECT_THAT(_steps, ElementsAre(1U));
+    _context2.execute();
+    EXPECT_THAT(_steps, ElementsAre(1U, 2U));
+}
+
+/**
+ * \desc
+ * Member functions take their context as first parameter.
+ */
+TEST_F(CoroutineTest, testMemberFunction)
+{
+    Flow flow;
+    flow.run(CONTEXT_2).start();
+    _context2.execute();
+    EXPECT_EQ(1U, flow._runs);
+}
+
+} // namespace
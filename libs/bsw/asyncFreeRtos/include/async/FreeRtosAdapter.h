@@ -72,6 +72,7 @@ public:
     static ContextType const TASK_IDLE  = 0U;
     static ContextType const TASK_TIMER = static_cast<ContextType>(TASK_COUNT);
 
+    using BindingType = Binding;
     using AdapterType = FreeRtosAdapter<Binding>;
 
     using TaskContextType  = TaskContext<AdapterType>;
@@ -146,6 +147,17 @@ public:
      */
     static bool getStackUsage(size_t taskIdx, StackUsage& stackUsage);
 
+    /**
+     * Retrieves the queue depth statistics of a priority lane of a specified task.
+     *
+     * \param taskIdx The index of the task.
+     * \param priority The priority lane of the task.
+     * \param statistics A reference to the RunnableLaneStatistics struct to populate.
+     * \return True if the task and lane exist and the task has more than one lane.
+     */
+    static bool
+    getLaneStatistics(size_t taskIdx, size_t priority, RunnableLaneStatistics& statistics);
+
     static void callIdleTaskFunction();
 
     /**
@@ -156,6 +168,15 @@ public:
      */
     static void execute(ContextType context, RunnableType& runnable);
 
+    /**
+     * Executes a specified runnable within a priority lane of a given context.
+     *
+     * \param context The task context.
+     * \param runnable The runnable to execute.
+     * \param priority The lane of the runnable, lane 0 has the lowest priority.
+     */
+    static void execute(ContextType context, RunnableType& runnable, size_t priority);
+
     /**
      * Schedules a runnable to execute after a delay.
      *
@@ -372,12 +393,33 @@ inline void FreeRtosAdapter<Binding>::callIdleTaskFunction()
     _taskContexts[TASK_IDLE].callTaskFunction();
 }
 
+template<class Binding>
+bool FreeRtosAdapter<Binding>::getLaneStatistics(
+    size_t const taskIdx, size_t const priority, RunnableLaneStatistics& statistics)
+{
+    // with a single lane the task context uses the RunnableExecutor without statistics
+    if ((TaskContextType::PRIORITY_LANE_COUNT > 1U) && (taskIdx < TASK_COUNT)
+        && (priority < TaskContextType::PRIORITY_LANE_COUNT))
+    {
+        statistics = _taskContexts[taskIdx].getLaneStatistics(priority);
+        return true;
+    }
+    return false;
+}
+
 template<class Binding>
 inline void FreeRtosAdapter<Binding>::execute(ContextType const context, RunnableType& runnable)
 {
     _taskContexts[static_cast<size_t>(context)].execute(runnable);
 }
 
+template<class Binding>
+inline void FreeRtosAdapter<Binding>::execute(
+    ContextType const context, RunnableType& runnable, size_t const priority)
+{
+    _taskContexts[static_cast<size_t>(context)].execute(runnable, priority);
+}
+
 template<class Binding>
 inline void FreeRtosAdapter<Binding>::schedule(
     ContextType const context,
@@ -5,9 +5,10 @@
  */
 #pragma once
 
+#include "FreeRTOSConfig.h"
 #include "async/EventDispatcher.h"
 #include "async/EventPolicy.h"
-#include "async/RunnableExecutor.h"
+#include "async/TaskContextTypes.h"
 #include "async/Types.h"
 
 #include <bsp/timer/SystemTimer.h>
@@ -20,6 +21,24 @@
 
 namespace async
 {
+namespace internal
+{
+template<bool Tickless = (ASYNC_CONFIG_TICKLESS_IDLE != 0)>
+struct TaskContextIdleTicks
+{
+    /**
+     * A tickless context without pending timeouts waits until an event is set.
+     */
+    static TickType_t get(TickType_t /* waitTicks */) { return portMAX_DELAY; }
+};
+
+template<>
+struct TaskContextIdleTicks<false>
+{
+    static TickType_t get(TickType_t const waitTicks) { return waitTicks; }
+};
+} // namespace internal
+
 /**
  * Provides an interface between application-specific Tasks and Timers
  * and the FreeRTOS framework, managing FreeRTOS* task and timer callbacks.
@@ -29,14 +48,18 @@ namespace async
  * for task creation, scheduling and processing callbacks.
  *
  * \tparam Binding The specific binding type associated with the TaskContext.
+ * \tparam Timer The timer collecting the timeouts of this context, ::timer::Timer or
+ * ::timer::TimingWheelTimer. Defaults to the timing wheel if ASYNC_CONFIG_TIMING_WHEEL is enabled.
  */
-template<class Binding>
+template<class Binding, class Timer = typename internal::TaskContextTimer<>::Type>
 class TaskContext : public EventDispatcher<2U, LockType>
 {
 public:
-    using TaskFunctionType = ::etl::delegate<void(TaskContext<Binding>&)>;
+    using TaskFunctionType = ::etl::delegate<void(TaskContext<Binding, Timer>&)>;
     using StackType        = ::etl::span<StackType_t>;
 
+    static size_t const PRIORITY_LANE_COUNT = static_cast<size_t>(ASYNC_CONFIG_PRIORITY_LANES);
+
     TaskContext();
 
     /**
@@ -82,6 +105,28 @@ public:
      */
     void execute(RunnableType& runnable);
 
+    /**
+     * Executes asynchronously the specified runnable within a priority lane of this task context.
+     * Runnables of higher lanes are executed first, a waiting runnable of a lower lane is executed
+     * at the latest after ASYNC_CONFIG_PRIORITY_LANE_STARVATION_LIMIT runnables of higher lanes.
+     * A runnable that is already waiting keeps its lane. With a single lane the priority is
+     * ignored.
+     * \param runnable The runnable to execute.
+     * \param priority The lane of the runnable, lane 0 has the lowest priority.
+     */
+    void execute(RunnableType& runnable, size_t priority);
+
+    /**
+     * Retrieves the queue depth statistics of a priority lane. The statistics are only collected
+     * with more than one lane, otherwise all values are zero.
+     * \param priority The lane to get the statistics for.
+     * \return The statistics of the lane.
+     */
+    RunnableLaneStatistics getLaneStatistics(size_t priority) const;
+
+    /// Resets the maximum queue depth and enqueue count of all priority lanes.
+    void resetLaneStatistics();
+
     /**
      * Schedules a runnable to execute after a delay.
      * \param runnable The runnable to schedule.
@@ -130,21 +175,21 @@ public:
      * Default function to be executed by a task within this context.
      * \param taskContext The context in which the task executes.
      */
-    static void defaultTaskFunction(TaskContext<Binding>& taskContext);
+    static void defaultTaskFunction(TaskContext<Binding, Timer>& taskContext);
 
     /**
      * Default function to be executed by the idle task.
      * \param taskContext The context in which the task executes.
      */
-    static void defaultIdleFunction(TaskContext<Binding>& taskContext);
+    static void defaultIdleFunction(TaskContext<Binding, Timer>& taskContext);
 
 private:
-    friend class EventPolicy<TaskContext<Binding>, 0U>;
-    friend class EventPolicy<TaskContext<Binding>, 1U>;
+    friend class EventPolicy<TaskContext<Binding, Timer>, 0U>;
+    friend class EventPolicy<TaskContext<Binding, Timer>, 1U>;
 
-    using ExecuteEventPolicyType = EventPolicy<TaskContext<Binding>, 0U>;
-    using TimerEventPolicyType   = EventPolicy<TaskContext<Binding>, 1U>;
-    using TimerType              = ::timer::Timer<LockType>;
+    using ExecuteEventPolicyType = EventPolicy<TaskContext<Binding, Timer>, 0U>;
+    using TimerEventPolicyType   = EventPolicy<TaskContext<Binding, Timer>, 1U>;
+    using TimerType              = Timer;
 
     static EventMaskType const STOP_EVENT_MASK = static_cast<EventMaskType>(
         static_cast<EventMaskType>(1U) << static_cast<EventMaskType>(EVENT_COUNT));
@@ -158,7 +203,11 @@ private:
 
     static void staticTaskFunction(void* param);
 
-    RunnableExecutor<RunnableType, ExecuteEventPolicyType, LockType> _runnableExecutor;
+    using RunnableExecutorType = internal::TaskContextRunnableExecutor<
+        ExecuteEventPolicyType,
+        typename internal::TaskContextRunnableHook<Binding>::Type>;
+
+    typename RunnableExecutorType::Type _runnableExecutor;
     TimerType _timer;
     TimerEventPolicyType _timerEventPolicy;
     TaskFunctionType _taskFunction;
@@ -170,8 +219,8 @@ private:
 /**
  * Inline implementations.
  */
-template<class Binding>
-inline TaskContext<Binding>::TaskContext()
+template<class Binding, class Timer>
+inline TaskContext<Binding, Timer>::TaskContext()
 : _runnableExecutor(*this)
 , _timerEventPolicy(*this)
 , _taskFunction()
@@ -184,8 +233,8 @@ inline TaskContext<Binding>::TaskContext()
     _runnableExecutor.init();
 }
 
-template<class Binding>
-void TaskContext<Binding>::initTask(
+template<class Binding, class Timer>
+void TaskContext<Binding, Timer>::initTask(
     ContextType const context, char const* const name, TaskFunctionType const taskFunction)
 {
     _context      = context;
@@ -195,14 +244,14 @@ void TaskContext<Binding>::initTask(
                         : TaskFunctionType::template create<&TaskContext::defaultIdleFunction>();
 }
 
-template<class Binding>
-void TaskContext<Binding>::initTaskHandle(TaskHandle_t const taskHandle)
+template<class Binding, class Timer>
+void TaskContext<Binding, Timer>::initTaskHandle(TaskHandle_t const taskHandle)
 {
     _taskHandle = taskHandle;
 }
 
-template<class Binding>
-void TaskContext<Binding>::createTask(
+template<class Binding, class Timer>
+void TaskContext<Binding, Timer>::createTask(
     ContextType const context,
     StaticTask_t& task,
     char const* const name,
@@ -225,32 +274,51 @@ void TaskContext<Binding>::createTask(
         &task);
 }
 
-template<class Binding>
-inline char const* TaskContext<Binding>::getName() const
+template<class Binding, class Timer>
+inline char const* TaskContext<Binding, Timer>::getName() const
 {
     return _name;
 }
 
-template<class Binding>
-inline TaskHandle_t TaskContext<Binding>::getTaskHandle() const
+template<class Binding, class Timer>
+inline TaskHandle_t TaskContext<Binding, Timer>::getTaskHandle() const
 {
     return _taskHandle;
 }
 
-template<class Binding>
-inline uint32_t TaskContext<Binding>::getUnusedStackSize() const
+template<class Binding, class Timer>
+inline uint32_t TaskContext<Binding, Timer>::getUnusedStackSize() const
 {
     return getUnusedStackSize(_taskHandle);
 }
 
-template<class Binding>
-inline void TaskContext<Binding>::execute(RunnableType& runnable)
+template<class Binding, class Timer>
+inline void TaskContext<Binding, Timer>::execute(RunnableType& runnable)
 {
     _runnableExecutor.enqueue(runnable);
 }
 
-template<class Binding>
-inline void TaskContext<Binding>::schedule(
+template<class Binding, class Timer>
+inline void TaskContext<Binding, Timer>::execute(RunnableType& runnable, size_t const priority)
+{
+    RunnableExecutorType::enqueue(_runnableExecutor, runnable, priority);
+}
+
+template<class Binding, class Timer>
+inline RunnableLaneStatistics
+TaskContext<Binding, Timer>::getLaneStatistics(size_t const priority) const
+{
+    return RunnableExecutorType::getLaneStatistics(_runnableExecutor, priority);
+}
+
+template<class Binding, class Timer>
+inline void TaskContext<Binding, Timer>::resetLaneStatistics()
+{
+    RunnableExecutorType::resetLaneStatistics(_runnableExecutor);
+}
+
+template<class Binding, class Timer>
+inline void TaskContext<Binding, Timer>::schedule(
     RunnableType& runnable, TimeoutType& timeout, uint32_t const delay, TimeUnitType const unit)
 {
     if (!_timer.isActive(timeout))
@@ -264,8 +332,8 @@ inline void TaskContext<Binding>::schedule(
     }
 }
 
-template<class Binding>
-inline void TaskContext<Binding>::scheduleAtFixedRate(
+template<class Binding, class Timer>
+inline void TaskContext<Binding, Timer>::scheduleAtFixedRate(
     RunnableType& runnable, TimeoutType& timeout, uint32_t const period, TimeUnitType const unit)
 {
     if (!_timer.isActive(timeout))
@@ -279,14 +347,14 @@ inline void TaskContext<Binding>::scheduleAtFixedRate(
     }
 }
 
-template<class Binding>
-inline void TaskContext<Binding>::cancel(TimeoutType& timeout)
+template<class Binding, class Timer>
+inline void TaskContext<Binding, Timer>::cancel(TimeoutType& timeout)
 {
     _timer.cancel(timeout);
 }
 
-template<class Binding>
-inline void TaskContext<Binding>::setEvents(EventMaskType const eventMask)
+template<class Binding, class Timer>
+inline void TaskContext<Binding, Timer>::setEvents(EventMaskType const eventMask)
 {
     BaseType_t* const higherPriorityTaskHasWoken = Binding::getHigherPriorityTaskWoken();
     if (higherPriorityTaskHasWoken != nullptr)
@@ -299,16 +367,17 @@ inline void TaskContext<Binding>::setEvents(EventMaskType const eventMask)
     }
 }
 
-template<class Binding>
-inline EventMaskType TaskContext<Binding>::waitEvents()
+template<class Binding, class Timer>
+inline EventMaskType TaskContext<Binding, Timer>::waitEvents()
 {
     EventMaskType eventMask = 0U;
-    uint32_t ticks          = Binding::WAIT_EVENTS_TICK_COUNT;
+    TickType_t ticks = internal::TaskContextIdleTicks<>::get(Binding::WAIT_EVENTS_TICK_COUNT);
     uint32_t nextDelta;
     bool const hasDelta = _timer.getNextDelta(getSystemTimeUs32Bit(), nextDelta);
     if (hasDelta)
     {
-        ticks = static_cast<uint32_t>((nextDelta + (Config::TICK_IN_US - 1U)) / Config::TICK_IN_US);
+        ticks = static_cast<TickType_t>(
+            (nextDelta + (Config::TICK_IN_US - 1U)) / Config::TICK_IN_US);
     }
     if (xTaskNotifyWait(0U, WAIT_EVENT_MASK, &eventMask, ticks) != 0)
     {
@@ -324,22 +393,22 @@ inline EventMaskType TaskContext<Binding>::waitEvents()
     }
 }
 
-template<class Binding>
-inline EventMaskType TaskContext<Binding>::peekEvents()
+template<class Binding, class Timer>
+inline EventMaskType TaskContext<Binding, Timer>::peekEvents()
 {
     EventMaskType eventMask = 0U;
     (void)xTaskNotifyWait(0U, WAIT_EVENT_MASK, &eventMask, 0U);
     return eventMask;
 }
 
-template<class Binding>
-void TaskContext<Binding>::callTaskFunction()
+template<class Binding, class Timer>
+void TaskContext<Binding, Timer>::callTaskFunction()
 {
     _taskFunction(*this);
 }
 
-template<class Binding>
-void TaskContext<Binding>::dispatch()
+template<class Binding, class Timer>
+void TaskContext<Binding, Timer>::dispatch()
 {
     EventMaskType eventMask = 0U;
     while ((eventMask & STOP_EVENT_MASK) == 0U)
@@ -349,14 +418,14 @@ void TaskContext<Binding>::dispatch()
     }
 }
 
-template<class Binding>
-inline void TaskContext<Binding>::stopDispatch()
+template<class Binding, class Timer>
+inline void TaskContext<Binding, Timer>::stopDispatch()
 {
     setEvents(STOP_EVENT_MASK);
 }
 
-template<class Binding>
-void TaskContext<Binding>::dispatchWhileWork()
+template<class Binding, class Timer>
+void TaskContext<Binding, Timer>::dispatchWhileWork()
 {
     while (true)
     {
@@ -373,33 +442,33 @@ void TaskContext<Binding>::dispatchWhileWork()
     }
 }
 
-template<class Binding>
-uint32_t TaskContext<Binding>::getUnusedStackSize(TaskHandle_t const taskHandle)
+template<class Binding, class Timer>
+uint32_t TaskContext<Binding, Timer>::getUnusedStackSize(TaskHandle_t const taskHandle)
 {
     return static_cast<uint32_t>(uxTaskGetStackHighWaterMark(taskHandle))
            * static_cast<uint32_t>(sizeof(StackType_t));
 }
 
-template<class Binding>
-void TaskContext<Binding>::defaultTaskFunction(TaskContext<Binding>& taskContext)
+template<class Binding, class Timer>
+void TaskContext<Binding, Timer>::defaultTaskFunction(TaskContext<Binding, Timer>& taskContext)
 {
     taskContext.dispatch();
 }
 
-template<class Binding>
-void TaskContext<Binding>::defaultIdleFunction(TaskContext<Binding>& taskContext)
+template<class Binding, class Timer>
+void TaskContext<Binding, Timer>::defaultIdleFunction(TaskContext<Binding, Timer>& taskContext)
 {
     taskContext.dispatchWhileWork();
 }
 
-template<class Binding>
-void TaskContext<Binding>::handleTimeout()
+template<class Binding, class Timer>
+void TaskContext<Binding, Timer>::handleTimeout()
 {
-    while (_timer.processNextTimeout(getSystemTimeUs32Bit())) {}
+    while (_timer.processDueTimeouts(getSystemTimeUs32Bit())) {}
 }
 
-template<class Binding>
-void TaskContext<Binding>::staticTaskFunction(void* const param)
+template<class Binding, class Timer>
+void TaskContext<Binding, Timer>::staticTaskFunction(void* const param)
 {
     TaskContext& taskContext = *reinterpret_cast<TaskContext*>(param);
     taskContext.callTaskFunction();
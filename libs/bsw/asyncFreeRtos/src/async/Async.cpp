@@ -11,6 +11,11 @@ void execute(ContextType const context, RunnableType& runnable)
     AdapterType::execute(context, runnable);
 }
 
+void execute(ContextType const context, RunnableType& runnable, size_t const priority)
+{
+    AdapterType::execute(context, runnable, priority);
+}
+
 void schedule(
     ContextType const context,
     RunnableType& runnable,
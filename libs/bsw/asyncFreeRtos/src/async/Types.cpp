@@ -13,7 +13,8 @@ void TimeoutType::expired()
     RunnableType* const runnable = _runnable;
     if (runnable != nullptr)
     {
-        runnable->execute();
+        internal::TaskContextRunnableHook<AsyncBindingType::AdapterType>::Type::expire(
+            *runnable, *this);
     }
 }
 
@@ -305,6 +305,58 @@ TEST_F(TaskContextTest, testSchedule)
     }
 }
 
+/**
+ * \refs: SMD_asyncFreeRtos_TaskContextAsyncApi, SMD_asyncFreeRtos_TaskContextTaskLoop
+ * \desc: To test task schedule functionality with the timing wheel timer
+ */
+TEST_F(TaskContextTest, testScheduleWithTimingWheel)
+{
+    using ContextType = TaskContext<TestBindingMock, ::timer::TimingWheelTimer<LockType>>;
+    ContextType cut;
+    TaskFunction_t* osTaskFunction = 0L;
+    EXPECT_CALL(
+        _freeRtosMock, xTaskCreateStatic(NotNull(), _name, 100, NotNull(), 12U, _stack, &_task))
+        .WillOnce(DoAll(SaveArg<0>(&osTaskFunction), Return(&_taskHandle)));
+    cut.createTask(1U, _task, _name, 12U, _stack, ContextType::TaskFunctionType());
+
+    EXPECT_CALL(_systemTimerMock, getSystemTimeUs32Bit()).WillRepeatedly(Return(100000U));
+
+    // Schedule first timer. Expect task notify
+    uint32_t eventMask = 0U;
+    EXPECT_CALL(_bindingMock, getHigherPriorityTaskWokenFunc())
+        .WillOnce(Return(static_cast<BaseType_t*>(0L)));
+    EXPECT_CALL(_freeRtosMock, xTaskNotify(&_taskHandle, _, eSetBits))
+        .WillOnce(SaveArg<1>(&eventMask));
+    cut.schedule(_runnableMock1, _timeout1, 150U, TimeUnit::MILLISECONDS);
+    // Schedule second timer (to elapse later). No task notify expected
+    cut.schedule(_runnableMock2, _timeout2, 151U, TimeUnit::MILLISECONDS);
+    Mock::VerifyAndClearExpectations(&_systemTimerMock);
+
+    // both timers have elapsed and are executed in order of their expiry
+    EXPECT_CALL(_systemTimerMock, getSystemTimeUs32Bit()).WillRepeatedly(Return(252000U));
+    Sequence seq;
+    EXPECT_CALL(_freeRtosMock, xTaskNotifyWait(0U, 7U, NotNull(), 0U))
+        .InSequence(seq)
+        .WillOnce(DoAll(SetArgPointee<2>(eventMask), Return(true)));
+    EXPECT_CALL(_runnableMock1, execute()).InSequence(seq);
+    EXPECT_CALL(_runnableMock2, execute()).InSequence(seq);
+    EXPECT_CALL(
+        _freeRtosMock, xTaskNotifyWait(0U, 7U, NotNull(), TestBindingMock::WAIT_EVENTS_TICK_COUNT))
+        .InSequence(seq)
+        .WillOnce(DoAll(SetArgPointee<2>(0U), StopDispatch(&cut), Return(false)));
+    // trigger shutdown on next iteration
+    EXPECT_CALL(_bindingMock, getHigherPriorityTaskWokenFunc())
+        .WillOnce(Return(static_cast<BaseType_t*>(0L)));
+    EXPECT_CALL(_freeRtosMock, xTaskNotify(&_taskHandle, _, eSetBits))
+        .InSequence(seq)
+        .WillOnce(SaveArg<1>(&eventMask));
+    EXPECT_CALL(
+        _freeRtosMock, xTaskNotifyWait(0U, 7U, NotNull(), TestBindingMock::WAIT_EVENTS_TICK_COUNT))
+        .InSequence(seq)
+        .WillOnce(DoAll(CopyArgPointee2(&eventMask), Return(true)));
+    osTaskFunction(&cut);
+}
+
 /**
  * \refs: SMD_asyncFreeRtos_TaskContextAsyncApi
  * \desc: To test task schedule at fixedrate functionality
@@ -371,7 +423,6 @@ TEST_F(TaskContextTest, testScheduleAtFixedRate)
                 .WillOnce(Return(105000U))
                 .WillOnce(Return(120000U))
                 .WillOnce(Return(120000U))
-                .WillOnce(Return(120000U))
                 .WillRepeatedly(Return(140000U));
 
             Sequence seq;
@@ -500,7 +551,6 @@ TEST_F(TaskContextTest, testDispatchWhileWork)
         EXPECT_CALL(_systemTimerMock, getSystemTimeUs32Bit())
             .WillOnce(Return(110000U))
             .WillOnce(Return(120000U))
-            .WillOnce(Return(120010U))
             .WillOnce(Return(120020U));
         Sequence seq;
         EXPECT_CALL(_freeRtosMock, xTaskNotifyWait(0U, 7U, NotNull(), 0U))
@@ -540,4 +590,14 @@ TEST_F(TaskContextTest, testGetUnusedStackSize)
     }
 }
 
+/**
+ * \refs: SMD_asyncFreeRtos_TaskContextEventHandling
+ * \desc: To test that a tickless context without pending timeouts waits until an event is set
+ */
+TEST_F(TaskContextTest, testIdleTicks)
+{
+    EXPECT_EQ(portMAX_DELAY, ::async::internal::TaskContextIdleTicks<true>::get(100U));
+    EXPECT_EQ(100U, ::async::internal::TaskContextIdleTicks<false>::get(100U));
+}
+
 } // namespace
@@ -0,0 +1,139 @@
+// Copyright 2025 Accenture.
+
+#define ASYNC_CONFIG_TICKLESS_IDLE 1
+
+#include "async/TaskContext.h"
+
+#include "async/RunnableMock.h"
+
+#include <bsp/timer/SystemTimerMock.h>
+#include <etl/singleton_base.h>
+#include <os/FreeRtosMock.h>
+
+namespace
+{
+using namespace ::async;
+using namespace ::testing;
+
+ACTION_P(StopDispatch, cut) { cut->stopDispatch(); }
+
+ACTION_P(CopyArgPointee2, pointer) { *arg2 = *pointer; }
+
+class TestBindingMock : public ::etl::singleton_base<TestBindingMock>
+{
+public:
+    static EventMaskType const WAIT_EVENTS_TICK_COUNT = 100U;
+    using BaseType_t                                  = int32_t;
+
+    TestBindingMock() : ::etl::singleton_base<TestBindingMock>(*this) {}
+
+    static BaseType_t* getHigherPriorityTaskWoken()
+    {
+        return instance().getHigherPriorityTaskWokenFunc();
+    }
+
+    MOCK_METHOD(BaseType_t*, getHigherPriorityTaskWokenFunc, ());
+};
+
+class TaskContextTicklessTest : public Test
+{
+public:
+    TaskContextTicklessTest() : _name("test"), _taskHandle(10U), _osTaskFunction(0L)
+    {
+        EXPECT_CALL(
+            _freeRtosMock,
+            xTaskCreateStatic(NotNull(), _name, 100, NotNull(), 12U, _stack, &_task))
+            .WillOnce(DoAll(SaveArg<0>(&_osTaskFunction), Return(&_taskHandle)));
+        _cut.createTask(
+            1U, _task, _name, 12U, _stack, TaskContext<TestBindingMock>::TaskFunctionType());
+    }
+
+protected:
+    StrictMock<::os::FreeRtosMock> _freeRtosMock;
+    StrictMock<TestBindingMock> _bindingMock;
+    StrictMock<RunnableMock> _runnableMock;
+    TimeoutType _timeout;
+    StrictMock<SystemTimerMock> _systemTimerMock;
+    StaticTask_t _task;
+    StackType_t _stack[100];
+    char const* _name;
+    uint32_t _taskHandle;
+    TaskFunction_t* _osTaskFunction;
+    TaskContext<TestBindingMock> _cut;
+};
+
+/**
+ * \refs: SMD_asyncFreeRtos_TaskContextEventHandling
+ * \desc: To test that a tickless context without pending timeouts waits for an event without a
+ * timeout, i.e. it isn't woken up every WAIT_EVENTS_TICK_COUNT ticks while it is idle
+ */
+TEST_F(TaskContextTicklessTest, testWaitWithoutPendingTimeout)
+{
+    EXPECT_CALL(_systemTimerMock, getSystemTimeUs32Bit()).WillRepeatedly(Return(100000U));
+
+    uint32_t eventMask = 0U;
+    EXPECT_CALL(_bindingMock, getHigherPriorityTaskWokenFunc())
+        .WillOnce(Return(static_cast<BaseType_t*>(0L)));
+    EXPECT_CALL(_freeRtosMock, xTaskNotify(&_taskHandle, _, eSetBits))
+        .WillOnce(SaveArg<1>(&eventMask));
+    _cut.execute(_runnableMock);
+    Mock::VerifyAndClearExpectations(&_bindingMock);
+    Mock::VerifyAndClearExpectations(&_freeRtosMock);
+
+    Sequence seq;
+    EXPECT_CALL(_freeRtosMock, xTaskNotifyWait(0U, 7U, NotNull(), portMAX_DELAY))
+        .InSequence(seq)
+        .WillOnce(DoAll(SetArgPointee<2>(eventMask), Return(true)));
+    // trigger shutdown, nothing is due afterwards, so the next wait only returns on this event
+    EXPECT_CALL(_runnableMock, execute()).InSequence(seq).WillOnce(StopDispatch(&_cut));
+    EXPECT_CALL(_bindingMock, getHigherPriorityTaskWokenFunc())
+        .WillOnce(Return(static_cast<BaseType_t*>(0L)));
+    EXPECT_CALL(_freeRtosMock, xTaskNotify(&_taskHandle, _, eSetBits))
+        .InSequence(seq)
+        .WillOnce(SaveArg<1>(&eventMask));
+    EXPECT_CALL(_freeRtosMock, xTaskNotifyWait(0U, 7U, NotNull(), portMAX_DELAY))
+        .InSequence(seq)
+        .WillOnce(DoAll(CopyArgPointee2(&eventMask), Return(true)));
+    _osTaskFunction(&_cut);
+}
+
+/**
+ * \refs: SMD_asyncFreeRtos_TaskContextEventHandling
+ * \desc: To test that a tickless context waits until the next timeout is due and without a
+ * timeout once no further timeout is pending
+ */
+TEST_F(TaskContextTicklessTest, testWaitForPendingTimeout)
+{
+    EXPECT_CALL(_systemTimerMock, getSystemTimeUs32Bit()).WillRepeatedly(Return(100000U));
+
+    uint32_t eventMask = 0U;
+    EXPECT_CALL(_bindingMock, getHigherPriorityTaskWokenFunc())
+        .WillOnce(Return(static_cast<BaseType_t*>(0L)));
+    EXPECT_CALL(_freeRtosMock, xTaskNotify(&_taskHandle, _, eSetBits))
+        .WillOnce(SaveArg<1>(&eventMask));
+    _cut.schedule(_runnableMock, _timeout, 150U, TimeUnit::MILLISECONDS);
+    Mock::VerifyAndClearExpectations(&_bindingMock);
+    Mock::VerifyAndClearExpectations(&_freeRtosMock);
+    Mock::VerifyAndClearExpectations(&_systemTimerMock);
+
+    // the first wait lasts until the timeout is due
+    EXPECT_CALL(_systemTimerMock, getSystemTimeUs32Bit())
+        .WillOnce(Return(100000U))
+        .WillRepeatedly(Return(250000U));
+    Sequence seq;
+    EXPECT_CALL(_freeRtosMock, xTaskNotifyWait(0U, 7U, NotNull(), 1500U))
+        .InSequence(seq)
+        .WillOnce(DoAll(SetArgPointee<2>(0U), Return(false)));
+    EXPECT_CALL(_runnableMock, execute()).InSequence(seq).WillOnce(StopDispatch(&_cut));
+    EXPECT_CALL(_bindingMock, getHigherPriorityTaskWokenFunc())
+        .WillOnce(Return(static_cast<BaseType_t*>(0L)));
+    EXPECT_CALL(_freeRtosMock, xTaskNotify(&_taskHandle, _, eSetBits))
+        .InSequence(seq)
+        .WillOnce(SaveArg<1>(&eventMask));
+    EXPECT_CALL(_freeRtosMock, xTaskNotifyWait(0U, 7U, NotNull(), portMAX_DELAY))
+        .InSequence(seq)
+        .WillOnce(DoAll(CopyArgPointee2(&eventMask), Return(true)));
+    _osTaskFunction(&_cut);
+}
+
+} // namespace
@@ -0,0 +1,133 @@
+// Copyright 2025 Accenture.
+
+#include <async/IRunnable.h>
+#include <async/LockedQueue.h>
+#include <async/MpscQueue.h>
+#include <benchmark/benchmark.h>
+
+#include <atomic>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace
+{
+/// Lock with real acquisition cost, standing in for the global interrupt lock of the target.
+struct MutexLock
+{
+    MutexLock() { mutex().lock(); }
+
+    ~MutexLock() { mutex().unlock(); }
+
+    static std::mutex& mutex()
+    {
+        static std::mutex m;
+        return m;
+    }
+};
+
+struct CountingRunnable : public ::async::IRunnable
+{
+    void execute() override { ++_count; }
+
+    uint64_t _count = 0U;
+};
+
+static size_t const RUNNABLES_PER_PRODUCER = 16U;
+
+/**
+ * Shared state of a benchmark run: the queue, one set of runnables per producer thread and the
+ * consumer thread draining the queue.
+ */
+template<class Queue>
+struct Fixture
+{
+    Queue _queue;
+    std::vector<CountingRunnable> _runnables;
+    std::atomic<bool> _running{false};
+    std::thread _consumer;
+
+    void start(size_t const producerCount)
+    {
+        _runnables = std::vector<CountingRunnable>(producerCount * RUNNABLES_PER_PRODUCER);
+        _running   = true;
+        _consumer  = std::thread(
+            [this]()
+            {
+                while (_running.load(std::memory_order_relaxed))
+                {
+                    ::async::IRunnable* runnable = _queue.dequeue();
+                    while (runnable != nullptr)
+                    {
+                        runnable->execute();
+                        runnable = _queue.dequeue();
+                    }
+                }
+                while (::async::IRunnable* const runnable = _queue.dequeue())
+                {
+                    runnable->execute();
+                }
+            });
+    }
+
+    uint64_t stop()
+    {
+        _running = false;
+        _consumer.join();
+        uint64_t executed = 0U;
+        for (auto const& runnable : _runnables)
+        {
+            executed += runnable._count;
+        }
+        return executed;
+    }
+};
+
+template<class Queue>
+Fixture<Queue>& fixture()
+{
+    static Fixture<Queue> f;
+    return f;
+}
+} // namespace
+
+/**
+ * Benchmarks enqueueing runnables from state.threads() producer threads while a single consumer
+ * thread drains the queue, like async::execute() calls from several tasks into one context.
+ * Each producer cycles through its own runnables, so enqueue attempts of already enqueued
+ * runnables are de-duplicated by the queue.
+ */
+template<class Queue>
+void BM_runnable_queue_contention(benchmark::State& state)
+{
+    auto& f = fixture<Queue>();
+    if (state.thread_index() == 0)
+    {
+        f.start(static_cast<size_t>(state.threads()));
+    }
+
+    size_t idx = 0U;
+    for (auto _ : state)
+    {
+        auto& runnable = f._runnables
+                             [(static_cast<size_t>(state.thread_index()) * RUNNABLES_PER_PRODUCER)
+                              + idx];
+        benchmark::DoNotOptimize(f._queue.enqueue(runnable));
+        idx = (idx + 1U) % RUNNABLES_PER_PRODUCER;
+    }
+
+    if (state.thread_index() == 0)
+    {
+        state.counters["executed"] = static_cast<double>(f.stop());
+    }
+}
+
+using LockedRunnableQueue = ::async::LockedQueue<::async::IRunnable, MutexLock>;
+using MpscRunnableQueue   = ::async::MpscQueue<::async::IRunnable>;
+
+BENCHMARK_TEMPLATE(BM_runnable_queue_contention, LockedRunnableQueue)
+    ->ThreadRange(1, 8)
+    ->UseRealTime();
+BENCHMARK_TEMPLATE(BM_runnable_queue_contention, MpscRunnableQueue)
+    ->ThreadRange(1, 8)
+    ->UseRealTime();
@@ -0,0 +1,72 @@
+// Copyright 2025 Accenture.
+
+/**
+ * \ingroup async
+ */
+#pragma once
+
+#include "async/Queue.h"
+
+#include <platform/config.h>
+
+namespace async
+{
+/**
+ * Queue policy of RunnableExecutor that guards a Queue with a Lock. A node that is already
+ * enqueued isn't enqueued again until it has been dequeued.
+ *
+ * \tparam Node Type of the nodes, derived from QueueNode<Node>.
+ * \tparam Lock RAII lock protecting the queue.
+ */
+template<typename Node, typename Lock>
+class LockedQueue
+{
+public:
+    LockedQueue();
+
+    /**
+     * Enqueues the node unless it is already enqueued.
+     * \param node Node to enqueue
+     * \return
+     * - true if the node has been enqueued
+     * - false if the node was already enqueued
+     */
+    bool enqueue(Node& node);
+
+    /**
+     * Dequeues the oldest node.
+     * \return pointer to the dequeued node or nullptr if the queue is empty
+     */
+    Node* dequeue();
+
+private:
+    Queue<Node> _queue;
+};
+
+/**
+ * Inline implementations.
+ */
+template<typename Node, typename Lock>
+LockedQueue<Node, Lock>::LockedQueue() : _queue()
+{}
+
+template<typename Node, typename Lock>
+inline bool LockedQueue<Node, Lock>::enqueue(Node& node)
+{
+    ESR_UNUSED const Lock lock;
+    if (node.isEnqueued())
+    {
+        return false;
+    }
+    _queue.enqueue(node);
+    return true;
+}
+
+template<typename Node, typename Lock>
+inline Node* LockedQueue<Node, Lock>::dequeue()
+{
+    ESR_UNUSED const Lock lock;
+    return _queue.dequeue();
+}
+
+} // namespace async
@@ -0,0 +1,101 @@
+// Copyright 2025 Accenture.
+
+/**
+ * \ingroup async
+ */
+#pragma once
+
+#include <etl/atomic.h>
+
+namespace async
+{
+/**
+ * Lock-free intrusive multi-producer/single-consumer queue of QueueNode derived nodes.
+ *
+ * Producers push nodes onto an atomic stack with a compare-and-swap loop, the single consumer
+ * takes the whole stack with one atomic exchange and reverses it into a private FIFO list. Nodes
+ * are therefore dequeued in the order in which they have been enqueued.
+ *
+ * A node that is already enqueued isn't enqueued again until it has been dequeued, exactly like
+ * a node guarded by isEnqueued() in a locked Queue. The node is claimed atomically with
+ * QueueNode::tryEnqueue(), so no lock is needed on either side.
+ *
+ * enqueue() may be called concurrently from any task or interrupt, dequeue() must only be called
+ * from the single consuming context.
+ *
+ * \tparam Node Type of the nodes, derived from QueueNode<Node>.
+ */
+template<typename Node>
+class MpscQueue
+{
+public:
+    MpscQueue();
+
+    /**
+     * Enqueues the node unless it is already enqueued.
+     * \param node Node to enqueue
+     * \return
+     * - true if the node has been enqueued
+     * - false if the node was already enqueued
+     */
+    bool enqueue(Node& node);
+
+    /**
+     * Dequeues the oldest node. Must be called from the consuming context only.
+     * \return pointer to the dequeued node or nullptr if the queue is empty
+     */
+    Node* dequeue();
+
+private:
+    ::etl::atomic<Node*> _pushed;
+    Node* _first;
+};
+
+/**
+ * Inline implementations.
+ */
+template<typename Node>
+MpscQueue<Node>::MpscQueue() : _pushed(nullptr), _first(nullptr)
+{}
+
+template<typename Node>
+bool MpscQueue<Node>::enqueue(Node& node)
+{
+    if (!node.tryEnqueue())
+    {
+        return false;
+    }
+    Node* head = _pushed.load(::etl::memory_order_relaxed);
+    do
+    {
+        node.setNext(head);
+    } while (!_pushed.compare_exchange_weak(
+        head, &node, ::etl::memory_order_release, ::etl::memory_order_relaxed));
+    return true;
+}
+
+template<typename Node>
+Node* MpscQueue<Node>::dequeue()
+{
+    if (_first == nullptr)
+    {
+        // take all pushed nodes at once and restore their enqueue order
+        Node* pushed = _pushed.exchange(nullptr, ::etl::memory_order_acquire);
+        while (pushed != nullptr)
+        {
+            Node* const next = pushed->getNext();
+            pushed->setNext(_first);
+            _first = pushed;
+            pushed = next;
+        }
+    }
+    if (_first != nullptr)
+    {
+        Node* const node = _first;
+        _first           = node->dequeue();
+        return node;
+    }
+    return nullptr;
+}
+
+} // namespace async
@@ -0,0 +1,352 @@
+// Copyright 2025 Accenture.
+
+/**
+ * \ingroup async
+ */
+#pragma once
+
+#include "async/LockedQueue.h"
+#include "async/RunnableHook.h"
+
+#include <etl/array.h>
+#include <etl/atomic.h>
+
+namespace async
+{
+/**
+ * Queue depth statistics of a single priority lane.
+ */
+struct RunnableLaneStatistics
+{
+    /// Number of runnables currently waiting in the lane.
+    uint32_t _depth;
+    /// Maximum number of runnables that have been waiting in the lane at the same time.
+    uint32_t _maxDepth;
+    /// Number of runnables that have been enqueued to the lane.
+    uint32_t _enqueueCount;
+};
+
+/**
+ * A RunnableExecutor with multiple priority lanes. Each lane is a separate queue, runnables of a
+ * lane are executed in the order in which they have been enqueued.
+ *
+ * On handling the event the non-empty lane with the highest priority is served first. To bound
+ * the starvation of lower lanes, a waiting lane is served as soon as MaxWait runnables of higher
+ * lanes have been executed while it was waiting.
+ *
+ * \tparam Runnable Type of functions, that will be executed.
+ * \tparam EventPolicy EventPolicy is derived from EventDispatcher. Method enqueue will set Event,
+ * specified in EventPolicy.
+ * \tparam Lock RAII lock protecting the default queue policy.
+ * \tparam LaneCount Number of priority lanes. Lane 0 has the lowest priority.
+ * \tparam MaxWait Maximum number of runnables of higher lanes executed while a lower lane is
+ * waiting.
+ * \tparam QueuePolicy Queue of a single lane, either the LockedQueue or the lock-free MpscQueue.
+ * \tparam Hook Static hook called for each enqueued and executed Runnable, see RunnableHook.
+ */
+template<
+    typename Runnable,
+    typename EventPolicy,
+    typename Lock,
+    size_t LaneCount,
+    size_t MaxWait       = 8U,
+    typename QueuePolicy = LockedQueue<Runnable, Lock>,
+    typename Hook        = RunnableHook>
+class PriorityRunnableExecutor
+{
+    static_assert(LaneCount > 0U, "at least one lane is required");
+    static_assert(MaxWait > 0U, "lower lanes must be served at some point");
+
+public:
+    static size_t const LANE_COUNT = LaneCount;
+
+    explicit PriorityRunnableExecutor(typename EventPolicy::EventDispatcherType& eventDispatcher);
+
+    void init();
+    void shutdown();
+
+    /**
+     * Places a Runnable in the queue of a lane and sets the event in the EventDispatcher. A
+     * Runnable that is already waiting in any lane isn't enqueued again and keeps its lane, even
+     * if priority is higher. Moving it would require removing it from the middle of a lock-free
+     * queue.
+     * \param runnable Runnable to be executed
+     * \param priority Lane of the runnable, values exceeding the highest lane are limited to it
+     */
+    void enqueue(Runnable& runnable, size_t priority);
+
+    /**
+     * Places a Runnable in the lane with the lowest priority.
+     * \param runnable Runnable to be executed
+     */
+    void enqueue(Runnable& runnable);
+
+    /**
+     * Get the queue depth statistics of a lane.
+     * \param priority Lane to get statistics for
+     */
+    RunnableLaneStatistics getLaneStatistics(size_t priority) const;
+
+    /**
+     * Reset the maximum depth and enqueue count of all lanes.
+     */
+    void resetLaneStatistics();
+
+private:
+    struct Lane
+    {
+        Lane();
+
+        QueuePolicy _queue;
+        ::etl::atomic<int32_t> _depth;
+        ::etl::atomic<int32_t> _maxDepth;
+        ::etl::atomic<uint32_t> _enqueueCount;
+        /// Number of runnables of higher lanes executed while this lane was waiting.
+        size_t _waitCount;
+    };
+
+    void handleEvent();
+
+    size_t selectLane() const;
+    Runnable* dequeueAny(size_t& priority);
+
+    ::etl::array<Lane, LaneCount> _lanes;
+    EventPolicy _eventPolicy;
+};
+
+/**
+ * Inline implementations.
+ */
+template<
+    typename Runnable,
+    typename EventPolicy,
+    typename Lock,
+    size_t LaneCount,
+    size_t MaxWait,
+    typename QueuePolicy,
+    typename Hook>
+PriorityRunnableExecutor<Runnable, EventPolicy, Lock, LaneCount, MaxWait, QueuePolicy, Hook>::
+    Lane::Lane()
+: _queue(), _depth(0), _maxDepth(0), _enqueueCount(0U), _waitCount(0U)
+{}
+
+template<
+    typename Runnable,
+    typename EventPolicy,
+    typename Lock,
+    size_t LaneCount,
+    size_t MaxWait,
+    typename QueuePolicy,
+    typename Hook>
+PriorityRunnableExecutor<Runnable, EventPolicy, Lock, LaneCount, MaxWait, QueuePolicy, Hook>::
+    PriorityRunnableExecutor(typename EventPolicy::EventDispatcherType& eventDispatcher)
+: _lanes(), _eventPolicy(eventDispatcher)
+{}
+
+template<
+    typename Runnable,
+    typename EventPolicy,
+    typename Lock,
+    size_t LaneCount,
+    size_t MaxWait,
+    typename QueuePolicy,
+    typename Hook>
+void
+PriorityRunnableExecutor<Runnable, EventPolicy, Lock, LaneCount, MaxWait, QueuePolicy, Hook>::
+    init()
+{
+    _eventPolicy.setEventHandler(
+        EventPolicy::HandlerFunctionType::
+            template create<PriorityRunnableExecutor, &PriorityRunnableExecutor::handleEvent>(
+                *this));
+}
+
+template<
+    typename Runnable,
+    typename EventPolicy,
+    typename Lock,
+    size_t LaneCount,
+    size_t MaxWait,
+    typename QueuePolicy,
+    typename Hook>
+void
+PriorityRunnableExecutor<Runnable, EventPolicy, Lock, LaneCount, MaxWait, QueuePolicy, Hook>::
+    shutdown()
+{
+    _eventPolicy.removeEventHandler();
+}
+
+template<
+    typename Runnable,
+    typename EventPolicy,
+    typename Lock,
+    size_t LaneCount,
+    size_t MaxWait,
+    typename QueuePolicy,
+    typename Hook>
+void
+PriorityRunnableExecutor<Runnable, EventPolicy, Lock, LaneCount, MaxWait, QueuePolicy, Hook>::
+    enqueue(Runnable& runnable, size_t const priority)
+{
+    Lane& lane = _lanes[(priority < LaneCount) ? priority : (LaneCount - 1U)];
+    Hook::enqueue(runnable);
+    if (lane._queue.enqueue(runnable))
+    {
+        // the depth may drop below zero for a moment if the runnable is dequeued right away
+        int32_t const depth = lane._depth.fetch_add(1) + 1;
+        int32_t maxDepth    = lane._maxDepth.load();
+        while ((depth > maxDepth) && (!lane._maxDepth.compare_exchange_weak(maxDepth, depth))) {}
+        (void)lane._enqueueCount.fetch_add(1U);
+    }
+    _eventPolicy.setEvent();
+}
+
+template<
+    typename Runnable,
+    typename EventPolicy,
+    typename Lock,
+    size_t LaneCount,
+    size_t MaxWait,
+    typename QueuePolicy,
+    typename Hook>
+inline void
+PriorityRunnableExecutor<Runnable, EventPolicy, Lock, LaneCount, MaxWait, QueuePolicy, Hook>::
+    enqueue(Runnable& runnable)
+{
+    enqueue(runnable, 0U);
+}
+
+template<
+    typename Runnable,
+    typename EventPolicy,
+    typename Lock,
+    size_t LaneCount,
+    size_t MaxWait,
+    typename QueuePolicy,
+    typename Hook>
+RunnableLaneStatistics
+PriorityRunnableExecutor<Runnable, EventPolicy, Lock, LaneCount, MaxWait, QueuePolicy, Hook>::
+    getLaneStatistics(size_t const priority) const
+{
+    Lane const& lane    = _lanes[priority];
+    int32_t const depth = lane._depth.load();
+    RunnableLaneStatistics statistics;
+    statistics._depth        = (depth > 0) ? static_cast<uint32_t>(depth) : 0U;
+    statistics._maxDepth     = static_cast<uint32_t>(lane._maxDepth.load());
+    statistics._enqueueCount = lane._enqueueCount.load();
+    return statistics;
+}
+
+template<
+    typename Runnable,
+    typename EventPolicy,
+    typename Lock,
+    size_t LaneCount,
+    size_t MaxWait,
+    typename QueuePolicy,
+    typename Hook>
+void
+PriorityRunnableExecutor<Runnable, EventPolicy, Lock, LaneCount, MaxWait, QueuePolicy, Hook>::
+    resetLaneStatistics()
+{
+    for (Lane& lane : _lanes)
+    {
+        int32_t const depth = lane._depth.load();
+        lane._maxDepth.store((depth > 0) ? depth : 0);
+        lane._enqueueCount.store(0U);
+    }
+}
+
+template<
+    typename Runnable,
+    typename EventPolicy,
+    typename Lock,
+    size_t LaneCount,
+    size_t MaxWait,
+    typename QueuePolicy,
+    typename Hook>
+size_t
+PriorityRunnableExecutor<Runnable, EventPolicy, Lock, LaneCount, MaxWait, QueuePolicy, Hook>::
+    selectLane() const
+{
+    size_t highest = LaneCount;
+    for (size_t priority = LaneCount; priority > 0U; --priority)
+    {
+        if (_lanes[priority - 1U]._depth.load() > 0)
+        {
+            highest = priority - 1U;
+            break;
+        }
+    }
+    for (size_t priority = 0U; priority < highest; ++priority)
+    {
+        Lane const& lane = _lanes[priority];
+        if ((lane._waitCount >= MaxWait) && (lane._depth.load() > 0))
+        {
+            return priority;
+        }
+    }
+    return highest;
+}
+
+template<
+    typename Runnable,
+    typename EventPolicy,
+    typename Lock,
+    size_t LaneCount,
+    size_t MaxWait,
+    typename QueuePolicy,
+    typename Hook>
+Runnable*
+PriorityRunnableExecutor<Runnable, EventPolicy, Lock, LaneCount, MaxWait, QueuePolicy, Hook>::
+    dequeueAny(size_t& priority)
+{
+    for (priority = LaneCount; priority > 0U; --priority)
+    {
+        Runnable* const runnable = _lanes[priority - 1U]._queue.dequeue();
+        if (runnable != nullptr)
+        {
+            --priority;
+            return runnable;
+        }
+    }
+    return nullptr;
+}
+
+template<
+    typename Runnable,
+    typename EventPolicy,
+    typename Lock,
+    size_t LaneCount,
+    size_t MaxWait,
+    typename QueuePolicy,
+    typename Hook>
+void
+PriorityRunnableExecutor<Runnable, EventPolicy, Lock, LaneCount, MaxWait, QueuePolicy, Hook>::
+    handleEvent()
+{
+    while (true)
+    {
+        size_t priority = selectLane();
+        Runnable* const selected
+            = (priority < LaneCount) ? _lanes[priority]._queue.dequeue() : nullptr;
+        // the depth of a lane is updated after enqueuing, so a runnable may be there already
+        Runnable* const runnable = (selected != nullptr) ? selected : dequeueAny(priority);
+        if (runnable == nullptr)
+        {
+            break;
+        }
+        (void)_lanes[priority]._depth.fetch_sub(1);
+        _lanes[priority]._waitCount = 0U;
+        for (size_t lower = 0U; lower < priority; ++lower)
+        {
+            if (_lanes[lower]._depth.load() > 0)
+            {
+                ++_lanes[lower]._waitCount;
+            }
+        }
+        Hook::execute(*runnable);
+    }
+}
+
+} // namespace async
@@ -5,13 +5,23 @@
  */
 #pragma once
 
+#include <etl/atomic.h>
+
 namespace async
 {
+/**
+ * Intrusive link of a node in a Queue or MpscQueue. The link is stored atomically, plain accesses
+ * use relaxed ordering and are meant to be protected by the queue. tryEnqueue() allows claiming
+ * the node without any lock. Copying a node never copies its link state.
+ */
 template<typename T>
 class QueueNode
 {
 public:
     QueueNode();
+    QueueNode(QueueNode const& other);
+
+    QueueNode& operator=(QueueNode const& other);
 
     bool isEnqueued() const;
 
@@ -19,10 +29,19 @@ public:
     void setNext(T* next);
 
     void enqueue();
+
+    /**
+     * Atomically marks the node as enqueued if it isn't enqueued yet.
+     * \return
+     * - true if the node has been marked as enqueued by this call
+     * - false if the node has already been enqueued
+     */
+    bool tryEnqueue();
+
     T* dequeue();
 
 private:
-    T* _next;
+    ::etl::atomic<T*> _next;
 };
 
 /**
@@ -32,36 +51,52 @@ template<typename T>
 inline QueueNode<T>::QueueNode() : _next(reinterpret_cast<T*>(1U))
 {}
 
+template<typename T>
+inline QueueNode<T>::QueueNode(QueueNode const& /* other */) : _next(reinterpret_cast<T*>(1U))
+{}
+
+template<typename T>
+inline QueueNode<T>& QueueNode<T>::operator=(QueueNode const& /* other */)
+{
+    return *this;
+}
+
 template<typename T>
 inline bool QueueNode<T>::isEnqueued() const
 {
-    return _next != reinterpret_cast<T*>(1U);
+    return _next.load(::etl::memory_order_relaxed) != reinterpret_cast<T*>(1U);
 }
 
 template<typename T>
 inline T* QueueNode<T>::getNext() const
 {
-    return _next;
+    return _next.load(::etl::memory_order_relaxed);
 }
 
 template<typename T>
 inline void QueueNode<T>::setNext(T* const next)
 {
-    _next = next;
+    _next.store(next, ::etl::memory_order_relaxed);
 }
 
 template<typename T>
 inline void QueueNode<T>::enqueue()
 {
-    _next = nullptr;
+    _next.store(nullptr, ::etl::memory_order_relaxed);
+}
+
+template<typename T>
+inline bool QueueNode<T>::tryEnqueue()
+{
+    T* expected = reinterpret_cast<T*>(1U);
+    return _next.compare_exchange_strong(
+        expected, nullptr, ::etl::memory_order_acquire, ::etl::memory_order_relaxed);
 }
 
 template<typename T>
 inline T* QueueNode<T>::dequeue()
 {
-    T* const prevNext = _next;
-    _next             = reinterpret_cast<T*>(1U);
-    return prevNext;
+    return _next.exchange(reinterpret_cast<T*>(1U), ::etl::memory_order_release);
 }
 
 } // namespace async
@@ -5,9 +5,8 @@
  */
 #pragma once
 
-#include "async/Queue.h"
-
-#include <platform/config.h>
+#include "async/LockedQueue.h"
+#include "async/RunnableHook.h"
 
 namespace async
 {
@@ -18,8 +17,17 @@ namespace async
  * \tparam Runnable Type of functions, that will be executed.
  * \tparam EventPolicy EventPolicy is derived from EventDispatcher. Method enqueue will set Event,
  * specified in EventPolicy.
+ * \tparam Lock RAII lock protecting the default queue policy.
+ * \tparam QueuePolicy Queue holding the enqueued Runnables, either the LockedQueue or the lock-free
+ * MpscQueue.
+ * \tparam Hook Static hook called for each enqueued and executed Runnable, see RunnableHook.
  */
-template<typename Runnable, typename EventPolicy, typename Lock>
+template<
+    typename Runnable,
+    typename EventPolicy,
+    typename Lock,
+    typename QueuePolicy = LockedQueue<Runnable, Lock>,
+    typename Hook        = RunnableHook>
 class RunnableExecutor
 {
 public:
@@ -39,59 +47,76 @@ public:
 private:
     void handleEvent();
 
-    Queue<Runnable> _queue;
+    QueuePolicy _queue;
     EventPolicy _eventPolicy;
 };
 
 /**
  * Inline implementations.
  */
-template<typename Runnable, typename EventPolicy, typename Lock>
-RunnableExecutor<Runnable, EventPolicy, Lock>::RunnableExecutor(
+template<
+    typename Runnable,
+    typename EventPolicy,
+    typename Lock,
+    typename QueuePolicy,
+    typename Hook>
+RunnableExecutor<Runnable, EventPolicy, Lock, QueuePolicy, Hook>::RunnableExecutor(
     typename EventPolicy::EventDispatcherType& eventDispatcher)
 : _queue(), _eventPolicy(eventDispatcher)
 {}
 
-template<typename Runnable, typename EventPolicy, typename Lock>
-void RunnableExecutor<Runnable, EventPolicy, Lock>::init()
+template<
+    typename Runnable,
+    typename EventPolicy,
+    typename Lock,
+    typename QueuePolicy,
+    typename Hook>
+void RunnableExecutor<Runnable, EventPolicy, Lock, QueuePolicy, Hook>::init()
 {
     _eventPolicy.setEventHandler(
         EventPolicy::HandlerFunctionType::
             template create<RunnableExecutor, &RunnableExecutor::handleEvent>(*this));
 }
 
-template<typename Runnable, typename EventPolicy, typename Lock>
-void RunnableExecutor<Runnable, EventPolicy, Lock>::shutdown()
+template<
+    typename Runnable,
+    typename EventPolicy,
+    typename Lock,
+    typename QueuePolicy,
+    typename Hook>
+void RunnableExecutor<Runnable, EventPolicy, Lock, QueuePolicy, Hook>::shutdown()
 {
     _eventPolicy.removeEventHandler();
 }
 
-template<typename Runnable, typename EventPolicy, typename Lock>
-inline void RunnableExecutor<Runnable, EventPolicy, Lock>::enqueue(Runnable& runnable)
+template<
+    typename Runnable,
+    typename EventPolicy,
+    typename Lock,
+    typename QueuePolicy,
+    typename Hook>
+inline void
+RunnableExecutor<Runnable, EventPolicy, Lock, QueuePolicy, Hook>::enqueue(Runnable& runnable)
 {
-    {
-        ESR_UNUSED const Lock lock;
-        if (!runnable.isEnqueued())
-        {
-            _queue.enqueue(runnable);
-        }
-    }
+    Hook::enqueue(runnable);
+    (void)_queue.enqueue(runnable);
     _eventPolicy.setEvent();
 }
 
-template<typename Runnable, typename EventPolicy, typename Lock>
-void RunnableExecutor<Runnable, EventPolicy, Lock>::handleEvent()
+template<
+    typename Runnable,
+    typename EventPolicy,
+    typename Lock,
+    typename QueuePolicy,
+    typename Hook>
+void RunnableExecutor<Runnable, EventPolicy, Lock, QueuePolicy, Hook>::handleEvent()
 {
     while (true)
     {
-        Runnable* runnable;
-        {
-            ESR_UNUSED const Lock lock;
-            runnable = _queue.dequeue();
-        }
+        Runnable* const runnable = _queue.dequeue();
         if (runnable != nullptr)
         {
-            runnable->execute();
+            Hook::execute(*runnable);
         }
         else
         {
@@ -0,0 +1,103 @@
+// Copyright 2025 Accenture.
+
+/**
+ * \ingroup async
+ */
+#pragma once
+
+#include <etl/singleton_base.h>
+
+namespace async
+{
+/**
+ * Default hook of the runnable executors, executing runnables without any instrumentation.
+ *
+ * A hook is called by an executor for each runnable that is enqueued and executed. It's also used
+ * for runnables executed on expiry of a timeout. A custom hook has to provide the same static
+ * functions, e.g. to measure the execution time of each runnable.
+ */
+struct RunnableHook
+{
+    /**
+     * Called before a runnable is placed in the queue of an executor.
+     * \param runnable Runnable to be enqueued
+     */
+    template<class Runnable>
+    static void enqueue(Runnable& /* runnable */)
+    {}
+
+    /**
+     * Called to execute a runnable that has been dequeued by an executor.
+     * \param runnable Runnable to execute
+     */
+    template<class Runnable>
+    static void execute(Runnable& runnable)
+    {
+        runnable.execute();
+    }
+
+    /**
+     * Called to execute the runnable of an expired timeout.
+     * \param runnable Runnable to execute
+     * \param timeout Expired timeout, a cyclic timeout has been rescheduled already
+     */
+    template<class Runnable, class Timeout>
+    static void expire(Runnable& runnable, Timeout const& /* timeout */)
+    {
+        runnable.execute();
+    }
+};
+
+/**
+ * A runnable hook forwarding all calls to the singleton instance of a monitor class with
+ * corresponding member functions.
+ *
+ * \tparam T The monitor type providing enqueue(), execute() and expire().
+ */
+template<class T>
+class StaticRunnableHook : public ::etl::singleton_base<T>
+{
+public:
+    using InstanceType = T;
+
+    explicit StaticRunnableHook(T& instance);
+
+    template<class Runnable>
+    static void enqueue(Runnable& runnable);
+
+    template<class Runnable>
+    static void execute(Runnable& runnable);
+
+    template<class Runnable, class Timeout>
+    static void expire(Runnable& runnable, Timeout const& timeout);
+};
+
+/**
+ * Inline implementations.
+ */
+template<class T>
+StaticRunnableHook<T>::StaticRunnableHook(T& instance) : ::etl::singleton_base<T>(instance)
+{}
+
+template<class T>
+template<class Runnable>
+inline void StaticRunnableHook<T>::enqueue(Runnable& runnable)
+{
+    ::etl::singleton_base<T>::instance().enqueue(runnable);
+}
+
+template<class T>
+template<class Runnable>
+inline void StaticRunnableHook<T>::execute(Runnable& runnable)
+{
+    ::etl::singleton_base<T>::instance().execute(runnable);
+}
+
+template<class T>
+template<class Runnable, class Timeout>
+inline void StaticRunnableHook<T>::expire(Runnable& runnable, Timeout const& timeout)
+{
+    ::etl::singleton_base<T>::instance().expire(runnable, timeout);
+}
+
+} // namespace async
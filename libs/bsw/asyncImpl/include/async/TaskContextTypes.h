@@ -0,0 +1,153 @@
+// Copyright 2025 Accenture.
+
+/**
+ * \ingroup async
+ */
+#pragma once
+
+#include "async/LockedQueue.h"
+#include "async/MpscQueue.h"
+#include "async/PriorityRunnableExecutor.h"
+#include "async/RunnableExecutor.h"
+#include "async/RunnableHook.h"
+#include "async/Types.h"
+
+#include <timer/Timer.h>
+#include <timer/TimingWheelTimer.h>
+
+namespace async
+{
+namespace internal
+{
+/**
+ * Selects the timer of a task context, the TimingWheelTimer if ASYNC_CONFIG_TIMING_WHEEL is
+ * enabled and the Timer otherwise.
+ */
+template<bool UseTimingWheel = (ASYNC_CONFIG_TIMING_WHEEL != 0)>
+struct TaskContextTimer
+{
+    using Type = ::timer::TimingWheelTimer<LockType>;
+};
+
+template<>
+struct TaskContextTimer<false>
+{
+    using Type = ::timer::Timer<LockType>;
+};
+
+/**
+ * Selects the queue of the runnable executor of a task context, the MpscQueue if
+ * ASYNC_CONFIG_LOCK_FREE_QUEUE is enabled and the LockedQueue otherwise.
+ */
+template<bool LockFree = (ASYNC_CONFIG_LOCK_FREE_QUEUE != 0)>
+struct TaskContextQueue
+{
+    using Type = MpscQueue<RunnableType>;
+};
+
+template<>
+struct TaskContextQueue<false>
+{
+    using Type = LockedQueue<RunnableType, LockType>;
+};
+
+/**
+ * Selects the hook of the runnable executor of a task context, the RunnableHookType of the
+ * binding if ASYNC_CONFIG_RUNNABLE_MONITOR is enabled and the RunnableHook otherwise.
+ */
+template<class Binding, bool UseMonitor = (ASYNC_CONFIG_RUNNABLE_MONITOR != 0)>
+struct TaskContextRunnableHook
+{
+    /**
+     * Forwards to the RunnableHookType of the async binding. The adapter is incomplete when
+     * the task context is instantiated, so the hook type is resolved on first use.
+     */
+    struct Type
+    {
+        template<class Runnable>
+        static void enqueue(Runnable& runnable)
+        {
+            Binding::BindingType::RunnableHookType::enqueue(runnable);
+        }
+
+        template<class Runnable>
+        static void execute(Runnable& runnable)
+        {
+            Binding::BindingType::RunnableHookType::execute(runnable);
+        }
+
+        template<class Runnable, class Timeout>
+        static void expire(Runnable& runnable, Timeout const& timeout)
+        {
+            Binding::BindingType::RunnableHookType::expire(runnable, timeout);
+        }
+    };
+};
+
+template<class Binding>
+struct TaskContextRunnableHook<Binding, false>
+{
+    using Type = RunnableHook;
+};
+
+/**
+ * Selects the runnable executor of a task context, the PriorityRunnableExecutor with
+ * ASYNC_CONFIG_PRIORITY_LANES lanes and the RunnableExecutor if there is only one lane. The
+ * static functions forward the lane specific calls of the task context to the executor.
+ */
+template<
+    class EventPolicy,
+    class Hook,
+    size_t LaneCount = static_cast<size_t>(ASYNC_CONFIG_PRIORITY_LANES)>
+struct TaskContextRunnableExecutor
+{
+    using Type = PriorityRunnableExecutor<
+        RunnableType,
+        EventPolicy,
+        LockType,
+        LaneCount,
+        static_cast<size_t>(ASYNC_CONFIG_PRIORITY_LANE_STARVATION_LIMIT),
+        typename TaskContextQueue<>::Type,
+        Hook>;
+
+    static void enqueue(Type& executor, RunnableType& runnable, size_t const priority)
+    {
+        executor.enqueue(runnable, priority);
+    }
+
+    static RunnableLaneStatistics getLaneStatistics(Type const& executor, size_t const priority)
+    {
+        return executor.getLaneStatistics(priority);
+    }
+
+    static void resetLaneStatistics(Type& executor) { executor.resetLaneStatistics(); }
+};
+
+template<class EventPolicy, class Hook>
+struct TaskContextRunnableExecutor<EventPolicy, Hook, 1U>
+{
+    using Type = RunnableExecutor<
+        RunnableType,
+        EventPolicy,
+        LockType,
+        typename TaskContextQueue<>::Type,
+        Hook>;
+
+    static void enqueue(Type& executor, RunnableType& runnable, size_t /* priority */)
+    {
+        executor.enqueue(runnable);
+    }
+
+    /**
+     * The RunnableExecutor doesn't collect statistics, so all values are zero.
+     */
+    static RunnableLaneStatistics
+    getLaneStatistics(Type const& /* executor */, size_t /* priority */)
+    {
+        return RunnableLaneStatistics{0U, 0U, 0U};
+    }
+
+    static void resetLaneStatistics(Type& /* executor */) {}
+};
+} // namespace internal
+} // namespace async
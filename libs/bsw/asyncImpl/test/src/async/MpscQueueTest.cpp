@@ -0,0 +1,118 @@
+// Copyright 2025 Accenture.
+
+#include "async/MpscQueue.h"
+
+#include "async/QueueNode.h"
+
+#include <gmock/gmock.h>
+
+#include <thread>
+#include <vector>
+
+namespace
+{
+using namespace ::async;
+using namespace ::testing;
+
+class TestNode : public QueueNode<TestNode>
+{
+public:
+    size_t _producer = 0U;
+    size_t _sequence = 0U;
+};
+
+TEST(MpscQueueTest, testAll)
+{
+    MpscQueue<TestNode> cut;
+    TestNode node1;
+    TestNode node2;
+    TestNode node3;
+    {
+        // expect empty queue on beginning
+        EXPECT_TRUE(cut.dequeue() == nullptr);
+    }
+    {
+        // enqueue single node and expect it to be returned on dequeue
+        EXPECT_TRUE(cut.enqueue(node1));
+        EXPECT_TRUE(node1.isEnqueued());
+        EXPECT_EQ(&node1, cut.dequeue());
+        EXPECT_FALSE(node1.isEnqueued());
+        EXPECT_TRUE(cut.dequeue() == nullptr);
+    }
+    {
+        // enqueue multiple nodes and expect them to be dequeued in enqueue order
+        EXPECT_TRUE(cut.enqueue(node1));
+        EXPECT_TRUE(cut.enqueue(node2));
+        EXPECT_TRUE(cut.enqueue(node3));
+        EXPECT_EQ(&node1, cut.dequeue());
+        EXPECT_EQ(&node2, cut.dequeue());
+        EXPECT_EQ(&node3, cut.dequeue());
+        EXPECT_TRUE(cut.dequeue() == nullptr);
+    }
+    {
+        // expect node not to be enqueued twice
+        EXPECT_TRUE(cut.enqueue(node1));
+        EXPECT_TRUE(cut.enqueue(node2));
+        EXPECT_FALSE(cut.enqueue(node1));
+        EXPECT_EQ(&node1, cut.dequeue());
+        EXPECT_EQ(&node2, cut.dequeue());
+        EXPECT_TRUE(cut.dequeue() == nullptr);
+    }
+    {
+        // expect order to be kept if nodes are enqueued while dequeuing
+        EXPECT_TRUE(cut.enqueue(node1));
+        EXPECT_TRUE(cut.enqueue(node2));
+        EXPECT_EQ(&node1, cut.dequeue());
+        EXPECT_TRUE(cut.enqueue(node3));
+        EXPECT_TRUE(cut.enqueue(node1));
+        EXPECT_EQ(&node2, cut.dequeue());
+        EXPECT_EQ(&node3, cut.dequeue());
+        EXPECT_EQ(&node1, cut.dequeue());
+        EXPECT_TRUE(cut.dequeue() == nullptr);
+    }
+}
+
+TEST(MpscQueueTest, testConcurrentProducers)
+{
+    static size_t const PRODUCER_COUNT = 4U;
+    static size_t const NODE_COUNT     = 1000U;
+
+    MpscQueue<TestNode> cut;
+    std::vector<TestNode> nodes(PRODUCER_COUNT * NODE_COUNT);
+    std::vector<std::thread> producers;
+    for (size_t producer = 0U; producer < PRODUCER_COUNT; ++producer)
+    {
+        producers.emplace_back(
+            [&cut, &nodes, producer]()
+            {
+                for (size_t i = 0U; i < NODE_COUNT; ++i)
+                {
+                    TestNode& node = nodes[(producer * NODE_COUNT) + i];
+                    node._producer = producer;
+                    node._sequence = i;
+                    EXPECT_TRUE(cut.enqueue(node));
+                }
+            });
+    }
+
+    // expect every node exactly once and the nodes of each producer in order
+    std::vector<size_t> nextSequence(PRODUCER_COUNT, 0U);
+    size_t received = 0U;
+    while (received < nodes.size())
+    {
+        TestNode* const node = cut.dequeue();
+        if (node != nullptr)
+        {
+            ASSERT_EQ(nextSequence[node->_producer], node->_sequence);
+            ++nextSequence[node->_producer];
+            ++received;
+        }
+    }
+    for (auto& producer : producers)
+    {
+        producer.join();
+    }
+    EXPECT_TRUE(cut.dequeue() == nullptr);
+}
+
+} // namespace
@@ -0,0 +1,218 @@
+// Copyright 2025 Accenture.
+
+#include "async/PriorityRunnableExecutor.h"
+
+#include "async/EventPolicy.h"
+#include "async/IRunnable.h"
+#include "async/MpscQueue.h"
+
+#include <etl/delegate.h>
+#include <etl/vector.h>
+
+#include <gmock/gmock.h>
+
+namespace
+{
+using namespace ::async;
+using namespace ::testing;
+
+using StepsType = ::etl::vector<uint32_t, 32U>;
+
+class StepRunnable : public IRunnable
+{
+public:
+    StepRunnable(StepsType& steps, uint32_t const step) : _steps(steps), _step(step) {}
+
+    void execute() override
+    {
+        _steps.push_back(_step);
+        if (_onExecute.is_valid())
+        {
+            _onExecute();
+        }
+    }
+
+    ::etl::delegate<void()> _onExecute;
+
+private:
+    StepsType& _steps;
+    uint32_t _step;
+};
+
+class PriorityRunnableExecutorTest : public Test
+{
+public:
+    using HandlerFunctionType = ::etl::delegate<void()>;
+
+    MOCK_METHOD(void, setEventHandler, (size_t event, HandlerFunctionType handlerFunction));
+    MOCK_METHOD(void, removeEventHandler, (size_t event));
+    MOCK_METHOD(void, setEvents, (EventMaskType events));
+
+protected:
+    StepsType _steps;
+};
+
+struct TestLock
+{
+    TestLock() {}
+
+    ~TestLock() {}
+};
+
+using ExecutorType = PriorityRunnableExecutor<
+    IRunnable,
+    EventPolicy<PriorityRunnableExecutorTest, 1>,
+    TestLock,
+    3U,
+    2U>;
+
+/**
+ * \desc
+ * Runnables of higher lanes are executed first, runnables of the same lane in enqueue order.
+ */
+TEST_F(PriorityRunnableExecutorTest, testHigherLanesAreExecutedFirst)
+{
+    ExecutorType cut(*this);
+    HandlerFunctionType eventHandler;
+    EXPECT_CALL(*this, setEventHandler(1U, _)).WillOnce(SaveArg<1>(&eventHandler));
+    cut.init();
+    Mock::VerifyAndClearExpectations(this);
+
+    StepRunnable low1(_steps, 1U);
+    StepRunnable low2(_steps, 2U);
+    StepRunnable mid(_steps, 3U);
+    StepRunnable high(_steps, 4U);
+    EXPECT_CALL(*this, setEvents(1U << 1U)).Times(4);
+    cut.enqueue(low1);
+    cut.enqueue(mid, 1U);
+    // priorities beyond the highest lane are limited
+    cut.enqueue(high, 7U);
+    cut.enqueue(low2, 0U);
+    Mock::VerifyAndClearExpectations(this);
+
+    eventHandler();
+    EXPECT_THAT(_steps, ElementsAre(4U, 3U, 1U, 2U));
+
+    // expect nothing to be executed on handle event
+    eventHandler();
+    EXPECT_EQ(4U, _steps.size());
+
+    EXPECT_CALL(*this, removeEventHandler(1U));
+    cut.shutdown();
+}
+
+/**
+ * \desc
+ * A runnable of a higher lane that is enqueued while executing overtakes waiting runnables of
+ * lower lanes, but only until the starvation limit of the lower lanes has been reached.
+ */
+TEST_F(PriorityRunnableExecutorTest, testStarvationOfLowerLanesIsBounded)
+{
+    ExecutorType cut(*this);
+    HandlerFunctionType eventHandler;
+    EXPECT_CALL(*this, setEventHandler(1U, _)).WillOnce(SaveArg<1>(&eventHandler));
+    cut.init();
+    EXPECT_CALL(*this, setEvents(_)).Times(AnyNumber());
+
+    StepRunnable low(_steps, 1U);
+    StepRunnable mid(_steps, 2U);
+    StepRunnable high(_steps, 3U);
+    uint32_t remaining = 6U;
+    auto const reenqueue = [&cut, &high, &remaining]()
+    {
+        if (remaining > 0U)
+        {
+            --remaining;
+            cut.enqueue(high, 2U);
+        }
+    };
+    high._onExecute = HandlerFunctionType::create(reenqueue);
+    cut.enqueue(low, 0U);
+    cut.enqueue(mid, 1U);
+    cut.enqueue(high, 2U);
+
+    eventHandler();
+    EXPECT_THAT(_steps, ElementsAre(3U, 3U, 1U, 2U, 3U, 3U, 3U, 3U, 3U));
+}
+
+/**
+ * \desc
+ * A runnable that is already waiting keeps its lane if it is enqueued again with a higher
+ * priority, it's neither promoted nor executed twice.
+ */
+TEST_F(PriorityRunnableExecutorTest, testWaitingRunnableKeepsItsLane)
+{
+    ExecutorType cut(*this);
+    HandlerFunctionType eventHandler;
+    EXPECT_CALL(*this, setEventHandler(1U, _)).WillOnce(SaveArg<1>(&eventHandler));
+    cut.init();
+    EXPECT_CALL(*this, setEvents(1U << 1U)).Times(3);
+
+    StepRunnable low(_steps, 1U);
+    StepRunnable mid(_steps, 2U);
+    cut.enqueue(low, 0U);
+    cut.enqueue(mid, 1U);
+    cut.enqueue(low, 2U);
+
+    eventHandler();
+    EXPECT_THAT(_steps, ElementsAre(2U, 1U));
+    EXPECT_EQ(0U, cut.getLaneStatistics(2U)._enqueueCount);
+}
+
+/**
+ * \desc
+ * The queue depth of each lane is tracked, including its maximum and the number of enqueued
+ * runnables. A runnable that is already enqueued isn't counted twice.
+ */
+TEST_F(PriorityRunnableExecutorTest, testLaneStatistics)
+{
+    PriorityRunnableExecutor<
+        IRunnable,
+        EventPolicy<PriorityRunnableExecutorTest, 1>,
+        TestLock,
+        2U,
+        8U,
+        MpscQueue<IRunnable>>
+        cut(*this);
+    HandlerFunctionType eventHandler;
+    EXPECT_CALL(*this, setEventHandler(1U, _)).WillOnce(SaveArg<1>(&eventHandler));
+    cut.init();
+    EXPECT_CALL(*this, setEvents(_)).Times(AnyNumber());
+
+    StepRunnable runnable1(_steps, 1U);
+    StepRunnable runnable2(_steps, 2U);
+    StepRunnable runnable3(_steps, 3U);
+    cut.enqueue(runnable1, 1U);
+    cut.enqueue(runnable2, 1U);
+    cut.enqueue(runnable1, 1U);
+    cut.enqueue(runnable3, 0U);
+
+    RunnableLaneStatistics statistics = cut.getLaneStatistics(1U);
+    EXPECT_EQ(2U, statistics._depth);
+    EXPECT_EQ(2U, statistics._maxDepth);
+    EXPECT_EQ(2U, statistics._enqueueCount);
+    statistics = cut.getLaneStatistics(0U);
+    EXPECT_EQ(1U, statistics._depth);
+    EXPECT_EQ(1U, statistics._maxDepth);
+    EXPECT_EQ(1U, statistics._enqueueCount);
+
+    eventHandler();
+    EXPECT_THAT(_steps, ElementsAre(1U, 2U, 3U));
+    statistics = cut.getLaneStatistics(1U);
+    EXPECT_EQ(0U, statistics._depth);
+    EXPECT_EQ(2U, statistics._maxDepth);
+    EXPECT_EQ(2U, statistics._enqueueCount);
+
+    cut.enqueue(runnable2, 1U);
+    cut.resetLaneStatistics();
+    statistics = cut.getLaneStatistics(1U);
+    EXPECT_EQ(1U, statistics._depth);
+    EXPECT_EQ(1U, statistics._maxDepth);
+    EXPECT_EQ(0U, statistics._enqueueCount);
+    statistics = cut.getLaneStatistics(0U);
+    EXPECT_EQ(0U, statistics._depth);
+    EXPECT_EQ(0U, statistics._maxDepth);
+    EXPECT_EQ(0U, statistics._enqueueCount);
+}
+
+} // namespace
@@ -52,6 +52,28 @@ TEST(QueueNodeTest, testAll)
         EXPECT_EQ(&next, cut.dequeue());
         EXPECT_FALSE(cut.isEnqueued());
     }
+    {
+        // expect node to be claimed only once
+        EXPECT_TRUE(cut.tryEnqueue());
+        EXPECT_TRUE(cut.isEnqueued());
+        EXPECT_TRUE(cut.getNext() == 0L);
+        EXPECT_FALSE(cut.tryEnqueue());
+        EXPECT_EQ(0L, cut.dequeue());
+        EXPECT_TRUE(cut.tryEnqueue());
+        EXPECT_EQ(0L, cut.dequeue());
+    }
+    {
+        // expect link state not to be copied
+        cut.enqueue();
+        TestNode copy(cut);
+        EXPECT_FALSE(copy.isEnqueued());
+        copy = cut;
+        EXPECT_FALSE(copy.isEnqueued());
+        TestNode other;
+        cut = other;
+        EXPECT_TRUE(cut.isEnqueued());
+        EXPECT_EQ(0L, cut.dequeue());
+    }
 }
 
 } // namespace
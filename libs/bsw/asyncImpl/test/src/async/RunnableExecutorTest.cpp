@@ -3,6 +3,7 @@
 #include "async/RunnableExecutor.h"
 
 #include "async/EventPolicy.h"
+#include "async/MpscQueue.h"
 #include "async/QueueNode.h"
 #include "async/RunnableMock.h"
 
@@ -37,6 +38,23 @@ struct TestLock
     ~TestLock() {}
 };
 
+struct TestHook
+{
+    static void enqueue(IRunnable& runnable) { _enqueued = &runnable; }
+
+    static void execute(IRunnable& runnable)
+    {
+        ++_executeCount;
+        runnable.execute();
+    }
+
+    static IRunnable* _enqueued;
+    static size_t _executeCount;
+};
+
+IRunnable* TestHook::_enqueued  = nullptr;
+size_t TestHook::_executeCount = 0U;
+
 TEST_F(RunnableExecutorTest, testAll)
 {
     RunnableExecutor<IRunnable, EventPolicy<RunnableExecutorTest, 2>, TestLock> cut(*this);
@@ -88,4 +106,73 @@ TEST_F(RunnableExecutorTest, testAll)
     }
 }
 
+TEST_F(RunnableExecutorTest, testLockFreeQueuePolicy)
+{
+    RunnableExecutor<
+        IRunnable,
+        EventPolicy<RunnableExecutorTest, 1>,
+        TestLock,
+        MpscQueue<IRunnable>>
+        cut(*this);
+    HandlerFunctionType eventHandler;
+    EXPECT_CALL(*this, setEventHandler(1U, _)).WillOnce(SaveArg<1>(&eventHandler));
+    cut.init();
+    Mock::VerifyAndClearExpectations(this);
+
+    {
+        // expect event to be set on each added runnable, even if it is already enqueued
+        EXPECT_CALL(*this, setEvents(1U << 1U)).Times(4);
+        cut.enqueue(_runnableMock1);
+        cut.enqueue(_runnableMock2);
+        cut.enqueue(_runnableMock1);
+        cut.enqueue(_runnableMock3);
+        Mock::VerifyAndClearExpectations(this);
+    }
+    {
+        // expect each runnable to be executed once in enqueue order, a runnable enqueued while
+        // executing is executed again
+        Sequence seq;
+        EXPECT_CALL(_runnableMock1, execute()).InSequence(seq);
+        EXPECT_CALL(_runnableMock2, execute())
+            .InSequence(seq)
+            .WillOnce(Invoke([&cut, this]() { cut.enqueue(_runnableMock2); }));
+        EXPECT_CALL(_runnableMock3, execute()).InSequence(seq);
+        EXPECT_CALL(_runnableMock2, execute()).InSequence(seq);
+        EXPECT_CALL(*this, setEvents(1U << 1U));
+        eventHandler();
+        Mock::VerifyAndClearExpectations(this);
+    }
+    {
+        // expect nothing to be executed on handle event
+        eventHandler();
+    }
+    EXPECT_CALL(*this, removeEventHandler(1U));
+    cut.shutdown();
+}
+
+TEST_F(RunnableExecutorTest, testHook)
+{
+    RunnableExecutor<
+        IRunnable,
+        EventPolicy<RunnableExecutorTest, 1>,
+        TestLock,
+        LockedQueue<IRunnable, TestLock>,
+        TestHook>
+        cut(*this);
+    HandlerFunctionType eventHandler;
+    EXPECT_CALL(*this, setEventHandler(1U, _)).WillOnce(SaveArg<1>(&eventHandler));
+    cut.init();
+    EXPECT_CALL(*this, setEvents(1U << 1U)).Times(2);
+
+    // expect the hook to be called for each enqueued and executed runnable
+    cut.enqueue(_runnableMock1);
+    EXPECT_EQ(&_runnableMock1, TestHook::_enqueued);
+    cut.enqueue(_runnableMock2);
+    EXPECT_EQ(&_runnableMock2, TestHook::_enqueued);
+    EXPECT_CALL(_runnableMock1, execute());
+    EXPECT_CALL(_runnableMock2, execute());
+    eventHandler();
+    EXPECT_EQ(2U, TestHook::_executeCount);
+}
+
 } // namespace
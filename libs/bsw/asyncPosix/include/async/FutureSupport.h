@@ -0,0 +1,33 @@
+// Copyright 2025 Accenture.
+
+/**
+ * \ingroup async
+ */
+#pragma once
+
+#include <async/Types.h>
+#include <util/concurrent/IFutureSupport.h>
+
+#include <condition_variable>
+#include <mutex>
+
+namespace async
+{
+class FutureSupport : public ::os::IFutureSupport
+{
+public:
+    explicit FutureSupport(ContextType context);
+
+    void wait() override;
+    void notify() override;
+    void assertTaskContext() override;
+    bool verifyTaskContext() override;
+
+private:
+    ContextType _context;
+    ::std::mutex _mutex;
+    ::std::condition_variable _condition;
+    bool _isNotified;
+};
+
+} // namespace async
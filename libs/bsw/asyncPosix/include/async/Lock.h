@@ -0,0 +1,50 @@
+// Copyright 2025 Accenture.
+
+/**
+ * \ingroup async
+ */
+#pragma once
+
+#include <mutex>
+
+namespace async
+{
+namespace internal
+{
+/**
+ * Returns the process wide mutex that protects all secure sections. It is recursive because
+ * secure sections may be nested, e.g. cancelling a timeout locks both in the adapter and the timer.
+ */
+inline ::std::recursive_mutex& getLockMutex()
+{
+    static ::std::recursive_mutex mutex;
+    return mutex;
+}
+} // namespace internal
+
+/**
+ * A synchronization mechanism that blocks threads from accessing a resource.
+ *
+ * The Lock class ensures mutual exclusion, allowing only one thread to access a
+ * protected resource or function at a time. When a thread acquires the lock,
+ * any other thread attempting to acquire it is blocked until the lock is released.
+ * The lock is automatically released in the destructor (RAII idiom).
+ *
+ * All locks share a single recursive mutex, so a Lock protects a resource against all
+ * other contexts, just like suspending all interrupts on a single core target does.
+ */
+class Lock
+{
+public:
+    Lock();
+    ~Lock();
+};
+
+/**
+ * Inline implementations.
+ */
+inline Lock::Lock() { internal::getLockMutex().lock(); }
+
+inline Lock::~Lock() { internal::getLockMutex().unlock(); }
+
+} // namespace async
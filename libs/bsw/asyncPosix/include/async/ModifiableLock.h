@@ -0,0 +1,67 @@
+// Copyright 2025 Accenture.
+
+/**
+ * \ingroup async
+ */
+#pragma once
+
+#include "async/Lock.h"
+
+namespace async
+{
+/**
+ * A synchronization mechanism that blocks threads from accessing a resource.
+ *
+ * The `ModifiableLock` class ensures mutual exclusion,
+ * allowing only one thread to access a protected
+ * resource or function at a time. When a thread acquires the lock,
+ * any other thread attempting to acquire it is blocked until the lock is released.
+ * The lock can be acquired either in the constructor or on demand using the `lock` function.
+ * Similarly, the lock can be released either in the destructor or on demand using the `unlock`
+ * function. It shares its mutex with `Lock`.
+ */
+class ModifiableLock final
+{
+public:
+    ModifiableLock();
+    ~ModifiableLock();
+
+    void unlock();
+    void lock();
+
+private:
+    bool _isLocked;
+};
+
+/**
+ * Inline implementations.
+ */
+inline ModifiableLock::ModifiableLock() : _isLocked(true) { internal::getLockMutex().lock(); }
+
+inline ModifiableLock::~ModifiableLock()
+{
+    if (_isLocked)
+    {
+        internal::getLockMutex().unlock();
+    }
+}
+
+inline void ModifiableLock::unlock()
+{
+    if (_isLocked)
+    {
+        internal::getLockMutex().unlock();
+        _isLocked = false;
+    }
+}
+
+inline void ModifiableLock::lock()
+{
+    if (!_isLocked)
+    {
+        internal::getLockMutex().lock();
+        _isLocked = true;
+    }
+}
+
+} // namespace async
@@ -0,0 +1,290 @@
+// Copyright 2025 Accenture.
+
+/**
+ * \ingroup async
+ */
+#pragma once
+
+#include "PosixConfig.h"
+#include "async/TaskContext.h"
+#include "async/TaskInitializer.h"
+
+#include <etl/array.h>
+#include <etl/delegate.h>
+#include <etl/error_handler.h>
+
+namespace async
+{
+/**
+ * Adapter class running each task on a native POSIX thread.
+ *
+ * The `PosixAdapter` class serves as a centralized interface for managing tasks(threads), timers,
+ * and scheduling functionalities on a host system without an RTOS simulation. Each context has
+ * its own `TaskContext` with a dedicated `std::thread`, so contexts are executed in parallel
+ * on all available cores. The thread calling `run()` becomes the idle task.
+ *
+ * \tparam Binding The binding type specifying application-specific configurations.
+ */
+template<class Binding>
+class PosixAdapter
+{
+public:
+    static size_t const TASK_COUNT             = Binding::TASK_COUNT;
+    static size_t const OS_TASK_COUNT          = TASK_COUNT + 1U;
+    static size_t const WAIT_EVENTS_TICK_COUNT = Binding::WAIT_EVENTS_TICK_COUNT;
+    static ContextType const TASK_IDLE         = 0U;
+    static ContextType const TASK_TIMER        = static_cast<ContextType>(TASK_COUNT);
+
+    using BindingType = Binding;
+    using AdapterType = PosixAdapter<Binding>;
+
+    using TaskContextType        = TaskContext<AdapterType>;
+    using TaskFunctionType       = typename TaskContextType::TaskFunctionType;
+    using StaticTaskFunctionType = typename TaskContextType::StaticTaskFunctionType;
+
+    /// Native threads don't support any task configuration.
+    struct TaskConfigType
+    {};
+
+    using StartAppFunctionType = ::etl::delegate<void()>;
+
+    template<size_t StackSize>
+    using Stack           = internal::Stack<StackSize>;
+    using TaskInitializer = internal::TaskInitializer<AdapterType>;
+
+    template<size_t StackSize = 0U>
+    using IdleTask = internal::IdleTask<AdapterType, StackSize>;
+    template<size_t StackSize = 0U>
+    using TimerTask = internal::TimerTask<AdapterType, StackSize>;
+    template<ContextType Context, size_t StackSize = 0U>
+    using Task = internal::Task<AdapterType, Context, StackSize>;
+    template<ContextType Context>
+    using TaskStack = internal::Task<AdapterType, Context>;
+
+    /// Struct representing the stack usage for a specific task.
+    struct StackUsage
+    {
+        StackUsage();
+
+        uint32_t _stackSize;
+        uint32_t _usedSize;
+    };
+
+public:
+    static char const* getTaskName(size_t taskIdx);
+
+    static ContextType getCurrentTaskContext();
+
+    /**
+     * Initializes all declared tasks, calls the startApp function within the idle context and
+     * starts one thread per task. The calling thread then runs the idle task until stop() is
+     * called. All other threads are stopped and joined before this function returns.
+     * \param startApp function to call before the threads are started
+     */
+    static void run(StartAppFunctionType startApp);
+
+    /**
+     * Stops dispatching in all tasks. May be called from any context.
+     */
+    static void stop();
+
+    static bool getStackUsage(size_t taskIdx, StackUsage& stackUsage);
+
+    static bool
+    getLaneStatistics(size_t taskIdx, size_t priority, RunnableLaneStatistics& statistics);
+
+    static void callIdleTaskFunction();
+
+    static void execute(ContextType context, RunnableType& runnable);
+    static void execute(ContextType context, RunnableType& runnable, size_t priority);
+
+    static void schedule(
+        ContextType context,
+        RunnableType& runnable,
+        TimeoutType& timeout,
+        uint32_t delay,
+        TimeUnitType unit);
+
+    static void scheduleAtFixedRate(
+        ContextType context,
+        RunnableType& runnable,
+        TimeoutType& timeout,
+        uint32_t delay,
+        TimeUnitType unit);
+
+    static void cancel(TimeoutType& timeout);
+
+private:
+    friend struct internal::TaskInitializer<AdapterType>;
+
+    static void initTask(TaskInitializer& initializer);
+
+    static void staticTaskFunction(ContextType context);
+
+    static StartAppFunctionType _startApp;
+    static ::etl::array<TaskContextType, OS_TASK_COUNT> _taskContexts;
+    static thread_local ContextType _currentContext;
+};
+
+/**
+ * Inline implementations.
+ */
+template<class Binding>
+typename PosixAdapter<Binding>::StartAppFunctionType PosixAdapter<Binding>::_startApp;
+template<class Binding>
+::etl::array<typename PosixAdapter<Binding>::TaskContextType, PosixAdapter<Binding>::OS_TASK_COUNT>
+    PosixAdapter<Binding>::_taskContexts;
+template<class Binding>
+thread_local ContextType PosixAdapter<Binding>::_currentContext = CONTEXT_INVALID;
+
+template<class Binding>
+inline char const* PosixAdapter<Binding>::getTaskName(size_t taskIdx)
+{
+    return _taskContexts[taskIdx].getName();
+}
+
+template<class Binding>
+inline ContextType PosixAdapter<Binding>::getCurrentTaskContext()
+{
+    return _currentContext;
+}
+
+template<class Binding>
+void PosixAdapter<Binding>::initTask(TaskInitializer& initializer)
+{
+    ContextType const context = initializer._context;
+    _taskContexts[static_cast<size_t>(context)].createTask(
+        context, initializer._name, initializer._taskFunction, staticTaskFunction);
+}
+
+template<class Binding>
+void PosixAdapter<Binding>::run(StartAppFunctionType startApp)
+{
+    ETL_ASSERT(startApp.is_valid(), ETL_ERROR_GENERIC("startApp function must be valid"));
+    _startApp = startApp;
+    for (size_t i = 0U; i < OS_TASK_COUNT; ++i)
+    {
+        // contexts without a declared task are dispatched by a thread as well
+        _taskContexts[i].createTask(
+            static_cast<ContextType>(i), nullptr, TaskFunctionType(), staticTaskFunction);
+    }
+    TaskInitializer::run();
+
+    _currentContext = TASK_IDLE;
+    _startApp();
+    for (size_t i = TASK_IDLE + 1U; i < OS_TASK_COUNT; ++i)
+    {
+        _taskContexts[i].startTask();
+    }
+    _taskContexts[TASK_IDLE].callTaskFunction();
+
+    // stop() has been called for all tasks, just wait for them to finish
+    for (size_t i = TASK_IDLE + 1U; i < OS_TASK_COUNT; ++i)
+    {
+        _taskContexts[i].joinTask();
+    }
+    _currentContext = CONTEXT_INVALID;
+}
+
+template<class Binding>
+void PosixAdapter<Binding>::stop()
+{
+    for (auto& taskContext : _taskContexts)
+    {
+        taskContext.stopDispatch();
+    }
+}
+
+template<class Binding>
+bool PosixAdapter<Binding>::getStackUsage(size_t const taskIdx, StackUsage& stackUsage)
+{
+    if (taskIdx < OS_TASK_COUNT)
+    {
+        // native threads allocate their stacks on their own, no information available
+        stackUsage._stackSize = 0U;
+        stackUsage._usedSize  = 0U;
+        return true;
+    }
+
+    return false;
+}
+
+template<class Binding>
+inline void PosixAdapter<Binding>::callIdleTaskFunction()
+{
+    _taskContexts[TASK_IDLE].callTaskFunction();
+}
+
+template<class Binding>
+bool PosixAdapter<Binding>::getLaneStatistics(
+    size_t const taskIdx, size_t const priority, RunnableLaneStatistics& statistics)
+{
+    // with a single lane the task context uses the RunnableExecutor without statistics
+    if ((TaskContextType::PRIORITY_LANE_COUNT > 1U) && (taskIdx < TASK_COUNT)
+        && (priority < TaskContextType::PRIORITY_LANE_COUNT))
+    {
+        statistics = _taskContexts[taskIdx].getLaneStatistics(priority);
+        return true;
+    }
+    return false;
+}
+
+template<class Binding>
+inline void PosixAdapter<Binding>::execute(ContextType const context, RunnableType& runnable)
+{
+    _taskContexts[static_cast<size_t>(context)].execute(runnable);
+}
+
+template<class Binding>
+inline void PosixAdapter<Binding>::execute(
+    ContextType const context, RunnableType& runnable, size_t const priority)
+{
+    _taskContexts[static_cast<size_t>(context)].execute(runnable, priority);
+}
+
+template<class Binding>
+inline void PosixAdapter<Binding>::schedule(
+    ContextType const context,
+    RunnableType& runnable,
+    TimeoutType& timeout,
+    uint32_t const delay,
+    TimeUnitType const unit)
+{
+    _taskContexts[static_cast<size_t>(context)].schedule(runnable, timeout, delay, unit);
+}
+
+template<class Binding>
+inline void PosixAdapter<Binding>::scheduleAtFixedRate(
+    ContextType const context,
+    RunnableType& runnable,
+    TimeoutType& timeout,
+    uint32_t const delay,
+    TimeUnitType const unit)
+{
+    _taskContexts[static_cast<size_t>(context)].scheduleAtFixedRate(runnable, timeout, delay, unit);
+}
+
+template<class Binding>
+inline void PosixAdapter<Binding>::cancel(TimeoutType& timeout)
+{
+    LockType const lock;
+    ContextType const context = timeout._context;
+    if (context != CONTEXT_INVALID)
+    {
+        timeout._context = CONTEXT_INVALID;
+        _taskContexts[static_cast<size_t>(context)].cancel(timeout);
+    }
+}
+
+template<class Binding>
+void PosixAdapter<Binding>::staticTaskFunction(ContextType const context)
+{
+    _currentContext = context;
+    _taskContexts[static_cast<size_t>(context)].callTaskFunction();
+}
+
+template<class Binding>
+PosixAdapter<Binding>::StackUsage::StackUsage() : _stackSize(0U), _usedSize(0U)
+{}
+
+} // namespace async
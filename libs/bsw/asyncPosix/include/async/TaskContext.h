@@ -0,0 +1,369 @@
+// Copyright 2025 Accenture.
+
+/**
+ * \ingroup async
+ */
+#pragma once
+
+#include "PosixConfig.h"
+#include "async/EventDispatcher.h"
+#include "async/EventPolicy.h"
+#include "async/TaskContextTypes.h"
+#include "async/Types.h"
+
+#include <bsp/timer/SystemTimer.h>
+#include <etl/delegate.h>
+#include <timer/Timer.h>
+
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <pthread.h>
+#include <thread>
+
+namespace async
+{
+/**
+ * Context of a single task that runs on its own native thread.
+ *
+ * Events are kept in a mask that is protected by a mutex of the task. The thread waits on a
+ * condition variable (a futex on Linux) until an event is set or the next timeout of the task
+ * is due, so an idle task doesn't consume any CPU time. Without ASYNC_CONFIG_TICKLESS_IDLE a
+ * task without pending timeouts additionally wakes up every WAIT_EVENTS_TICK_COUNT ticks.
+ *
+ * \tparam Binding The adapter type providing WAIT_EVENTS_TICK_COUNT.
+ * \tparam Timer The timer type used for scheduled runnables.
+ */
+template<class Binding, class Timer = typename internal::TaskContextTimer<>::Type>
+class TaskContext : public EventDispatcher<2U, LockType>
+{
+public:
+    using TaskFunctionType       = ::etl::delegate<void(TaskContext<Binding, Timer>&)>;
+    using StaticTaskFunctionType = void (*)(ContextType);
+
+    static size_t const PRIORITY_LANE_COUNT = static_cast<size_t>(ASYNC_CONFIG_PRIORITY_LANES);
+
+    TaskContext();
+
+    void createTask(
+        ContextType context,
+        char const* name,
+        TaskFunctionType taskFunction,
+        StaticTaskFunctionType staticTaskFunction);
+
+    void startTask();
+    void joinTask();
+
+    char const* getName() const;
+
+    void execute(RunnableType& runnable);
+    void execute(RunnableType& runnable, size_t priority);
+    void schedule(RunnableType& runnable, TimeoutType& timeout, uint32_t delay, TimeUnitType unit);
+    void scheduleAtFixedRate(
+        RunnableType& runnable, TimeoutType& timeout, uint32_t period, TimeUnitType unit);
+    void cancel(TimeoutType& timeout);
+
+    RunnableLaneStatistics getLaneStatistics(size_t priority) const;
+    void resetLaneStatistics();
+
+    void callTaskFunction();
+    void dispatch();
+    void stopDispatch();
+    void dispatchWhileWork();
+
+    static void defaultTaskFunction(TaskContext<Binding, Timer>& taskContext);
+
+private:
+    friend class EventPolicy<TaskContext<Binding, Timer>, 0U>;
+    friend class EventPolicy<TaskContext<Binding, Timer>, 1U>;
+
+    using ExecuteEventPolicyType = EventPolicy<TaskContext<Binding, Timer>, 0U>;
+    using TimerEventPolicyType   = EventPolicy<TaskContext<Binding, Timer>, 1U>;
+    using TimerType              = Timer;
+
+    static bool const TICKLESS_IDLE = (ASYNC_CONFIG_TICKLESS_IDLE != 0);
+
+    static EventMaskType const STOP_EVENT_MASK = static_cast<EventMaskType>(
+        static_cast<EventMaskType>(1U) << static_cast<EventMaskType>(EVENT_COUNT));
+
+    void setEvents(EventMaskType eventMask);
+    EventMaskType waitEvents();
+    EventMaskType peekEvents();
+
+    void handleTimeout();
+
+    using RunnableExecutorType = internal::TaskContextRunnableExecutor<
+        ExecuteEventPolicyType,
+        typename internal::TaskContextRunnableHook<Binding>::Type>;
+
+    typename RunnableExecutorType::Type _runnableExecutor;
+    TimerType _timer;
+    TimerEventPolicyType _timerEventPolicy;
+    TaskFunctionType _taskFunction;
+    StaticTaskFunctionType _staticTaskFunction;
+    ::std::thread _thread;
+    ::std::mutex _eventMutex;
+    ::std::condition_variable _eventCondition;
+    EventMaskType _events;
+    char const* _name;
+    ContextType _context;
+};
+
+/**
+ * Inline implementations.
+ */
+template<class Binding, class Timer>
+inline TaskContext<Binding, Timer>::TaskContext()
+: _runnableExecutor(*this)
+, _timer()
+, _timerEventPolicy(*this)
+, _taskFunction(TaskFunctionType::template create<&TaskContext::defaultTaskFunction>())
+, _staticTaskFunction(nullptr)
+, _thread()
+, _eventMutex()
+, _eventCondition()
+, _events(0U)
+, _name(nullptr)
+, _context(CONTEXT_INVALID)
+{
+    _timerEventPolicy.setEventHandler(
+        HandlerFunctionType::create<TaskContext, &TaskContext::handleTimeout>(*this));
+    _runnableExecutor.init();
+}
+
+template<class Binding, class Timer>
+void TaskContext<Binding, Timer>::createTask(
+    ContextType const context,
+    char const* const name,
+    TaskFunctionType const taskFunction,
+    StaticTaskFunctionType const staticTaskFunction)
+{
+    _context            = context;
+    _staticTaskFunction = staticTaskFunction;
+    if (name != nullptr)
+    {
+        _name = name;
+    }
+    if (taskFunction.is_valid())
+    {
+        _taskFunction = taskFunction;
+    }
+}
+
+template<class Binding, class Timer>
+void TaskContext<Binding, Timer>::startTask()
+{
+    if ((_staticTaskFunction != nullptr) && !_thread.joinable())
+    {
+        _thread = ::std::thread(_staticTaskFunction, _context);
+        if (_name != nullptr)
+        {
+            // names exceeding the limit of 15 characters are rejected and simply not applied
+            (void)pthread_setname_np(_thread.native_handle(), _name);
+        }
+    }
+}
+
+template<class Binding, class Timer>
+void TaskContext<Binding, Timer>::joinTask()
+{
+    if (_thread.joinable())
+    {
+        _thread.join();
+    }
+}
+
+template<class Binding, class Timer>
+inline char const* TaskContext<Binding, Timer>::getName() const
+{
+    if (_name != nullptr)
+    {
+        return _name;
+    }
+    else
+    {
+        return "<undefined>";
+    }
+}
+
+template<class Binding, class Timer>
+inline void TaskContext<Binding, Timer>::execute(RunnableType& runnable)
+{
+    _runnableExecutor.enqueue(runnable);
+}
+
+template<class Binding, class Timer>
+inline void TaskContext<Binding, Timer>::execute(RunnableType& runnable, size_t const priority)
+{
+    RunnableExecutorType::enqueue(_runnableExecutor, runnable, priority);
+}
+
+template<class Binding, class Timer>
+inline RunnableLaneStatistics
+TaskContext<Binding, Timer>::getLaneStatistics(size_t const priority) const
+{
+    return RunnableExecutorType::getLaneStatistics(_runnableExecutor, priority);
+}
+
+template<class Binding, class Timer>
+inline void TaskContext<Binding, Timer>::resetLaneStatistics()
+{
+    RunnableExecutorType::resetLaneStatistics(_runnableExecutor);
+}
+
+template<class Binding, class Timer>
+inline void TaskContext<Binding, Timer>::schedule(
+    RunnableType& runnable, TimeoutType& timeout, uint32_t const delay, TimeUnitType const unit)
+{
+    if (!_timer.isActive(timeout))
+    {
+        timeout._runnable = &runnable;
+        timeout._context  = _context;
+        if (_timer.set(timeout, delay * static_cast<uint32_t>(unit), getSystemTimeUs32Bit()))
+        {
+            _timerEventPolicy.setEvent();
+        }
+    }
+}
+
+template<class Binding, class Timer>
+inline void TaskContext<Binding, Timer>::scheduleAtFixedRate(
+    RunnableType& runnable, TimeoutType& timeout, uint32_t const period, TimeUnitType const unit)
+{
+    if (!_timer.isActive(timeout))
+    {
+        timeout._runnable = &runnable;
+        timeout._context  = _context;
+
+        if (_timer.setCyclic(timeout, period * static_cast<uint32_t>(unit), getSystemTimeUs32Bit()))
+        {
+            _timerEventPolicy.setEvent();
+        }
+    }
+}
+
+template<class Binding, class Timer>
+inline void TaskContext<Binding, Timer>::cancel(TimeoutType& timeout)
+{
+    _timer.cancel(timeout);
+}
+
+template<class Binding, class Timer>
+inline void TaskContext<Binding, Timer>::setEvents(EventMaskType const eventMask)
+{
+    {
+        ::std::lock_guard<::std::mutex> const lock(_eventMutex);
+        _events |= eventMask;
+    }
+    _eventCondition.notify_one();
+}
+
+template<class Binding, class Timer>
+inline EventMaskType TaskContext<Binding, Timer>::waitEvents()
+{
+    uint32_t timeoutUs
+        = static_cast<uint32_t>(Binding::WAIT_EVENTS_TICK_COUNT * Config::TICK_IN_US);
+    uint32_t nextDelta;
+    bool const hasDelta = _timer.getNextDelta(getSystemTimeUs32Bit(), nextDelta);
+    if (hasDelta)
+    {
+        timeoutUs = nextDelta;
+    }
+
+    ::std::unique_lock<::std::mutex> lock(_eventMutex);
+    auto const hasEvents = [this] { return _events != 0U; };
+    bool isEventSet      = true;
+    if (TICKLESS_IDLE && !hasDelta)
+    {
+        // nothing is due: sleep until an event is set, a newly scheduled timeout sets one too
+        _eventCondition.wait(lock, hasEvents);
+    }
+    else
+    {
+        isEventSet
+            = _eventCondition.wait_for(lock, ::std::chrono::microseconds(timeoutUs), hasEvents);
+    }
+    if (isEventSet)
+    {
+        EventMaskType const eventMask = _events;
+        _events                       = 0U;
+        return eventMask;
+    }
+    else if (hasDelta)
+    {
+        return TimerEventPolicyType::EVENT_MASK;
+    }
+    else
+    {
+        return 0U;
+    }
+}
+
+template<class Binding, class Timer>
+inline EventMaskType TaskContext<Binding, Timer>::peekEvents()
+{
+    ::std::lock_guard<::std::mutex> const lock(_eventMutex);
+    EventMaskType const eventMask = _events;
+    _events                       = 0U;
+    return eventMask;
+}
+
+template<class Binding, class Timer>
+void TaskContext<Binding, Timer>::callTaskFunction()
+{
+    _taskFunction(*this);
+}
+
+template<class Binding, class Timer>
+void TaskContext<Binding, Timer>::dispatch()
+{
+    while (true)
+    {
+        EventMaskType const eventMask = waitEvents();
+        if ((eventMask & STOP_EVENT_MASK) != 0U)
+        {
+            break;
+        }
+        handleEvents(eventMask);
+    }
+}
+
+template<class Binding, class Timer>
+inline void TaskContext<Binding, Timer>::stopDispatch()
+{
+    // The handlers are kept: they may be in use by the running thread. Instead the dispatch loop
+    // returns without handling any further event.
+    setEvents(STOP_EVENT_MASK);
+}
+
+template<class Binding, class Timer>
+void TaskContext<Binding, Timer>::dispatchWhileWork()
+{
+    while (true)
+    {
+        handleTimeout();
+        EventMaskType const eventMask = peekEvents();
+        if (eventMask != 0U)
+        {
+            handleEvents(eventMask);
+        }
+        else
+        {
+            break;
+        }
+    }
+}
+
+template<class Binding, class Timer>
+void TaskContext<Binding, Timer>::defaultTaskFunction(TaskContext<Binding, Timer>& taskContext)
+{
+    taskContext.dispatch();
+}
+
+template<class Binding, class Timer>
+void TaskContext<Binding, Timer>::handleTimeout()
+{
+    while (_timer.processDueTimeouts(getSystemTimeUs32Bit())) {}
+}
+
+} // namespace async
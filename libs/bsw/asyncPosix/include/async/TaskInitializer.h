@@ -0,0 +1,254 @@
+// Copyright 2025 Accenture.
+
+/**
+ * \ingroup async
+ */
+#pragma once
+
+#include "async/StaticRunnable.h"
+#include "async/Types.h"
+
+#include <etl/array.h>
+
+namespace async
+{
+namespace internal
+{
+/**
+ * Stack type for tasks that are declared with an external stack. Native threads allocate their
+ * own stack, the type is provided for source compatibility with the other async platforms only.
+ */
+template<size_t StackSize>
+using Stack = ::etl::array<uint8_t, StackSize>;
+
+/**
+ * The TaskInitializer struct centralizes the initialization of tasks within the application.
+ *
+ * All declared tasks are collected at static initialization time and initialized by the adapter
+ * right before the threads are started.
+ *
+ * \tparam Adapter The adapter type used to provide specific task configuration types and functions.
+ */
+template<typename Adapter>
+struct TaskInitializer : public StaticRunnable<TaskInitializer<Adapter>>
+{
+    using AdapterType      = Adapter;
+    using TaskConfigType   = typename AdapterType::TaskConfigType;
+    using TaskFunctionType = typename AdapterType::TaskFunctionType;
+
+    TaskInitializer(
+        ContextType context,
+        char const* name,
+        TaskFunctionType taskFunction,
+        TaskConfigType const& config);
+
+    /// Executes task object initialization.
+    void execute();
+
+    /// The function assigned for the task's execution.
+    TaskFunctionType _taskFunction;
+
+    /// The name of the task.
+    char const* _name;
+
+    /// The context in which the task will execute.
+    ContextType _context;
+
+    /// The configuration settings for the task.
+    TaskConfigType _config;
+};
+
+/**
+ * Base class of all task declarations. The stack size and an external stack are accepted for
+ * source compatibility with the other async platforms but aren't used by native threads.
+ *
+ * \tparam Adapter The adapter type that supplies specific task configuration types and functions.
+ * \tparam Context The context in which the task operates.
+ */
+template<class Adapter, ContextType Context>
+class TaskImpl
+{
+public:
+    using AdapterType      = Adapter;
+    using TaskConfigType   = typename AdapterType::TaskConfigType;
+    using TaskFunctionType = typename AdapterType::TaskFunctionType;
+
+    TaskImpl(char const* name, TaskFunctionType taskFunction, TaskConfigType const& taskConfig);
+
+protected:
+    ~TaskImpl() = default;
+
+private:
+    TaskInitializer<Adapter> _initializer;
+};
+
+template<class Adapter, size_t StackSize = 0U>
+struct IdleTask : public TaskImpl<Adapter, Adapter::TASK_IDLE>
+{
+    using TaskFunctionType = typename Adapter::TaskFunctionType;
+    using TaskConfigType   = typename Adapter::TaskConfigType;
+
+    IdleTask(char const* name, TaskConfigType const& taskConfig = TaskConfigType());
+
+    IdleTask(
+        char const* name,
+        TaskFunctionType taskFunction,
+        TaskConfigType const& taskConfig = TaskConfigType());
+};
+
+template<class Adapter>
+struct IdleTask<Adapter, 0U> : public TaskImpl<Adapter, Adapter::TASK_IDLE>
+{
+    using TaskFunctionType = typename Adapter::TaskFunctionType;
+    using TaskConfigType   = typename Adapter::TaskConfigType;
+
+    template<typename T>
+    IdleTask(char const* name, T& stack, TaskConfigType const& taskConfig = TaskConfigType());
+
+    template<typename T>
+    IdleTask(
+        char const* name,
+        T& stack,
+        TaskFunctionType taskFunction,
+        TaskConfigType const& taskConfig = TaskConfigType());
+};
+
+template<class Adapter, size_t StackSize = 0U>
+struct TimerTask : public TaskImpl<Adapter, Adapter::TASK_TIMER>
+{
+    using TaskConfigType = typename Adapter::TaskConfigType;
+
+    explicit TimerTask(char const* name, TaskConfigType const& taskConfig = TaskConfigType());
+};
+
+template<class Adapter>
+struct TimerTask<Adapter, 0U> : public TaskImpl<Adapter, Adapter::TASK_TIMER>
+{
+    using TaskConfigType = typename Adapter::TaskConfigType;
+
+    template<typename T>
+    TimerTask(char const* name, T& stack, TaskConfigType const& taskConfig = TaskConfigType());
+};
+
+template<class Adapter, ContextType Context, size_t StackSize = 0U>
+struct Task : public TaskImpl<Adapter, Context>
+{
+    using TaskFunctionType = typename Adapter::TaskFunctionType;
+    using TaskConfigType   = typename Adapter::TaskConfigType;
+
+    explicit Task(char const* name, TaskConfigType const& taskConfig = TaskConfigType());
+
+    Task(
+        char const* name,
+        TaskFunctionType taskFunction,
+        TaskConfigType const& taskConfig = TaskConfigType());
+};
+
+template<class Adapter, ContextType Context>
+struct Task<Adapter, Context, 0U> : public TaskImpl<Adapter, Context>
+{
+    using TaskFunctionType = typename Adapter::TaskFunctionType;
+    using TaskConfigType   = typename Adapter::TaskConfigType;
+
+    template<typename T>
+    explicit Task(char const* name, T& stack, TaskConfigType const& taskConfig = TaskConfigType());
+
+    template<typename T>
+    Task(
+        char const* name,
+        T& stack,
+        TaskFunctionType taskFunction,
+        TaskConfigType const& taskConfig = TaskConfigType());
+};
+
+template<class Adapter>
+TaskInitializer<Adapter>::TaskInitializer(
+    ContextType const context,
+    char const* const name,
+    TaskFunctionType const taskFunction,
+    TaskConfigType const& config)
+: _taskFunction(taskFunction), _name(name), _context(context), _config(config)
+{}
+
+template<class Adapter>
+void TaskInitializer<Adapter>::execute()
+{
+    Adapter::initTask(*this);
+}
+
+template<class Adapter, ContextType Context>
+TaskImpl<Adapter, Context>::TaskImpl(
+    char const* const name, TaskFunctionType const taskFunction, TaskConfigType const& taskConfig)
+: _initializer(Context, name, taskFunction, taskConfig)
+{}
+
+template<class Adapter, size_t StackSize>
+IdleTask<Adapter, StackSize>::IdleTask(char const* const name, TaskConfigType const& taskConfig)
+: TaskImpl<Adapter, Adapter::TASK_IDLE>(name, TaskFunctionType(), taskConfig)
+{}
+
+template<class Adapter, size_t StackSize>
+IdleTask<Adapter, StackSize>::IdleTask(
+    char const* const name, TaskFunctionType const taskFunction, TaskConfigType const& taskConfig)
+: TaskImpl<Adapter, Adapter::TASK_IDLE>(name, taskFunction, taskConfig)
+{}
+
+template<class Adapter>
+template<typename T>
+IdleTask<Adapter, 0U>::IdleTask(
+    char const* const name, T& /*stack*/, TaskConfigType const& taskConfig)
+: TaskImpl<Adapter, Adapter::TASK_IDLE>(name, TaskFunctionType(), taskConfig)
+{}
+
+template<class Adapter>
+template<typename T>
+IdleTask<Adapter, 0U>::IdleTask(
+    char const* const name,
+    T& /*stack*/,
+    TaskFunctionType const taskFunction,
+    TaskConfigType const& taskConfig)
+: TaskImpl<Adapter, Adapter::TASK_IDLE>(name, taskFunction, taskConfig)
+{}
+
+template<class Adapter, size_t StackSize>
+TimerTask<Adapter, StackSize>::TimerTask(char const* const name, TaskConfigType const& taskConfig)
+: TaskImpl<Adapter, Adapter::TASK_TIMER>(name, typename Adapter::TaskFunctionType(), taskConfig)
+{}
+
+template<class Adapter>
+template<typename T>
+TimerTask<Adapter, 0U>::TimerTask(
+    char const* const name, T& /*stack*/, TaskConfigType const& taskConfig)
+: TaskImpl<Adapter, Adapter::TASK_TIMER>(name, typename Adapter::TaskFunctionType(), taskConfig)
+{}
+
+template<class Adapter, ContextType Context, size_t StackSize>
+Task<Adapter, Context, StackSize>::Task(char const* const name, TaskConfigType const& taskConfig)
+: TaskImpl<Adapter, Context>(name, TaskFunctionType(), taskConfig)
+{}
+
+template<class Adapter, ContextType Context, size_t StackSize>
+Task<Adapter, Context, StackSize>::Task(
+    char const* const name, TaskFunctionType const taskFunction, TaskConfigType const& taskConfig)
+: TaskImpl<Adapter, Context>(name, taskFunction, taskConfig)
+{}
+
+template<class Adapter, ContextType Context>
+template<typename T>
+Task<Adapter, Context, 0U>::Task(
+    char const* const name, T& /*stack*/, TaskConfigType const& taskConfig)
+: TaskImpl<Adapter, Context>(name, TaskFunctionType(), taskConfig)
+{}
+
+template<class Adapter, ContextType Context>
+template<typename T>
+Task<Adapter, Context, 0U>::Task(
+    char const* const name,
+    T& /*stack*/,
+    TaskFunctionType const taskFunction,
+    TaskConfigType const& taskConfig)
+: TaskImpl<Adapter, Context>(name, taskFunction, taskConfig)
+{}
+
+} // namespace internal
+} // namespace async
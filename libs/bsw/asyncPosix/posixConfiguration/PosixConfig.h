@@ -0,0 +1,54 @@
+// Copyright 2025 Accenture.
+
+/**
+ * \ingroup async
+ */
+
+/**
+ * Async specific configuration
+ *
+ */
+
+#pragma once
+
+#include "async/Config.h"
+
+#ifndef ASYNC_CONFIG_TIMING_WHEEL
+#define ASYNC_CONFIG_TIMING_WHEEL (0)
+#endif
+
+#ifndef ASYNC_CONFIG_LOCK_FREE_QUEUE
+#define ASYNC_CONFIG_LOCK_FREE_QUEUE (0)
+#endif
+
+#ifndef ASYNC_CONFIG_PRIORITY_LANES
+#define ASYNC_CONFIG_PRIORITY_LANES (1)
+#endif
+
+#ifndef ASYNC_CONFIG_PRIORITY_LANE_STARVATION_LIMIT
+#define ASYNC_CONFIG_PRIORITY_LANE_STARVATION_LIMIT (8)
+#endif
+
+#ifndef ASYNC_CONFIG_RUNNABLE_MONITOR
+#define ASYNC_CONFIG_RUNNABLE_MONITOR (0)
+#endif
+
+#ifndef ASYNC_CONFIG_TICKLESS_IDLE
+#define ASYNC_CONFIG_TICKLESS_IDLE (1)
+#endif
+
+#ifdef __cplusplus
+
+#include <platform/estdint.h>
+
+namespace async
+{
+struct Config
+{
+    static size_t const TASK_COUNT = static_cast<size_t>(ASYNC_CONFIG_TASK_COUNT);
+    static size_t const TICK_IN_US = static_cast<size_t>(ASYNC_CONFIG_TICK_IN_US);
+};
+
+} // namespace async
+
+#endif // __cplusplus
@@ -0,0 +1,40 @@
+// Copyright 2025 Accenture.
+
+#include "async/FutureSupport.h"
+
+#include <async/AsyncBinding.h>
+#include <etl/error_handler.h>
+
+namespace async
+{
+FutureSupport::FutureSupport(ContextType const context)
+: _context(context), _mutex(), _condition(), _isNotified(false)
+{}
+
+void FutureSupport::wait()
+{
+    ::std::unique_lock<::std::mutex> lock(_mutex);
+    _condition.wait(lock, [this] { return _isNotified; });
+    _isNotified = false;
+}
+
+void FutureSupport::notify()
+{
+    {
+        ::std::lock_guard<::std::mutex> const lock(_mutex);
+        _isNotified = true;
+    }
+    _condition.notify_one();
+}
+
+void FutureSupport::assertTaskContext()
+{
+    ETL_ASSERT(verifyTaskContext(), ETL_ERROR_GENERIC("TaskContext must be verified"));
+}
+
+bool FutureSupport::verifyTaskContext()
+{
+    return _context == AsyncBinding::AdapterType::getCurrentTaskContext();
+}
+
+} // namespace async
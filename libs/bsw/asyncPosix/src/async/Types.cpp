@@ -0,0 +1,21 @@
+// Copyright 2025 Accenture.
+
+#include "async/AsyncBinding.h"
+
+namespace async
+{
+TimeoutType::TimeoutType() : _runnable(nullptr), _context(CONTEXT_INVALID) {}
+
+void TimeoutType::cancel() { AsyncBindingType::AdapterType::cancel(*this); }
+
+void TimeoutType::expired()
+{
+    RunnableType* const runnable = _runnable;
+    if (runnable != nullptr)
+    {
+        internal::TaskContextRunnableHook<AsyncBindingType::AdapterType>::Type::expire(
+            *runnable, *this);
+    }
+}
+
+} // namespace async
@@ -0,0 +1,21 @@
+// Copyright 2025 Accenture.
+
+/**
+ * \ingroup async
+ */
+#pragma once
+
+#include "async/PosixAdapter.h"
+
+namespace async
+{
+struct AsyncBinding : public Config
+{
+    static size_t const WAIT_EVENTS_TICK_COUNT = 100U;
+
+    using AdapterType = PosixAdapter<AsyncBinding>;
+};
+
+using AsyncBindingType = AsyncBinding;
+
+} // namespace async
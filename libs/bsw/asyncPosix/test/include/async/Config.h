@@ -0,0 +1,9 @@
+// Copyright 2025 Accenture.
+
+/**
+ * \ingroup async
+ */
+#pragma once
+
+#define ASYNC_CONFIG_TASK_COUNT (3)
+#define ASYNC_CONFIG_TICK_IN_US (1000)
@@ -0,0 +1,83 @@
+// Copyright 2025 Accenture.
+
+#include "async/FutureSupport.h"
+
+#include <async/AsyncBinding.h>
+
+#include <gmock/gmock.h>
+
+#include <chrono>
+#include <thread>
+
+namespace
+{
+using namespace ::async;
+using namespace ::testing;
+
+using AdapterType = AsyncBindingType::AdapterType;
+
+/**
+ * \refs: SMD_asyncPosix_FutureSupport
+ * \desc: To test that wait() returns immediately if notify() has been called before
+ */
+TEST(FutureSupportTest, testNotifyBeforeWait)
+{
+    ::async::FutureSupport cut(1U);
+    cut.notify();
+    cut.wait();
+}
+
+/**
+ * \refs: SMD_asyncPosix_FutureSupport
+ * \desc: To test that wait() blocks until notify() is called by another thread
+ */
+TEST(FutureSupportTest, testWaitForNotifyFromOtherThread)
+{
+    ::async::FutureSupport cut(1U);
+    auto const start = ::std::chrono::steady_clock::now();
+    ::std::thread notifier(
+        [&cut]
+        {
+            ::std::this_thread::sleep_for(::std::chrono::milliseconds(10));
+            cut.notify();
+        });
+    cut.wait();
+    EXPECT_GE(::std::chrono::steady_clock::now() - start, ::std::chrono::milliseconds(10));
+    notifier.join();
+}
+
+::async::FutureSupport* futureSupport = nullptr;
+bool isVerifiedInContext              = false;
+
+class VerifyRunnable : public RunnableType
+{
+public:
+    void execute() override
+    {
+        isVerifiedInContext = futureSupport->verifyTaskContext();
+        futureSupport->assertTaskContext();
+        AdapterType::stop();
+    }
+};
+
+VerifyRunnable verifyRunnable;
+
+void startVerify() { AdapterType::execute(2U, verifyRunnable); }
+
+/**
+ * \refs: SMD_asyncPosix_FutureSupport
+ * \desc: To test the verification of the task context
+ */
+TEST(FutureSupportTest, testVerifyTaskContext)
+{
+    ::async::FutureSupport cut(2U);
+    EXPECT_FALSE(cut.verifyTaskContext());
+    EXPECT_THROW({ cut.assertTaskContext(); }, ::etl::exception);
+
+    futureSupport = &cut;
+    AdapterType::run(AdapterType::StartAppFunctionType::create<&startVerify>());
+    futureSupport = nullptr;
+    EXPECT_TRUE(isVerifiedInContext);
+}
+
+} // namespace
@@ -0,0 +1,90 @@
+// Copyright 2025 Accenture.
+
+#include "async/Lock.h"
+
+#include <gmock/gmock.h>
+
+#include <thread>
+
+namespace
+{
+using namespace ::async;
+using namespace ::testing;
+
+bool isLockedForOtherThreads()
+{
+    bool isLocked = false;
+    ::std::thread thread(
+        [&isLocked]
+        {
+            isLocked = !::async::internal::getLockMutex().try_lock();
+            if (!isLocked)
+            {
+                ::async::internal::getLockMutex().unlock();
+            }
+        });
+    thread.join();
+    return isLocked;
+}
+
+/**
+ * \refs: SMD_asyncPosix_Lock
+ * \desc: To test the lock guard functionality
+ */
+TEST(LockTest, testLocksAndUnlocks)
+{
+    {
+        Lock const cut;
+        EXPECT_TRUE(isLockedForOtherThreads());
+    }
+    EXPECT_FALSE(isLockedForOtherThreads());
+}
+
+/**
+ * \refs: SMD_asyncPosix_Lock
+ * \desc: To test that locks can be nested within the same thread
+ */
+TEST(LockTest, testNestedLocks)
+{
+    {
+        Lock const outer;
+        {
+            Lock const inner;
+            EXPECT_TRUE(isLockedForOtherThreads());
+        }
+        EXPECT_TRUE(isLockedForOtherThreads());
+    }
+    EXPECT_FALSE(isLockedForOtherThreads());
+}
+
+/**
+ * \refs: SMD_asyncPosix_Lock
+ * \desc: To test that the lock serializes modifications from concurrent threads
+ */
+TEST(LockTest, testMutualExclusion)
+{
+    static uint32_t const THREAD_COUNT    = 4U;
+    static uint32_t const INCREMENT_COUNT = 10000U;
+
+    uint32_t counter = 0U;
+    ::std::thread threads[THREAD_COUNT];
+    for (auto& thread : threads)
+    {
+        thread = ::std::thread(
+            [&counter]
+            {
+                for (uint32_t i = 0U; i < INCREMENT_COUNT; ++i)
+                {
+                    Lock const lock;
+                    counter = counter + 1U;
+                }
+            });
+    }
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+    EXPECT_EQ(THREAD_COUNT * INCREMENT_COUNT, counter);
+}
+
+} // namespace
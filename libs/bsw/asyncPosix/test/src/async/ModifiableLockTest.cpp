@@ -0,0 +1,80 @@
+// Copyright 2025 Accenture.
+
+#include "async/ModifiableLock.h"
+
+#include <gmock/gmock.h>
+
+#include <thread>
+
+namespace
+{
+using namespace ::async;
+using namespace ::testing;
+
+bool isLockedForOtherThreads()
+{
+    bool isLocked = false;
+    ::std::thread thread(
+        [&isLocked]
+        {
+            isLocked = !::async::internal::getLockMutex().try_lock();
+            if (!isLocked)
+            {
+                ::async::internal::getLockMutex().unlock();
+            }
+        });
+    thread.join();
+    return isLocked;
+}
+
+/**
+ * \refs: SMD_asyncPosix_ModifiableLock
+ * \desc: To test the lock guard functionality
+ */
+TEST(ModifiableLockTest, testConstructorAndDestructor)
+{
+    {
+        ModifiableLock const cut;
+        EXPECT_TRUE(isLockedForOtherThreads());
+    }
+    EXPECT_FALSE(isLockedForOtherThreads());
+}
+
+/**
+ * \refs: SMD_asyncPosix_ModifiableLock
+ * \desc: To test unlock and lock functionality of lock guard
+ */
+TEST(ModifiableLockTest, testUnlockAndLockAgain)
+{
+    {
+        ModifiableLock cut;
+        // lock again is neutral
+        cut.lock();
+        EXPECT_TRUE(isLockedForOtherThreads());
+        cut.unlock();
+        EXPECT_FALSE(isLockedForOtherThreads());
+        // unlocking again is neutral
+        cut.unlock();
+        EXPECT_FALSE(isLockedForOtherThreads());
+        cut.lock();
+        EXPECT_TRUE(isLockedForOtherThreads());
+    }
+    EXPECT_FALSE(isLockedForOtherThreads());
+}
+
+/**
+ * \refs: SMD_asyncPosix_ModifiableLock
+ * \desc: To test that the destructor doesn't unlock if already unlocked
+ */
+TEST(ModifiableLockTest, testDestructorIsNotUnlockingIfUnlocked)
+{
+    Lock const outer;
+    {
+        ModifiableLock cut;
+        cut.unlock();
+    }
+    // the outer lock must still be held
+    EXPECT_TRUE(isLockedForOtherThreads());
+}
+
+} // namespace
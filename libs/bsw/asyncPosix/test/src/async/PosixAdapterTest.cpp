@@ -0,0 +1,170 @@
+// Copyright 2025 Accenture.
+
+#include "async/PosixAdapter.h"
+
+#include <async/AsyncBinding.h>
+
+#include <gmock/gmock.h>
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+
+namespace
+{
+using namespace ::async;
+using namespace ::testing;
+
+using AdapterType = AsyncBindingType::AdapterType;
+
+AdapterType::IdleTask<1024U> idleTask{"idle"};
+AdapterType::TimerTask<1024U> timerTask{"timer"};
+AdapterType::Task<1U, 1024U> task1{"task1"};
+AdapterType::Stack<1024U> task2Stack;
+AdapterType::TaskStack<2U> task2{"task2", task2Stack};
+
+/**
+ * Runnable that waits until all instances have been entered, which is only possible if they are
+ * executed in parallel.
+ */
+class RendezvousRunnable : public RunnableType
+{
+public:
+    static uint32_t const COUNT = 2U;
+
+    void execute() override
+    {
+        _context = AdapterType::getCurrentTaskContext();
+        ++_arrived;
+        auto const deadline = ::std::chrono::steady_clock::now() + ::std::chrono::seconds(5);
+        while ((_arrived.load() < COUNT) && (::std::chrono::steady_clock::now() < deadline))
+        {
+            ::std::this_thread::yield();
+        }
+        _hasMet = (_arrived.load() >= COUNT);
+        if (++_finished == COUNT)
+        {
+            AdapterType::stop();
+        }
+    }
+
+    static ::std::atomic<uint32_t> _arrived;
+    static ::std::atomic<uint32_t> _finished;
+
+    ContextType _context = CONTEXT_INVALID;
+    bool _hasMet         = false;
+};
+
+::std::atomic<uint32_t> RendezvousRunnable::_arrived{0U};
+::std::atomic<uint32_t> RendezvousRunnable::_finished{0U};
+
+RendezvousRunnable rendezvous1;
+RendezvousRunnable rendezvous2;
+ContextType startAppContext = CONTEXT_INVALID;
+
+void startRendezvous()
+{
+    startAppContext = AdapterType::getCurrentTaskContext();
+    AdapterType::execute(1U, rendezvous1);
+    AdapterType::execute(2U, rendezvous2);
+}
+
+/**
+ * \refs: SMD_asyncPosix_PosixAdapter
+ * \desc: To test that runnables of different contexts are executed in parallel
+ */
+TEST(PosixAdapterTest, testRunExecutesContextsInParallel)
+{
+    RendezvousRunnable::_arrived  = 0U;
+    RendezvousRunnable::_finished = 0U;
+    EXPECT_EQ(CONTEXT_INVALID, AdapterType::getCurrentTaskContext());
+    AdapterType::run(AdapterType::StartAppFunctionType::create<&startRendezvous>());
+    EXPECT_EQ(CONTEXT_INVALID, AdapterType::getCurrentTaskContext());
+
+    EXPECT_EQ(static_cast<ContextType>(AdapterType::TASK_IDLE), startAppContext);
+    EXPECT_EQ(1U, rendezvous1._context);
+    EXPECT_EQ(2U, rendezvous2._context);
+    EXPECT_TRUE(rendezvous1._hasMet);
+    EXPECT_TRUE(rendezvous2._hasMet);
+
+    EXPECT_STREQ("idle", AdapterType::getTaskName(AdapterType::TASK_IDLE));
+    EXPECT_STREQ("task1", AdapterType::getTaskName(1U));
+    EXPECT_STREQ("task2", AdapterType::getTaskName(2U));
+    EXPECT_STREQ("timer", AdapterType::getTaskName(AdapterType::TASK_TIMER));
+}
+
+class CyclicRunnable : public RunnableType
+{
+public:
+    void execute() override
+    {
+        _context = AdapterType::getCurrentTaskContext();
+        if (++_count == 3U)
+        {
+            _timeout.cancel();
+            AdapterType::schedule(
+                AdapterType::TASK_TIMER, _stopRunnable, _stopTimeout, 5U, TimeUnit::MILLISECONDS);
+        }
+    }
+
+    class StopRunnable : public RunnableType
+    {
+    public:
+        void execute() override { AdapterType::stop(); }
+    };
+
+    TimeoutType _timeout;
+    TimeoutType _stopTimeout;
+    StopRunnable _stopRunnable;
+    ContextType _context = CONTEXT_INVALID;
+    uint32_t _count      = 0U;
+};
+
+CyclicRunnable cyclicRunnable;
+
+void startCyclic()
+{
+    AdapterType::scheduleAtFixedRate(
+        1U, cyclicRunnable, cyclicRunnable._timeout, 1U, TimeUnit::MILLISECONDS);
+}
+
+/**
+ * \refs: SMD_asyncPosix_PosixAdapter
+ * \desc: To test that cyclic runnables are scheduled and cancelled through the adapter
+ */
+TEST(PosixAdapterTest, testScheduleAtFixedRateAndCancel)
+{
+    cyclicRunnable._count = 0U;
+    AdapterType::run(AdapterType::StartAppFunctionType::create<&startCyclic>());
+
+    EXPECT_EQ(3U, cyclicRunnable._count);
+    EXPECT_EQ(1U, cyclicRunnable._context);
+    EXPECT_EQ(CONTEXT_INVALID, cyclicRunnable._timeout._context);
+}
+
+/**
+ * \refs: SMD_asyncPosix_PosixAdapter
+ * \desc: To test that stack usage is reported for valid tasks only
+ */
+TEST(PosixAdapterTest, testGetStackUsage)
+{
+    AdapterType::StackUsage stackUsage;
+    EXPECT_TRUE(AdapterType::getStackUsage(AdapterType::TASK_TIMER, stackUsage));
+    EXPECT_EQ(0U, stackUsage._stackSize);
+    EXPECT_EQ(0U, stackUsage._usedSize);
+    EXPECT_FALSE(AdapterType::getStackUsage(AdapterType::OS_TASK_COUNT, stackUsage));
+}
+
+/**
+ * \refs: SMD_asyncPosix_PosixAdapter
+ * \desc: To test that a task context with a single lane uses the RunnableExecutor, which doesn't
+ * provide lane statistics
+ */
+TEST(PosixAdapterTest, testSingleLaneHasNoLaneStatistics)
+{
+    static_assert(AdapterType::TaskContextType::PRIORITY_LANE_COUNT == 1U, "");
+    RunnableLaneStatistics statistics;
+    EXPECT_FALSE(AdapterType::getLaneStatistics(AdapterType::TASK_TIMER, 0U, statistics));
+}
+
+} // namespace
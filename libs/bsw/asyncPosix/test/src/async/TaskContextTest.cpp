@@ -0,0 +1,204 @@
+// Copyright 2025 Accenture.
+
+#include "async/TaskContext.h"
+
+#include <gmock/gmock.h>
+
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+namespace
+{
+using namespace ::async;
+using namespace ::testing;
+
+struct TestBinding
+{
+    static size_t const WAIT_EVENTS_TICK_COUNT = 10U;
+};
+
+using TaskContextType = TaskContext<TestBinding>;
+
+class CountingRunnable : public RunnableType
+{
+public:
+    void execute() override
+    {
+        {
+            ::std::lock_guard<::std::mutex> const lock(_mutex);
+            ++_count;
+            _threadId = ::std::this_thread::get_id();
+        }
+        _condition.notify_all();
+    }
+
+    bool waitForCount(uint32_t const count)
+    {
+        ::std::unique_lock<::std::mutex> lock(_mutex);
+        return _condition.wait_for(
+            lock, ::std::chrono::seconds(5), [this, count] { return _count >= count; });
+    }
+
+    uint32_t getCount()
+    {
+        ::std::lock_guard<::std::mutex> const lock(_mutex);
+        return _count;
+    }
+
+    ::std::thread::id getThreadId()
+    {
+        ::std::lock_guard<::std::mutex> const lock(_mutex);
+        return _threadId;
+    }
+
+private:
+    ::std::mutex _mutex;
+    ::std::condition_variable _condition;
+    uint32_t _count = 0U;
+    ::std::thread::id _threadId;
+};
+
+class TaskContextTest : public Test
+{
+public:
+    TaskContextTest() { _cut = &_taskContext; }
+
+    ~TaskContextTest() override
+    {
+        _taskContext.stopDispatch();
+        _taskContext.joinTask();
+        _cut = nullptr;
+    }
+
+protected:
+    static void staticTaskFunction(ContextType const /* context */) { _cut->callTaskFunction(); }
+
+    static TaskContextType* _cut;
+
+    TaskContextType _taskContext;
+};
+
+TaskContextType* TaskContextTest::_cut = nullptr;
+
+/**
+ * \refs: SMD_asyncPosix_TaskContext
+ * \desc: To test that pending runnables are executed by dispatchWhileWork in the calling thread
+ */
+TEST_F(TaskContextTest, testDispatchWhileWork)
+{
+    CountingRunnable runnable;
+    _taskContext.createTask(1U, "test", TaskContextType::TaskFunctionType(), nullptr);
+    EXPECT_STREQ("test", _taskContext.getName());
+    _taskContext.execute(runnable);
+    _taskContext.execute(runnable);
+    _taskContext.dispatchWhileWork();
+    EXPECT_EQ(1U, runnable.getCount());
+    EXPECT_EQ(::std::this_thread::get_id(), runnable.getThreadId());
+}
+
+/**
+ * \refs: SMD_asyncPosix_TaskContext
+ * \desc: To test that runnables are executed by the thread of the task
+ */
+TEST_F(TaskContextTest, testExecuteOnOwnThread)
+{
+    CountingRunnable runnable;
+    EXPECT_STREQ("<undefined>", _taskContext.getName());
+    _taskContext.createTask(
+        1U, nullptr, TaskContextType::TaskFunctionType(), &TaskContextTest::staticTaskFunction);
+    _taskContext.startTask();
+    _taskContext.execute(runnable);
+    ASSERT_TRUE(runnable.waitForCount(1U));
+    EXPECT_NE(::std::this_thread::get_id(), runnable.getThreadId());
+    _taskContext.execute(runnable);
+    ASSERT_TRUE(runnable.waitForCount(2U));
+}
+
+/**
+ * \refs: SMD_asyncPosix_TaskContext
+ * \desc: To test that a scheduled runnable is executed after the delay has elapsed
+ */
+TEST_F(TaskContextTest, testSchedule)
+{
+    CountingRunnable runnable;
+    TimeoutType timeout;
+    _taskContext.createTask(
+        2U, "test", TaskContextType::TaskFunctionType(), &TaskContextTest::staticTaskFunction);
+    _taskContext.startTask();
+
+    auto const start = ::std::chrono::steady_clock::now();
+    _taskContext.schedule(runnable, timeout, 10U, TimeUnit::MILLISECONDS);
+    EXPECT_EQ(2U, timeout._context);
+    ASSERT_TRUE(runnable.waitForCount(1U));
+    EXPECT_GE(::std::chrono::steady_clock::now() - start, ::std::chrono::milliseconds(10));
+}
+
+/**
+ * \refs: SMD_asyncPosix_TaskContext
+ * \desc: To test that a timeout scheduled from another thread wakes up an idle task that waits
+ * without a timeout
+ */
+TEST_F(TaskContextTest, testScheduleWhileIdle)
+{
+    CountingRunnable runnable;
+    TimeoutType timeout;
+    _taskContext.createTask(
+        1U, "test", TaskContextType::TaskFunctionType(), &TaskContextTest::staticTaskFunction);
+    _taskContext.startTask();
+    // let the task go idle for longer than WAIT_EVENTS_TICK_COUNT
+    ::std::this_thread::sleep_for(::std::chrono::milliseconds(30));
+
+    auto const start = ::std::chrono::steady_clock::now();
+    _taskContext.schedule(runnable, timeout, 5U, TimeUnit::MILLISECONDS);
+    ASSERT_TRUE(runnable.waitForCount(1U));
+    EXPECT_GE(::std::chrono::steady_clock::now() - start, ::std::chrono::milliseconds(5));
+}
+
+/**
+ * \refs: SMD_asyncPosix_TaskContext
+ * \desc: To test that a cyclic runnable is executed until it is cancelled
+ */
+TEST_F(TaskContextTest, testScheduleAtFixedRateAndCancel)
+{
+    CountingRunnable runnable;
+    TimeoutType timeout;
+    _taskContext.createTask(
+        1U, "test", TaskContextType::TaskFunctionType(), &TaskContextTest::staticTaskFunction);
+    _taskContext.startTask();
+
+    _taskContext.scheduleAtFixedRate(runnable, timeout, 1U, TimeUnit::MILLISECONDS);
+    ASSERT_TRUE(runnable.waitForCount(5U));
+    _taskContext.cancel(timeout);
+    // an expiry that is already running may still complete
+    uint32_t const count = runnable.getCount() + 1U;
+    ::std::this_thread::sleep_for(::std::chrono::milliseconds(20));
+    EXPECT_GE(count, runnable.getCount());
+}
+
+CountingRunnable customTaskFunctionCalls;
+
+void customTaskFunction(TaskContextType& taskContext)
+{
+    customTaskFunctionCalls.execute();
+    taskContext.dispatch();
+}
+
+/**
+ * \refs: SMD_asyncPosix_TaskContext
+ * \desc: To test that a custom task function is called by the thread of the task
+ */
+TEST_F(TaskContextTest, testCustomTaskFunction)
+{
+    _taskContext.createTask(
+        1U,
+        "test",
+        TaskContextType::TaskFunctionType::create<&customTaskFunction>(),
+        &TaskContextTest::staticTaskFunction);
+    _taskContext.startTask();
+    ASSERT_TRUE(customTaskFunctionCalls.waitForCount(1U));
+    EXPECT_NE(::std::this_thread::get_id(), customTaskFunctionCalls.getThreadId());
+}
+
+} // namespace
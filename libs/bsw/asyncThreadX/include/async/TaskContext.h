@@ -8,7 +8,7 @@
 #include "ThreadXConfig.h"
 #include "async/EventDispatcher.h"
 #include "async/EventPolicy.h"
-#include "async/RunnableExecutor.h"
+#include "async/TaskContextTypes.h"
 #include "async/Types.h"
 #include "tx_api.h"
 
@@ -20,12 +20,14 @@
 
 namespace async
 {
-template<class Binding>
+template<class Binding, class Timer = typename internal::TaskContextTimer<>::Type>
 class TaskContext : public EventDispatcher<2U, LockType>
 {
 public:
-    using TaskFunctionType       = ::etl::delegate<void(TaskContext<Binding>&)>;
+    using TaskFunctionType       = ::etl::delegate<void(TaskContext<Binding, Timer>&)>;
     using StaticTaskFunctionType = void (*)(ULONG);
+
+    static size_t const PRIORITY_LANE_COUNT = static_cast<size_t>(ASYNC_CONFIG_PRIORITY_LANES);
     using StackType              = ::etl::span<ULONG>;
 
     TaskContext();
@@ -49,25 +51,29 @@ public:
     TX_THREAD& getTaskHandle() const;
 
     void execute(RunnableType& runnable);
+    void execute(RunnableType& runnable, size_t priority);
     void schedule(RunnableType& runnable, TimeoutType& timeout, uint32_t delay, TimeUnitType unit);
     void scheduleAtFixedRate(
         RunnableType& runnable, TimeoutType& timeout, uint32_t period, TimeUnitType unit);
     void cancel(TimeoutType& timeout);
 
+    RunnableLaneStatistics getLaneStatistics(size_t priority) const;
+    void resetLaneStatistics();
+
     void callTaskFunction();
     void dispatch();
     void stopDispatch();
     void dispatchWhileWork();
 
-    static void defaultTaskFunction(TaskContext<Binding>& taskContext);
+    static void defaultTaskFunction(TaskContext<Binding, Timer>& taskContext);
 
 private:
-    friend class EventPolicy<TaskContext<Binding>, 0U>;
-    friend class EventPolicy<TaskContext<Binding>, 1U>;
+    friend class EventPolicy<TaskContext<Binding, Timer>, 0U>;
+    friend class EventPolicy<TaskContext<Binding, Timer>, 1U>;
 
-    using ExecuteEventPolicyType = EventPolicy<TaskContext<Binding>, 0U>;
-    using TimerEventPolicyType   = EventPolicy<TaskContext<Binding>, 1U>;
-    using TimerType              = ::timer::Timer<LockType>;
+    using ExecuteEventPolicyType = EventPolicy<TaskContext<Binding, Timer>, 0U>;
+    using TimerEventPolicyType   = EventPolicy<TaskContext<Binding, Timer>, 1U>;
+    using TimerType              = Timer;
 
     static EventMaskType const STOP_EVENT_MASK = static_cast<EventMaskType>(
         static_cast<EventMaskType>(1U) << static_cast<EventMaskType>(EVENT_COUNT));
@@ -79,7 +85,11 @@ private:
 
     void handleTimeout();
 
-    RunnableExecutor<RunnableType, ExecuteEventPolicyType, LockType> _runnableExecutor;
+    using RunnableExecutorType = internal::TaskContextRunnableExecutor<
+        ExecuteEventPolicyType,
+        typename internal::TaskContextRunnableHook<Binding>::Type>;
+
+    typename RunnableExecutorType::Type _runnableExecutor;
     TimerType _timer;
     TimerEventPolicyType _timerEventPolicy;
     TaskFunctionType _taskFunction;
@@ -92,8 +102,8 @@ private:
 /**
  * Inline implementations.
  */
-template<class Binding>
-inline TaskContext<Binding>::TaskContext()
+template<class Binding, class Timer>
+inline TaskContext<Binding, Timer>::TaskContext()
 : _runnableExecutor(*this)
 , _timer()
 , _timerEventPolicy(*this)
@@ -107,8 +117,8 @@ inline TaskContext<Binding>::TaskContext()
     _runnableExecutor.init();
 }
 
-template<class Binding>
-void TaskContext<Binding>::initTask(
+template<class Binding, class Timer>
+void TaskContext<Binding, Timer>::initTask(
     ContextType const context, char const* const name, TX_THREAD& taskHandle)
 {
     _context    = context;
@@ -116,8 +126,8 @@ void TaskContext<Binding>::initTask(
     _taskHandle = &taskHandle;
 }
 
-template<class Binding>
-void TaskContext<Binding>::createTask(
+template<class Binding, class Timer>
+void TaskContext<Binding, Timer>::createTask(
     ContextType const context,
     TX_THREAD& task,
     char const* const name,
@@ -155,8 +165,8 @@ void TaskContext<Binding>::createTask(
     _taskHandle = &task;
 }
 
-template<class Binding>
-void TaskContext<Binding>::startTask()
+template<class Binding, class Timer>
+void TaskContext<Binding, Timer>::startTask()
 {
     if (_taskHandle != nullptr)
     {
@@ -164,8 +174,8 @@ void TaskContext<Binding>::startTask()
     }
 }
 
-template<class Binding>
-inline char const* TaskContext<Binding>::getName() const
+template<class Binding, class Timer>
+inline char const* TaskContext<Binding, Timer>::getName() const
 {
     if (_name != nullptr)
     {
@@ -177,20 +187,39 @@ inline char const* TaskContext<Binding>::getName() const
     }
 }
 
-template<class Binding>
-inline TX_THREAD& TaskContext<Binding>::getTaskHandle() const
+template<class Binding, class Timer>
+inline TX_THREAD& TaskContext<Binding, Timer>::getTaskHandle() const
 {
     return *_taskHandle;
 }
 
-template<class Binding>
-inline void TaskContext<Binding>::execute(RunnableType& runnable)
+template<class Binding, class Timer>
+inline void TaskContext<Binding, Timer>::execute(RunnableType& runnable)
 {
     _runnableExecutor.enqueue(runnable);
 }
 
-template<class Binding>
-inline void TaskContext<Binding>::schedule(
+template<class Binding, class Timer>
+inline void TaskContext<Binding, Timer>::execute(RunnableType& runnable, size_t const priority)
+{
+    RunnableExecutorType::enqueue(_runnableExecutor, runnable, priority);
+}
+
+template<class Binding, class Timer>
+inline RunnableLaneStatistics
+TaskContext<Binding, Timer>::getLaneStatistics(size_t const priority) const
+{
+    return RunnableExecutorType::getLaneStatistics(_runnableExecutor, priority);
+}
+
+template<class Binding, class Timer>
+inline void TaskContext<Binding, Timer>::resetLaneStatistics()
+{
+    RunnableExecutorType::resetLaneStatistics(_runnableExecutor);
+}
+
+template<class Binding, class Timer>
+inline void TaskContext<Binding, Timer>::schedule(
     RunnableType& runnable, TimeoutType& timeout, uint32_t const delay, TimeUnitType const unit)
 {
     if (!_timer.isActive(timeout))
@@ -204,8 +233,8 @@ inline void TaskContext<Binding>::schedule(
     }
 }
 
-template<class Binding>
-inline void TaskContext<Binding>::scheduleAtFixedRate(
+template<class Binding, class Timer>
+inline void TaskContext<Binding, Timer>::scheduleAtFixedRate(
     RunnableType& runnable, TimeoutType& timeout, uint32_t const period, TimeUnitType const unit)
 {
     if (!_timer.isActive(timeout))
@@ -220,14 +249,14 @@ inline void TaskContext<Binding>::scheduleAtFixedRate(
     }
 }
 
-template<class Binding>
-inline void TaskContext<Binding>::cancel(TimeoutType& timeout)
+template<class Binding, class Timer>
+inline void TaskContext<Binding, Timer>::cancel(TimeoutType& timeout)
 {
     _timer.cancel(timeout);
 }
 
-template<class Binding>
-inline void TaskContext<Binding>::setEvents(EventMaskType const eventMask)
+template<class Binding, class Timer>
+inline void TaskContext<Binding, Timer>::setEvents(EventMaskType const eventMask)
 {
     tx_event_flags_set(
         &_eventObject,
@@ -236,8 +265,8 @@ inline void TaskContext<Binding>::setEvents(EventMaskType const eventMask)
     );
 }
 
-template<class Binding>
-inline EventMaskType TaskContext<Binding>::waitEvents()
+template<class Binding, class Timer>
+inline EventMaskType TaskContext<Binding, Timer>::waitEvents()
 {
     EventMaskType eventMask = 0U;
     uint32_t ticks          = Binding::WAIT_EVENTS_TICK_COUNT;
@@ -268,14 +297,14 @@ inline EventMaskType TaskContext<Binding>::waitEvents()
     }
 }
 
-template<class Binding>
-void TaskContext<Binding>::callTaskFunction()
+template<class Binding, class Timer>
+void TaskContext<Binding, Timer>::callTaskFunction()
 {
     _taskFunction(*this);
 }
 
-template<class Binding>
-void TaskContext<Binding>::dispatch()
+template<class Binding, class Timer>
+void TaskContext<Binding, Timer>::dispatch()
 {
     EventMaskType eventMask = 0U;
     while ((eventMask & STOP_EVENT_MASK) == 0U)
@@ -285,23 +314,23 @@ void TaskContext<Binding>::dispatch()
     }
 }
 
-template<class Binding>
-inline void TaskContext<Binding>::stopDispatch()
+template<class Binding, class Timer>
+inline void TaskContext<Binding, Timer>::stopDispatch()
 {
     _runnableExecutor.shutdown();
     setEvents(STOP_EVENT_MASK);
 }
 
-template<class Binding>
-void TaskContext<Binding>::defaultTaskFunction(TaskContext<Binding>& taskContext)
+template<class Binding, class Timer>
+void TaskContext<Binding, Timer>::defaultTaskFunction(TaskContext<Binding, Timer>& taskContext)
 {
     taskContext.dispatch();
 }
 
-template<class Binding>
-void TaskContext<Binding>::handleTimeout()
+template<class Binding, class Timer>
+void TaskContext<Binding, Timer>::handleTimeout()
 {
-    while (_timer.processNextTimeout(getSystemTimeUs32Bit())) {}
+    while (_timer.processDueTimeouts(getSystemTimeUs32Bit())) {}
 }
 
 } // namespace async
@@ -78,6 +78,7 @@ public:
     static ContextType const TASK_IDLE        = 0U;
     static ContextType const TASK_TIMER       = static_cast<ContextType>(TASK_COUNT);
 
+    using BindingType = Binding;
     using AdapterType = ThreadXAdapter<Binding>;
 
     using TaskContextType        = TaskContext<AdapterType>;
@@ -122,9 +123,13 @@ public:
 
     static bool getStackUsage(size_t taskIdx, StackUsage& stackUsage);
 
+    static bool
+    getLaneStatistics(size_t taskIdx, size_t priority, RunnableLaneStatistics& statistics);
+
     static void callIdleTaskFunction();
 
     static void execute(ContextType context, RunnableType& runnable);
+    static void execute(ContextType context, RunnableType& runnable, size_t priority);
 
     static void schedule(
         ContextType context,
@@ -290,12 +295,33 @@ bool ThreadXAdapter<Binding>::getStackUsage(size_t const taskIdx, StackUsage& st
     return false;
 }
 
+template<class Binding>
+bool ThreadXAdapter<Binding>::getLaneStatistics(
+    size_t const taskIdx, size_t const priority, RunnableLaneStatistics& statistics)
+{
+    // with a single lane the task context uses the RunnableExecutor without statistics
+    if ((TaskContextType::PRIORITY_LANE_COUNT > 1U) && (taskIdx < TASK_COUNT)
+        && (priority < TaskContextType::PRIORITY_LANE_COUNT))
+    {
+        statistics = _taskContexts[taskIdx].getLaneStatistics(priority);
+        return true;
+    }
+    return false;
+}
+
 template<class Binding>
 inline void ThreadXAdapter<Binding>::execute(ContextType const context, RunnableType& runnable)
 {
     _taskContexts[static_cast<size_t>(context)].execute(runnable);
 }
 
+template<class Binding>
+inline void ThreadXAdapter<Binding>::execute(
+    ContextType const context, RunnableType& runnable, size_t const priority)
+{
+    _taskContexts[static_cast<size_t>(context)].execute(runnable, priority);
+}
+
 template<class Binding>
 inline void ThreadXAdapter<Binding>::schedule(
     ContextType const context,
@@ -18,6 +18,26 @@
 
 #define ASYNC_CONFIG_NESTED_INTERRUPTS (1)
 
+#ifndef ASYNC_CONFIG_TIMING_WHEEL
+#define ASYNC_CONFIG_TIMING_WHEEL (0)
+#endif
+
+#ifndef ASYNC_CONFIG_LOCK_FREE_QUEUE
+#define ASYNC_CONFIG_LOCK_FREE_QUEUE (0)
+#endif
+
+#ifndef ASYNC_CONFIG_PRIORITY_LANES
+#define ASYNC_CONFIG_PRIORITY_LANES (1)
+#endif
+
+#ifndef ASYNC_CONFIG_PRIORITY_LANE_STARVATION_LIMIT
+#define ASYNC_CONFIG_PRIORITY_LANE_STARVATION_LIMIT (8)
+#endif
+
+#ifndef ASYNC_CONFIG_RUNNABLE_MONITOR
+#define ASYNC_CONFIG_RUNNABLE_MONITOR (0)
+#endif
+
 #define ASYNC_TASK_CONFIG_TYPE void
 
 #ifdef __cplusplus
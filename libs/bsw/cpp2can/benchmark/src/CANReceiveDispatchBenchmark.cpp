@@ -0,0 +1,150 @@
+// Copyright 2025 Accenture.
+
+#include <benchmark/benchmark.h>
+#include <can/canframes/CANFrame.h>
+#include <can/canframes/CanId.h>
+#include <can/framemgmt/AbstractBitFieldFilteredCANFrameListener.h>
+#include <can/framemgmt/AbstractIntervalFilteredCANFrameListener.h>
+#include <can/framemgmt/CANFrameListenerIndex.h>
+#include <can/transceiver/AbstractCANTransceiver.h>
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace
+{
+using ::can::CANFrame;
+using ::can::ICanTransceiver;
+
+/**
+ * Transceiver without hardware, which passes injected frames to notifyListeners().
+ */
+class Transceiver : public ::can::AbstractCANTransceiver
+{
+public:
+    Transceiver() : AbstractCANTransceiver(0U) { setState(State::OPEN); }
+
+    ErrorCode init() override { return ErrorCode::CAN_ERR_OK; }
+
+    void shutdown() override {}
+
+    ErrorCode open(CANFrame const&) override { return ErrorCode::CAN_ERR_OK; }
+
+    ErrorCode open() override { return ErrorCode::CAN_ERR_OK; }
+
+    ErrorCode close() override { return ErrorCode::CAN_ERR_OK; }
+
+    ErrorCode mute() override { return ErrorCode::CAN_ERR_OK; }
+
+    ErrorCode unmute() override { return ErrorCode::CAN_ERR_OK; }
+
+    uint32_t getBaudrate() const override { return 500000U; }
+
+    uint16_t getHwQueueTimeout() const override { return 0U; }
+
+    ErrorCode write(CANFrame const&) override { return ErrorCode::CAN_ERR_OK; }
+
+    ErrorCode write(CANFrame const&, ::can::ICANFrameSentListener&) override
+    {
+        return ErrorCode::CAN_ERR_OK;
+    }
+
+    void inject(CANFrame const& frame) { notifyListeners(frame); }
+};
+
+class BitFieldListener : public ::can::AbstractBitFieldFilteredCANFrameListener
+{
+public:
+    void frameReceived(CANFrame const&) override { ++received; }
+
+    uint32_t received = 0U;
+};
+
+class IntervalListener : public ::can::AbstractIntervalFilteredCANFrameListener
+{
+public:
+    void frameReceived(CANFrame const&) override { ++received; }
+
+    uint32_t received = 0U;
+};
+
+/**
+ * Receives frames of 64 base and 64 extended ids on a transceiver with the given number of
+ * listeners. Every listener is interested in a few base ids, every fifth one in a range of
+ * extended ids, so most filter checks of the listeners reject a frame.
+ */
+void receive(benchmark::State& state, bool const indexed)
+{
+    size_t const count = static_cast<size_t>(state.range(0));
+    Transceiver transceiver;
+    ::can::CANFrameListenerIndex index;
+    if (indexed)
+    {
+        transceiver.setListenerIndex(index);
+    }
+
+    std::vector<std::unique_ptr<BitFieldListener>> bitFieldListeners;
+    std::vector<std::unique_ptr<IntervalListener>> intervalListeners;
+    for (uint32_t i = 0U; i < count; ++i)
+    {
+        if ((i % 5U) == 4U)
+        {
+            intervalListeners.emplace_back(new IntervalListener());
+            uint32_t const from = 0x10000U * i;
+            intervalListeners.back()->getFilter().add(
+                ::can::CanId::extended(from), ::can::CanId::extended(from + 0xFFFFU));
+            transceiver.addCANFrameListener(*intervalListeners.back());
+        }
+        else
+        {
+            bitFieldListeners.emplace_back(new BitFieldListener());
+            bitFieldListeners.back()->getFilter().add(0x100U + (i * 4U), 0x103U + (i * 4U));
+            transceiver.addCANFrameListener(*bitFieldListeners.back());
+        }
+    }
+
+    std::vector<CANFrame> frames;
+    for (uint32_t i = 0U; i < 64U; ++i)
+    {
+        frames.emplace_back(0x100U + (i * 3U), nullptr, 0U);
+        frames.emplace_back(::can::CanId::extended(0x10000U * i + i), nullptr, 0U);
+    }
+
+    for (auto _ : state)
+    {
+        for (auto const& frame : frames)
+        {
+            transceiver.inject(frame);
+        }
+    }
+
+    uint32_t received = 0U;
+    for (auto const& listener : bitFieldListeners)
+    {
+        received += listener->received;
+        transceiver.removeCANFrameListener(*listener);
+    }
+    for (auto const& listener : intervalListeners)
+    {
+        received += listener->received;
+        transceiver.removeCANFrameListener(*listener);
+    }
+    benchmark::DoNotOptimize(received);
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * frames.size()));
+}
+} // namespace
+
+/**
+ * Benchmarks receiving frames with checking the filters of all listeners.
+ */
+void BM_can_receive_all_filters(benchmark::State& state) { receive(state, false); }
+
+BENCHMARK(BM_can_receive_all_filters)->Arg(1)->Arg(10)->Arg(50);
+
+/**
+ * Benchmarks receiving frames with looking up the listeners in a CANFrameListenerIndex.
+ */
+void BM_can_receive_listener_index(benchmark::State& state) { receive(state, true); }
+
+BENCHMARK(BM_can_receive_listener_index)->Arg(1)->Arg(10)->Arg(50);
@@ -0,0 +1,160 @@
+// Copyright 2025 Accenture.
+
+/**
+ * Contains class CANFrameListenerIndex.
+ * \file         CANFrameListenerIndex.h
+ * \ingroup        framemgmt
+ */
+#pragma once
+
+#include "can/canframes/CanId.h"
+#include "can/filter/IMerger.h"
+#include "can/framemgmt/ICANFrameListener.h"
+
+#include <etl/atomic.h>
+#include <etl/intrusive_list.h>
+#include <etl/span.h>
+
+#include <platform/estdint.h>
+
+namespace can
+{
+class CANFrame;
+
+/**
+ * Index of the ICANFrameListeners of a transceiver for dispatching received frames in O(1).
+ * \class        CANFrameListenerIndex
+ *
+ * The index maps each CAN identifier to the bitmask of the listeners whose filter matches it,
+ * bit i representing the i-th listener of the list it has been built from:
+ * - base identifiers are looked up in a dense table of MAX_BASE_ID + 1 entries
+ * - all other identifiers are looked up in a sorted list of disjoint intervals with the merged
+ *   masks of all IntervalFilters overlapping them, using a binary search
+ *
+ * The filters of the listeners are collected through the IMerger interface, i.e. from
+ * BitFieldFilters, AbstractStaticBitFieldFilters and IntervalFilters. A filter changed after
+ * building the index doesn't take effect until the index is built again.
+ *
+ * The index keeps two tables: lookups use the active one while prepare() builds the other one,
+ * which activate() then makes the active one. Building takes a while, so it can run without a
+ * lock, while switching the tables only exchanges a pointer. notifyListeners() counts itself as
+ * reader of the table it uses, and prepare() only reuses a table that isn't read anymore. If both
+ * tables are still read, prepare() fails and the index stays invalid until it is prepared again.
+ * invalidate() stops further lookups in the active table, e.g. as soon as a listener is removed.
+ *
+ * The index requires about 37 kB of memory for the two base identifier tables and is therefore
+ * optional for a transceiver, see AbstractCANTransceiver::setListenerIndex().
+ */
+class CANFrameListenerIndex : public IMerger
+{
+public:
+    using ListenerList = ::etl::intrusive_list<ICANFrameListener, ::etl::bidirectional_link<0>>;
+    using Mask         = uint64_t;
+
+    /** maximum number of listeners that can be indexed */
+    static constexpr uint32_t MAX_LISTENERS = 64U;
+    /** maximum number of intervals of extended identifiers that can be indexed */
+    static constexpr uint32_t MAX_INTERVALS = 64U;
+    static constexpr uint32_t MAX_BASE_ID   = CanId::MAX_RAW_BASE_ID;
+
+    CANFrameListenerIndex();
+
+    CANFrameListenerIndex(CANFrameListenerIndex const&)            = delete;
+    CANFrameListenerIndex& operator=(CANFrameListenerIndex const&) = delete;
+
+    /**
+     * Builds the index from the filters of listeners and activates it.
+     * \param    listeners    listeners in the order they shall be notified
+     * \return
+     *             - true: the index is valid
+     *             - false: there are more than MAX_LISTENERS listeners or more than
+     *               MAX_INTERVALS intervals of extended identifiers, the index is invalid
+     */
+    bool build(ListenerList& listeners);
+
+    /**
+     * Builds an inactive table that isn't read anymore from the filters of listeners, lookups
+     * are not affected until activate() is called.
+     * \param    listeners    listeners in the order they shall be notified
+     * \return
+     *             - true: the table is valid
+     *             - false: there are more than MAX_LISTENERS listeners or more than
+     *               MAX_INTERVALS intervals of extended identifiers, or both tables are still
+     *               read, the table is invalid
+     */
+    bool prepare(::etl::span<ICANFrameListener* const> listeners);
+
+    /**
+     * Makes the table built by the last call of prepare() the active one.
+     */
+    void activate();
+
+    /**
+     * Stops lookups in the active table until activate() is called again.
+     */
+    void invalidate();
+
+    /**
+     * \return    true if there is an active table that has been built successfully
+     */
+    bool isValid() const;
+
+    /**
+     * Must not be called concurrently with prepare().
+     * \return    mask of the listeners matching id
+     */
+    Mask lookup(uint32_t id) const;
+
+    /**
+     * Notifies all listeners matching the id of frame in the order of the list the index has
+     * been built from.
+     * \return
+     *             - true: the listeners have been notified
+     *             - false: the index is invalid, no listener has been notified
+     */
+    bool notifyListeners(CANFrame const& frame);
+
+    void mergeWithBitField(BitFieldFilter const& filter) override;
+
+    void mergeWithStaticBitField(AbstractStaticBitFieldFilter const& filter) override;
+
+    void mergeWithInterval(IntervalFilter const& filter) override;
+
+private:
+    struct Interval
+    {
+        uint32_t from;
+        uint32_t to;
+        Mask mask;
+    };
+
+    struct Table
+    {
+        Mask baseMasks[MAX_BASE_ID + 1U];
+        ICANFrameListener* listeners[MAX_LISTENERS];
+        /** start of the i-th segment of the identifiers above MAX_BASE_ID */
+        uint32_t segmentStarts[(2U * MAX_INTERVALS) + 1U];
+        Mask segmentMasks[(2U * MAX_INTERVALS) + 1U];
+        uint32_t segmentCount;
+        bool valid;
+        /** number of notifyListeners() calls using the table */
+        ::etl::atomic<uint32_t> readers;
+    };
+
+    static Mask lookup(Table const& table, uint32_t id);
+
+    void addBaseIds(uint32_t from, uint32_t to);
+
+    void buildSegments();
+
+    Table _tables[2];
+    /** table used for lookups, nullptr if invalidated */
+    ::etl::atomic<Table*> _table;
+    /** table built by prepare(), nullptr if none was free */
+    Table* _nextTable;
+    Interval _intervals[MAX_INTERVALS];
+    uint32_t _intervalCount;
+    Mask _current;
+};
+
+} // namespace can
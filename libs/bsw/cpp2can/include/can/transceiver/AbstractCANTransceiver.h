@@ -10,6 +10,7 @@
 #include "can/canframes/CANFrame.h"
 #include "can/framemgmt/AbstractBitFieldFilteredCANFrameListener.h"
 #include "can/framemgmt/AbstractIntervalFilteredCANFrameListener.h"
+#include "can/framemgmt/CANFrameListenerIndex.h"
 #include "can/framemgmt/IFilteredCANFrameSentListener.h"
 #include "can/transceiver/ICANTransceiverStateListener.h"
 #include "can/transceiver/ICanTransceiver.h"
@@ -43,6 +44,11 @@ class CanTransportLayer;
  * notifyListeners() with the received CANFrame which distributes it to all
  * listeners, i.e. to all listeners whose filter match the id of fRxFrame.
  *
+ * By default notifyListeners() checks the filter of each listener. With a
+ * CANFrameListenerIndex set by setListenerIndex() the matching listeners are
+ * looked up instead, so the cost of receiving a frame doesn't depend on the
+ * number of listeners.
+ *
  */
 class AbstractCANTransceiver : public ICanTransceiver
 {
@@ -116,6 +122,21 @@ public:
      */
     void removeCANFrameSentListener(IFilteredCANFrameSentListener& listener) override;
 
+    /**
+     * Sets the index used to look up the listeners of received frames.
+     * \param    index    CANFrameListenerIndex to use
+     *
+     * This method contains a critical section and uses Suspend-/ResumeOSInterrupts.
+     *
+     * The index is built from the registered listeners and rebuilt whenever a listener
+     * is added or removed. While the index is not valid, e.g. because there are more
+     * than CANFrameListenerIndex::MAX_LISTENERS listeners, the filters of all listeners
+     * are checked. The index is built outside of the critical section into its inactive
+     * table, interrupts are only suspended to copy the list of listeners and to switch
+     * the tables.
+     */
+    void setListenerIndex(CANFrameListenerIndex& index);
+
     /**
      * \return    busId of transceiver
      */
@@ -173,9 +194,18 @@ protected:
      */
     void notifyStateListenerWithState(ICANTransceiverStateListener::CANTransceiverState state);
 
+private:
+    /** must be called with interrupts suspended */
+    void invalidateListenerIndex();
+    void updateListenerIndex();
+
 protected:
     BitFieldFilter _filter;
     ::etl::intrusive_list<ICANFrameListener, ::etl::bidirectional_link<0>> _listeners;
+    CANFrameListenerIndex* _listenerIndex;
+    /** incremented whenever the listeners change, an outdated index isn't activated */
+    uint32_t _listenerGeneration;
+    bool _listenerIndexBuilding;
     IFilteredCANFrameSentListener* _sentListener;
     ::etl::intrusive_forward_list<IFilteredCANFrameSentListener, ::etl::forward_link<0>>
         _sentListeners;
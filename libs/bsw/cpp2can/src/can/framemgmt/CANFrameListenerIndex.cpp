@@ -0,0 +1,244 @@
+// Copyright 2025 Accenture.
+
+#include "can/framemgmt/CANFrameListenerIndex.h"
+
+#include "can/canframes/CANFrame.h"
+#include "can/filter/AbstractStaticBitFieldFilter.h"
+#include "can/filter/BitFieldFilter.h"
+#include "can/filter/IntervalFilter.h"
+
+#include <etl/algorithm.h>
+#include <etl/binary.h>
+#include <etl/limits.h>
+
+namespace can
+{
+#ifdef __GNUC__
+constexpr uint32_t CANFrameListenerIndex::MAX_LISTENERS;
+constexpr uint32_t CANFrameListenerIndex::MAX_INTERVALS;
+constexpr uint32_t CANFrameListenerIndex::MAX_BASE_ID;
+#endif
+
+CANFrameListenerIndex::CANFrameListenerIndex()
+: _tables(), _table(nullptr), _nextTable(nullptr), _intervals(), _intervalCount(0U), _current(0U)
+{}
+
+bool CANFrameListenerIndex::build(ListenerList& listeners)
+{
+    ICANFrameListener* listenerArray[MAX_LISTENERS + 1U];
+    uint32_t count = 0U;
+    for (auto& listener : listeners)
+    {
+        listenerArray[count] = &listener;
+        ++count;
+        if (count > MAX_LISTENERS)
+        {
+            break;
+        }
+    }
+    bool const valid = prepare(::etl::span<ICANFrameListener* const>(listenerArray, count));
+    activate();
+    return valid;
+}
+
+bool CANFrameListenerIndex::prepare(::etl::span<ICANFrameListener* const> const listeners)
+{
+    // a lookup marks itself as reader before checking that its table is still the active one,
+    // so a table found unread here won't be read until it has been activated again
+    Table const* const active = _table.load();
+    _nextTable                = nullptr;
+    for (Table& candidate : _tables)
+    {
+        if ((&candidate != active) && (candidate.readers.load() == 0U))
+        {
+            _nextTable = &candidate;
+            break;
+        }
+    }
+    if (_nextTable == nullptr)
+    {
+        return false;
+    }
+
+    Table& table = *_nextTable;
+    ::etl::fill(&table.baseMasks[0], &table.baseMasks[MAX_BASE_ID + 1U], static_cast<Mask>(0U));
+    _intervalCount     = 0U;
+    table.segmentCount = 0U;
+    table.valid        = (listeners.size() <= MAX_LISTENERS);
+
+    for (uint32_t index = 0U; table.valid && (index < listeners.size()); ++index)
+    {
+        table.listeners[index] = listeners[index];
+        _current               = static_cast<Mask>(1U) << index;
+        listeners[index]->getFilter().acceptMerger(*this);
+    }
+    if (table.valid)
+    {
+        buildSegments();
+    }
+    return table.valid;
+}
+
+void CANFrameListenerIndex::activate()
+{
+    if (_nextTable != nullptr)
+    {
+        _table.store(_nextTable);
+        _nextTable = nullptr;
+    }
+}
+
+void CANFrameListenerIndex::invalidate() { _table.store(nullptr); }
+
+bool CANFrameListenerIndex::isValid() const
+{
+    Table const* const table = _table.load();
+    return (table != nullptr) && table->valid;
+}
+
+CANFrameListenerIndex::Mask CANFrameListenerIndex::lookup(uint32_t const id) const
+{
+    Table const* const table = _table.load();
+    return (table != nullptr) ? lookup(*table, id) : 0U;
+}
+
+bool CANFrameListenerIndex::notifyListeners(CANFrame const& frame)
+{
+    Table* const table = _table.load();
+    if (table == nullptr)
+    {
+        return false;
+    }
+    (void)table->readers.fetch_add(1U);
+    // the table may have been retired and handed to prepare() before it was marked as read
+    if ((_table.load() != table) || (!table->valid))
+    {
+        (void)table->readers.fetch_sub(1U);
+        return false;
+    }
+    Mask mask = lookup(*table, frame.getId());
+    while (mask != 0U)
+    {
+        uint32_t const index = ::etl::count_trailing_zeros(mask);
+        mask &= mask - 1U;
+        table->listeners[index]->frameReceived(frame);
+    }
+    (void)table->readers.fetch_sub(1U);
+    return true;
+}
+
+CANFrameListenerIndex::Mask CANFrameListenerIndex::lookup(Table const& table, uint32_t const id)
+{
+    if (id <= MAX_BASE_ID)
+    {
+        return table.baseMasks[id];
+    }
+    uint32_t const* const end = &table.segmentStarts[table.segmentCount];
+    uint32_t const* const it  = ::etl::upper_bound(&table.segmentStarts[0], end, id);
+    if (it == &table.segmentStarts[0])
+    {
+        return 0U;
+    }
+    return table.segmentMasks[(it - &table.segmentStarts[0]) - 1];
+}
+
+void CANFrameListenerIndex::mergeWithBitField(BitFieldFilter const& filter)
+{
+    uint8_t const* const bitField = filter.getRawBitField();
+    for (uint32_t id = 0U; id <= BitFieldFilter::MAX_ID; ++id)
+    {
+        if ((bitField[id / 8U] & (1U << (id % 8U))) != 0U)
+        {
+            _nextTable->baseMasks[id] |= _current;
+        }
+    }
+}
+
+void CANFrameListenerIndex::mergeWithStaticBitField(AbstractStaticBitFieldFilter const& filter)
+{
+    for (uint16_t i = 0U; i < AbstractStaticBitFieldFilter::MASK_SIZE; ++i)
+    {
+        uint8_t const value = filter.getMaskValue(i);
+        for (uint32_t bit = 0U; bit < 8U; ++bit)
+        {
+            if ((value & (1U << bit)) != 0U)
+            {
+                _nextTable->baseMasks[(i * 8U) + bit] |= _current;
+            }
+        }
+    }
+}
+
+void CANFrameListenerIndex::mergeWithInterval(IntervalFilter const& filter)
+{
+    uint32_t const from = filter.getLowerBound();
+    uint32_t const to   = filter.getUpperBound();
+    if (from > to)
+    {
+        return; // empty filter
+    }
+    if (from <= MAX_BASE_ID)
+    {
+        addBaseIds(from, ::etl::min(to, MAX_BASE_ID));
+    }
+    if (to > MAX_BASE_ID)
+    {
+        if (_intervalCount == MAX_INTERVALS)
+        {
+            _nextTable->valid = false;
+            return;
+        }
+        _intervals[_intervalCount] = {::etl::max(from, MAX_BASE_ID + 1U), to, _current};
+        ++_intervalCount;
+    }
+}
+
+void CANFrameListenerIndex::addBaseIds(uint32_t const from, uint32_t const to)
+{
+    for (uint32_t id = from; id <= to; ++id)
+    {
+        _nextTable->baseMasks[id] |= _current;
+    }
+}
+
+void CANFrameListenerIndex::buildSegments()
+{
+    Table& table = *_nextTable;
+
+    // collect the boundaries of all intervals, each of them starts a segment
+    uint32_t boundaryCount = 0U;
+    for (uint32_t i = 0U; i < _intervalCount; ++i)
+    {
+        table.segmentStarts[boundaryCount] = _intervals[i].from;
+        ++boundaryCount;
+        if (_intervals[i].to < ::etl::numeric_limits<uint32_t>::max())
+        {
+            table.segmentStarts[boundaryCount] = _intervals[i].to + 1U;
+            ++boundaryCount;
+        }
+    }
+    ::etl::sort(&table.segmentStarts[0], &table.segmentStarts[boundaryCount]);
+
+    // assign the merged masks and join adjacent segments with equal masks, which also removes
+    // duplicate boundaries
+    for (uint32_t i = 0U; i < boundaryCount; ++i)
+    {
+        uint32_t const start = table.segmentStarts[i];
+        Mask mask            = 0U;
+        for (uint32_t j = 0U; j < _intervalCount; ++j)
+        {
+            if ((start >= _intervals[j].from) && (start <= _intervals[j].to))
+            {
+                mask |= _intervals[j].mask;
+            }
+        }
+        if ((table.segmentCount == 0U) || (table.segmentMasks[table.segmentCount - 1U] != mask))
+        {
+            table.segmentStarts[table.segmentCount] = start;
+            table.segmentMasks[table.segmentCount]  = mask;
+            ++table.segmentCount;
+        }
+    }
+}
+
+} // namespace can
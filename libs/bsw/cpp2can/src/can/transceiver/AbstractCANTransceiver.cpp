@@ -16,6 +16,9 @@ using interrupts::SuspendResumeAllInterruptsScopedLock;
 AbstractCANTransceiver::AbstractCANTransceiver(uint8_t const busId)
 : _filter()
 , _listeners()
+, _listenerIndex(nullptr)
+, _listenerGeneration(0U)
+, _listenerIndexBuilding(false)
 , _sentListener(nullptr)
 , _sentListeners()
 , _baudrate(0U)
@@ -27,28 +30,104 @@ AbstractCANTransceiver::AbstractCANTransceiver(uint8_t const busId)
 
 void AbstractCANTransceiver::addCANFrameListener(ICANFrameListener& listener)
 {
-    ESR_UNUSED const SuspendResumeAllInterruptsScopedLock lock;
-    if (!_listeners.contains_node(listener))
     {
+        ESR_UNUSED const SuspendResumeAllInterruptsScopedLock lock;
+        if (_listeners.contains_node(listener))
+        {
+            return;
+        }
         _listeners.push_back(listener);
         listener.getFilter().acceptMerger(_filter);
+        invalidateListenerIndex();
     }
+    updateListenerIndex();
 }
 
 void AbstractCANTransceiver::addVIPCANFrameListener(ICANFrameListener& listener)
 {
-    ESR_UNUSED const SuspendResumeAllInterruptsScopedLock lock;
-    if (!_listeners.contains_node(listener))
     {
+        ESR_UNUSED const SuspendResumeAllInterruptsScopedLock lock;
+        if (_listeners.contains_node(listener))
+        {
+            return;
+        }
         _listeners.push_front(listener);
         listener.getFilter().acceptMerger(_filter);
+        invalidateListenerIndex();
     }
+    updateListenerIndex();
 }
 
 void AbstractCANTransceiver::removeCANFrameListener(ICANFrameListener& listener)
 {
-    ESR_UNUSED const SuspendResumeAllInterruptsScopedLock lock;
-    _listeners.erase(listener);
+    {
+        ESR_UNUSED const SuspendResumeAllInterruptsScopedLock lock;
+        _listeners.erase(listener);
+        invalidateListenerIndex();
+    }
+    updateListenerIndex();
+}
+
+void AbstractCANTransceiver::setListenerIndex(CANFrameListenerIndex& index)
+{
+    {
+        ESR_UNUSED const SuspendResumeAllInterruptsScopedLock lock;
+        _listenerIndex = &index;
+        invalidateListenerIndex();
+    }
+    updateListenerIndex();
+}
+
+void AbstractCANTransceiver::invalidateListenerIndex()
+{
+    // received frames are passed to the list until an index of the current listeners is active
+    ++_listenerGeneration;
+    if (_listenerIndex != nullptr)
+    {
+        _listenerIndex->invalidate();
+    }
+}
+
+void AbstractCANTransceiver::updateListenerIndex()
+{
+    ICANFrameListener* listeners[CANFrameListenerIndex::MAX_LISTENERS + 1U];
+    while (true)
+    {
+        CANFrameListenerIndex* index = nullptr;
+        uint32_t generation          = 0U;
+        uint32_t count               = 0U;
+        {
+            // only copy the listeners while interrupts are suspended, a build running meanwhile
+            // in another context builds again after it has finished
+            ESR_UNUSED const SuspendResumeAllInterruptsScopedLock lock;
+            if ((_listenerIndex == nullptr) || _listenerIndexBuilding)
+            {
+                return;
+            }
+            _listenerIndexBuilding = true;
+            index                  = _listenerIndex;
+            generation             = _listenerGeneration;
+            for (auto& listener : _listeners)
+            {
+                listeners[count] = &listener;
+                ++count;
+                if (count > CANFrameListenerIndex::MAX_LISTENERS)
+                {
+                    break;
+                }
+            }
+        }
+
+        (void)index->prepare(::etl::span<ICANFrameListener* const>(listeners, count));
+
+        ESR_UNUSED const SuspendResumeAllInterruptsScopedLock lock;
+        _listenerIndexBuilding = false;
+        if (generation == _listenerGeneration)
+        {
+            index->activate();
+            return;
+        }
+    }
 }
 
 void AbstractCANTransceiver::addCANFrameSentListener(IFilteredCANFrameSentListener& listener)
@@ -70,6 +149,11 @@ void AbstractCANTransceiver::notifyListeners(CANFrame const& frame)
         return; // don't receive messages in state CLOSED
     }
 
+    if ((_listenerIndex != nullptr) && _listenerIndex->notifyListeners(frame))
+    {
+        return;
+    }
+
     for (auto& listener : _listeners)
     {
         if (listener.getFilter().match(frame.getId()))
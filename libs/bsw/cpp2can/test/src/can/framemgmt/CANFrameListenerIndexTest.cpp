@@ -0,0 +1,317 @@
+// Copyright 2025 Accenture.
+
+#include "can/framemgmt/CANFrameListenerIndex.h"
+
+#include "can/canframes/CANFrame.h"
+#include "can/canframes/CanId.h"
+#include "can/framemgmt/AbstractBitFieldFilteredCANFrameListener.h"
+#include "can/framemgmt/AbstractIntervalFilteredCANFrameListener.h"
+
+#include <gmock/gmock.h>
+
+namespace
+{
+using namespace ::can;
+using namespace ::testing;
+
+class BitFieldListener : public AbstractBitFieldFilteredCANFrameListener
+{
+public:
+    MOCK_METHOD(void, frameReceived, (CANFrame const& frame));
+};
+
+class IntervalListener : public AbstractIntervalFilteredCANFrameListener
+{
+public:
+    MOCK_METHOD(void, frameReceived, (CANFrame const& frame));
+};
+
+class StaticFilter : public AbstractStaticBitFieldFilter
+{
+public:
+    // matches the ids 0x008..0x00F
+    uint8_t getMaskValue(uint16_t const byteIndex) const override
+    {
+        return (byteIndex == 1U) ? 0xFFU : 0x00U;
+    }
+};
+
+class StaticListener : public ICANFrameListener
+{
+public:
+    MOCK_METHOD(void, frameReceived, (CANFrame const& frame));
+
+    IFilter& getFilter() override { return _filter; }
+
+private:
+    StaticFilter _filter;
+};
+
+class TwoIntervalsFilter : public IntervalFilter
+{
+public:
+    void acceptMerger(IMerger& merger) override
+    {
+        IntervalFilter const first(CanId::extended(0x1000U), CanId::extended(0x1001U));
+        IntervalFilter const second(CanId::extended(0x2000U), CanId::extended(0x2001U));
+        merger.mergeWithInterval(first);
+        merger.mergeWithInterval(second);
+    }
+};
+
+class TwoIntervalsListener : public ICANFrameListener
+{
+public:
+    MOCK_METHOD(void, frameReceived, (CANFrame const& frame));
+
+    IFilter& getFilter() override { return _filter; }
+
+private:
+    TwoIntervalsFilter _filter;
+};
+
+class CANFrameListenerIndexTest : public ::testing::Test
+{
+protected:
+    CANFrameListenerIndex::ListenerList _listeners;
+    CANFrameListenerIndex _index;
+};
+
+/**
+ * \desc
+ * An index which has not been built is invalid and matches nothing.
+ */
+TEST_F(CANFrameListenerIndexTest, initially_invalid)
+{
+    EXPECT_FALSE(_index.isValid());
+    EXPECT_EQ(0U, _index.lookup(0x100U));
+    EXPECT_EQ(0U, _index.lookup(CanId::extended(0x100U)));
+    EXPECT_TRUE(_index.build(_listeners));
+    EXPECT_TRUE(_index.isValid());
+    EXPECT_EQ(0U, _index.lookup(0x100U));
+}
+
+/**
+ * \desc
+ * Base identifiers of BitFieldFilters, AbstractStaticBitFieldFilters and IntervalFilters are
+ * looked up in the base identifier table.
+ */
+TEST_F(CANFrameListenerIndexTest, base_ids)
+{
+    BitFieldListener bitField;
+    bitField.getFilter().add(0x123U);
+    bitField.getFilter().add(0x7FFU);
+    StaticListener staticBitField;
+    IntervalListener interval;
+    interval.getFilter().add(0x00AU, 0x200U);
+    _listeners.push_back(bitField);
+    _listeners.push_back(staticBitField);
+    _listeners.push_back(interval);
+
+    ASSERT_TRUE(_index.build(_listeners));
+    EXPECT_EQ(0U, _index.lookup(0x000U));
+    EXPECT_EQ(0x2U, _index.lookup(0x008U));
+    EXPECT_EQ(0x6U, _index.lookup(0x00AU));
+    EXPECT_EQ(0x4U, _index.lookup(0x010U));
+    EXPECT_EQ(0x5U, _index.lookup(0x123U));
+    EXPECT_EQ(0x4U, _index.lookup(0x200U));
+    EXPECT_EQ(0x0U, _index.lookup(0x201U));
+    EXPECT_EQ(0x1U, _index.lookup(0x7FFU));
+    // BitFieldFilters don't match extended ids
+    EXPECT_EQ(0U, _index.lookup(CanId::extended(0x123U)));
+    _listeners.clear();
+}
+
+/**
+ * \desc
+ * Overlapping intervals of extended identifiers are merged into disjoint segments.
+ */
+TEST_F(CANFrameListenerIndexTest, extended_id_intervals)
+{
+    IntervalListener first;
+    first.getFilter().add(CanId::extended(0x1000U), CanId::extended(0x2000U));
+    IntervalListener second;
+    second.getFilter().add(CanId::extended(0x1800U), CanId::extended(0x3000U));
+    IntervalListener third;
+    third.getFilter().add(CanId::extended(0x1800U), CanId::extended(0x1800U));
+    IntervalListener all;
+    all.getFilter().open();
+    IntervalListener empty;
+    _listeners.push_back(first);
+    _listeners.push_back(second);
+    _listeners.push_back(third);
+    _listeners.push_back(all);
+    _listeners.push_back(empty);
+
+    ASSERT_TRUE(_index.build(_listeners));
+    EXPECT_EQ(0x8U, _index.lookup(0x000U));
+    EXPECT_EQ(0x8U, _index.lookup(0x7FFU));
+    EXPECT_EQ(0x8U, _index.lookup(0x800U));
+    EXPECT_EQ(0x8U, _index.lookup(CanId::extended(0x0FFFU)));
+    EXPECT_EQ(0x9U, _index.lookup(CanId::extended(0x1000U)));
+    EXPECT_EQ(0x9U, _index.lookup(CanId::extended(0x17FFU)));
+    EXPECT_EQ(0xFU, _index.lookup(CanId::extended(0x1800U)));
+    EXPECT_EQ(0xBU, _index.lookup(CanId::extended(0x1801U)));
+    EXPECT_EQ(0xBU, _index.lookup(CanId::extended(0x2000U)));
+    EXPECT_EQ(0xAU, _index.lookup(CanId::extended(0x2001U)));
+    EXPECT_EQ(0xAU, _index.lookup(CanId::extended(0x3000U)));
+    EXPECT_EQ(0x8U, _index.lookup(CanId::extended(0x3001U)));
+    EXPECT_EQ(0x8U, _index.lookup(IntervalFilter::MAX_ID));
+    EXPECT_EQ(0x0U, _index.lookup(CanId::INVALID_ID));
+    _listeners.clear();
+}
+
+/**
+ * \desc
+ * Matching listeners are notified in the order of the list.
+ */
+TEST_F(CANFrameListenerIndexTest, notify_listeners_in_list_order)
+{
+    BitFieldListener first;
+    first.getFilter().add(0x123U);
+    IntervalListener second;
+    second.getFilter().add(0x100U, 0x200U);
+    BitFieldListener third;
+    third.getFilter().add(0x124U);
+    _listeners.push_back(second);
+    _listeners.push_front(first);
+    _listeners.push_back(third);
+    ASSERT_TRUE(_index.build(_listeners));
+
+    CANFrame frame(0x123U, nullptr, 0U);
+    Sequence sequence;
+    EXPECT_CALL(first, frameReceived(Ref(frame))).InSequence(sequence);
+    EXPECT_CALL(second, frameReceived(Ref(frame))).InSequence(sequence);
+    _index.notifyListeners(frame);
+    _listeners.clear();
+}
+
+/**
+ * \desc
+ * An index can't hold more than MAX_LISTENERS listeners or MAX_INTERVALS intervals of extended
+ * identifiers.
+ */
+TEST_F(CANFrameListenerIndexTest, too_many_listeners_or_intervals)
+{
+    IntervalListener listeners[CANFrameListenerIndex::MAX_LISTENERS + 1U];
+    for (auto& listener : listeners)
+    {
+        listener.getFilter().add(0x100U);
+        _listeners.push_back(listener);
+    }
+    EXPECT_FALSE(_index.build(_listeners));
+    EXPECT_FALSE(_index.isValid());
+
+    _listeners.erase(listeners[0]);
+    EXPECT_TRUE(_index.build(_listeners));
+    EXPECT_EQ(~static_cast<CANFrameListenerIndex::Mask>(0U), _index.lookup(0x100U));
+
+    for (uint32_t i = 1U; i < (CANFrameListenerIndex::MAX_INTERVALS + 1U); ++i)
+    {
+        listeners[i].getFilter().clear();
+        listeners[i].getFilter().add(CanId::extended(i));
+    }
+    EXPECT_TRUE(_index.build(_listeners));
+    EXPECT_EQ(0x1U, _index.lookup(CanId::extended(1U)));
+    EXPECT_EQ(
+        static_cast<CANFrameListenerIndex::Mask>(1U) << (CANFrameListenerIndex::MAX_INTERVALS - 1U),
+        _index.lookup(CanId::extended(CANFrameListenerIndex::MAX_INTERVALS)));
+
+    _listeners.erase(listeners[1]);
+    TwoIntervalsListener twoIntervals;
+    _listeners.push_back(twoIntervals);
+    EXPECT_FALSE(_index.build(_listeners));
+    _listeners.clear();
+}
+
+/**
+ * \desc
+ * prepare() builds the inactive table, lookups use the previous table until activate() is called.
+ */
+TEST_F(CANFrameListenerIndexTest, prepare_and_activate)
+{
+    BitFieldListener first;
+    first.getFilter().add(0x123U);
+    BitFieldListener second;
+    second.getFilter().add(0x456U);
+    ICANFrameListener* const firstOnly[] = {&first};
+    ICANFrameListener* const both[]      = {&second, &first};
+
+    EXPECT_TRUE(_index.prepare(firstOnly));
+    EXPECT_FALSE(_index.isValid());
+    _index.activate();
+    EXPECT_TRUE(_index.isValid());
+    EXPECT_EQ(0x1U, _index.lookup(0x123U));
+
+    EXPECT_TRUE(_index.prepare(both));
+    EXPECT_EQ(0x1U, _index.lookup(0x123U));
+    EXPECT_EQ(0x0U, _index.lookup(0x456U));
+    _index.activate();
+    EXPECT_EQ(0x2U, _index.lookup(0x123U));
+    EXPECT_EQ(0x1U, _index.lookup(0x456U));
+
+    EXPECT_CALL(second, frameReceived(_)).Times(1);
+    EXPECT_TRUE(_index.notifyListeners(CANFrame(0x456U, nullptr, 0U)));
+}
+
+/**
+ * \desc
+ * An invalidated index notifies no listener until a table is activated again.
+ */
+TEST_F(CANFrameListenerIndexTest, invalidate)
+{
+    BitFieldListener listener;
+    listener.getFilter().add(0x123U);
+    _listeners.push_back(listener);
+    EXPECT_TRUE(_index.build(_listeners));
+
+    _index.invalidate();
+    EXPECT_FALSE(_index.isValid());
+    EXPECT_EQ(0U, _index.lookup(0x123U));
+    EXPECT_FALSE(_index.notifyListeners(CANFrame(0x123U, nullptr, 0U)));
+
+    EXPECT_TRUE(_index.build(_listeners));
+    EXPECT_CALL(listener, frameReceived(_)).Times(1);
+    EXPECT_TRUE(_index.notifyListeners(CANFrame(0x123U, nullptr, 0U)));
+    _listeners.clear();
+}
+
+/**
+ * \desc
+ * prepare() doesn't reuse a table that is still read by notifyListeners(), even after it has
+ * been retired.
+ */
+TEST_F(CANFrameListenerIndexTest, prepare_skips_tables_being_read)
+{
+    BitFieldListener first;
+    first.getFilter().add(0x123U);
+    BitFieldListener second;
+    second.getFilter().add(0x456U);
+    ICANFrameListener* const firstOnly[]  = {&first};
+    ICANFrameListener* const secondOnly[] = {&second};
+
+    EXPECT_TRUE(_index.prepare(firstOnly));
+    _index.activate();
+
+    EXPECT_CALL(first, frameReceived(_))
+        .WillOnce(Invoke(
+            [&](CANFrame const&)
+            {
+                // the other table is free
+                EXPECT_TRUE(_index.prepare(secondOnly));
+                _index.activate();
+                EXPECT_EQ(0x1U, _index.lookup(0x456U));
+                // the retired table is still read, the active one is in use
+                EXPECT_FALSE(_index.prepare(firstOnly));
+                _index.activate();
+                EXPECT_EQ(0x1U, _index.lookup(0x456U));
+            }));
+    EXPECT_TRUE(_index.notifyListeners(CANFrame(0x123U, nullptr, 0U)));
+
+    EXPECT_TRUE(_index.prepare(firstOnly));
+    _index.activate();
+    EXPECT_EQ(0x1U, _index.lookup(0x123U));
+    EXPECT_EQ(0x0U, _index.lookup(0x456U));
+}
+
+} // namespace
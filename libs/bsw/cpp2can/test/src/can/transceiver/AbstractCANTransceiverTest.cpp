@@ -14,6 +14,8 @@
 
 #include <gmock/gmock.h>
 
+#include <functional>
+
 namespace
 {
 using namespace ::can;
@@ -116,6 +118,36 @@ private:
     aBitFieldFilter filter;
 };
 
+/**
+ * IntervalFilter calling a function when it is merged, e.g. while a listener index is built.
+ */
+class tMergeHookFilter : public IntervalFilter
+{
+public:
+    void acceptMerger(IMerger& merger) override
+    {
+        if (onMerge)
+        {
+            auto const function = onMerge;
+            onMerge             = nullptr;
+            function();
+        }
+        IntervalFilter::acceptMerger(merger);
+    }
+
+    ::std::function<void()> onMerge;
+};
+
+class tMergeHookListener : public ICANFrameListener
+{
+public:
+    MOCK_METHOD(void, frameReceived, (CANFrame const& frame));
+
+    IFilter& getFilter() override { return filter; }
+
+    tMergeHookFilter filter;
+};
+
 class tStateChangeListener
 : public ICANTransceiverStateListener
 , public ICANFrameSentListener
@@ -365,6 +397,123 @@ TEST_F(AbstractCANTransceiverTest, testNotifyListeners)
     fpTransceiver->removeCANFrameListener(listener5);
 }
 
+/**
+ * @test
+ * verification of receive method with a listener index
+ */
+TEST_F(AbstractCANTransceiverTest, testNotifyListenersWithIndex)
+{
+    CANFrameListenerIndex index;
+    uint8_t payload[6] = {0x00, 0x01, 0x02, 0x03, 0x04, 0x05};
+    CANFrame frame(0x555, payload, 6);
+    CANFrame extendedFrame(CanId::extended(0x17000080), payload, 6);
+
+    tBitFieldListener listener1;
+    tIntervalListener listener2;
+    tIntervalListener listener3;
+    listener1.getFilter().add(0x555);
+    listener2.getFilter().add(0x000, 0x7FF);
+    listener3.getFilter().add(CanId::extended(0x17000000), CanId::extended(0x170000FF));
+
+    // listeners added before and after setting the index are indexed
+    fpTransceiver->addCANFrameListener(listener1);
+    fpTransceiver->setListenerIndex(index);
+    EXPECT_TRUE(index.isValid());
+    fpTransceiver->addCANFrameListener(listener2);
+    fpTransceiver->addVIPCANFrameListener(listener3);
+
+    // no reception in state CLOSED
+    fpTransceiver->inject(frame);
+
+    EXPECT_CALL(*fpTransceiver, open()).Times(1);
+    ASSERT_EQ(ICanTransceiver::ErrorCode::CAN_ERR_OK, fpTransceiver->open());
+    {
+        InSequence sequence;
+        EXPECT_CALL(listener1, frameReceived(_)).Times(1);
+        EXPECT_CALL(listener2, frameReceived(_)).Times(1);
+    }
+    fpTransceiver->inject(frame);
+    EXPECT_CALL(listener3, frameReceived(_)).Times(1);
+    fpTransceiver->inject(extendedFrame);
+
+    // a removed listener isn't notified anymore
+    fpTransceiver->removeCANFrameListener(listener1);
+    EXPECT_CALL(listener2, frameReceived(_)).Times(1);
+    fpTransceiver->inject(frame);
+
+    fpTransceiver->removeCANFrameListener(listener2);
+    fpTransceiver->removeCANFrameListener(listener3);
+    fpTransceiver->inject(frame);
+    fpTransceiver->inject(extendedFrame);
+}
+
+/**
+ * @test
+ * verification that a listener removed while the listener index is built isn't notified anymore
+ */
+TEST_F(AbstractCANTransceiverTest, testRemoveListenerWhileIndexIsBuilt)
+{
+    CANFrameListenerIndex index;
+    CANFrame frame(0x555, nullptr, 0);
+
+    tBitFieldListener listener1;
+    tMergeHookListener listener2;
+    tBitFieldListener listener3;
+    listener1.getFilter().add(0x555);
+    listener2.filter.add(0x555, 0x555);
+    fpTransceiver->addCANFrameListener(listener1);
+    fpTransceiver->addCANFrameListener(listener2);
+    fpTransceiver->setListenerIndex(index);
+    EXPECT_CALL(*fpTransceiver, open()).Times(1);
+    ASSERT_EQ(ICanTransceiver::ErrorCode::CAN_ERR_OK, fpTransceiver->open());
+
+    // remove listener1 while the index is built for adding listener3, the removal doesn't build
+    // the index itself, it is built again afterwards
+    listener2.filter.onMerge = [&]()
+    {
+        fpTransceiver->removeCANFrameListener(listener1);
+        EXPECT_FALSE(index.isValid());
+        fpTransceiver->inject(frame);
+    };
+    EXPECT_CALL(listener1, frameReceived(_)).Times(0);
+    EXPECT_CALL(listener2, frameReceived(_)).Times(2);
+    fpTransceiver->addCANFrameListener(listener3);
+    EXPECT_TRUE(index.isValid());
+    fpTransceiver->inject(frame);
+
+    fpTransceiver->removeCANFrameListener(listener2);
+    fpTransceiver->removeCANFrameListener(listener3);
+}
+
+/**
+ * @test
+ * verification that all listeners are notified if the listener index is not valid
+ */
+TEST_F(AbstractCANTransceiverTest, testNotifyListenersWithInvalidIndex)
+{
+    CANFrameListenerIndex index;
+    CANFrame frame(0x123, nullptr, 0);
+    tIntervalListener listeners[CANFrameListenerIndex::MAX_LISTENERS + 1U];
+
+    fpTransceiver->setListenerIndex(index);
+    for (auto& listener : listeners)
+    {
+        listener.getFilter().add(0x123);
+        fpTransceiver->addCANFrameListener(listener);
+        EXPECT_CALL(listener, frameReceived(_)).Times(1);
+    }
+    EXPECT_FALSE(index.isValid());
+
+    EXPECT_CALL(*fpTransceiver, open()).Times(1);
+    ASSERT_EQ(ICanTransceiver::ErrorCode::CAN_ERR_OK, fpTransceiver->open());
+    fpTransceiver->inject(frame);
+
+    for (auto& listener : listeners)
+    {
+        fpTransceiver->removeCANFrameListener(listener);
+    }
+}
+
 TEST_F(AbstractCANTransceiverTest, testNotifySentListeners)
 {
     uint8_t payload[6] = {0x00, 0x01, 0x02, 0x03, 0x04, 0x05};
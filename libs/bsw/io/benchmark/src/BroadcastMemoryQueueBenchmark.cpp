@@ -0,0 +1,111 @@
+// Copyright 2025 Accenture.
+
+#include <benchmark/benchmark.h>
+#include <etl/array.h>
+#include <etl/memory.h>
+#include <io/BroadcastMemoryQueue.h>
+#include <io/MemoryQueue.h>
+#include <io/SplitWriter.h>
+
+namespace
+{
+constexpr size_t CAPACITY     = 1024 * 4;
+constexpr size_t MAX_SIZE     = 128;
+constexpr size_t MESSAGE_SIZE = 64;
+
+/**
+ * Writes one message of MESSAGE_SIZE bytes and reads it from all readers.
+ */
+template<class Writer, class Reader, size_t N>
+void transfer(Writer& writer, ::etl::array<Reader*, N>& readers, uint8_t const value)
+{
+    auto const s = writer.allocate(MESSAGE_SIZE);
+    if (s.size() == MESSAGE_SIZE)
+    {
+        ::etl::mem_set(s.begin(), s.size(), value);
+        writer.commit();
+    }
+    for (auto* const reader : readers)
+    {
+        auto const r = reader->peek();
+        benchmark::DoNotOptimize(r.data());
+        reader->release();
+    }
+}
+} // namespace
+
+/**
+ * Benchmarks the fan-out of messages to N readers using a SplitWriter, which copies each message
+ * into N separate MemoryQueues.
+ */
+template<size_t N>
+void BM_split_writer_fan_out(benchmark::State& state)
+{
+    using Queue = ::io::MemoryQueue<CAPACITY, MAX_SIZE>;
+    ::etl::array<Queue, N> queues;
+    ::etl::array<::io::MemoryQueueWriter<Queue>*, N> writers;
+    ::etl::array<::io::IWriter*, N> destinations;
+    ::etl::array<::io::MemoryQueueReader<Queue>*, N> readers;
+    for (size_t i = 0; i < N; ++i)
+    {
+        writers[i]      = new ::io::MemoryQueueWriter<Queue>(queues[i]);
+        destinations[i] = writers[i];
+        readers[i]      = new ::io::MemoryQueueReader<Queue>(queues[i]);
+    }
+    ::io::SplitWriter<N> writer{::etl::span<::io::IWriter*, N>(destinations)};
+
+    uint8_t value = 0U;
+    for (auto _ : state)
+    {
+        transfer(writer, readers, value++);
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) * MESSAGE_SIZE);
+    state.counters["queueBytes"] = static_cast<double>(sizeof(queues));
+
+    for (size_t i = 0; i < N; ++i)
+    {
+        delete writers[i];
+        delete readers[i];
+    }
+}
+
+/**
+ * Benchmarks the fan-out of messages to N readers using a BroadcastMemoryQueue, which stores each
+ * message once.
+ */
+template<size_t N>
+void BM_broadcast_queue_fan_out(benchmark::State& state)
+{
+    using Queue = ::io::BroadcastMemoryQueue<CAPACITY, MAX_SIZE, N>;
+    Queue queue;
+    ::io::MemoryQueueWriter<Queue> writer(queue);
+    ::etl::array<::io::BroadcastMemoryQueueReader<Queue>*, N> readers;
+    for (size_t i = 0; i < N; ++i)
+    {
+        readers[i] = new ::io::BroadcastMemoryQueueReader<Queue>(queue, i);
+    }
+
+    uint8_t value = 0U;
+    for (auto _ : state)
+    {
+        transfer(writer, readers, value++);
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) * MESSAGE_SIZE);
+    state.counters["queueBytes"] = static_cast<double>(sizeof(queue));
+
+    for (size_t i = 0; i < N; ++i)
+    {
+        delete readers[i];
+    }
+}
+
+BENCHMARK_TEMPLATE(BM_split_writer_fan_out, 2);
+BENCHMARK_TEMPLATE(BM_broadcast_queue_fan_out, 2);
+BENCHMARK_TEMPLATE(BM_split_writer_fan_out, 3);
+BENCHMARK_TEMPLATE(BM_broadcast_queue_fan_out, 3);
+BENCHMARK_TEMPLATE(BM_split_writer_fan_out, 4);
+BENCHMARK_TEMPLATE(BM_broadcast_queue_fan_out, 4);
+BENCHMARK_TEMPLATE(BM_split_writer_fan_out, 6);
+BENCHMARK_TEMPLATE(BM_broadcast_queue_fan_out, 6);
+BENCHMARK_TEMPLATE(BM_split_writer_fan_out, 8);
+BENCHMARK_TEMPLATE(BM_broadcast_queue_fan_out, 8);
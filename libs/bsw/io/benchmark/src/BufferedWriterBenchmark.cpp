@@ -0,0 +1,82 @@
+// Copyright 2025 Accenture.
+
+#include <benchmark/benchmark.h>
+#include <etl/memory.h>
+#include <io/BufferedWriter.h>
+#include <io/MemoryQueue.h>
+
+namespace
+{
+constexpr size_t CAPACITY   = 1024 * 4;
+constexpr size_t MAX_SIZE   = 1024;
+constexpr size_t FRAME_SIZE = 16;
+using Queue                 = ::io::MemoryQueue<CAPACITY, MAX_SIZE>;
+} // namespace
+
+/**
+ * Benchmarks writing small frames directly into a MemoryQueue, one queue element per frame.
+ */
+void BM_memory_queue_writer_small_frames(benchmark::State& state)
+{
+    Queue q;
+    ::io::MemoryQueueWriter<Queue> w(q);
+    ::io::MemoryQueueReader<Queue> r(q);
+
+    for (auto _ : state)
+    {
+        auto s = w.allocate(FRAME_SIZE);
+        while (s.size() > 0U)
+        {
+            ::etl::mem_set(s.begin(), s.size(), static_cast<uint8_t>(0xAAU));
+            w.commit();
+            s = w.allocate(FRAME_SIZE);
+        }
+        s = r.peek();
+        while (s.size() > 0U)
+        {
+            benchmark::DoNotOptimize(s.data());
+            r.release();
+            s = r.peek();
+        }
+    }
+    state.SetBytesProcessed(
+        static_cast<int64_t>(state.iterations()) * (CAPACITY / (FRAME_SIZE + 2U)) * FRAME_SIZE);
+}
+
+BENCHMARK(BM_memory_queue_writer_small_frames);
+
+/**
+ * Benchmarks packing small frames through a BufferedWriter into MAX_SIZE elements of a
+ * MemoryQueue.
+ */
+void BM_buffered_writer_small_frames(benchmark::State& state)
+{
+    Queue q;
+    ::io::MemoryQueueWriter<Queue> w(q);
+    ::io::MemoryQueueReader<Queue> r(q);
+    ::io::BufferedWriter buffered(w);
+    int64_t frames = 0;
+
+    for (auto _ : state)
+    {
+        auto s = buffered.allocate(FRAME_SIZE);
+        while (s.size() > 0U)
+        {
+            ::etl::mem_set(s.begin(), s.size(), static_cast<uint8_t>(0xAAU));
+            buffered.commit();
+            ++frames;
+            s = buffered.allocate(FRAME_SIZE);
+        }
+        buffered.flush();
+        s = r.peek();
+        while (s.size() > 0U)
+        {
+            benchmark::DoNotOptimize(s.data());
+            r.release();
+            s = r.peek();
+        }
+    }
+    state.SetBytesProcessed(frames * static_cast<int64_t>(FRAME_SIZE));
+}
+
+BENCHMARK(BM_buffered_writer_small_frames);
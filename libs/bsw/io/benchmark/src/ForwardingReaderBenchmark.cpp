@@ -0,0 +1,47 @@
+// Copyright 2025 Accenture.
+
+#include <benchmark/benchmark.h>
+#include <etl/memory.h>
+#include <io/ForwardingReader.h>
+#include <io/MemoryQueue.h>
+
+namespace
+{
+constexpr size_t CAPACITY = 1024 * 4;
+constexpr size_t MAX_SIZE = 128;
+using Queue               = ::io::MemoryQueue<CAPACITY, MAX_SIZE>;
+} // namespace
+
+/**
+ * Benchmarks forwarding messages of a given size from one MemoryQueue into another one while
+ * reading them.
+ */
+void BM_forwarding_reader(benchmark::State& state)
+{
+    Queue source;
+    Queue destination;
+    ::io::MemoryQueueWriter<Queue> sourceWriter(source);
+    ::io::MemoryQueueReader<Queue> sourceReader(source);
+    ::io::MemoryQueueWriter<Queue> destinationWriter(destination);
+    ::io::MemoryQueueReader<Queue> destinationReader(destination);
+    ::io::ForwardingReader reader(sourceReader, destinationWriter);
+    size_t const size = static_cast<size_t>(state.range(0));
+
+    for (auto _ : state)
+    {
+        auto s = sourceWriter.allocate(size);
+        ::etl::mem_set(s.begin(), s.size(), static_cast<uint8_t>(0xAAU));
+        sourceWriter.commit();
+
+        s = reader.peek();
+        benchmark::DoNotOptimize(s.data());
+        reader.release();
+
+        s = destinationReader.peek();
+        benchmark::DoNotOptimize(s.data());
+        destinationReader.release();
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) * state.range(0));
+}
+
+BENCHMARK(BM_forwarding_reader)->Arg(8)->Arg(64)->Arg(128);
@@ -0,0 +1,64 @@
+// Copyright 2025 Accenture.
+
+#include <benchmark/benchmark.h>
+#include <etl/array.h>
+#include <etl/memory.h>
+#include <io/JoinReader.h>
+#include <io/MemoryQueue.h>
+
+namespace
+{
+constexpr size_t CAPACITY     = 1024 * 4;
+constexpr size_t MAX_SIZE     = 128;
+constexpr size_t MESSAGE_SIZE = 64;
+using Queue                   = ::io::MemoryQueue<CAPACITY, MAX_SIZE>;
+} // namespace
+
+/**
+ * Benchmarks reading messages from N MemoryQueues through a JoinReader, with one message pending
+ * in every source queue.
+ */
+template<size_t N>
+void BM_join_reader_fan_in(benchmark::State& state)
+{
+    ::etl::array<Queue, N> queues;
+    ::etl::array<::io::MemoryQueueWriter<Queue>*, N> writers;
+    ::etl::array<::io::MemoryQueueReader<Queue>*, N> readers;
+    ::etl::array<::io::IReader*, N> sources;
+    for (size_t i = 0; i < N; ++i)
+    {
+        writers[i] = new ::io::MemoryQueueWriter<Queue>(queues[i]);
+        readers[i] = new ::io::MemoryQueueReader<Queue>(queues[i]);
+        sources[i] = readers[i];
+    }
+    ::io::JoinReader<N> reader{::etl::span<::io::IReader*, N>(sources)};
+
+    for (auto _ : state)
+    {
+        for (auto* const writer : writers)
+        {
+            auto const s = writer->allocate(MESSAGE_SIZE);
+            ::etl::mem_set(s.begin(), s.size(), static_cast<uint8_t>(0xAAU));
+            writer->commit();
+        }
+        auto s = reader.peek();
+        while (s.size() > 0U)
+        {
+            benchmark::DoNotOptimize(s.data());
+            reader.release();
+            s = reader.peek();
+        }
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) * N * MESSAGE_SIZE);
+
+    for (size_t i = 0; i < N; ++i)
+    {
+        delete writers[i];
+        delete readers[i];
+    }
+}
+
+BENCHMARK_TEMPLATE(BM_join_reader_fan_in, 1);
+BENCHMARK_TEMPLATE(BM_join_reader_fan_in, 2);
+BENCHMARK_TEMPLATE(BM_join_reader_fan_in, 4);
+BENCHMARK_TEMPLATE(BM_join_reader_fan_in, 8);
@@ -0,0 +1,167 @@
+// Copyright 2025 Accenture.
+
+#include <benchmark/benchmark.h>
+#include <etl/array.h>
+#include <etl/span.h>
+#include <io/MemoryQueue.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <thread>
+
+namespace
+{
+constexpr size_t ELEMENT_SIZE = 8U;
+constexpr size_t MAX_BATCH    = 64U;
+constexpr size_t ELEMENTS     = 1024U * 64U;
+using Queue                   = ::io::MemoryQueue<1024 * 4, ELEMENT_SIZE>;
+
+/**
+ * Transfers ELEMENTS elements from a producer thread to a consumer thread. A batch size of one
+ * publishes and releases each element on its own, larger batch sizes use append()/publish() on
+ * the writer side and peek()/release() of many elements on the reader side.
+ */
+void transfer(Queue& q, size_t const batch)
+{
+    Queue::Writer w(q);
+    Queue::Reader r(q);
+
+    std::thread producer(
+        [&w, batch]()
+        {
+            size_t sent = 0U;
+            while (sent < ELEMENTS)
+            {
+                size_t appended = 0U;
+                while ((appended < batch) && (sent < ELEMENTS))
+                {
+                    auto s = w.allocate(ELEMENT_SIZE);
+                    if (s.size() == 0U)
+                    {
+                        std::this_thread::yield();
+                        break;
+                    }
+                    s[0] = static_cast<uint8_t>(sent);
+                    if (batch == 1U)
+                    {
+                        w.commit();
+                    }
+                    else
+                    {
+                        w.append();
+                    }
+                    ++appended;
+                    ++sent;
+                }
+                w.publish();
+            }
+        });
+
+    ::etl::array<::etl::span<uint8_t>, MAX_BATCH> slices;
+    size_t received = 0U;
+    uint32_t sum    = 0U;
+    while (received < ELEMENTS)
+    {
+        if (batch == 1U)
+        {
+            auto s = r.peek();
+            if (s.size() > 0U)
+            {
+                sum += s[0];
+                r.release();
+                ++received;
+            }
+            else
+            {
+                std::this_thread::yield();
+            }
+        }
+        else
+        {
+            size_t const count = r.peek(::etl::span<::etl::span<uint8_t>>(slices.data(), batch));
+            for (size_t i = 0U; i < count; ++i)
+            {
+                sum += slices[i][0];
+            }
+            if (count == 0U)
+            {
+                std::this_thread::yield();
+            }
+            r.release(count);
+            received += count;
+        }
+    }
+    producer.join();
+    benchmark::DoNotOptimize(sum);
+}
+} // namespace
+
+/**
+ * Benchmarks the throughput of a MemoryQueue shared by two threads depending on the number of
+ * elements that are published and released at once.
+ */
+void BM_memory_queue_batch_transfer(benchmark::State& state)
+{
+    Queue q;
+    size_t const batch = static_cast<size_t>(state.range(0));
+    for (auto _ : state)
+    {
+        transfer(q, batch);
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * ELEMENTS));
+}
+
+BENCHMARK(BM_memory_queue_batch_transfer)->Arg(1)->Arg(4)->Arg(16)->Arg(64)->UseRealTime();
+
+/**
+ * Benchmarks filling and emptying a MemoryQueue within a single thread, once per element and once
+ * with a single publish and a single release for the whole queue content.
+ */
+void BM_memory_queue_fill_empty(benchmark::State& state)
+{
+    Queue q;
+    Queue::Writer w(q);
+    Queue::Reader r(q);
+    bool const batched = (state.range(0) != 0);
+    ::etl::array<::etl::span<uint8_t>, MAX_BATCH> slices;
+    int64_t items = 0;
+
+    for (auto _ : state)
+    {
+        auto s = w.allocate(ELEMENT_SIZE);
+        while (s.size() > 0U)
+        {
+            s[0] = 0xAAU;
+            if (batched)
+            {
+                w.append();
+            }
+            else
+            {
+                w.commit();
+            }
+            ++items;
+            s = w.allocate(ELEMENT_SIZE);
+        }
+        w.publish();
+        if (batched)
+        {
+            size_t count = r.peek(slices);
+            while (count > 0U)
+            {
+                r.release(count);
+                count = r.peek(slices);
+            }
+        }
+        else
+        {
+            while (!r.empty())
+            {
+                r.release();
+            }
+        }
+    }
+    state.SetItemsProcessed(items);
+}
+
+BENCHMARK(BM_memory_queue_fill_empty)->Arg(0)->Arg(1);
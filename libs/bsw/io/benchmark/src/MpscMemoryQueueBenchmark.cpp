@@ -0,0 +1,153 @@
+// Copyright 2025 Accenture.
+
+#include <benchmark/benchmark.h>
+#include <etl/memory.h>
+#include <io/MemoryQueue.h>
+#include <io/MpscMemoryQueue.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace
+{
+constexpr size_t CAPACITY              = 1024 * 4;
+constexpr size_t MESSAGE_SIZE          = 64;
+constexpr size_t MESSAGES_PER_PRODUCER = 1024 * 4;
+
+/**
+ * Writer of a MemoryQueue shared by several producers, which hold a lock from allocate() until
+ * commit(), i.e. while they fill their slices.
+ */
+struct LockedWriter
+{
+    using Queue = ::io::MemoryQueue<CAPACITY, MESSAGE_SIZE>;
+
+    explicit LockedWriter(Queue& queue, std::mutex& mutex) : _writer(queue), _mutex(mutex) {}
+
+    bool write(uint8_t const value)
+    {
+        std::lock_guard<std::mutex> const lock(_mutex);
+        auto const s = _writer.allocate(MESSAGE_SIZE);
+        if (s.size() == 0U)
+        {
+            return false;
+        }
+        ::etl::mem_set(s.begin(), s.size(), value);
+        _writer.commit();
+        return true;
+    }
+
+    Queue::Writer _writer;
+    std::mutex& _mutex;
+};
+
+/**
+ * Writer of an MpscMemoryQueue, each producer has its own.
+ */
+struct MpscWriter
+{
+    using Queue = ::io::MpscMemoryQueue<CAPACITY, MESSAGE_SIZE>;
+
+    explicit MpscWriter(Queue& queue, std::mutex&) : _writer(queue) {}
+
+    bool write(uint8_t const value)
+    {
+        auto const s = _writer.allocate(MESSAGE_SIZE);
+        if (s.size() == 0U)
+        {
+            return false;
+        }
+        ::etl::mem_set(s.begin(), s.size(), value);
+        _writer.commit();
+        return true;
+    }
+
+    Queue::Writer _writer;
+};
+
+/**
+ * Writes MESSAGES_PER_PRODUCER messages from each of the given number of producer threads and
+ * reads all of them in the calling thread.
+ */
+template<class Writer>
+void transfer(typename Writer::Queue& queue, size_t const producers)
+{
+    std::mutex mutex;
+    std::vector<std::thread> threads;
+    for (size_t i = 0U; i < producers; ++i)
+    {
+        threads.emplace_back(
+            [&queue, &mutex, i]()
+            {
+                Writer writer(queue, mutex);
+                for (size_t n = 0U; n < MESSAGES_PER_PRODUCER;)
+                {
+                    if (writer.write(static_cast<uint8_t>(i)))
+                    {
+                        ++n;
+                    }
+                    else
+                    {
+                        std::this_thread::yield();
+                    }
+                }
+            });
+    }
+
+    typename Writer::Queue::Reader reader(queue);
+    size_t received = 0U;
+    while (received < (producers * MESSAGES_PER_PRODUCER))
+    {
+        auto const s = reader.peek();
+        if (s.size() == 0U)
+        {
+            std::this_thread::yield();
+            continue;
+        }
+        benchmark::DoNotOptimize(s[0]);
+        reader.release();
+        ++received;
+    }
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+}
+} // namespace
+
+/**
+ * Benchmarks several producer threads writing into a MemoryQueue protected by a lock.
+ */
+void BM_locked_memory_queue_producers(benchmark::State& state)
+{
+    LockedWriter::Queue queue;
+    size_t const producers = static_cast<size_t>(state.range(0));
+    for (auto _ : state)
+    {
+        transfer<LockedWriter>(queue, producers);
+    }
+    state.SetItemsProcessed(
+        static_cast<int64_t>(state.iterations() * producers * MESSAGES_PER_PRODUCER));
+}
+
+BENCHMARK(BM_locked_memory_queue_producers)->Arg(1)->Arg(2)->Arg(4)->UseRealTime();
+
+/**
+ * Benchmarks several producer threads writing into an MpscMemoryQueue.
+ */
+void BM_mpsc_memory_queue_producers(benchmark::State& state)
+{
+    MpscWriter::Queue queue;
+    size_t const producers = static_cast<size_t>(state.range(0));
+    for (auto _ : state)
+    {
+        transfer<MpscWriter>(queue, producers);
+    }
+    state.SetItemsProcessed(
+        static_cast<int64_t>(state.iterations() * producers * MESSAGES_PER_PRODUCER));
+}
+
+BENCHMARK(BM_mpsc_memory_queue_producers)->Arg(1)->Arg(2)->Arg(4)->UseRealTime();
@@ -0,0 +1,217 @@
+// Copyright 2025 Accenture.
+
+#include <benchmark/benchmark.h>
+#include <etl/array.h>
+#include <io/VariantQueue.h>
+
+#include <cstdint>
+
+namespace
+{
+struct __attribute__((packed)) Frame
+{
+    uint32_t id;
+    uint8_t length;
+};
+
+struct __attribute__((packed)) Event
+{
+    uint16_t type;
+    uint32_t value;
+};
+
+struct __attribute__((packed)) Tick
+{
+    uint32_t time;
+};
+
+using TypeList = ::io::make_variant_queue<
+    ::io::VariantQueueType<Frame, 64>,
+    ::io::VariantQueueType<Event>,
+    ::io::VariantQueueType<Tick>>;
+
+using Queue   = ::io::VariantQueue<TypeList, 1024 * 4>;
+using Variant = ::io::variant_q<TypeList::type_list>;
+
+struct Visitor
+{
+    uint32_t sum = 0U;
+
+    void operator()(Frame const& frame, ::etl::span<uint8_t const> const payload)
+    {
+        sum += frame.id + static_cast<uint32_t>(payload.size());
+    }
+
+    void operator()(Event const& event, ::etl::span<uint8_t const> const)
+    {
+        sum += event.value;
+    }
+
+    void operator()(Tick const& tick, ::etl::span<uint8_t const> const) { sum += tick.time; }
+};
+
+template<size_t N>
+struct __attribute__((packed)) Message
+{
+    uint8_t value;
+};
+
+using ManyTypeList = ::io::make_variant_queue<
+    ::io::VariantQueueType<Message<0>>,
+    ::io::VariantQueueType<Message<1>>,
+    ::io::VariantQueueType<Message<2>>,
+    ::io::VariantQueueType<Message<3>>,
+    ::io::VariantQueueType<Message<4>>,
+    ::io::VariantQueueType<Message<5>>,
+    ::io::VariantQueueType<Message<6>>,
+    ::io::VariantQueueType<Message<7>>,
+    ::io::VariantQueueType<Message<8>>,
+    ::io::VariantQueueType<Message<9>>,
+    ::io::VariantQueueType<Message<10>>,
+    ::io::VariantQueueType<Message<11>>>;
+
+using ManyQueue   = ::io::VariantQueue<ManyTypeList, 1024 * 4>;
+using ManyVariant = ::io::variant_q<ManyTypeList::type_list>;
+
+struct ManyVisitor
+{
+    uint32_t sum = 0U;
+
+    template<size_t N>
+    void operator()(Message<N> const& message)
+    {
+        sum += message.value + N;
+    }
+};
+
+/**
+ * Fills the queue with elements of all types in turn.
+ */
+void fill(ManyQueue& q)
+{
+    ManyQueue::Writer w(q);
+    bool written = true;
+    for (uint8_t i = 0U; written; ++i)
+    {
+        auto const buffer = w.allocate(2U);
+        written           = (buffer.size() != 0U);
+        if (written)
+        {
+            buffer[0] = static_cast<uint8_t>(i % ManyTypeList::type_list::size);
+            buffer[1] = i;
+            w.commit();
+        }
+    }
+}
+} // namespace
+
+/**
+ * Benchmarks writing a mix of all element types to a VariantQueue and dispatching them to a
+ * visitor when reading them.
+ */
+void BM_variant_queue_write_read_mixed(benchmark::State& state)
+{
+    Queue q;
+    ::io::MemoryQueueWriter<Queue> w(q);
+    ::io::MemoryQueueReader<Queue> r(q);
+    ::etl::array<uint8_t, 8> payload{};
+    Visitor visitor;
+    uint32_t i = 0U;
+
+    for (auto _ : state)
+    {
+        (void)Variant::write(w, Frame{i, 8U}, payload);
+        (void)Variant::write(w, Event{1U, i});
+        (void)Variant::write(w, Tick{i});
+        for (size_t n = 0U; n < 3U; ++n)
+        {
+            Variant::read_with_payload(visitor, r.peek());
+            r.release();
+        }
+        ++i;
+    }
+    benchmark::DoNotOptimize(visitor.sum);
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * 3);
+}
+
+BENCHMARK(BM_variant_queue_write_read_mixed);
+
+/**
+ * Benchmarks dispatching elements of twelve types by comparing the type id to each type in turn.
+ */
+void BM_variant_queue_dispatch_compare_chain(benchmark::State& state)
+{
+    ManyQueue q;
+    ManyQueue::Reader r(q);
+    ManyVisitor visitor;
+    int64_t items = 0;
+
+    for (auto _ : state)
+    {
+        state.PauseTiming();
+        fill(q);
+        state.ResumeTiming();
+        for (auto data = r.peek(); data.size() != 0U; data = r.peek())
+        {
+            ::io::variant_T_do<ManyTypeList::type_list>::call<ManyVisitor, void>(
+                data[0], &data[1], visitor);
+            r.release();
+            ++items;
+        }
+    }
+    benchmark::DoNotOptimize(visitor.sum);
+    state.SetItemsProcessed(items);
+}
+
+BENCHMARK(BM_variant_queue_dispatch_compare_chain);
+
+/**
+ * Benchmarks dispatching elements of twelve types through the jump table of variant_q::read().
+ */
+void BM_variant_queue_dispatch_table(benchmark::State& state)
+{
+    ManyQueue q;
+    ManyQueue::Reader r(q);
+    ManyVisitor visitor;
+    int64_t items = 0;
+
+    for (auto _ : state)
+    {
+        state.PauseTiming();
+        fill(q);
+        state.ResumeTiming();
+        for (auto data = r.peek(); data.size() != 0U; data = r.peek())
+        {
+            ManyVariant::read(visitor, data);
+            r.release();
+            ++items;
+        }
+    }
+    benchmark::DoNotOptimize(visitor.sum);
+    state.SetItemsProcessed(items);
+}
+
+BENCHMARK(BM_variant_queue_dispatch_table);
+
+/**
+ * Benchmarks draining a queue of elements of twelve types with variant_q::read_all().
+ */
+void BM_variant_queue_read_all(benchmark::State& state)
+{
+    ManyQueue q;
+    ManyQueue::Reader r(q);
+    ManyVisitor visitor;
+    int64_t items = 0;
+
+    for (auto _ : state)
+    {
+        state.PauseTiming();
+        fill(q);
+        state.ResumeTiming();
+        items += static_cast<int64_t>(ManyVariant::read_all(visitor, r));
+    }
+    benchmark::DoNotOptimize(visitor.sum);
+    state.SetItemsProcessed(items);
+}
+
+BENCHMARK(BM_variant_queue_read_all);
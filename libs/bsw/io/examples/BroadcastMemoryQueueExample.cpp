@@ -0,0 +1,61 @@
+// Copyright 2025 Accenture.
+
+#include "io/BroadcastMemoryQueue.h"
+#include "io/MemoryQueue.h"
+
+#include <etl/algorithm.h>
+#include <etl/span.h>
+
+#include <gmock/gmock.h>
+
+#include <cstring>
+
+namespace broadcastMemoryQueueExample
+{
+
+// EXAMPLE_BEGIN BroadcastMemoryQueue
+/**
+ * Writes a log line to a given IWriter.
+ * \return true if the line has been written, false otherwise.
+ */
+bool log(::io::IWriter& writer, char const* const line)
+{
+    size_t const size = ::etl::min(strlen(line), writer.maxSize());
+    auto data         = writer.allocate(size);
+    if (data.size() == 0)
+    {
+        return false;
+    }
+    (void)memcpy(data.data(), line, size);
+    writer.commit();
+    return true;
+}
+
+/**
+ * This usage example demonstrates how log lines are distributed to three channels, e.g. UART, UDP
+ * and a RAM buffer. Each line is stored only once and every channel reads it with its own reader.
+ */
+TEST(BroadcastMemoryQueue, UsageExample)
+{
+    using Queue = ::io::BroadcastMemoryQueue<1024, 64, 3>;
+    Queue queue;
+    ::io::MemoryQueueWriter<Queue> writer{queue};
+    ::io::BroadcastMemoryQueueReader<Queue> uart{queue, 0};
+    ::io::BroadcastMemoryQueueReader<Queue> udp{queue, 1};
+    ::io::BroadcastMemoryQueueReader<Queue> ram{queue, 2};
+
+    ASSERT_TRUE(log(writer, "startup done"));
+
+    // Each channel reads the line at its own pace.
+    EXPECT_EQ(12U, uart.peek().size());
+    uart.release();
+    EXPECT_EQ(12U, udp.peek().size());
+    udp.release();
+
+    // A channel that doesn't keep up doesn't block the others, lines not read in time are
+    // dropped for this channel only and counted.
+    EXPECT_EQ(0U, ram.dropped());
+}
+
+// EXAMPLE_END BroadcastMemoryQueue
+} // namespace broadcastMemoryQueueExample
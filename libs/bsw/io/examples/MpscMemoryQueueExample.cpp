@@ -0,0 +1,66 @@
+// Copyright 2025 Accenture.
+
+#include "io/MemoryQueue.h"
+#include "io/MpscMemoryQueue.h"
+
+#include <etl/algorithm.h>
+#include <etl/span.h>
+
+#include <gmock/gmock.h>
+
+#include <cstring>
+
+namespace mpscMemoryQueueExample
+{
+
+// EXAMPLE_BEGIN MpscMemoryQueue
+/**
+ * Writes a log line to a given IWriter.
+ * \return true if the line has been written, false otherwise.
+ */
+bool log(::io::IWriter& writer, char const* const line)
+{
+    size_t const size = ::etl::min(strlen(line), writer.maxSize());
+    auto data         = writer.allocate(size);
+    if (data.size() == 0)
+    {
+        return false;
+    }
+    (void)memcpy(data.data(), line, size);
+    writer.commit();
+    return true;
+}
+
+/**
+ * This usage example demonstrates how two tasks log into one UART without a lock. Each task uses
+ * its own writer and the UART driver reads the lines in the order in which they were allocated.
+ */
+TEST(MpscMemoryQueue, UsageExample)
+{
+    using Queue = ::io::MpscMemoryQueue<1024, 64>;
+    Queue queue;
+    ::io::MemoryQueueWriter<Queue> task1{queue};
+    ::io::MemoryQueueWriter<Queue> task2{queue};
+    ::io::MemoryQueueReader<Queue> uart{queue};
+
+    ASSERT_TRUE(log(task1, "task1 started"));
+
+    // task2 allocates its line before task1 and fills it while task1 logs its next line.
+    auto line = task2.allocate(13U);
+    ASSERT_EQ(13U, line.size());
+    ASSERT_TRUE(log(task1, "task1 running"));
+    (void)memcpy(line.data(), "task2 started", line.size());
+
+    // The line of task1 is not read before the earlier allocated line of task2 is committed.
+    EXPECT_EQ(13U, uart.peek().size());
+    uart.release();
+    EXPECT_EQ(0U, uart.peek().size());
+    task2.commit();
+    EXPECT_EQ(0, memcmp(uart.peek().data(), "task2 started", 13U));
+    uart.release();
+    EXPECT_EQ(0, memcmp(uart.peek().data(), "task1 running", 13U));
+    uart.release();
+}
+
+// EXAMPLE_END MpscMemoryQueue
+} // namespace mpscMemoryQueueExample
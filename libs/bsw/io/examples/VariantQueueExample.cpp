@@ -113,6 +113,31 @@ void read_with_payload()
     // EXAMPLE_END read_with_payload
 }
 
+void read_all()
+{
+    struct VisitWithPayload
+    {
+        void operator()(A const& /* a */, ::etl::span<uint8_t const> /* payload */)
+        {
+            printf("received A");
+        }
+
+        void operator()(B const& /* b */, ::etl::span<uint8_t const> /* payload */)
+        {
+            printf("received B");
+        }
+    };
+
+    MyQueue queue;
+    // EXAMPLE_START read_all
+    MyQueue::Reader reader(queue);
+
+    VisitWithPayload vp;
+    size_t const count = ::io::variant_q<MyTypes>::read_all_with_payload(vp, reader);
+    // EXAMPLE_END read_all
+    (void)count;
+}
+
 // EXAMPLE_END
 
 TEST(VariantQueue, UsageExamples)
@@ -120,6 +145,7 @@ TEST(VariantQueue, UsageExamples)
     write();
     read_with_payload();
     read_no_payload();
+    read_all();
 }
 
 } // namespace
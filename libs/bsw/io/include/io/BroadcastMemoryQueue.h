@@ -0,0 +1,585 @@
+// Copyright 2025 Accenture.
+
+#pragma once
+
+#include "io/IReader.h"
+#include "io/IWriter.h"
+
+#include <etl/algorithm.h>
+#include <etl/array.h>
+#include <etl/atomic.h>
+#include <etl/error_handler.h>
+#include <etl/span.h>
+#include <etl/unaligned_type.h>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace io
+{
+
+/**
+ * Lock free single producer multi consumer queue of variable size slices, where every reader
+ * receives every slice.
+ * [TPARAMS_BEGIN]
+ * \tparam CAPACITY Number of bytes that this BroadcastMemoryQueue shall provide.
+ * \tparam MAX_ELEMENT_SIZE Maximum size of one allocation
+ * \tparam NUM_READERS Number of independent readers
+ * \tparam SIZE_TYPE Type used to store size of allocation internally
+ * [TPARAMS_END]
+ *
+ * \section Memory overhead
+ * Like MemoryQueue, the BroadcastMemoryQueue introduces an overhead of sizeof(SIZE_TYPE) bytes
+ * per allocation. The data is stored only once, each reader just adds a cursor and a drop counter.
+ *
+ * \section Slow readers
+ * The writer never waits for a slow reader. If a reader doesn't leave enough space for the next
+ * allocation, the writer moves the cursor of this reader past its oldest slices and adds their
+ * number to the drop counter of the reader. A reader holds the slice returned by peek() until it
+ * calls release(), so the writer never overwrites a slice that is currently being read. If such a
+ * reader blocks the allocation, allocate() fails instead.
+ *
+ * \section Concurrency
+ * This BroadcastMemoryQueue is designed as a lock free queue with a single producer and
+ * NUM_READERS consumers, each of them using its own Reader.
+ */
+template<
+    size_t CAPACITY,
+    size_t MAX_ELEMENT_SIZE,
+    size_t NUM_READERS,
+    typename SIZE_TYPE = uint16_t>
+class BroadcastMemoryQueue
+{
+    static_assert(CAPACITY >= MAX_ELEMENT_SIZE + sizeof(SIZE_TYPE), "");
+    static_assert(NUM_READERS > 0U, "");
+
+    // The cursor of a reader stores the read index shifted by one bit, the lowest bit is set while
+    // the reader holds the slice at the read index.
+    static constexpr size_t HELD = 1U;
+
+    struct RxData
+    {
+        ::etl::atomic<size_t> cursor{0U};
+        ::etl::atomic<size_t> drops{0U};
+    };
+
+    ::etl::array<RxData, NUM_READERS> rx;
+
+    struct TxData
+    {
+        ::etl::atomic<size_t> sent{0U};
+        ::etl::array<uint8_t, CAPACITY> data;
+        size_t allocated{0U};
+        size_t minAvailable{CAPACITY};
+
+        size_t sizeAt(size_t index) const;
+    };
+
+    TxData tx;
+
+    static size_t advanceIndex(size_t index, size_t const size)
+    {
+        index = (index + size + sizeof(SIZE_TYPE)) % (2 * CAPACITY);
+
+        // Check if enough contiguous space is available at the end of the array and wrap
+        // otherwise skipping the too small piece of memory.
+        size_t const space = (((2 * CAPACITY) - index) % CAPACITY);
+        if (space < (MAX_ELEMENT_SIZE + sizeof(SIZE_TYPE)))
+        {
+            index = (index + space) % (2 * CAPACITY);
+        }
+        return index;
+    }
+
+    static size_t availableBetween(size_t const writeIndex, size_t const readIndex)
+    {
+        size_t usedBytes;
+        if (writeIndex < readIndex)
+        {
+            usedBytes = (writeIndex + (2 * CAPACITY)) - readIndex;
+        }
+        else
+        {
+            usedBytes = writeIndex - readIndex;
+        }
+
+        size_t freeBytes = CAPACITY - usedBytes;
+        if (freeBytes < (MAX_ELEMENT_SIZE + sizeof(SIZE_TYPE)))
+        {
+            freeBytes = 0;
+        }
+        return freeBytes;
+    }
+
+public:
+    // [PUBLIC_TYPES_BEGIN]
+    /** Type of the size information stored for each entry. */
+    using size_type = SIZE_TYPE;
+
+    // [PUBLIC_TYPES_END]
+
+    // [PUBLIC_API_BEGIN]
+    /**
+     * Returns the capacity of the underlying array of data managed by this BroadcastMemoryQueue.
+     */
+    static constexpr size_t capacity() { return CAPACITY; }
+
+    /**
+     * Returns the maximum size of one allocation.
+     */
+    static constexpr size_t maxElementSize() { return MAX_ELEMENT_SIZE; }
+
+    /**
+     * Returns the number of readers.
+     */
+    static constexpr size_t numReaders() { return NUM_READERS; }
+
+    /**
+     * Constructs a BroadcastMemoryQueue of CAPACITY bytes.
+     */
+    BroadcastMemoryQueue() = default;
+
+    // [PUBLIC_API_END]
+
+    /**
+     * The Writer side of a BroadcastMemoryQueue provides API to insert data in the queue.
+     */
+    class Writer
+    {
+    public:
+        // [PUBLIC_API_WRITER_BEGIN]
+        /**
+         * Constructs a Writer to a given queue.
+         */
+        explicit Writer(BroadcastMemoryQueue& queue);
+
+        /**
+         * Allocates a requested number of bytes and returns them as a slice. Slices not yet read
+         * by a reader are dropped for this reader if needed. This function can be called multiple
+         * times before calling commit() allowing to first allocate a worst case size slice and
+         * then trimming it before calling commit.
+         *
+         * \param size  Number of bytes to allocate from this BroadcastMemoryQueue.
+         * \return  - Empty slice, if requested size was greater as MAX_ELEMENT_SIZE or a reader
+         *            holding its oldest slice prevents the allocation
+         *          - Slice of size bytes otherwise.
+         */
+        ::etl::span<uint8_t> allocate(size_t size) const;
+
+        /**
+         * Makes the previously allocated data available for all Readers.
+         */
+        void commit();
+
+        /**
+         * Returns the number of contiguous bytes that can be allocated next without dropping
+         * slices for the slowest reader.
+         */
+        size_t available() const;
+
+        /**
+         * Returns the minimum number of available bytes at the time of an allocate call since the
+         * last reset using resetMinAvailable().
+         */
+        size_t minAvailable() const;
+
+        /**
+         * Resets the minimum number of available bytes to the current number of available bytes.
+         */
+        void resetMinAvailable();
+
+        /**
+         * The BroadcastMemoryQueue is considered full if the slowest reader leaves less than
+         * MAX_ELEMENT_SIZE + sizeof(SIZE_TYPE) contiguous bytes.
+         */
+        bool full() const;
+
+        /**
+         * Returns the maximum size of which a slice of bytes can be allocated.
+         */
+        size_t maxSize() const;
+        // [PUBLIC_API_WRITER_END]
+    private:
+        bool makeSpace(size_t& freeBytes) const;
+
+        ::etl::array<RxData, NUM_READERS>& _rxData;
+        TxData& _txData;
+    };
+
+    /**
+     * The Reader side of a BroadcastMemoryQueue provides API to read data from the queue.
+     */
+    class Reader
+    {
+    public:
+        // [PUBLIC_API_READER_BEGIN]
+        /**
+         * Constructs the Reader with a given index from a given queue.
+         *
+         * \assert index < NUM_READERS
+         */
+        Reader(BroadcastMemoryQueue& queue, size_t index);
+
+        /**
+         * Returns true if no data is available.
+         *
+         * Calling peek() on an empty queue will return an empty slice.
+         */
+        bool empty() const;
+
+        /**
+         * Returns a slice of bytes pointing to the next memory chunk of the BroadcastMemoryQueue,
+         * if available. The slice is held until release() is called, i.e. the writer doesn't drop
+         * it. Calling peek on an empty BroadcastMemoryQueue will return an empty slice.
+         */
+        ::etl::span<uint8_t> peek() const;
+
+        /**
+         * Releases the first allocated chunk of memory. If the Reader is empty, calling this
+         * function has no effect.
+         */
+        void release() const;
+
+        /**
+         * Releases all entries until empty() returns true.
+         */
+        void clear() const;
+
+        /**
+         * Returns the maximum size of which a slice of bytes can be read.
+         */
+        size_t maxSize() const;
+
+        /**
+         * Returns the number of contiguous bytes that can be allocated next without dropping
+         * slices for this reader.
+         */
+        size_t available() const;
+
+        /**
+         * Returns the number of slices that have been dropped for this reader, because it didn't
+         * read them fast enough.
+         */
+        size_t dropped() const;
+        // [PUBLIC_API_READER_END]
+    private:
+        TxData& _txData;
+        RxData& _rxData;
+    };
+};
+
+template<size_t CAPACITY, size_t MAX_ELEMENT_SIZE, size_t NUM_READERS, typename SIZE_TYPE>
+inline BroadcastMemoryQueue<CAPACITY, MAX_ELEMENT_SIZE, NUM_READERS, SIZE_TYPE>::Writer::Writer(
+    BroadcastMemoryQueue& queue)
+: _rxData(queue.rx), _txData(queue.tx)
+{}
+
+template<size_t CAPACITY, size_t MAX_ELEMENT_SIZE, size_t NUM_READERS, typename SIZE_TYPE>
+::etl::span<uint8_t>
+BroadcastMemoryQueue<CAPACITY, MAX_ELEMENT_SIZE, NUM_READERS, SIZE_TYPE>::Writer::allocate(
+    size_t const size) const
+{
+    // Set allocated zero prevent a subsequent call to commit() to have
+    // effects in case this allocation fails. That is important if this is a
+    // reallocation, i.e. a previous call to allocate() succeeded.
+    _txData.allocated = 0U;
+    if ((size > MAX_ELEMENT_SIZE) || (size == 0))
+    {
+        return {};
+    }
+    size_t freeBytes       = 0U;
+    bool const isAvailable = makeSpace(freeBytes);
+    _txData.minAvailable   = ::etl::min(freeBytes, _txData.minAvailable);
+    if (!isAvailable)
+    {
+        return {};
+    }
+    size_t const index = _txData.sent.load(::etl::memory_order_relaxed) % CAPACITY;
+    _txData.allocated  = size;
+    return ::etl::span<uint8_t>(&_txData.data[index + sizeof(SIZE_TYPE)], size);
+}
+
+template<size_t CAPACITY, size_t MAX_ELEMENT_SIZE, size_t NUM_READERS, typename SIZE_TYPE>
+void BroadcastMemoryQueue<CAPACITY, MAX_ELEMENT_SIZE, NUM_READERS, SIZE_TYPE>::Writer::commit()
+{
+    // Prevent accidentally committing random data if allocate has not been called or
+    // previous allocation was unsuccessful.
+    if (_txData.allocated == 0U)
+    {
+        return;
+    }
+    size_t writeIndex    = _txData.sent.load(::etl::memory_order_relaxed);
+    size_t const index   = writeIndex % CAPACITY;
+    SIZE_TYPE const size = static_cast<SIZE_TYPE>(_txData.allocated);
+    ::etl::unaligned_type_ext<SIZE_TYPE, etl::endian::big>{&_txData.data[index]}
+    = static_cast<SIZE_TYPE>(size);
+
+    writeIndex        = advanceIndex(writeIndex, size);
+    _txData.allocated = 0U;
+    // Store writeIndex last to ensure data consistency.
+    _txData.sent.store(writeIndex, ::etl::memory_order_release);
+}
+
+template<size_t CAPACITY, size_t MAX_ELEMENT_SIZE, size_t NUM_READERS, typename SIZE_TYPE>
+bool BroadcastMemoryQueue<CAPACITY, MAX_ELEMENT_SIZE, NUM_READERS, SIZE_TYPE>::Writer::makeSpace(
+    size_t& freeBytes) const
+{
+    size_t const writeIndex = _txData.sent.load(::etl::memory_order_relaxed);
+    freeBytes               = CAPACITY;
+    for (auto& rxData : _rxData)
+    {
+        size_t cursor = rxData.cursor.load(::etl::memory_order_acquire);
+        freeBytes     = ::etl::min(freeBytes, availableBetween(writeIndex, cursor >> 1U));
+        while (availableBetween(writeIndex, cursor >> 1U) == 0U)
+        {
+            if ((cursor & HELD) != 0U)
+            {
+                // The oldest slice is being read, it must not be overwritten.
+                return false;
+            }
+            // Drop the oldest slices of this reader until enough space is available. The
+            // cursor is only moved if the reader hasn't touched it in the meantime.
+            size_t readIndex = cursor >> 1U;
+            size_t count     = 0U;
+            while (availableBetween(writeIndex, readIndex) == 0U)
+            {
+                readIndex = advanceIndex(readIndex, _txData.sizeAt(readIndex));
+                ++count;
+            }
+            if (rxData.cursor.compare_exchange_strong(
+                    cursor,
+                    readIndex << 1U,
+                    ::etl::memory_order_acquire,
+                    ::etl::memory_order_acquire))
+            {
+                rxData.drops.fetch_add(count, ::etl::memory_order_relaxed);
+                break;
+            }
+        }
+    }
+    return true;
+}
+
+template<size_t CAPACITY, size_t MAX_ELEMENT_SIZE, size_t NUM_READERS, typename SIZE_TYPE>
+inline size_t
+BroadcastMemoryQueue<CAPACITY, MAX_ELEMENT_SIZE, NUM_READERS, SIZE_TYPE>::Writer::available() const
+{
+    size_t const writeIndex = _txData.sent.load(::etl::memory_order_relaxed);
+    size_t freeBytes        = CAPACITY;
+    for (auto const& rxData : _rxData)
+    {
+        size_t const readIndex = rxData.cursor.load(::etl::memory_order_acquire) >> 1U;
+        freeBytes              = ::etl::min(freeBytes, availableBetween(writeIndex, readIndex));
+    }
+    return freeBytes;
+}
+
+template<size_t CAPACITY, size_t MAX_ELEMENT_SIZE, size_t NUM_READERS, typename SIZE_TYPE>
+inline size_t
+BroadcastMemoryQueue<CAPACITY, MAX_ELEMENT_SIZE, NUM_READERS, SIZE_TYPE>::Writer::minAvailable()
+    const
+{
+    return _txData.minAvailable;
+}
+
+template<size_t CAPACITY, size_t MAX_ELEMENT_SIZE, size_t NUM_READERS, typename SIZE_TYPE>
+inline void BroadcastMemoryQueue<CAPACITY, MAX_ELEMENT_SIZE, NUM_READERS, SIZE_TYPE>::Writer::
+    resetMinAvailable()
+{
+    _txData.minAvailable = available();
+}
+
+template<size_t CAPACITY, size_t MAX_ELEMENT_SIZE, size_t NUM_READERS, typename SIZE_TYPE>
+inline bool BroadcastMemoryQueue<CAPACITY, MAX_ELEMENT_SIZE, NUM_READERS, SIZE_TYPE>::Writer::full()
+    const
+{
+    return available() == 0;
+}
+
+template<size_t CAPACITY, size_t MAX_ELEMENT_SIZE, size_t NUM_READERS, typename SIZE_TYPE>
+inline size_t
+BroadcastMemoryQueue<CAPACITY, MAX_ELEMENT_SIZE, NUM_READERS, SIZE_TYPE>::Writer::maxSize() const
+{
+    return MAX_ELEMENT_SIZE;
+}
+
+template<size_t CAPACITY, size_t MAX_ELEMENT_SIZE, size_t NUM_READERS, typename SIZE_TYPE>
+inline BroadcastMemoryQueue<CAPACITY, MAX_ELEMENT_SIZE, NUM_READERS, SIZE_TYPE>::Reader::Reader(
+    BroadcastMemoryQueue& queue, size_t const index)
+: _txData(queue.tx), _rxData(queue.rx[(index < NUM_READERS) ? index : 0U])
+{
+    ETL_ASSERT(index < NUM_READERS, ETL_ERROR_GENERIC("reader index out of range"));
+}
+
+template<size_t CAPACITY, size_t MAX_ELEMENT_SIZE, size_t NUM_READERS, typename SIZE_TYPE>
+inline bool
+BroadcastMemoryQueue<CAPACITY, MAX_ELEMENT_SIZE, NUM_READERS, SIZE_TYPE>::Reader::empty() const
+{
+    size_t const readIndex  = _rxData.cursor.load(::etl::memory_order_relaxed) >> 1U;
+    size_t const writeIndex = _txData.sent.load(::etl::memory_order_acquire);
+    return writeIndex == readIndex;
+}
+
+template<size_t CAPACITY, size_t MAX_ELEMENT_SIZE, size_t NUM_READERS, typename SIZE_TYPE>
+::etl::span<uint8_t>
+BroadcastMemoryQueue<CAPACITY, MAX_ELEMENT_SIZE, NUM_READERS, SIZE_TYPE>::Reader::peek() const
+{
+    size_t cursor = _rxData.cursor.load(::etl::memory_order_relaxed);
+    // Mark the slice as held, which fails if the writer has dropped it in the meantime.
+    while ((cursor & HELD) == 0U)
+    {
+        if ((cursor >> 1U) == _txData.sent.load(::etl::memory_order_acquire))
+        {
+            return {};
+        }
+        if (_rxData.cursor.compare_exchange_strong(
+                cursor, cursor | HELD, ::etl::memory_order_relaxed, ::etl::memory_order_relaxed))
+        {
+            break;
+        }
+    }
+    size_t const index = (cursor >> 1U) % CAPACITY;
+    return ::etl::span<uint8_t>(
+        &_txData.data[index + sizeof(SIZE_TYPE)], _txData.sizeAt(cursor >> 1U));
+}
+
+template<size_t CAPACITY, size_t MAX_ELEMENT_SIZE, size_t NUM_READERS, typename SIZE_TYPE>
+void BroadcastMemoryQueue<CAPACITY, MAX_ELEMENT_SIZE, NUM_READERS, SIZE_TYPE>::Reader::release()
+    const
+{
+    size_t cursor = _rxData.cursor.load(::etl::memory_order_relaxed);
+    if ((cursor & HELD) != 0U)
+    {
+        // The writer doesn't move a held cursor.
+        size_t const readIndex = cursor >> 1U;
+        _rxData.cursor.store(
+            advanceIndex(readIndex, _txData.sizeAt(readIndex)) << 1U, ::etl::memory_order_release);
+        return;
+    }
+    size_t const readIndex = cursor >> 1U;
+    if (readIndex == _txData.sent.load(::etl::memory_order_acquire))
+    {
+        return;
+    }
+    // If the writer has dropped the slice in the meantime, it is already released.
+    (void)_rxData.cursor.compare_exchange_strong(
+        cursor,
+        advanceIndex(readIndex, _txData.sizeAt(readIndex)) << 1U,
+        ::etl::memory_order_release,
+        ::etl::memory_order_relaxed);
+}
+
+template<size_t CAPACITY, size_t MAX_ELEMENT_SIZE, size_t NUM_READERS, typename SIZE_TYPE>
+inline void
+BroadcastMemoryQueue<CAPACITY, MAX_ELEMENT_SIZE, NUM_READERS, SIZE_TYPE>::Reader::clear() const
+{
+    while (!empty())
+    {
+        release();
+    }
+}
+
+template<size_t CAPACITY, size_t MAX_ELEMENT_SIZE, size_t NUM_READERS, typename SIZE_TYPE>
+inline size_t
+BroadcastMemoryQueue<CAPACITY, MAX_ELEMENT_SIZE, NUM_READERS, SIZE_TYPE>::Reader::maxSize() const
+{
+    return MAX_ELEMENT_SIZE;
+}
+
+template<size_t CAPACITY, size_t MAX_ELEMENT_SIZE, size_t NUM_READERS, typename SIZE_TYPE>
+inline size_t
+BroadcastMemoryQueue<CAPACITY, MAX_ELEMENT_SIZE, NUM_READERS, SIZE_TYPE>::Reader::available() const
+{
+    return availableBetween(
+        _txData.sent.load(::etl::memory_order_acquire),
+        _rxData.cursor.load(::etl::memory_order_relaxed) >> 1U);
+}
+
+template<size_t CAPACITY, size_t MAX_ELEMENT_SIZE, size_t NUM_READERS, typename SIZE_TYPE>
+inline size_t
+BroadcastMemoryQueue<CAPACITY, MAX_ELEMENT_SIZE, NUM_READERS, SIZE_TYPE>::Reader::dropped() const
+{
+    return _rxData.drops.load(::etl::memory_order_relaxed);
+}
+
+template<size_t CAPACITY, size_t MAX_ELEMENT_SIZE, size_t NUM_READERS, typename SIZE_TYPE>
+inline size_t
+BroadcastMemoryQueue<CAPACITY, MAX_ELEMENT_SIZE, NUM_READERS, SIZE_TYPE>::TxData::sizeAt(
+    size_t const index) const
+{
+    return ::etl::unaligned_type<SIZE_TYPE, ::etl::endian::big>(&data[index % CAPACITY]);
+}
+
+/**
+ * Implementation of IReader for one reader of a BroadcastMemoryQueue. The writing side is
+ * provided by MemoryQueueWriter.
+ * [TPARAMS_BMQR_BEGIN]
+ * \tparam Queue Type of queue to read data from.
+ * [TPARAMS_BMQR_END]
+ */
+template<class Queue>
+class BroadcastMemoryQueueReader : public IReader
+{
+public:
+    // [PUBLIC_API_BMQR_BEGIN]
+    /**
+     * Constructs a BroadcastMemoryQueueReader for the reader with a given index of a given queue.
+     */
+    BroadcastMemoryQueueReader(Queue& queue, size_t index);
+
+    /** \see IReader::maxSize() */
+    size_t maxSize() const override;
+
+    /** \see IReader::peek() */
+    ::etl::span<uint8_t> peek() const override;
+
+    /** \see IReader::release() */
+    void release() override;
+
+    /** \see Queue::Reader::available() */
+    size_t available() const;
+
+    /** \see Queue::Reader::dropped() */
+    size_t dropped() const;
+    // [PUBLIC_API_BMQR_END]
+private:
+    typename Queue::Reader _reader;
+};
+
+template<class Queue>
+inline BroadcastMemoryQueueReader<Queue>::BroadcastMemoryQueueReader(
+    Queue& queue, size_t const index)
+: _reader(queue, index)
+{}
+
+template<class Queue>
+inline size_t BroadcastMemoryQueueReader<Queue>::maxSize() const
+{
+    return _reader.maxSize();
+}
+
+template<class Queue>
+inline ::etl::span<uint8_t> BroadcastMemoryQueueReader<Queue>::peek() const
+{
+    return _reader.peek();
+}
+
+template<class Queue>
+inline void BroadcastMemoryQueueReader<Queue>::release()
+{
+    _reader.release();
+}
+
+template<class Queue>
+inline size_t BroadcastMemoryQueueReader<Queue>::available() const
+{
+    return _reader.available();
+}
+
+template<class Queue>
+inline size_t BroadcastMemoryQueueReader<Queue>::dropped() const
+{
+    return _reader.dropped();
+}
+
+} // namespace io
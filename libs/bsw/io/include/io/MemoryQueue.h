@@ -36,6 +36,11 @@ namespace io
  * \section Concurrency
  * This MemoryQueue is designed as a lock free single producer single consumer queue.
  *
+ * \section Batching
+ * Every commit() and release() publishes an updated index to the other side, which is a cache
+ * line transfer between cores on multi-core targets. The Writer can append() several elements and
+ * publish() them at once, the Reader can peek() several elements and release() them at once.
+ *
  */
 template<size_t CAPACITY, size_t MAX_ELEMENT_SIZE, typename SIZE_TYPE = uint16_t>
 class MemoryQueue
@@ -55,8 +60,9 @@ class MemoryQueue
         ::etl::array<uint8_t, CAPACITY> data;
         size_t allocated{0U};
         size_t minAvailable{CAPACITY};
+        size_t appended{0U};
 
-        size_t available(RxData const& rxData) const;
+        size_t available(size_t writeIndex, RxData const& rxData) const;
     };
 
     TxData tx;
@@ -129,6 +135,18 @@ public:
          */
         void commit();
 
+        /**
+         * Appends the previously allocated data to the current batch without making it available
+         * for the Reader. Subsequent allocations follow the appended data.
+         */
+        void append();
+
+        /**
+         * Makes all data appended since the last call to publish() or commit() available for the
+         * Reader with a single update of the write index.
+         */
+        void publish();
+
         /**
          * Returns the number of contiguous bytes that can be allocated next.
          *
@@ -197,6 +215,21 @@ public:
          */
         void release() const;
 
+        /**
+         * Fills a given array of slices with the next consecutive memory chunks of the
+         * MemoryQueue, as far as available.
+         *
+         * \param slices  Array receiving the slices.
+         * \return Number of slices that have been filled.
+         */
+        size_t peek(::etl::span<::etl::span<uint8_t>> slices) const;
+
+        /**
+         * Releases the first count allocated chunks of memory with a single update of the read
+         * index. Releasing more chunks than available releases all of them.
+         */
+        void release(size_t count) const;
+
         /**
          * Releases all entries until empty() returns true.
          */
@@ -246,13 +279,20 @@ MemoryQueue<CAPACITY, MAX_ELEMENT_SIZE, SIZE_TYPE>::Writer::allocate(size_t cons
     {
         return {};
     }
-    size_t const index = _txData.sent.load() % CAPACITY;
+    size_t const index = _txData.appended % CAPACITY;
     _txData.allocated  = size;
     return ::etl::span<uint8_t>(&_txData.data[index + sizeof(SIZE_TYPE)], size);
 }
 
 template<size_t CAPACITY, size_t MAX_ELEMENT_SIZE, typename SIZE_TYPE>
-void MemoryQueue<CAPACITY, MAX_ELEMENT_SIZE, SIZE_TYPE>::Writer::commit()
+inline void MemoryQueue<CAPACITY, MAX_ELEMENT_SIZE, SIZE_TYPE>::Writer::commit()
+{
+    append();
+    publish();
+}
+
+template<size_t CAPACITY, size_t MAX_ELEMENT_SIZE, typename SIZE_TYPE>
+void MemoryQueue<CAPACITY, MAX_ELEMENT_SIZE, SIZE_TYPE>::Writer::append()
 {
     // Prevent accidentally committing random data if allocate has not been called or
     // previous allocation was unsuccessful.
@@ -260,22 +300,29 @@ void MemoryQueue<CAPACITY, MAX_ELEMENT_SIZE, SIZE_TYPE>::Writer::commit()
     {
         return;
     }
-    size_t writeIndex    = _txData.sent.load();
-    size_t const index   = writeIndex % CAPACITY;
+    size_t const index   = _txData.appended % CAPACITY;
     SIZE_TYPE const size = static_cast<SIZE_TYPE>(_txData.allocated);
     ::etl::unaligned_type_ext<SIZE_TYPE, etl::endian::big>{&_txData.data[index]}
     = static_cast<SIZE_TYPE>(size);
 
-    writeIndex        = advanceIndex(writeIndex, size);
+    _txData.appended  = advanceIndex(_txData.appended, size);
     _txData.allocated = 0U;
+}
+
+template<size_t CAPACITY, size_t MAX_ELEMENT_SIZE, typename SIZE_TYPE>
+inline void MemoryQueue<CAPACITY, MAX_ELEMENT_SIZE, SIZE_TYPE>::Writer::publish()
+{
     // Store writeIndex last to ensure data consistency.
-    _txData.sent.store(writeIndex);
+    if (_txData.sent.load() != _txData.appended)
+    {
+        _txData.sent.store(_txData.appended);
+    }
 }
 
 template<size_t CAPACITY, size_t MAX_ELEMENT_SIZE, typename SIZE_TYPE>
 inline size_t MemoryQueue<CAPACITY, MAX_ELEMENT_SIZE, SIZE_TYPE>::Writer::available() const
 {
-    return _txData.available(_rxData);
+    return _txData.available(_txData.appended, _rxData);
 }
 
 template<size_t CAPACITY, size_t MAX_ELEMENT_SIZE, typename SIZE_TYPE>
@@ -344,6 +391,45 @@ void MemoryQueue<CAPACITY, MAX_ELEMENT_SIZE, SIZE_TYPE>::Reader::release() const
     _rxData.received.store(readIndex);
 }
 
+template<size_t CAPACITY, size_t MAX_ELEMENT_SIZE, typename SIZE_TYPE>
+size_t MemoryQueue<CAPACITY, MAX_ELEMENT_SIZE, SIZE_TYPE>::Reader::peek(
+    ::etl::span<::etl::span<uint8_t>> const slices) const
+{
+    size_t readIndex        = _rxData.received.load();
+    size_t const writeIndex = _txData.sent.load();
+    size_t count            = 0U;
+    while ((count < slices.size()) && (readIndex != writeIndex))
+    {
+        size_t const index = readIndex % CAPACITY;
+        SIZE_TYPE const size
+            = ::etl::unaligned_type<SIZE_TYPE, ::etl::endian::big>(&_txData.data[index]);
+        slices[count] = ::etl::span<uint8_t>(&_txData.data[index + sizeof(SIZE_TYPE)], size);
+        readIndex     = advanceIndex(readIndex, size);
+        ++count;
+    }
+    return count;
+}
+
+template<size_t CAPACITY, size_t MAX_ELEMENT_SIZE, typename SIZE_TYPE>
+void MemoryQueue<CAPACITY, MAX_ELEMENT_SIZE, SIZE_TYPE>::Reader::release(size_t count) const
+{
+    size_t readIndex        = _rxData.received.load();
+    size_t const writeIndex = _txData.sent.load();
+    if (readIndex == writeIndex)
+    {
+        return;
+    }
+    while ((count > 0U) && (readIndex != writeIndex))
+    {
+        SIZE_TYPE const size = ::etl::unaligned_type<SIZE_TYPE, ::etl::endian::big>(
+            &_txData.data[readIndex % CAPACITY]);
+        readIndex = advanceIndex(readIndex, size);
+        --count;
+    }
+    // Store readIndex last to ensure data consistency.
+    _rxData.received.store(readIndex);
+}
+
 template<size_t CAPACITY, size_t MAX_ELEMENT_SIZE, typename SIZE_TYPE>
 inline void MemoryQueue<CAPACITY, MAX_ELEMENT_SIZE, SIZE_TYPE>::Reader::clear() const
 {
@@ -362,15 +448,14 @@ inline size_t MemoryQueue<CAPACITY, MAX_ELEMENT_SIZE, SIZE_TYPE>::Reader::maxSiz
 template<size_t CAPACITY, size_t MAX_ELEMENT_SIZE, typename SIZE_TYPE>
 inline size_t MemoryQueue<CAPACITY, MAX_ELEMENT_SIZE, SIZE_TYPE>::Reader::available() const
 {
-    return _txData.available(_rxData);
+    return _txData.available(_txData.sent.load(), _rxData);
 }
 
 template<size_t CAPACITY, size_t MAX_ELEMENT_SIZE, typename SIZE_TYPE>
-size_t
-MemoryQueue<CAPACITY, MAX_ELEMENT_SIZE, SIZE_TYPE>::TxData::available(RxData const& rxData) const
+size_t MemoryQueue<CAPACITY, MAX_ELEMENT_SIZE, SIZE_TYPE>::TxData::available(
+    size_t const writeIndex, RxData const& rxData) const
 {
-    size_t const writeIndex = sent.load();
-    size_t const readIndex  = rxData.received.load();
+    size_t const readIndex = rxData.received.load();
 
     size_t usedBytes;
     if (writeIndex < readIndex)
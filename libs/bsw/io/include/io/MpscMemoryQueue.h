@@ -0,0 +1,406 @@
+// Copyright 2025 Accenture.
+
+#pragma once
+
+#include "io/IReader.h"
+#include "io/IWriter.h"
+
+#include <etl/array.h>
+#include <etl/atomic.h>
+#include <etl/memory.h>
+#include <etl/span.h>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace io
+{
+
+/**
+ * Lock free multi producer single consumer queue of variable size slices.
+ * [TPARAMS_BEGIN]
+ * \tparam CAPACITY Number of bytes that this MpscMemoryQueue shall provide.
+ * \tparam MAX_ELEMENT_SIZE Maximum size of one allocation
+ * \tparam SIZE_TYPE Type used to store size of allocation internally
+ * [TPARAMS_END]
+ *
+ * \section Memory overhead
+ * Each entry starts with a header of 2 * sizeof(SIZE_TYPE) bytes, the length of the entry and the
+ * size of the allocation, and is padded to a multiple of sizeof(SIZE_TYPE) bytes. The data is
+ * stored as an array of SIZE_TYPE words, so that the length in the header is a SIZE_TYPE object
+ * that is accessed atomically, while slices are handed out as bytes of these words.
+ *
+ * \section Concurrency
+ * Any number of producers, each using its own Writer, reserve space by a compare and swap of the
+ * reservation index and fill their slices concurrently. A commit only sets the length in the
+ * header of the entry. The single Reader returns the entries in the order of their reservation,
+ * i.e. an entry is only returned after all entries reserved before it have been committed. The
+ * Reader zeroes the memory of released entries, so that the header of a reserved entry reads as
+ * not committed until its producer commits it.
+ *
+ * \section Latency
+ * allocate() is lock free: it retries the compare and swap only if another producer reserved an
+ * entry in the meantime, i.e. at most once per concurrent producer. commit() never waits. The
+ * latency of an entry for the Reader is bounded by the time from the oldest pending reservation
+ * to its commit, including the time its producer is preempted. Every successful allocation
+ * therefore has to be committed, an abandoned reservation blocks the Reader forever.
+ */
+template<size_t CAPACITY, size_t MAX_ELEMENT_SIZE, typename SIZE_TYPE = uint16_t>
+class MpscMemoryQueue
+{
+    static constexpr size_t HEADER_SIZE = 2U * sizeof(SIZE_TYPE);
+
+    static constexpr size_t entrySize(size_t const size)
+    {
+        return ((HEADER_SIZE + size + sizeof(SIZE_TYPE) - 1U) / sizeof(SIZE_TYPE))
+               * sizeof(SIZE_TYPE);
+    }
+
+    static constexpr size_t MAX_ENTRY_SIZE = entrySize(MAX_ELEMENT_SIZE);
+
+    static_assert(CAPACITY >= MAX_ENTRY_SIZE, "");
+    static_assert((CAPACITY % sizeof(SIZE_TYPE)) == 0U, "");
+    static_assert(MAX_ENTRY_SIZE <= static_cast<SIZE_TYPE>(-1), "");
+    static_assert(__atomic_always_lock_free(sizeof(SIZE_TYPE), 0), "");
+
+    struct RxData
+    {
+        ::etl::atomic<size_t> received{0U};
+    };
+
+    RxData rx;
+
+    struct TxData
+    {
+        ::etl::atomic<size_t> reserved{0U};
+        ::etl::array<SIZE_TYPE, CAPACITY / sizeof(SIZE_TYPE)> words{};
+
+        uint8_t* bytesAt(size_t index);
+        SIZE_TYPE& wordAt(size_t index);
+        SIZE_TYPE loadLength(size_t index);
+        void storeLength(size_t index, SIZE_TYPE length);
+    };
+
+    TxData tx;
+
+    static size_t advanceIndex(size_t index, size_t const length)
+    {
+        index = (index + length) % (2 * CAPACITY);
+
+        // Check if enough contiguous space is available at the end of the array and wrap
+        // otherwise skipping the too small piece of memory.
+        size_t const space = (((2 * CAPACITY) - index) % CAPACITY);
+        if (space < MAX_ENTRY_SIZE)
+        {
+            index = (index + space) % (2 * CAPACITY);
+        }
+        return index;
+    }
+
+    static size_t availableBetween(size_t const writeIndex, size_t const readIndex)
+    {
+        size_t usedBytes;
+        if (writeIndex < readIndex)
+        {
+            usedBytes = (writeIndex + (2 * CAPACITY)) - readIndex;
+        }
+        else
+        {
+            usedBytes = writeIndex - readIndex;
+        }
+        return CAPACITY - usedBytes;
+    }
+
+public:
+    // [PUBLIC_TYPES_BEGIN]
+    /** Type of the size information stored for each entry. */
+    using size_type = SIZE_TYPE;
+
+    // [PUBLIC_TYPES_END]
+
+    // [PUBLIC_API_BEGIN]
+    /**
+     * Returns the capacity of the underlying array of data managed by this MpscMemoryQueue.
+     */
+    static constexpr size_t capacity() { return CAPACITY; }
+
+    /**
+     * Returns the maximum size of one allocation.
+     */
+    static constexpr size_t maxElementSize() { return MAX_ELEMENT_SIZE; }
+
+    /**
+     * Constructs an MpscMemoryQueue of CAPACITY bytes.
+     */
+    MpscMemoryQueue() = default;
+
+    // [PUBLIC_API_END]
+
+    /**
+     * The Writer side of an MpscMemoryQueue provides API to insert data in the queue. Each
+     * producer uses its own Writer.
+     */
+    class Writer
+    {
+    public:
+        // [PUBLIC_API_WRITER_BEGIN]
+        /**
+         * Constructs a Writer to a given queue.
+         */
+        explicit Writer(MpscMemoryQueue& queue);
+
+        /**
+         * Reserves a requested number of bytes and returns them as a slice. If this Writer has
+         * reserved a slice that has not been committed yet, no new space is reserved: the
+         * pending slice is returned trimmed to size if it is large enough, which allows to
+         * first allocate a worst case size slice and then trimming it before calling commit.
+         *
+         * \param size  Number of bytes to allocate from this MpscMemoryQueue.
+         * \return  - Empty slice, if requested size was greater as MAX_ELEMENT_SIZE, greater
+         *            than a pending slice or not enough memory is available
+         *          - Slice of size bytes otherwise.
+         */
+        ::etl::span<uint8_t> allocate(size_t size);
+
+        /**
+         * Makes the previously allocated data available for the Reader, as soon as all data
+         * allocated before by other Writers has been committed.
+         */
+        void commit();
+
+        /**
+         * Returns the number of bytes that are currently not reserved, including the bytes
+         * needed for the headers of the entries.
+         */
+        size_t available() const;
+
+        /**
+         * Returns the maximum size of which a slice of bytes can be allocated.
+         */
+        size_t maxSize() const;
+        // [PUBLIC_API_WRITER_END]
+    private:
+        TxData& _txData;
+        RxData const& _rxData;
+        size_t _index;
+        size_t _reserved;
+        size_t _size;
+    };
+
+    /**
+     * The Reader side of an MpscMemoryQueue provides API to read data from the queue.
+     */
+    class Reader
+    {
+    public:
+        // [PUBLIC_API_READER_BEGIN]
+        /**
+         * Constructs a Reader from a given queue.
+         */
+        explicit Reader(MpscMemoryQueue& queue);
+
+        /**
+         * Returns true if the next entry is not available, i.e. nothing has been reserved or
+         * the oldest reservation has not been committed yet.
+         *
+         * Calling peek() on an empty queue will return an empty slice.
+         */
+        bool empty() const;
+
+        /**
+         * Returns a slice of bytes pointing to the next memory chunk of the MpscMemoryQueue,
+         * if available. Calling peek on an empty MpscMemoryQueue will return an empty slice.
+         */
+        ::etl::span<uint8_t> peek() const;
+
+        /**
+         * Releases the first allocated chunk of memory. If the Reader is empty, calling this
+         * function has no effect.
+         */
+        void release() const;
+
+        /**
+         * Releases all entries until empty() returns true.
+         */
+        void clear() const;
+
+        /**
+         * Returns the maximum size of which a slice of bytes can be read.
+         */
+        size_t maxSize() const;
+
+        /**
+         * Returns the number of bytes that are currently not reserved, including the bytes
+         * needed for the headers of the entries.
+         */
+        size_t available() const;
+        // [PUBLIC_API_READER_END]
+    private:
+        TxData& _txData;
+        RxData& _rxData;
+    };
+};
+
+template<size_t CAPACITY, size_t MAX_ELEMENT_SIZE, typename SIZE_TYPE>
+inline uint8_t*
+MpscMemoryQueue<CAPACITY, MAX_ELEMENT_SIZE, SIZE_TYPE>::TxData::bytesAt(size_t const index)
+{
+    return reinterpret_cast<uint8_t*>(words.data()) + index;
+}
+
+template<size_t CAPACITY, size_t MAX_ELEMENT_SIZE, typename SIZE_TYPE>
+inline SIZE_TYPE&
+MpscMemoryQueue<CAPACITY, MAX_ELEMENT_SIZE, SIZE_TYPE>::TxData::wordAt(size_t const index)
+{
+    return words[(index % CAPACITY) / sizeof(SIZE_TYPE)];
+}
+
+template<size_t CAPACITY, size_t MAX_ELEMENT_SIZE, typename SIZE_TYPE>
+inline SIZE_TYPE
+MpscMemoryQueue<CAPACITY, MAX_ELEMENT_SIZE, SIZE_TYPE>::TxData::loadLength(size_t const index)
+{
+    return __atomic_load_n(&wordAt(index), __ATOMIC_ACQUIRE);
+}
+
+template<size_t CAPACITY, size_t MAX_ELEMENT_SIZE, typename SIZE_TYPE>
+inline void MpscMemoryQueue<CAPACITY, MAX_ELEMENT_SIZE, SIZE_TYPE>::TxData::storeLength(
+    size_t const index, SIZE_TYPE const length)
+{
+    __atomic_store_n(&wordAt(index), length, __ATOMIC_RELEASE);
+}
+
+template<size_t CAPACITY, size_t MAX_ELEMENT_SIZE, typename SIZE_TYPE>
+inline MpscMemoryQueue<CAPACITY, MAX_ELEMENT_SIZE, SIZE_TYPE>::Writer::Writer(
+    MpscMemoryQueue& queue)
+: _txData(queue.tx), _rxData(queue.rx), _index(0U), _reserved(0U), _size(0U)
+{}
+
+template<size_t CAPACITY, size_t MAX_ELEMENT_SIZE, typename SIZE_TYPE>
+::etl::span<uint8_t>
+MpscMemoryQueue<CAPACITY, MAX_ELEMENT_SIZE, SIZE_TYPE>::Writer::allocate(size_t const size)
+{
+    if ((size > MAX_ELEMENT_SIZE) || (size == 0))
+    {
+        return {};
+    }
+    if (_reserved == 0U)
+    {
+        size_t const length = entrySize(size);
+        size_t writeIndex   = _txData.reserved.load(::etl::memory_order_relaxed);
+        do
+        {
+            // Acquiring the read index makes the zeroed memory of released entries visible.
+            size_t const readIndex = _rxData.received.load(::etl::memory_order_acquire);
+            if (availableBetween(writeIndex, readIndex) < length)
+            {
+                return {};
+            }
+        } while (!_txData.reserved.compare_exchange_weak(
+            writeIndex,
+            advanceIndex(writeIndex, length),
+            ::etl::memory_order_relaxed,
+            ::etl::memory_order_relaxed));
+        _index    = writeIndex % CAPACITY;
+        _reserved = length;
+    }
+    else if (entrySize(size) > _reserved)
+    {
+        return {};
+    }
+    _size = size;
+    return ::etl::span<uint8_t>(_txData.bytesAt(_index + HEADER_SIZE), size);
+}
+
+template<size_t CAPACITY, size_t MAX_ELEMENT_SIZE, typename SIZE_TYPE>
+void MpscMemoryQueue<CAPACITY, MAX_ELEMENT_SIZE, SIZE_TYPE>::Writer::commit()
+{
+    // Prevent accidentally committing random data if allocate has not been called or
+    // previous allocation was unsuccessful.
+    if (_reserved == 0U)
+    {
+        return;
+    }
+    _txData.wordAt(_index + sizeof(SIZE_TYPE)) = static_cast<SIZE_TYPE>(_size);
+    // Store the length last to ensure data consistency.
+    _txData.storeLength(_index, static_cast<SIZE_TYPE>(_reserved));
+    _reserved = 0U;
+}
+
+template<size_t CAPACITY, size_t MAX_ELEMENT_SIZE, typename SIZE_TYPE>
+inline size_t MpscMemoryQueue<CAPACITY, MAX_ELEMENT_SIZE, SIZE_TYPE>::Writer::available() const
+{
+    return availableBetween(
+        _txData.reserved.load(::etl::memory_order_relaxed),
+        _rxData.received.load(::etl::memory_order_relaxed));
+}
+
+template<size_t CAPACITY, size_t MAX_ELEMENT_SIZE, typename SIZE_TYPE>
+inline size_t MpscMemoryQueue<CAPACITY, MAX_ELEMENT_SIZE, SIZE_TYPE>::Writer::maxSize() const
+{
+    return MAX_ELEMENT_SIZE;
+}
+
+template<size_t CAPACITY, size_t MAX_ELEMENT_SIZE, typename SIZE_TYPE>
+inline MpscMemoryQueue<CAPACITY, MAX_ELEMENT_SIZE, SIZE_TYPE>::Reader::Reader(
+    MpscMemoryQueue& queue)
+: _txData(queue.tx), _rxData(queue.rx)
+{}
+
+template<size_t CAPACITY, size_t MAX_ELEMENT_SIZE, typename SIZE_TYPE>
+inline bool MpscMemoryQueue<CAPACITY, MAX_ELEMENT_SIZE, SIZE_TYPE>::Reader::empty() const
+{
+    return peek().size() == 0U;
+}
+
+template<size_t CAPACITY, size_t MAX_ELEMENT_SIZE, typename SIZE_TYPE>
+::etl::span<uint8_t> MpscMemoryQueue<CAPACITY, MAX_ELEMENT_SIZE, SIZE_TYPE>::Reader::peek() const
+{
+    size_t const index = _rxData.received.load(::etl::memory_order_relaxed) % CAPACITY;
+    if (_txData.loadLength(index) == 0U)
+    {
+        return {};
+    }
+    SIZE_TYPE const size = _txData.wordAt(index + sizeof(SIZE_TYPE));
+    return ::etl::span<uint8_t>(_txData.bytesAt(index + HEADER_SIZE), size);
+}
+
+template<size_t CAPACITY, size_t MAX_ELEMENT_SIZE, typename SIZE_TYPE>
+void MpscMemoryQueue<CAPACITY, MAX_ELEMENT_SIZE, SIZE_TYPE>::Reader::release() const
+{
+    size_t const readIndex = _rxData.received.load(::etl::memory_order_relaxed);
+    size_t const index     = readIndex % CAPACITY;
+    size_t const length    = _txData.loadLength(index);
+    if (length == 0U)
+    {
+        return;
+    }
+    // Zero the entry, so that any header reserved at this memory reads as not committed.
+    (void)::etl::mem_set(_txData.bytesAt(index), length, static_cast<uint8_t>(0U));
+    // Store readIndex last to ensure data consistency.
+    _rxData.received.store(advanceIndex(readIndex, length), ::etl::memory_order_release);
+}
+
+template<size_t CAPACITY, size_t MAX_ELEMENT_SIZE, typename SIZE_TYPE>
+inline void MpscMemoryQueue<CAPACITY, MAX_ELEMENT_SIZE, SIZE_TYPE>::Reader::clear() const
+{
+    while (!empty())
+    {
+        release();
+    }
+}
+
+template<size_t CAPACITY, size_t MAX_ELEMENT_SIZE, typename SIZE_TYPE>
+inline size_t MpscMemoryQueue<CAPACITY, MAX_ELEMENT_SIZE, SIZE_TYPE>::Reader::maxSize() const
+{
+    return MAX_ELEMENT_SIZE;
+}
+
+template<size_t CAPACITY, size_t MAX_ELEMENT_SIZE, typename SIZE_TYPE>
+inline size_t MpscMemoryQueue<CAPACITY, MAX_ELEMENT_SIZE, SIZE_TYPE>::Reader::available() const
+{
+    return availableBetween(
+        _txData.reserved.load(::etl::memory_order_relaxed),
+        _rxData.received.load(::etl::memory_order_relaxed));
+}
+
+} // namespace io
@@ -97,6 +97,52 @@ struct variant_ops<void>
         return return_helper<R>::help();
     }
 };
+
+template<typename T>
+struct variant_payload_ops
+{
+    template<typename Visitor>
+    static void call(::etl::span<uint8_t const> const mem, Visitor& visitor)
+    {
+        visitor(*reinterpret_cast<T const*>(mem.data()), mem.subspan(sizeof(T)));
+    }
+};
+
+/**
+ * Dispatches an element to the visitor overload of its type through a table of function pointers
+ * indexed by the type id, so that the cost of dispatching doesn't depend on the number of types.
+ * Unknown type ids are ignored.
+ */
+template<typename TypeList>
+struct variant_dispatch;
+
+template<typename... Types>
+struct variant_dispatch<::etl::type_list<Types...>>
+{
+    template<typename Visitor>
+    static void call(size_t const t, uint8_t const* const mem, Visitor& visitor)
+    {
+        using Function                    = void (*)(uint8_t const*, Visitor&);
+        static constexpr Function TABLE[] = {&variant_ops<Types>::template call<Visitor, void>...};
+        if (t < sizeof...(Types))
+        {
+            TABLE[t](mem, visitor);
+        }
+    }
+
+    template<typename Visitor>
+    static void
+    call_with_payload(size_t const t, ::etl::span<uint8_t const> const mem, Visitor& visitor)
+    {
+        using Function = void (*)(::etl::span<uint8_t const>, Visitor&);
+        static constexpr Function TABLE[]
+            = {&variant_payload_ops<Types>::template call<Visitor>...};
+        if (t < sizeof...(Types))
+        {
+            TABLE[t](mem, visitor);
+        }
+    }
+};
 } // namespace internal
 
 template<typename... ElementTypes>
@@ -146,34 +192,39 @@ struct variant_q
 
     using types = TypeList;
 
+    static constexpr size_t READ_ALL_BATCH_SIZE = 16U;
+
 private:
-    template<typename TL, size_t ID = 0>
-    struct variant_do
+    template<typename F, typename Reader>
+    static auto drain(F const& read, Reader& reader, int)
+        -> decltype(reader.release(size_t()), size_t())
     {
-        using T       = typename TL::head;
-        using recurse = variant_do<typename TL::tail, ID + 1>;
-
-        template<typename Visitor, typename R>
-        static void call(size_t const t, ::etl::span<uint8_t const> const mem, Visitor& visitor)
+        ::etl::span<uint8_t> slices[READ_ALL_BATCH_SIZE];
+        size_t count = 0U;
+        for (size_t n = reader.peek(slices); n != 0U; n = reader.peek(slices))
         {
-            if (t == ID)
-            {
-                visitor(*reinterpret_cast<T const*>(mem.data()), mem.subspan(sizeof(T)));
-            }
-            else
+            for (size_t i = 0U; i < n; ++i)
             {
-                recurse::template call<Visitor, R>(t, mem, visitor);
+                read(slices[i]);
             }
+            reader.release(n);
+            count += n;
         }
-    };
+        return count;
+    }
 
-    template<size_t ID>
-    struct variant_do<::etl::type_list<>, ID>
+    template<typename F, typename Reader>
+    static size_t drain(F const& read, Reader& reader, long)
     {
-        template<typename Visitor, typename R>
-        static void call(size_t const, ::etl::span<uint8_t const> const, Visitor const&)
-        {}
-    };
+        size_t count = 0U;
+        for (auto data = reader.peek(); data.size() != 0U; data = reader.peek())
+        {
+            read(data);
+            reader.release();
+            ++count;
+        }
+        return count;
+    }
 
     template<typename T>
     static void write_header(T const& t, ::etl::span<uint8_t>& buffer)
@@ -193,16 +244,42 @@ public:
     static void read(Visitor& visitor, ::etl::span<uint8_t const> const data)
     {
         assert(data.size() != 0);
-        return variant_T_do<TypeList>::template call<Visitor, void>(
-            data[0], data.subspan(1).data(), visitor);
+        internal::variant_dispatch<TypeList>::call(data[0], data.subspan(1).data(), visitor);
     }
 
     template<typename Visitor>
     static void read_with_payload(Visitor& visitor, ::etl::span<uint8_t const> const data)
     {
         assert(data.size() != 0);
-        return variant_do<TypeList>::template call<Visitor, void>(
-            data[0], data.subspan(1), visitor);
+        internal::variant_dispatch<TypeList>::call_with_payload(data[0], data.subspan(1), visitor);
+    }
+
+    /**
+     * Dispatches all elements available from reader to visitor like read() and releases them.
+     * Readers providing peek() and release() of several elements at once, like
+     * MemoryQueue::Reader, release up to READ_ALL_BATCH_SIZE elements at once.
+     * \return number of elements read
+     */
+    template<typename Visitor, typename Reader>
+    static size_t read_all(Visitor& visitor, Reader& reader)
+    {
+        return drain(
+            [&visitor](::etl::span<uint8_t const> const data) { read(visitor, data); }, reader, 0);
+    }
+
+    /**
+     * Dispatches all elements available from reader to visitor like read_with_payload() and
+     * releases them, see read_all().
+     * \return number of elements read
+     */
+    template<typename Visitor, typename Reader>
+    static size_t read_all_with_payload(Visitor& visitor, Reader& reader)
+    {
+        return drain(
+            [&visitor](::etl::span<uint8_t const> const data)
+            { read_with_payload(visitor, data); },
+            reader,
+            0);
     }
 
     template<typename T, typename Writer>
@@ -277,4 +354,7 @@ public:
     }
 };
 
+template<typename TypeList>
+constexpr size_t variant_q<TypeList>::READ_ALL_BATCH_SIZE;
+
 } // namespace io
@@ -0,0 +1,314 @@
+// Copyright 2025 Accenture.
+
+#include "io/BroadcastMemoryQueue.h"
+
+#include "io/MemoryQueue.h"
+
+#include <etl/span.h>
+
+#include <gmock/gmock.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+using namespace ::testing;
+
+namespace
+{
+struct BroadcastMemoryQueueTest : ::testing::Test
+{
+    static size_t const QUEUE_SIZE       = 30;
+    static size_t const MAX_ELEMENT_SIZE = 8;
+    static size_t const NUM_READERS      = 3;
+
+    using Q = ::io::BroadcastMemoryQueue<QUEUE_SIZE, MAX_ELEMENT_SIZE, NUM_READERS>;
+
+    BroadcastMemoryQueueTest() : _q(), _w(_q), _r0(_q, 0), _r1(_q, 1), _r2(_q, 2) {}
+
+    bool write(uint8_t const value, size_t const size = 1)
+    {
+        ::etl::span<uint8_t> s = _w.allocate(size);
+        if (s.size() != size)
+        {
+            return false;
+        }
+        s[0] = value;
+        _w.commit();
+        return true;
+    }
+
+    static int read(Q::Reader& r)
+    {
+        ::etl::span<uint8_t> s = r.peek();
+        if (s.size() == 0)
+        {
+            return -1;
+        }
+        int const value = s[0];
+        r.release();
+        return value;
+    }
+
+    Q _q;
+    Q::Writer _w;
+    Q::Reader _r0;
+    Q::Reader _r1;
+    Q::Reader _r2;
+};
+
+size_t const BroadcastMemoryQueueTest::QUEUE_SIZE;
+size_t const BroadcastMemoryQueueTest::MAX_ELEMENT_SIZE;
+size_t const BroadcastMemoryQueueTest::NUM_READERS;
+
+/**
+ * \refs:    SMD_io_BroadcastMemoryQueue
+ * \desc
+ * Checks the constants and that initially all bytes are available.
+ */
+TEST_F(BroadcastMemoryQueueTest, initial_state)
+{
+    EXPECT_EQ(QUEUE_SIZE, Q::capacity());
+    EXPECT_EQ(MAX_ELEMENT_SIZE, Q::maxElementSize());
+    EXPECT_EQ(NUM_READERS, Q::numReaders());
+    EXPECT_EQ(QUEUE_SIZE, _w.available());
+    EXPECT_EQ(QUEUE_SIZE, _w.minAvailable());
+    EXPECT_EQ(QUEUE_SIZE, _r0.available());
+    EXPECT_FALSE(_w.full());
+    EXPECT_TRUE(_r0.empty());
+    EXPECT_EQ(0U, _r0.peek().size());
+    EXPECT_EQ(0U, _r0.dropped());
+}
+
+/**
+ * \refs:    SMD_io_BroadcastMemoryQueue
+ * \desc
+ * Every reader receives every committed slice, which is stored only once.
+ */
+TEST_F(BroadcastMemoryQueueTest, every_reader_receives_every_slice)
+{
+    ASSERT_TRUE(write(0x11U, 3));
+    ASSERT_TRUE(write(0x22U, 5));
+
+    EXPECT_EQ(_r0.peek().data(), _r1.peek().data());
+    EXPECT_EQ(_r0.peek().data(), _r2.peek().data());
+    EXPECT_EQ(3U, _r0.peek().size());
+    EXPECT_EQ(0x11, read(_r0));
+    EXPECT_EQ(0x22, read(_r0));
+    EXPECT_TRUE(_r0.empty());
+    EXPECT_EQ(0x11, read(_r1));
+    EXPECT_EQ(0x22, read(_r1));
+    EXPECT_EQ(0x11, read(_r2));
+    EXPECT_EQ(0x22, read(_r2));
+    EXPECT_EQ(-1, read(_r2));
+}
+
+/**
+ * \refs:    SMD_io_BroadcastMemoryQueue
+ * \desc
+ * The space available to the writer is determined by the slowest reader.
+ */
+TEST_F(BroadcastMemoryQueueTest, available_depends_on_slowest_reader)
+{
+    ASSERT_TRUE(write(1U));
+    ASSERT_TRUE(write(2U));
+    EXPECT_EQ(QUEUE_SIZE - 6, _w.available());
+
+    _r0.clear();
+    _r1.clear();
+    EXPECT_EQ(QUEUE_SIZE, _r0.available());
+    EXPECT_EQ(QUEUE_SIZE - 6, _r2.available());
+    EXPECT_EQ(QUEUE_SIZE - 6, _w.available());
+
+    _r2.release();
+    EXPECT_EQ(QUEUE_SIZE - 3, _w.available());
+}
+
+/**
+ * \refs:    SMD_io_BroadcastMemoryQueue
+ * \desc
+ * The writer doesn't block on a slow reader but drops the oldest slices for it.
+ */
+TEST_F(BroadcastMemoryQueueTest, slow_reader_gets_drops_instead_of_blocking_writer)
+{
+    for (uint8_t i = 0U; i < 20U; ++i)
+    {
+        ASSERT_TRUE(write(i));
+        // reader 0 keeps up, readers 1 and 2 never read
+        EXPECT_EQ(i, read(_r0));
+    }
+
+    EXPECT_EQ(0U, _r0.dropped());
+    EXPECT_GT(_r1.dropped(), 0U);
+    EXPECT_EQ(_r1.dropped(), _r2.dropped());
+
+    // the slow reader continues with the oldest slice that hasn't been dropped
+    size_t const dropped = _r1.dropped();
+    for (size_t i = dropped; i < 20U; ++i)
+    {
+        EXPECT_EQ(static_cast<int>(i), read(_r1));
+    }
+    EXPECT_TRUE(_r1.empty());
+}
+
+/**
+ * \refs:    SMD_io_BroadcastMemoryQueue
+ * \desc
+ * A slice returned by peek() is never dropped before it is released, the allocation fails instead.
+ */
+TEST_F(BroadcastMemoryQueueTest, held_slice_is_not_dropped)
+{
+    ASSERT_TRUE(write(0xAAU, MAX_ELEMENT_SIZE));
+    ::etl::span<uint8_t> const held = _r1.peek();
+    ASSERT_EQ(MAX_ELEMENT_SIZE, held.size());
+    _r0.clear();
+    _r2.clear();
+
+    size_t written = 1U;
+    while (write(static_cast<uint8_t>(written), MAX_ELEMENT_SIZE))
+    {
+        ++written;
+        ASSERT_LT(written, 10U);
+    }
+    EXPECT_EQ(0U, _w.allocate(1).size());
+    EXPECT_EQ(0xAAU, held[0]);
+    EXPECT_EQ(0U, _r1.dropped());
+
+    // after the release, the writer can drop the slices of reader 1 again
+    _r1.release();
+    _r0.clear();
+    _r2.clear();
+    EXPECT_TRUE(write(0xBBU, MAX_ELEMENT_SIZE));
+    EXPECT_EQ(0U, _r1.dropped());
+    _r0.clear();
+    _r2.clear();
+    EXPECT_TRUE(write(0xCCU, MAX_ELEMENT_SIZE));
+    EXPECT_EQ(1U, _r1.dropped());
+    EXPECT_EQ(2, read(_r1));
+}
+
+/**
+ * \refs:    SMD_io_BroadcastMemoryQueue
+ * \desc
+ * A reallocation before commit only commits the last allocation.
+ */
+TEST_F(BroadcastMemoryQueueTest, allocate_can_be_used_to_reallocate)
+{
+    EXPECT_EQ(0U, _w.allocate(MAX_ELEMENT_SIZE + 1).size());
+    EXPECT_EQ(0U, _w.allocate(0).size());
+    _w.commit();
+    EXPECT_TRUE(_r0.empty());
+
+    EXPECT_EQ(MAX_ELEMENT_SIZE, _w.allocate(MAX_ELEMENT_SIZE).size());
+    ::etl::span<uint8_t> s = _w.allocate(2);
+    ASSERT_EQ(2U, s.size());
+    s[0] = 0x12U;
+    _w.commit();
+    EXPECT_EQ(2U, _r2.peek().size());
+    EXPECT_EQ(QUEUE_SIZE - 4, _w.available());
+    EXPECT_LE(_w.minAvailable(), QUEUE_SIZE);
+    _r0.clear();
+    _r1.clear();
+    _r2.clear();
+    _w.resetMinAvailable();
+    EXPECT_EQ(QUEUE_SIZE, _w.minAvailable());
+}
+
+/**
+ * \refs:    SMD_io_BroadcastMemoryQueueReader
+ * \desc
+ * The IWriter and IReader adapters can be used with a BroadcastMemoryQueue.
+ */
+TEST_F(BroadcastMemoryQueueTest, generic_interfaces)
+{
+    ::io::MemoryQueueWriter<Q> w(_q);
+    ::io::BroadcastMemoryQueueReader<Q> r0(_q, 0);
+    ::io::BroadcastMemoryQueueReader<Q> r1(_q, 1);
+
+    EXPECT_EQ(MAX_ELEMENT_SIZE, w.maxSize());
+    EXPECT_EQ(MAX_ELEMENT_SIZE, r0.maxSize());
+    ::etl::span<uint8_t> s = w.allocate(1);
+    ASSERT_EQ(1U, s.size());
+    s[0] = 0x5AU;
+    w.commit();
+    w.flush();
+
+    ::io::IReader& reader = r1;
+    ASSERT_EQ(1U, reader.peek().size());
+    EXPECT_EQ(0x5AU, reader.peek()[0]);
+    reader.release();
+    EXPECT_EQ(0U, r1.peek().size());
+    EXPECT_EQ(1U, r0.peek().size());
+    EXPECT_EQ(0U, r0.dropped());
+    EXPECT_EQ(QUEUE_SIZE - 3, r0.available());
+}
+
+/**
+ * \refs:    SMD_io_BroadcastMemoryQueue
+ * \desc
+ * Readers on their own threads receive the slices in order, or count the missing ones as drops.
+ */
+TEST(BroadcastMemoryQueueThreadTest, concurrent_readers)
+{
+    using Q = ::io::BroadcastMemoryQueue<64, 4, 3>;
+    Q q;
+    Q::Writer w(q);
+    uint32_t const count = 10000U;
+
+    std::vector<uint32_t> received(Q::numReaders(), 0U);
+    std::vector<uint32_t> outOfOrder(Q::numReaders(), 0U);
+    std::vector<size_t> dropped(Q::numReaders(), 0U);
+    std::vector<std::thread> readers;
+    for (size_t i = 0U; i < Q::numReaders(); ++i)
+    {
+        readers.emplace_back(
+            [&q, &received, &outOfOrder, &dropped, i]()
+            {
+                Q::Reader r(q, i);
+                uint32_t last = 0U;
+                while (last != (count - 1U))
+                {
+                    ::etl::span<uint8_t> const s = r.peek();
+                    if (s.size() == 0U)
+                    {
+                        std::this_thread::yield();
+                        continue;
+                    }
+                    uint32_t const value = ::etl::be_uint32_t(s.data());
+                    if ((received[i] != 0U) && (value <= last))
+                    {
+                        ++outOfOrder[i];
+                    }
+                    last = value;
+                    ++received[i];
+                    r.release();
+                }
+                dropped[i] = r.dropped();
+            });
+    }
+    for (uint32_t i = 0U; i < count; ++i)
+    {
+        ::etl::span<uint8_t> s = w.allocate(4);
+        if (s.size() != 4U)
+        {
+            // all readers hold a slice, try again
+            std::this_thread::yield();
+            --i;
+            continue;
+        }
+        ::etl::be_uint32_ext_t{s.data()} = i;
+        w.commit();
+    }
+    for (auto& reader : readers)
+    {
+        reader.join();
+    }
+    for (size_t i = 0U; i < Q::numReaders(); ++i)
+    {
+        EXPECT_EQ(0U, outOfOrder[i]);
+        EXPECT_EQ(count, received[i] + dropped[i]);
+    }
+}
+
+} // namespace
@@ -2,6 +2,7 @@
 
 #include "io/MemoryQueue.h"
 
+#include <etl/array.h>
 #include <etl/memory.h>
 #include <etl/span.h>
 #include <etl/unaligned_type.h>
@@ -646,6 +647,112 @@ TEST_F(MemoryQueueTest, available_use_cases)
     EXPECT_EQ(20U, _r.available());
 }
 
+/**
+ * \refs:    SMD_io_MemoryQueue, SMD_io_MemoryQueue::Writer
+ * \desc
+ * Appended data only becomes visible to the Reader with publish(), but is already accounted for
+ * by the Writer.
+ */
+TEST_F(MemoryQueueTest, append_is_visible_after_publish)
+{
+    auto b = _w.allocate(4U);
+    ASSERT_EQ(4U, b.size());
+    b[0] = 0x11U;
+    _w.append();
+    b = _w.allocate(2U);
+    ASSERT_EQ(2U, b.size());
+    b[0] = 0x22U;
+    _w.append();
+    EXPECT_TRUE(_r.empty());
+    EXPECT_EQ(20U, _r.available());
+    EXPECT_EQ(10U, _w.available());
+
+    _w.publish();
+    EXPECT_FALSE(_r.empty());
+    EXPECT_EQ(10U, _r.available());
+    b = _r.peek();
+    ASSERT_EQ(4U, b.size());
+    EXPECT_EQ(0x11U, b[0]);
+    _r.release();
+    b = _r.peek();
+    ASSERT_EQ(2U, b.size());
+    EXPECT_EQ(0x22U, b[0]);
+    _r.release();
+    EXPECT_TRUE(_r.empty());
+
+    // publishing without appended data has no effect
+    _w.publish();
+    EXPECT_TRUE(_r.empty());
+}
+
+/**
+ * \refs:    SMD_io_MemoryQueue, SMD_io_MemoryQueue::Writer
+ * \desc
+ * Calling append() without a successful allocation has no effect, commit() still publishes
+ * previously appended data.
+ */
+TEST_F(MemoryQueueTest, append_without_allocation_and_commit_after_append)
+{
+    _w.append();
+    _w.publish();
+    EXPECT_TRUE(_r.empty());
+
+    (void)_w.allocate(1U);
+    _w.append();
+    (void)_w.allocate(1U);
+    _w.commit();
+    size_t count = 0U;
+    while (!_r.empty())
+    {
+        _r.release();
+        ++count;
+    }
+    EXPECT_EQ(2U, count);
+}
+
+/**
+ * \refs:    SMD_io_MemoryQueue, SMD_io_MemoryQueue::Reader
+ * \desc
+ * The Reader peeks several consecutive chunks at once, also across the end of the buffer, and
+ * releases them with a single call.
+ */
+TEST_F(MemoryQueueTest, peek_and_release_many)
+{
+    ::etl::array<::etl::span<uint8_t>, 4U> slices;
+    EXPECT_EQ(0U, _r.peek(slices));
+
+    // [s s 1 1 1 1 1 1 1 1 s s 2 2 2 2 2 2 2 2]
+    for (uint8_t i = 1U; i <= 2U; ++i)
+    {
+        auto b = _w.allocate(Q::maxElementSize());
+        b[0]   = i;
+        _w.append();
+    }
+    _w.publish();
+    EXPECT_EQ(1U, _r.peek(::etl::span<::etl::span<uint8_t>>(slices.data(), 1U)));
+    EXPECT_EQ(2U, _r.peek(slices));
+    EXPECT_EQ(Q::maxElementSize(), slices[0].size());
+    EXPECT_EQ(1U, slices[0][0]);
+    EXPECT_EQ(2U, slices[1][0]);
+    _r.release(1U);
+
+    // [s s 3 3 3 3 3 3 3 3 s s 2 2 2 2 2 2 2 2]
+    auto b = _w.allocate(Q::maxElementSize());
+    ASSERT_EQ(Q::maxElementSize(), b.size());
+    b[0] = 3U;
+    _w.commit();
+    EXPECT_EQ(2U, _r.peek(slices));
+    EXPECT_EQ(2U, slices[0][0]);
+    EXPECT_EQ(3U, slices[1][0]);
+
+    // releasing more chunks than available empties the queue
+    _r.release(3U);
+    EXPECT_TRUE(_r.empty());
+    EXPECT_EQ(20U, _w.available());
+    _r.release(1U);
+    EXPECT_TRUE(_r.empty());
+}
+
 /**
  * \refs:    SMD_io_MemoryQueue, SMD_io_MemoryQueue::Writer, SMD_io_MemoryQueue::Reader
  * \desc
@@ -0,0 +1,344 @@
+// Copyright 2025 Accenture.
+
+#include "io/MpscMemoryQueue.h"
+
+#include "io/MemoryQueue.h"
+
+#include <etl/span.h>
+
+#include <gmock/gmock.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <thread>
+#include <vector>
+
+using namespace ::testing;
+
+namespace
+{
+struct MpscMemoryQueueTest : ::testing::Test
+{
+    static size_t const QUEUE_SIZE       = 32;
+    static size_t const MAX_ELEMENT_SIZE = 8;
+
+    using Q = ::io::MpscMemoryQueue<QUEUE_SIZE, MAX_ELEMENT_SIZE>;
+
+    MpscMemoryQueueTest() : _q(), _w0(_q), _w1(_q), _r(_q) {}
+
+    static bool write(Q::Writer& w, uint8_t const value, size_t const size = 1)
+    {
+        ::etl::span<uint8_t> s = w.allocate(size);
+        if (s.size() != size)
+        {
+            return false;
+        }
+        s[0] = value;
+        w.commit();
+        return true;
+    }
+
+    int read()
+    {
+        ::etl::span<uint8_t> s = _r.peek();
+        if (s.size() == 0)
+        {
+            return -1;
+        }
+        int const value = s[0];
+        _r.release();
+        return value;
+    }
+
+    Q _q;
+    Q::Writer _w0;
+    Q::Writer _w1;
+    Q::Reader _r;
+};
+
+size_t const MpscMemoryQueueTest::QUEUE_SIZE;
+size_t const MpscMemoryQueueTest::MAX_ELEMENT_SIZE;
+
+/**
+ * \refs:    SMD_io_MpscMemoryQueue
+ * \desc
+ * A new queue is empty and provides its full capacity.
+ */
+TEST_F(MpscMemoryQueueTest, initially_empty)
+{
+    EXPECT_TRUE(_r.empty());
+    EXPECT_EQ(0U, _r.peek().size());
+    EXPECT_EQ(QUEUE_SIZE, _w0.available());
+    EXPECT_EQ(QUEUE_SIZE, _r.available());
+    EXPECT_EQ(MAX_ELEMENT_SIZE, _w0.maxSize());
+    EXPECT_EQ(MAX_ELEMENT_SIZE, _r.maxSize());
+    // releasing an empty queue has no effect
+    _r.release();
+    EXPECT_TRUE(_r.empty());
+}
+
+/**
+ * \refs:    SMD_io_MpscMemoryQueue, SMD_io_MpscMemoryQueue::Writer
+ * \desc
+ * Allocations of invalid sizes fail, committing without an allocation has no effect.
+ */
+TEST_F(MpscMemoryQueueTest, invalid_allocations)
+{
+    EXPECT_EQ(0U, _w0.allocate(0U).size());
+    EXPECT_EQ(0U, _w0.allocate(MAX_ELEMENT_SIZE + 1U).size());
+    _w0.commit();
+    EXPECT_TRUE(_r.empty());
+    EXPECT_EQ(QUEUE_SIZE, _w0.available());
+}
+
+/**
+ * \refs:    SMD_io_MpscMemoryQueue
+ * \desc
+ * Slices from different writers are read in the order of their allocation.
+ */
+TEST_F(MpscMemoryQueueTest, read_in_allocation_order)
+{
+    EXPECT_TRUE(write(_w0, 1U));
+    EXPECT_TRUE(write(_w1, 2U, 3U));
+    EXPECT_TRUE(write(_w0, 3U, MAX_ELEMENT_SIZE));
+    EXPECT_EQ(1U, _r.peek().size());
+    EXPECT_EQ(1, read());
+    EXPECT_EQ(3U, _r.peek().size());
+    EXPECT_EQ(2, read());
+    EXPECT_EQ(MAX_ELEMENT_SIZE, _r.peek().size());
+    EXPECT_EQ(3, read());
+    EXPECT_TRUE(_r.empty());
+}
+
+/**
+ * \refs:    SMD_io_MpscMemoryQueue
+ * \desc
+ * A slice committed before an earlier allocated slice is only visible after the earlier one.
+ */
+TEST_F(MpscMemoryQueueTest, later_commit_waits_for_earlier_allocation)
+{
+    ::etl::span<uint8_t> first = _w0.allocate(2U);
+    ASSERT_EQ(2U, first.size());
+    EXPECT_TRUE(write(_w1, 2U));
+    EXPECT_TRUE(_r.empty());
+
+    first[0] = 1U;
+    _w0.commit();
+    EXPECT_EQ(1, read());
+    EXPECT_EQ(2, read());
+    EXPECT_TRUE(_r.empty());
+}
+
+/**
+ * \refs:    SMD_io_MpscMemoryQueue, SMD_io_MpscMemoryQueue::Writer
+ * \desc
+ * Allocating again before commit() trims the pending slice without reserving more space.
+ */
+TEST_F(MpscMemoryQueueTest, reallocate_trims_pending_slice)
+{
+    ::etl::span<uint8_t> s = _w0.allocate(MAX_ELEMENT_SIZE);
+    ASSERT_EQ(MAX_ELEMENT_SIZE, s.size());
+    size_t const available = _w0.available();
+
+    s = _w0.allocate(2U);
+    ASSERT_EQ(2U, s.size());
+    EXPECT_EQ(available, _w0.available());
+    s[0] = 5U;
+    _w0.commit();
+
+    EXPECT_EQ(2U, _r.peek().size());
+    EXPECT_EQ(5, read());
+    EXPECT_EQ(QUEUE_SIZE, _w0.available());
+
+    // growing a pending slice beyond its reservation fails
+    ASSERT_EQ(1U, _w0.allocate(1U).size());
+    EXPECT_EQ(0U, _w0.allocate(MAX_ELEMENT_SIZE).size());
+    _w0.commit();
+    EXPECT_EQ(1U, _r.peek().size());
+}
+
+/**
+ * \refs:    SMD_io_MpscMemoryQueue
+ * \desc
+ * The queue fills up, and wraps around the end of its memory after slices have been read.
+ */
+TEST_F(MpscMemoryQueueTest, full_and_wrap_around)
+{
+    // Each slice of 8 bytes uses 12 bytes including the header, the remaining 8 bytes at the end
+    // are skipped.
+    EXPECT_TRUE(write(_w0, 1U, MAX_ELEMENT_SIZE));
+    EXPECT_TRUE(write(_w1, 2U, MAX_ELEMENT_SIZE));
+    EXPECT_EQ(0U, _w0.available());
+    EXPECT_FALSE(write(_w0, 3U));
+
+    EXPECT_EQ(1, read());
+    EXPECT_EQ(12U, _w0.available());
+    EXPECT_TRUE(write(_w1, 3U, MAX_ELEMENT_SIZE));
+    EXPECT_EQ(0U, _w0.available());
+    EXPECT_EQ(2, read());
+    EXPECT_EQ(3, read());
+    EXPECT_TRUE(_r.empty());
+    EXPECT_EQ(QUEUE_SIZE, _w0.available());
+
+    for (uint8_t i = 0U; i < 20U; ++i)
+    {
+        EXPECT_TRUE(write((i % 2U) == 0U ? _w0 : _w1, i, 1U + (i % MAX_ELEMENT_SIZE)));
+        EXPECT_EQ(i, read());
+    }
+}
+
+/**
+ * \refs:    SMD_io_MpscMemoryQueue
+ * \desc
+ * Releasing a slice zeroes its memory, so that stale data never looks like a committed header.
+ */
+TEST_F(MpscMemoryQueueTest, stale_data_is_not_read)
+{
+    ::etl::span<uint8_t> s = _w0.allocate(MAX_ELEMENT_SIZE);
+    ASSERT_EQ(MAX_ELEMENT_SIZE, s.size());
+    for (auto& b : s)
+    {
+        b = 0xFFU;
+    }
+    _w0.commit();
+    EXPECT_EQ(0xFF, read());
+
+    // reserve an entry starting within the memory of the released slice
+    for (uint8_t i = 0U; i < 6U; ++i)
+    {
+        EXPECT_TRUE(write(_w0, i, 2U));
+        EXPECT_EQ(i, read());
+    }
+    ASSERT_EQ(2U, _w1.allocate(2U).size());
+    EXPECT_TRUE(_r.empty());
+    _w1.commit();
+    EXPECT_FALSE(_r.empty());
+    _r.clear();
+    EXPECT_TRUE(_r.empty());
+}
+
+/**
+ * \refs:    SMD_io_MpscMemoryQueue, SMD_io_MemoryQueueWriter, SMD_io_MemoryQueueReader
+ * \desc
+ * The adapters of MemoryQueue provide IWriter and IReader for an MpscMemoryQueue.
+ */
+TEST_F(MpscMemoryQueueTest, adapters)
+{
+    ::io::MemoryQueueWriter<Q> w(_q);
+    ::io::MemoryQueueReader<Q> r(_q);
+    ::io::IWriter& writer = w;
+    ::io::IReader& reader = r;
+
+    auto s = writer.allocate(4U);
+    ASSERT_EQ(4U, s.size());
+    s[0] = 7U;
+    writer.commit();
+    writer.flush();
+    EXPECT_EQ(MAX_ELEMENT_SIZE, writer.maxSize());
+    EXPECT_EQ(MAX_ELEMENT_SIZE, reader.maxSize());
+    s = reader.peek();
+    ASSERT_EQ(4U, s.size());
+    EXPECT_EQ(7U, s[0]);
+    reader.release();
+    EXPECT_EQ(0U, reader.peek().size());
+}
+
+/**
+ * \refs:    SMD_io_MpscMemoryQueue
+ * \desc
+ * The size of a slice is stored as SIZE_TYPE, so sizes that need more than one byte are read back
+ * unchanged with wider size types, also after trimming the slice.
+ */
+TEST(MpscMemoryQueueSizeTypeTest, wide_size_type)
+{
+    using Q = ::io::MpscMemoryQueue<1024, 300, uint32_t>;
+    Q q;
+    Q::Writer w(q);
+    Q::Reader r(q);
+
+    ASSERT_EQ(300U, w.allocate(300U).size());
+    ASSERT_EQ(258U, w.allocate(258U).size());
+    w.commit();
+    ASSERT_EQ(257U, w.allocate(257U).size());
+    w.commit();
+
+    EXPECT_EQ(258U, r.peek().size());
+    r.release();
+    EXPECT_EQ(257U, r.peek().size());
+    r.release();
+    EXPECT_TRUE(r.empty());
+}
+
+/**
+ * \refs:    SMD_io_MpscMemoryQueue
+ * \desc
+ * Several producer threads write concurrently, the reader receives all slices of each producer
+ * completely and in order.
+ */
+TEST(MpscMemoryQueueThreadTest, concurrent_writers)
+{
+    using Q = ::io::MpscMemoryQueue<128, 8>;
+    Q q;
+    Q::Reader r(q);
+    size_t const numWriters = 4U;
+    uint32_t const count    = 5000U;
+
+    std::vector<std::thread> writers;
+    for (size_t i = 0U; i < numWriters; ++i)
+    {
+        writers.emplace_back(
+            [&q, i]()
+            {
+                Q::Writer w(q);
+                for (uint32_t n = 0U; n < count;)
+                {
+                    ::etl::span<uint8_t> s = w.allocate(1U + (n % 4U) + 4U);
+                    if (s.size() == 0U)
+                    {
+                        std::this_thread::yield();
+                        continue;
+                    }
+                    s[0] = static_cast<uint8_t>(i);
+                    ::memcpy(&s[1], &n, sizeof(n));
+                    w.commit();
+                    ++n;
+                }
+            });
+    }
+
+    std::vector<uint32_t> next(numWriters, 0U);
+    uint32_t outOfOrder = 0U;
+    uint32_t received   = 0U;
+    while (received < (numWriters * count))
+    {
+        ::etl::span<uint8_t> s = r.peek();
+        if (s.size() == 0U)
+        {
+            std::this_thread::yield();
+            continue;
+        }
+        size_t const writer = s[0];
+        uint32_t n;
+        ::memcpy(&n, &s[1], sizeof(n));
+        if ((writer >= numWriters) || (n != next[writer]) || (s.size() != (5U + (n % 4U))))
+        {
+            ++outOfOrder;
+        }
+        else
+        {
+            ++next[writer];
+        }
+        r.release();
+        ++received;
+    }
+    for (auto& t : writers)
+    {
+        t.join();
+    }
+    EXPECT_EQ(0U, outOfOrder);
+    EXPECT_TRUE(r.empty());
+    EXPECT_EQ(Q::capacity(), r.available());
+}
+
+} // namespace
@@ -69,6 +69,19 @@ struct VisitWithPayload
     }
 };
 
+struct SumPayloads
+{
+    size_t elements = 0U;
+    size_t bytes    = 0U;
+
+    template<typename T>
+    void operator()(T const&, ::etl::span<uint8_t const> const payload)
+    {
+        ++elements;
+        bytes += payload.size();
+    }
+};
+
 TEST(VariantQueue, read_write_no_payload)
 {
     Queue queue;
@@ -192,4 +205,99 @@ TEST(VariantQueue, manually_allocate_payload)
     reader.release();
 }
 
+TEST(VariantQueue, read_all)
+{
+    Queue queue;
+    ::io::MemoryQueueWriter<Queue> writer(queue);
+    ::io::MemoryQueueReader<Queue> reader(queue);
+
+    struct CountTypes
+    {
+        size_t counts[3] = {};
+
+        void operator()(A const&) { ++counts[0]; }
+
+        void operator()(B const&) { ++counts[1]; }
+
+        void operator()(C const&) { ++counts[2]; }
+    } visitor;
+
+    EXPECT_EQ(0U, abc_queue::read_all(visitor, reader));
+
+    ASSERT_TRUE(abc_queue::write(writer, A{{0, 1, 2, 3, 4}}));
+    ASSERT_TRUE(abc_queue::write(writer, C{}));
+    ASSERT_TRUE(abc_queue::write(writer, B{::etl::be_uint16_t(3), ::etl::be_uint32_t(4)}));
+    ASSERT_TRUE(abc_queue::write(writer, C{}));
+
+    EXPECT_EQ(4U, abc_queue::read_all(visitor, reader));
+    EXPECT_THAT(visitor.counts, ElementsAre(1U, 1U, 2U));
+    EXPECT_EQ(0, reader.peek().size());
+}
+
+TEST(VariantQueue, read_all_in_batches)
+{
+    using LargeQueue = ::io::VariantQueue<abc_variant_q_type_list, 200>;
+    LargeQueue queue;
+    LargeQueue::Writer writer(queue);
+    LargeQueue::Reader reader(queue);
+
+    size_t written = 0U;
+    while (abc_queue::write(writer, C{}))
+    {
+        ++written;
+    }
+    ASSERT_GT(written, abc_queue::READ_ALL_BATCH_SIZE);
+
+    SumPayloads visitor;
+    EXPECT_EQ(written, abc_queue::read_all_with_payload(visitor, reader));
+    EXPECT_EQ(written, visitor.elements);
+    EXPECT_TRUE(reader.empty());
+    EXPECT_EQ(0U, abc_queue::read_all_with_payload(visitor, reader));
+}
+
+TEST(VariantQueue, read_all_with_payload)
+{
+    Queue queue;
+    ::io::MemoryQueueWriter<Queue> writer(queue);
+    ::io::MemoryQueueReader<Queue> reader(queue);
+
+    SumPayloads visitor;
+
+    uint8_t const payload[] = {0x33, 0x77, 0x99};
+    ASSERT_TRUE(abc_queue::write(writer, A{{9, 8, 7, 6, 5}}, payload));
+    ASSERT_TRUE(abc_queue::write(writer, C{}, ::etl::span<uint8_t const>(payload, 1U)));
+    ASSERT_TRUE(abc_queue::write(writer, B{::etl::be_uint16_t(3), ::etl::be_uint32_t(4)}));
+
+    EXPECT_EQ(3U, abc_queue::read_all_with_payload(visitor, reader));
+    EXPECT_EQ(3U, visitor.elements);
+    EXPECT_EQ(4U, visitor.bytes);
+    EXPECT_EQ(0, reader.peek().size());
+}
+
+TEST(VariantQueue, unknown_type_id_is_ignored)
+{
+    Queue queue;
+    ::io::MemoryQueueWriter<Queue> writer(queue);
+    ::io::MemoryQueueReader<Queue> reader(queue);
+
+    auto buffer = writer.allocate(sizeof(A) + 1);
+    ASSERT_EQ(sizeof(A) + 1, buffer.size());
+    buffer[0] = 3U;
+    writer.commit();
+    ASSERT_TRUE(abc_queue::write(writer, C{}));
+
+    Visit visitor;
+    visitor.value = A{{1, 2, 3, 4, 5}};
+    abc_queue::read(visitor, reader.peek());
+    EXPECT_TRUE(visitor.value.is_type<A>());
+
+    VisitWithPayload payloadVisitor;
+    payloadVisitor.value = A{{1, 2, 3, 4, 5}};
+    abc_queue::read_with_payload(payloadVisitor, reader.peek());
+    EXPECT_TRUE(payloadVisitor.value.is_type<A>());
+
+    EXPECT_EQ(2U, abc_queue::read_all(visitor, reader));
+    EXPECT_TRUE(visitor.value.is_type<C>());
+}
+
 } // namespace
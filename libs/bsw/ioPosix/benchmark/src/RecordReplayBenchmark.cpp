@@ -0,0 +1,87 @@
+// Copyright 2025 Accenture.
+
+#include <benchmark/benchmark.h>
+#include <etl/memory.h>
+#include <io/posix/MappedFileReader.h>
+#include <io/posix/MappedFileWriter.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <string>
+
+namespace
+{
+constexpr size_t MAX_SIZE = 64U;
+constexpr size_t RECORDS  = 1024U * 64U;
+
+std::string recordPath() { return "/tmp/RecordReplayBenchmark.rec"; }
+
+size_t record(size_t const size)
+{
+    ::io::posix::MappedFileWriter w(MAX_SIZE);
+    if (!w.open(recordPath().c_str()))
+    {
+        return 0U;
+    }
+    for (size_t i = 0U; i < RECORDS; ++i)
+    {
+        auto s = w.allocate(size);
+        ::etl::mem_set(s.begin(), s.size(), static_cast<uint8_t>(i));
+        w.commit();
+    }
+    size_t const bytes = w.fileSize();
+    w.close();
+    return bytes;
+}
+} // namespace
+
+/**
+ * Benchmarks recording RECORDS records of the given size into a memory mapped file.
+ */
+void BM_mapped_file_record(benchmark::State& state)
+{
+    size_t const size = static_cast<size_t>(state.range(0));
+    size_t bytes      = 0U;
+    for (auto _ : state)
+    {
+        bytes += record(size);
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * RECORDS));
+    state.SetBytesProcessed(static_cast<int64_t>(bytes));
+    (void)std::remove(recordPath().c_str());
+}
+
+BENCHMARK(BM_mapped_file_record)->Arg(8)->Arg(64)->UseRealTime();
+
+/**
+ * Benchmarks replaying a file of RECORDS records of the given size at maximum speed.
+ */
+void BM_mapped_file_replay(benchmark::State& state)
+{
+    size_t const size  = static_cast<size_t>(state.range(0));
+    size_t const bytes = record(size);
+    ::io::posix::MappedFileReader r;
+    if (!r.open(recordPath().c_str()))
+    {
+        state.SkipWithError("record file not opened");
+        return;
+    }
+    uint32_t sum = 0U;
+    for (auto _ : state)
+    {
+        r.rewind();
+        for (auto s = r.peek(); s.size() > 0U; s = r.peek())
+        {
+            sum += s[0];
+            r.release();
+        }
+    }
+    benchmark::DoNotOptimize(sum);
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * RECORDS));
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * bytes));
+    r.close();
+    (void)std::remove(recordPath().c_str());
+}
+
+BENCHMARK(BM_mapped_file_replay)->Arg(8)->Arg(64)->UseRealTime();
@@ -0,0 +1,87 @@
+// Copyright 2025 Accenture.
+
+#pragma once
+
+#include "io/IReader.h"
+
+#include <etl/span.h>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace io
+{
+namespace posix
+{
+
+/**
+ * Implementation of IReader returning the records of a file written by MappedFileWriter, e.g. to
+ * replay recorded traffic at maximum speed.
+ *
+ * The whole file is mapped privately, so peek() returns slices pointing directly into the mapping
+ * without copying them. Modifying such a slice doesn't modify the file. Reading stops at the end
+ * of the file, at a record of length 0 or at a record exceeding the end of the file or maxSize().
+ */
+class MappedFileReader : public IReader
+{
+public:
+    // [PUBLIC_API_BEGIN]
+    /**
+     * Constructs a MappedFileReader without an open file.
+     */
+    MappedFileReader();
+
+    MappedFileReader(MappedFileReader const&) = delete;
+
+    /**
+     * Closes the file, if open.
+     */
+    ~MappedFileReader() override;
+
+    /**
+     * Maps the record file at path and positions the reader at its first record.
+     * \return true if the file has been mapped and has a valid header, false otherwise.
+     */
+    bool open(char const* path);
+
+    /**
+     * Unmaps the file.
+     */
+    void close();
+
+    /**
+     * Returns true if a file is open.
+     */
+    bool isOpen() const;
+
+    /**
+     * Positions the reader at the first record again.
+     */
+    void rewind();
+
+    /**
+     * Returns the maximum size of a record, as stored in the file header.
+     */
+    size_t maxSize() const override;
+
+    /**
+     * Returns a slice pointing to the next record within the mapping, an empty slice if there
+     * are no more records.
+     */
+    ::etl::span<uint8_t> peek() const override;
+
+    /**
+     * Advances to the next record. Calling release() at the end of the records has no effect.
+     */
+    void release() override;
+    // [PUBLIC_API_END]
+
+private:
+    uint8_t* _data;
+    size_t _size;
+    size_t _maxElementSize;
+    size_t _position;
+};
+
+} // namespace posix
+} // namespace io
@@ -0,0 +1,105 @@
+// Copyright 2025 Accenture.
+
+#pragma once
+
+#include "io/IWriter.h"
+
+#include <etl/span.h>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace io
+{
+namespace posix
+{
+
+/**
+ * Implementation of IWriter appending each committed slice as a length prefixed record to a
+ * memory mapped file, e.g. to record the traffic of a MemoryQueue.
+ *
+ * Slices are allocated directly in the mapping, so committing a slice only writes its length.
+ * The file grows by growSize bytes whenever the mapping is full, which unmaps and maps the file
+ * again and invalidates any previously allocated slice. close() truncates the file to the
+ * written records. The format is described by RecordFile.
+ */
+class MappedFileWriter : public IWriter
+{
+public:
+    static constexpr size_t DEFAULT_GROW_SIZE = 1024U * 1024U;
+
+    // [PUBLIC_API_BEGIN]
+    /**
+     * Constructs a MappedFileWriter for records of up to maxElementSize bytes, growing the file
+     * by growSize bytes at once.
+     */
+    explicit MappedFileWriter(size_t maxElementSize, size_t growSize = DEFAULT_GROW_SIZE);
+
+    MappedFileWriter(MappedFileWriter const&) = delete;
+
+    /**
+     * Closes the file, if open.
+     */
+    ~MappedFileWriter() override;
+
+    /**
+     * Creates the file at path, replacing an existing file, and writes the file header.
+     * \return true if the file has been created and mapped, false otherwise.
+     */
+    bool open(char const* path);
+
+    /**
+     * Unmaps the file and truncates it to the written records. A slice allocated but not yet
+     * committed is discarded.
+     */
+    void close();
+
+    /**
+     * Returns true if a file is open.
+     */
+    bool isOpen() const;
+
+    /**
+     * Returns the number of records committed since open().
+     */
+    size_t recordCount() const;
+
+    /**
+     * Returns the number of bytes written to the file including the header.
+     */
+    size_t fileSize() const;
+
+    /** \see IWriter::maxSize() */
+    size_t maxSize() const override;
+
+    /**
+     * \see IWriter::allocate()
+     * \return Empty slice, if no file is open, size is greater than maxSize() or the file could
+     *         not be grown.
+     */
+    ::etl::span<uint8_t> allocate(size_t size) override;
+
+    /** \see IWriter::commit() */
+    void commit() override;
+
+    /**
+     * Schedules writing the mapped records to the file without waiting for it.
+     */
+    void flush() override;
+    // [PUBLIC_API_END]
+
+private:
+    bool grow(size_t requiredSize);
+
+    size_t const _maxElementSize;
+    size_t const _growSize;
+    int _fileDescriptor;
+    uint8_t* _data;
+    size_t _mappedSize;
+    size_t _end;
+    size_t _allocated;
+    size_t _recordCount;
+};
+
+} // namespace posix
+} // namespace io
@@ -0,0 +1,32 @@
+// Copyright 2025 Accenture.
+
+#pragma once
+
+#include <etl/array.h>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace io
+{
+namespace posix
+{
+
+/**
+ * Format of a record file written by MappedFileWriter and read by MappedFileReader.
+ *
+ * The file starts with a header of HEADER_SIZE bytes: the MAGIC followed by the maximum size of a
+ * record as big endian uint32_t. The header is followed by the records, each of them a big endian
+ * uint32_t length of LENGTH_SIZE bytes followed by length bytes of data. A length of 0 marks the
+ * end of the records, e.g. in the zero filled space behind the last record of a file that has not
+ * been closed properly.
+ */
+struct RecordFile
+{
+    static constexpr ::etl::array<uint8_t, 8> MAGIC{{'O', 'B', 'S', 'W', 'R', 'E', 'C', '1'}};
+    static constexpr size_t HEADER_SIZE = MAGIC.size() + sizeof(uint32_t);
+    static constexpr size_t LENGTH_SIZE = sizeof(uint32_t);
+};
+
+} // namespace posix
+} // namespace io
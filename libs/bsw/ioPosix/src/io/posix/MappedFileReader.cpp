@@ -0,0 +1,120 @@
+// Copyright 2025 Accenture.
+
+#include "io/posix/MappedFileReader.h"
+
+#include "io/posix/RecordFile.h"
+
+#include <etl/algorithm.h>
+#include <etl/unaligned_type.h>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace io
+{
+namespace posix
+{
+
+MappedFileReader::MappedFileReader()
+: _data(nullptr), _size(0U), _maxElementSize(0U), _position(0U)
+{}
+
+MappedFileReader::~MappedFileReader() { close(); }
+
+bool MappedFileReader::open(char const* const path)
+{
+    if (isOpen() || (path == nullptr))
+    {
+        return false;
+    }
+    int const fileDescriptor = ::open(path, O_RDONLY);
+    if (fileDescriptor < 0)
+    {
+        return false;
+    }
+    struct stat status;
+    if ((fstat(fileDescriptor, &status) != 0)
+        || (static_cast<size_t>(status.st_size) < RecordFile::HEADER_SIZE))
+    {
+        (void)::close(fileDescriptor);
+        return false;
+    }
+    size_t const size = static_cast<size_t>(status.st_size);
+    // A private mapping allows to return writable slices without modifying the file.
+    void* const address
+        = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fileDescriptor, 0);
+    // the mapping stays valid after closing the file descriptor
+    (void)::close(fileDescriptor);
+    if (address == MAP_FAILED)
+    {
+        return false;
+    }
+    uint8_t* const data = static_cast<uint8_t*>(address);
+    if (!::etl::equal(RecordFile::MAGIC.begin(), RecordFile::MAGIC.end(), data))
+    {
+        (void)munmap(address, size);
+        return false;
+    }
+    (void)madvise(address, size, MADV_SEQUENTIAL);
+    _data           = data;
+    _size           = size;
+    _maxElementSize = ::etl::unaligned_type_ext<uint32_t, ::etl::endian::big>{
+        &_data[RecordFile::MAGIC.size()]};
+    _position = RecordFile::HEADER_SIZE;
+    return true;
+}
+
+void MappedFileReader::close()
+{
+    if (!isOpen())
+    {
+        return;
+    }
+    (void)munmap(_data, _size);
+    _data           = nullptr;
+    _size           = 0U;
+    _maxElementSize = 0U;
+    _position       = 0U;
+}
+
+bool MappedFileReader::isOpen() const { return _data != nullptr; }
+
+void MappedFileReader::rewind()
+{
+    if (isOpen())
+    {
+        _position = RecordFile::HEADER_SIZE;
+    }
+}
+
+size_t MappedFileReader::maxSize() const { return _maxElementSize; }
+
+::etl::span<uint8_t> MappedFileReader::peek() const
+{
+    if ((!isOpen()) || ((_size - _position) < RecordFile::LENGTH_SIZE))
+    {
+        return {};
+    }
+    size_t const length
+        = ::etl::unaligned_type_ext<uint32_t, ::etl::endian::big>{&_data[_position]};
+    size_t const start = _position + RecordFile::LENGTH_SIZE;
+    if ((length == 0U) || (length > _maxElementSize) || (length > (_size - start)))
+    {
+        return {};
+    }
+    return ::etl::span<uint8_t>(&_data[start], length);
+}
+
+void MappedFileReader::release()
+{
+    ::etl::span<uint8_t> const record = peek();
+    if (record.size() != 0U)
+    {
+        _position += RecordFile::LENGTH_SIZE + record.size();
+    }
+}
+
+} // namespace posix
+} // namespace io
@@ -0,0 +1,152 @@
+// Copyright 2025 Accenture.
+
+#include "io/posix/MappedFileWriter.h"
+
+#include "io/posix/RecordFile.h"
+
+#include <etl/algorithm.h>
+#include <etl/unaligned_type.h>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace io
+{
+namespace posix
+{
+
+constexpr size_t MappedFileWriter::DEFAULT_GROW_SIZE;
+
+MappedFileWriter::MappedFileWriter(size_t const maxElementSize, size_t const growSize)
+: _maxElementSize(maxElementSize)
+, _growSize(::etl::max(growSize, RecordFile::HEADER_SIZE + RecordFile::LENGTH_SIZE + maxElementSize))
+, _fileDescriptor(-1)
+, _data(nullptr)
+, _mappedSize(0U)
+, _end(0U)
+, _allocated(0U)
+, _recordCount(0U)
+{}
+
+MappedFileWriter::~MappedFileWriter() { close(); }
+
+bool MappedFileWriter::open(char const* const path)
+{
+    if (isOpen() || (path == nullptr))
+    {
+        return false;
+    }
+    _fileDescriptor = ::open(path, O_CREAT | O_TRUNC | O_RDWR, S_IRUSR | S_IWUSR | S_IRGRP);
+    if (_fileDescriptor < 0)
+    {
+        return false;
+    }
+    if (!grow(RecordFile::HEADER_SIZE))
+    {
+        (void)::close(_fileDescriptor);
+        _fileDescriptor = -1;
+        return false;
+    }
+    (void)::etl::copy(RecordFile::MAGIC.begin(), RecordFile::MAGIC.end(), _data);
+    ::etl::unaligned_type_ext<uint32_t, ::etl::endian::big>{&_data[RecordFile::MAGIC.size()]}
+        = static_cast<uint32_t>(_maxElementSize);
+    _end         = RecordFile::HEADER_SIZE;
+    _allocated   = 0U;
+    _recordCount = 0U;
+    return true;
+}
+
+void MappedFileWriter::close()
+{
+    if (!isOpen())
+    {
+        return;
+    }
+    (void)munmap(_data, _mappedSize);
+    // Remove the space reserved for further records.
+    (void)ftruncate(_fileDescriptor, static_cast<off_t>(_end));
+    (void)::close(_fileDescriptor);
+    _fileDescriptor = -1;
+    _data           = nullptr;
+    _mappedSize     = 0U;
+    _allocated      = 0U;
+}
+
+bool MappedFileWriter::isOpen() const { return _fileDescriptor >= 0; }
+
+size_t MappedFileWriter::recordCount() const { return _recordCount; }
+
+size_t MappedFileWriter::fileSize() const { return _end; }
+
+size_t MappedFileWriter::maxSize() const { return _maxElementSize; }
+
+::etl::span<uint8_t> MappedFileWriter::allocate(size_t const size)
+{
+    // Set allocated zero prevent a subsequent call to commit() to have
+    // effects in case this allocation fails.
+    _allocated = 0U;
+    if ((!isOpen()) || (size > _maxElementSize) || (size == 0U))
+    {
+        return {};
+    }
+    size_t const requiredSize = _end + RecordFile::LENGTH_SIZE + size;
+    if ((requiredSize > _mappedSize) && (!grow(requiredSize)))
+    {
+        return {};
+    }
+    _allocated = size;
+    return ::etl::span<uint8_t>(&_data[_end + RecordFile::LENGTH_SIZE], size);
+}
+
+void MappedFileWriter::commit()
+{
+    if (_allocated == 0U)
+    {
+        return;
+    }
+    ::etl::unaligned_type_ext<uint32_t, ::etl::endian::big>{&_data[_end]}
+        = static_cast<uint32_t>(_allocated);
+    _end += RecordFile::LENGTH_SIZE + _allocated;
+    _allocated = 0U;
+    ++_recordCount;
+}
+
+void MappedFileWriter::flush()
+{
+    if (isOpen())
+    {
+        (void)msync(_data, _mappedSize, MS_ASYNC);
+    }
+}
+
+bool MappedFileWriter::grow(size_t const requiredSize)
+{
+    size_t newSize = _mappedSize;
+    while (newSize < requiredSize)
+    {
+        newSize += _growSize;
+    }
+    // The new space of the file reads as zero, i.e. as end of the records.
+    if (ftruncate(_fileDescriptor, static_cast<off_t>(newSize)) != 0)
+    {
+        return false;
+    }
+    void* const address
+        = mmap(nullptr, newSize, PROT_READ | PROT_WRITE, MAP_SHARED, _fileDescriptor, 0);
+    if (address == MAP_FAILED)
+    {
+        return false;
+    }
+    if (_data != nullptr)
+    {
+        (void)munmap(_data, _mappedSize);
+    }
+    _data       = static_cast<uint8_t*>(address);
+    _mappedSize = newSize;
+    return true;
+}
+
+} // namespace posix
+} // namespace io
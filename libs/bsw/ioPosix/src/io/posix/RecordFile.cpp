@@ -0,0 +1,15 @@
+// Copyright 2025 Accenture.
+
+#include "io/posix/RecordFile.h"
+
+namespace io
+{
+namespace posix
+{
+
+constexpr ::etl::array<uint8_t, 8> RecordFile::MAGIC;
+constexpr size_t RecordFile::HEADER_SIZE;
+constexpr size_t RecordFile::LENGTH_SIZE;
+
+} // namespace posix
+} // namespace io
@@ -0,0 +1,312 @@
+// Copyright 2025 Accenture.
+
+#include "io/posix/MappedFileReader.h"
+#include "io/posix/MappedFileWriter.h"
+#include "io/posix/RecordFile.h"
+
+#include <io/ForwardingReader.h>
+#include <io/MemoryQueue.h>
+
+#include <etl/span.h>
+
+#include <gmock/gmock.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <string>
+
+#include <unistd.h>
+
+using namespace ::testing;
+
+namespace
+{
+struct MappedFileTest : ::testing::Test
+{
+    static size_t const MAX_ELEMENT_SIZE = 16;
+
+    MappedFileTest()
+    : _path(::testing::TempDir() + "MappedFileTest_"
+            + ::testing::UnitTest::GetInstance()->current_test_info()->name() + ".rec")
+    {}
+
+    ~MappedFileTest() override { (void)std::remove(_path.c_str()); }
+
+    static bool write(::io::posix::MappedFileWriter& w, uint8_t const value, size_t const size)
+    {
+        ::etl::span<uint8_t> s = w.allocate(size);
+        if (s.size() != size)
+        {
+            return false;
+        }
+        for (auto& b : s)
+        {
+            b = value;
+        }
+        w.commit();
+        return true;
+    }
+
+    static int read(::io::posix::MappedFileReader& r, size_t const expectedSize)
+    {
+        ::etl::span<uint8_t> s = r.peek();
+        if (s.size() != expectedSize)
+        {
+            return -1;
+        }
+        int const value = s[0];
+        r.release();
+        return value;
+    }
+
+    size_t fileSize() const
+    {
+        std::ifstream file(_path, std::ios::binary | std::ios::ate);
+        return static_cast<size_t>(file.tellg());
+    }
+
+    std::string const _path;
+};
+
+size_t const MappedFileTest::MAX_ELEMENT_SIZE;
+
+/**
+ * \refs:    SMD_io_posix_MappedFileWriter, SMD_io_posix_MappedFileReader
+ * \desc
+ * Records written by a MappedFileWriter are read back in order by a MappedFileReader.
+ */
+TEST_F(MappedFileTest, round_trip)
+{
+    ::io::posix::MappedFileWriter w(MAX_ELEMENT_SIZE);
+    EXPECT_FALSE(w.isOpen());
+    ASSERT_TRUE(w.open(_path.c_str()));
+    EXPECT_TRUE(w.isOpen());
+    EXPECT_EQ(MAX_ELEMENT_SIZE, w.maxSize());
+    for (uint8_t i = 1U; i <= MAX_ELEMENT_SIZE; ++i)
+    {
+        EXPECT_TRUE(write(w, i, i));
+    }
+    w.flush();
+    EXPECT_EQ(MAX_ELEMENT_SIZE, w.recordCount());
+    size_t const expectedSize = ::io::posix::RecordFile::HEADER_SIZE
+                                + (MAX_ELEMENT_SIZE * ::io::posix::RecordFile::LENGTH_SIZE)
+                                + ((MAX_ELEMENT_SIZE * (MAX_ELEMENT_SIZE + 1U)) / 2U);
+    EXPECT_EQ(expectedSize, w.fileSize());
+    w.close();
+    EXPECT_FALSE(w.isOpen());
+    EXPECT_EQ(expectedSize, fileSize());
+
+    ::io::posix::MappedFileReader r;
+    ASSERT_TRUE(r.open(_path.c_str()));
+    EXPECT_TRUE(r.isOpen());
+    EXPECT_EQ(MAX_ELEMENT_SIZE, r.maxSize());
+    for (uint8_t i = 1U; i <= MAX_ELEMENT_SIZE; ++i)
+    {
+        EXPECT_EQ(i, read(r, i));
+    }
+    EXPECT_EQ(0U, r.peek().size());
+    // releasing at the end has no effect
+    r.release();
+    EXPECT_EQ(0U, r.peek().size());
+    r.close();
+    EXPECT_FALSE(r.isOpen());
+}
+
+/**
+ * \refs:    SMD_io_posix_MappedFileWriter
+ * \desc
+ * Allocations of invalid sizes or without an open file fail, committing without an allocation
+ * has no effect.
+ */
+TEST_F(MappedFileTest, invalid_allocations)
+{
+    ::io::posix::MappedFileWriter w(MAX_ELEMENT_SIZE);
+    EXPECT_EQ(0U, w.allocate(1U).size());
+    w.commit();
+    EXPECT_FALSE(w.open(nullptr));
+    ASSERT_TRUE(w.open(_path.c_str()));
+    EXPECT_FALSE(w.open(_path.c_str()));
+    EXPECT_EQ(0U, w.allocate(0U).size());
+    EXPECT_EQ(0U, w.allocate(MAX_ELEMENT_SIZE + 1U).size());
+    w.commit();
+    EXPECT_EQ(0U, w.recordCount());
+    EXPECT_EQ(::io::posix::RecordFile::HEADER_SIZE, w.fileSize());
+}
+
+/**
+ * \refs:    SMD_io_posix_MappedFileWriter
+ * \desc
+ * Allocating again before commit() replaces the pending slice, only committed slices are stored.
+ */
+TEST_F(MappedFileTest, reallocate_and_discard)
+{
+    {
+        ::io::posix::MappedFileWriter w(MAX_ELEMENT_SIZE);
+        ASSERT_TRUE(w.open(_path.c_str()));
+        ASSERT_EQ(MAX_ELEMENT_SIZE, w.allocate(MAX_ELEMENT_SIZE).size());
+        EXPECT_TRUE(write(w, 1U, 2U));
+        // not committed, discarded by the destructor
+        ASSERT_EQ(3U, w.allocate(3U).size());
+    }
+
+    ::io::posix::MappedFileReader r;
+    ASSERT_TRUE(r.open(_path.c_str()));
+    EXPECT_EQ(1, read(r, 2U));
+    EXPECT_EQ(0U, r.peek().size());
+}
+
+/**
+ * \refs:    SMD_io_posix_MappedFileWriter, SMD_io_posix_MappedFileReader
+ * \desc
+ * The file grows beyond its initial size while recording.
+ */
+TEST_F(MappedFileTest, grow)
+{
+    size_t const count = 1000U;
+    ::io::posix::MappedFileWriter w(MAX_ELEMENT_SIZE, 64U);
+    ASSERT_TRUE(w.open(_path.c_str()));
+    for (size_t i = 0U; i < count; ++i)
+    {
+        ASSERT_TRUE(write(w, static_cast<uint8_t>(i), 1U + (i % MAX_ELEMENT_SIZE)));
+    }
+    w.close();
+
+    ::io::posix::MappedFileReader r;
+    ASSERT_TRUE(r.open(_path.c_str()));
+    for (size_t i = 0U; i < count; ++i)
+    {
+        ASSERT_EQ(static_cast<uint8_t>(i), read(r, 1U + (i % MAX_ELEMENT_SIZE)));
+    }
+    EXPECT_EQ(0U, r.peek().size());
+}
+
+/**
+ * \refs:    SMD_io_posix_MappedFileReader
+ * \desc
+ * After rewind() the records are read from the beginning again.
+ */
+TEST_F(MappedFileTest, rewind)
+{
+    ::io::posix::MappedFileWriter w(MAX_ELEMENT_SIZE);
+    ASSERT_TRUE(w.open(_path.c_str()));
+    EXPECT_TRUE(write(w, 1U, 1U));
+    EXPECT_TRUE(write(w, 2U, 2U));
+    w.close();
+
+    ::io::posix::MappedFileReader r;
+    ASSERT_TRUE(r.open(_path.c_str()));
+    EXPECT_EQ(1, read(r, 1U));
+    EXPECT_EQ(2, read(r, 2U));
+    EXPECT_EQ(0U, r.peek().size());
+    r.rewind();
+    EXPECT_EQ(1, read(r, 1U));
+}
+
+/**
+ * \refs:    SMD_io_posix_MappedFileReader
+ * \desc
+ * A file that hasn't been closed contains zeros behind the last record, which end the records.
+ * A record exceeding the end of a truncated file isn't read.
+ */
+TEST_F(MappedFileTest, unterminated_and_truncated_file)
+{
+    ::io::posix::MappedFileWriter w(MAX_ELEMENT_SIZE);
+    ASSERT_TRUE(w.open(_path.c_str()));
+    EXPECT_TRUE(write(w, 1U, 4U));
+    EXPECT_TRUE(write(w, 2U, 4U));
+    w.flush();
+    size_t const size = w.fileSize();
+    EXPECT_LT(size, fileSize());
+
+    {
+        ::io::posix::MappedFileReader r;
+        ASSERT_TRUE(r.open(_path.c_str()));
+        EXPECT_EQ(1, read(r, 4U));
+        EXPECT_EQ(2, read(r, 4U));
+        EXPECT_EQ(0U, r.peek().size());
+    }
+    w.close();
+
+    ASSERT_EQ(0, truncate(_path.c_str(), static_cast<off_t>(size - 1U)));
+    ::io::posix::MappedFileReader r;
+    ASSERT_TRUE(r.open(_path.c_str()));
+    EXPECT_EQ(1, read(r, 4U));
+    EXPECT_EQ(0U, r.peek().size());
+}
+
+/**
+ * \refs:    SMD_io_posix_MappedFileReader
+ * \desc
+ * Files which don't exist, are too short or don't start with the magic aren't opened.
+ */
+TEST_F(MappedFileTest, invalid_files)
+{
+    ::io::posix::MappedFileReader r;
+    EXPECT_FALSE(r.open(nullptr));
+    EXPECT_FALSE(r.open(_path.c_str()));
+    EXPECT_EQ(0U, r.peek().size());
+    EXPECT_EQ(0U, r.maxSize());
+
+    {
+        std::ofstream file(_path, std::ios::binary);
+        file << "OBSW";
+    }
+    EXPECT_FALSE(r.open(_path.c_str()));
+
+    {
+        std::ofstream file(_path, std::ios::binary);
+        file << "NOTARECORDFILE";
+    }
+    EXPECT_FALSE(r.open(_path.c_str()));
+    EXPECT_FALSE(r.isOpen());
+}
+
+/**
+ * \refs:    SMD_io_posix_MappedFileWriter, SMD_io_posix_MappedFileReader
+ * \desc
+ * Traffic of a MemoryQueue is recorded with a ForwardingReader and replayed into another
+ * MemoryQueue.
+ */
+TEST_F(MappedFileTest, record_and_replay_memory_queue)
+{
+    using Queue = ::io::MemoryQueue<64, MAX_ELEMENT_SIZE>;
+    Queue source;
+    ::io::MemoryQueueWriter<Queue> sourceWriter(source);
+    ::io::MemoryQueueReader<Queue> sourceReader(source);
+
+    ::io::posix::MappedFileWriter recorder(MAX_ELEMENT_SIZE);
+    ASSERT_TRUE(recorder.open(_path.c_str()));
+    ::io::ForwardingReader forwarder(sourceReader, recorder);
+    for (uint8_t i = 0U; i < 10U; ++i)
+    {
+        auto s = sourceWriter.allocate(1U + i);
+        ASSERT_EQ(1U + i, s.size());
+        s[0] = i;
+        sourceWriter.commit();
+        ASSERT_EQ(1U + i, forwarder.peek().size());
+        forwarder.release();
+    }
+    recorder.close();
+    EXPECT_EQ(0U, sourceReader.peek().size());
+
+    Queue target;
+    ::io::MemoryQueueWriter<Queue> targetWriter(target);
+    ::io::MemoryQueueReader<Queue> targetReader(target);
+    ::io::posix::MappedFileReader player;
+    ASSERT_TRUE(player.open(_path.c_str()));
+    ::io::ForwardingReader replay(player, targetWriter);
+    for (uint8_t i = 0U; i < 10U; ++i)
+    {
+        ASSERT_EQ(1U + i, replay.peek().size());
+        replay.release();
+        auto s = targetReader.peek();
+        ASSERT_EQ(1U + i, s.size());
+        EXPECT_EQ(i, s[0]);
+        targetReader.release();
+    }
+    EXPECT_EQ(0U, replay.peek().size());
+}
+
+} // namespace
@@ -8,6 +8,7 @@
 
 #include <etl/delegate.h>
 #include <logger/ConsoleEntryOutput.h>
+#include <logger/ILoggerListener.h>
 #include <util/logger/IComponentMapping.h>
 #include <util/logger/ILoggerOutput.h>
 
@@ -23,9 +24,20 @@ public:
         ::util::logger::IComponentMapping& componentMapping, char const* name);
 
     void start(ConfigStart const& configStart);
-    void run();
+
+    /**
+     * Output the next buffered entry to the console.
+     * \return true if an entry has been output, i.e. further entries may be pending
+     */
+    bool run();
     void stop(ConfigStop const& configStop);
 
+    /**
+     * Add a listener that is notified whenever an entry has been buffered, so that run() can be
+     * called on demand instead of cyclically.
+     */
+    void addListener(ILoggerListener& listener);
+
 private:
     DefaultLoggerTime<> _loggerTime;
 
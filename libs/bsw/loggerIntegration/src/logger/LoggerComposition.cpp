@@ -20,9 +20,9 @@ void LoggerComposition::start(ConfigStart const& configStart)
     configStart(_bufferedLoggerOutput);
 }
 
-void LoggerComposition::run()
+bool LoggerComposition::run()
 {
-    (void)_bufferedLoggerOutput.outputEntry(_consoleLoggerOutput, _entryRef);
+    return _bufferedLoggerOutput.outputEntry(_consoleLoggerOutput, _entryRef);
 }
 
 void LoggerComposition::stop(ConfigStop const& configStop)
@@ -31,4 +31,9 @@ void LoggerComposition::stop(ConfigStop const& configStop)
     configStop();
 }
 
+void LoggerComposition::addListener(ILoggerListener& listener)
+{
+    _bufferedLoggerOutput.addListener(listener);
+}
+
 } // namespace logger
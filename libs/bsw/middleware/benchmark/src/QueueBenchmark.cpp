@@ -0,0 +1,204 @@
+// Copyright 2025 BMW AG
+
+#include "middleware/queue/Queue.h"
+
+#include <benchmark/benchmark.h>
+#include <etl/array.h>
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+
+namespace
+{
+/// Element with the size of a middleware message.
+using Item = etl::array<uint32_t, 8U>;
+
+/// Timestamp source counting nanoseconds of the steady clock.
+struct SteadyClock
+{
+    static uint32_t now()
+    {
+        return static_cast<uint32_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                         std::chrono::steady_clock::now().time_since_epoch())
+                                         .count());
+    }
+};
+
+using ::middleware::queue::QueueTraits;
+
+using Queue      = ::middleware::queue::Queue<QueueTraits<Item, 64U>>;
+using TimedQueue = ::middleware::queue::Queue<QueueTraits<Item, 64U, void, uint8_t, SteadyClock>>;
+
+static uint32_t const ITEMS_PER_ITERATION = 4096U;
+
+/**
+ * Consumer thread draining the queue, either element by element or in batches of all available
+ * elements. The sum of the first word of all elements keeps the reads from being optimized away.
+ */
+template<typename QueueType>
+struct Consumer
+{
+    QueueType& _queue;
+    bool const _batched;
+    std::atomic<bool> _running{true};
+    std::atomic<uint64_t> _received{0U};
+    uint64_t _sum = 0U;
+    std::thread _thread;
+
+    Consumer(QueueType& queue, bool const batched)
+    : _queue(queue), _batched(batched), _thread([this]() { run(); })
+    {}
+
+    ~Consumer()
+    {
+        _running = false;
+        _thread.join();
+    }
+
+    void run()
+    {
+        typename QueueType::Receiver receiver(_queue);
+        while (_running.load(std::memory_order_relaxed))
+        {
+            uint32_t const available = receiver.size();
+            if (available == 0U)
+            {
+                std::this_thread::yield();
+                continue;
+            }
+            if (_batched)
+            {
+                for (uint32_t i = 0U; i < available; ++i)
+                {
+                    _sum += receiver.peek(i)[0];
+                }
+                receiver.advance(available);
+            }
+            else
+            {
+                for (uint32_t i = 0U; i < available; ++i)
+                {
+                    _sum += receiver.peek()[0];
+                    receiver.advance();
+                }
+            }
+            _received.fetch_add(available, std::memory_order_relaxed);
+        }
+    }
+};
+
+template<typename Sender>
+void writeSingle(Sender& sender, Item& item, uint32_t const count)
+{
+    uint32_t written = 0U;
+    while (written < count)
+    {
+        item[0] = written;
+        if (sender.write(item))
+        {
+            ++written;
+        }
+        else
+        {
+            std::this_thread::yield();
+        }
+    }
+}
+
+void writeBatched(Queue::Sender& sender, uint32_t const count, uint32_t const batchSize)
+{
+    uint32_t written = 0U;
+    while (written < count)
+    {
+        uint32_t const remaining = count - written;
+        uint32_t const reserved  = sender.reserve((remaining < batchSize) ? remaining : batchSize);
+        if (reserved == 0U)
+        {
+            std::this_thread::yield();
+            continue;
+        }
+        for (uint32_t i = 0U; i < reserved; ++i)
+        {
+            sender.reserved(i)[0] = written + i;
+        }
+        sender.publish(reserved);
+        written += reserved;
+    }
+}
+} // namespace
+
+/**
+ * Benchmarks the throughput between a producer and a consumer thread, with one cursor update per
+ * element on both sides.
+ */
+void BM_queue_two_threads_single(benchmark::State& state)
+{
+    Queue queue;
+    queue.init();
+    Queue::Sender sender(queue);
+    Item item{};
+    {
+        Consumer<Queue> consumer(queue, false);
+        for (auto _ : state)
+        {
+            writeSingle(sender, item, ITEMS_PER_ITERATION);
+        }
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * ITEMS_PER_ITERATION);
+    state.counters["queueFull"] = static_cast<double>(queue.getStats().lostMessages);
+}
+
+BENCHMARK(BM_queue_two_threads_single)->UseRealTime();
+
+/**
+ * Benchmarks the throughput between a producer and a consumer thread, with the producer reserving
+ * and publishing state.range(0) elements at once and the consumer releasing all available
+ * elements at once.
+ */
+void BM_queue_two_threads_batched(benchmark::State& state)
+{
+    Queue queue;
+    queue.init();
+    Queue::Sender sender(queue);
+    uint32_t const batchSize = static_cast<uint32_t>(state.range(0));
+    {
+        Consumer<Queue> consumer(queue, true);
+        for (auto _ : state)
+        {
+            writeBatched(sender, ITEMS_PER_ITERATION, batchSize);
+        }
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * ITEMS_PER_ITERATION);
+}
+
+BENCHMARK(BM_queue_two_threads_batched)->RangeMultiplier(4)->Range(1, 64)->UseRealTime();
+
+/**
+ * Same as BM_queue_two_threads_single with enqueue timestamps, reporting the overhead of the
+ * measurement and the measured time elements have been waiting in the queue.
+ */
+void BM_queue_two_threads_timed(benchmark::State& state)
+{
+    TimedQueue queue;
+    queue.init();
+    TimedQueue::Sender sender(queue);
+    Item item{};
+    {
+        Consumer<TimedQueue> consumer(queue, false);
+        for (auto _ : state)
+        {
+            writeSingle(sender, item, ITEMS_PER_ITERATION);
+        }
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * ITEMS_PER_ITERATION);
+    ::middleware::queue::LatencyHistogram const histogram = queue.getLatencyHistogram();
+    if (histogram.count != 0U)
+    {
+        state.counters["meanLatencyNs"]
+            = static_cast<double>(histogram.totalLatency) / static_cast<double>(histogram.count);
+        state.counters["maxLatencyNs"] = static_cast<double>(histogram.maxLatency);
+    }
+}
+
+BENCHMARK(BM_queue_two_threads_timed)->UseRealTime();
@@ -0,0 +1,161 @@
+// Copyright 2025 BMW AG
+
+#include "middleware/core/RoutingTable.h"
+
+#include <benchmark/benchmark.h>
+
+#include <map>
+#include <unordered_map>
+#include <vector>
+
+namespace
+{
+using ::middleware::core::Message;
+using ::middleware::core::RouteKey;
+
+static size_t const ROUTE_COUNT = 512U;
+
+/// Manifest of 64 services with two instances, four members and different addresses each.
+constexpr etl::array<RouteKey, ROUTE_COUNT> createManifest()
+{
+    etl::array<RouteKey, ROUTE_COUNT> routes{};
+    for (size_t i = 0U; i < routes.size(); ++i)
+    {
+        routes[i] = RouteKey{
+            static_cast<uint16_t>(0x0100U + (i / 8U)),
+            static_cast<uint16_t>(1U + (i % 2U)),
+            static_cast<uint16_t>(0x8000U + ((i / 2U) % 4U)),
+            static_cast<uint8_t>(i % 3U)};
+    }
+    return routes;
+}
+
+constexpr etl::array<RouteKey, ROUTE_COUNT> ROUTES = createManifest();
+constexpr ::middleware::core::RoutingTable<ROUTE_COUNT> TABLE{createManifest()};
+
+/**
+ * Messages to dispatch in a reproducible, non-sequential order, with every 16th message having no
+ * route.
+ */
+std::vector<Message> createMessages()
+{
+    std::vector<Message> messages;
+    uint32_t seed = 1U;
+    for (size_t i = 0U; i < 1024U; ++i)
+    {
+        seed                = (seed * 1664525U) + 1013904223U;
+        RouteKey const& key = ROUTES[(seed >> 8U) % ROUTE_COUNT];
+        uint8_t const addressId
+            = ((i % 16U) == 0U) ? static_cast<uint8_t>(0xF0U) : key.addressId;
+        messages.push_back(Message::createRequest(
+            key.serviceId, key.memberId, 1U, key.serviceInstanceId, 0U, 1U, addressId));
+    }
+    return messages;
+}
+
+template<class Map>
+Map createMap()
+{
+    Map map;
+    for (size_t i = 0U; i < ROUTE_COUNT; ++i)
+    {
+        map.emplace(ROUTES[i].pack(), static_cast<uint16_t>(i));
+    }
+    return map;
+}
+
+template<class Map>
+uint16_t findInMap(Map const& map, Message const& message)
+{
+    auto const it = map.find(RouteKey::fromMessage(message).pack());
+    return (it != map.end()) ? it->second : 0xFFFFU;
+}
+
+uint16_t findLinear(Message const& message)
+{
+    RouteKey const key = RouteKey::fromMessage(message);
+    for (size_t i = 0U; i < ROUTE_COUNT; ++i)
+    {
+        if (ROUTES[i] == key)
+        {
+            return static_cast<uint16_t>(i);
+        }
+    }
+    return 0xFFFFU;
+}
+} // namespace
+
+/**
+ * Benchmarks resolving messages with the routing table generated at compile time.
+ */
+void BM_route_static_table(benchmark::State& state)
+{
+    std::vector<Message> const messages = createMessages();
+    for (auto _ : state)
+    {
+        for (auto const& message : messages)
+        {
+            benchmark::DoNotOptimize(TABLE.find(message));
+        }
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * messages.size()));
+}
+
+BENCHMARK(BM_route_static_table);
+
+/**
+ * Benchmarks resolving messages with routes registered in a std::map at runtime.
+ */
+void BM_route_map(benchmark::State& state)
+{
+    std::vector<Message> const messages      = createMessages();
+    std::map<uint64_t, uint16_t> const routes = createMap<std::map<uint64_t, uint16_t>>();
+    for (auto _ : state)
+    {
+        for (auto const& message : messages)
+        {
+            benchmark::DoNotOptimize(findInMap(routes, message));
+        }
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * messages.size()));
+}
+
+BENCHMARK(BM_route_map);
+
+/**
+ * Benchmarks resolving messages with routes registered in a std::unordered_map at runtime.
+ */
+void BM_route_unordered_map(benchmark::State& state)
+{
+    using Map                           = std::unordered_map<uint64_t, uint16_t>;
+    std::vector<Message> const messages = createMessages();
+    Map const routes                    = createMap<Map>();
+    for (auto _ : state)
+    {
+        for (auto const& message : messages)
+        {
+            benchmark::DoNotOptimize(findInMap(routes, message));
+        }
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * messages.size()));
+}
+
+BENCHMARK(BM_route_unordered_map);
+
+/**
+ * Benchmarks resolving messages by searching the manifest linearly.
+ */
+void BM_route_linear_search(benchmark::State& state)
+{
+    std::vector<Message> const messages = createMessages();
+    for (auto _ : state)
+    {
+        for (auto const& message : messages)
+        {
+            benchmark::DoNotOptimize(findLinear(message));
+        }
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * messages.size()));
+}
+
+BENCHMARK(BM_route_linear_search);
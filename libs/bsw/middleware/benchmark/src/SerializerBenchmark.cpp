@@ -0,0 +1,114 @@
+// Copyright 2025 BMW AG
+
+#include "middleware/core/Serializer.h"
+
+#include <benchmark/benchmark.h>
+
+namespace
+{
+struct Sample
+{
+    uint32_t timestamp;
+    uint16_t id;
+    int16_t value;
+    etl::array<uint16_t, 8U> channels;
+};
+} // namespace
+
+namespace middleware
+{
+namespace core
+{
+template<>
+struct PayloadLayout<Sample>
+{
+    using Members = MemberList<
+        Member<Sample, uint32_t, &Sample::timestamp>,
+        Member<Sample, uint16_t, &Sample::id>,
+        Member<Sample, int16_t, &Sample::value>,
+        Member<Sample, etl::array<uint16_t, 8U>, &Sample::channels>>;
+};
+} // namespace core
+} // namespace middleware
+
+namespace
+{
+using ::middleware::core::Serializer;
+
+Sample createSample()
+{
+    Sample sample{};
+    sample.timestamp = 0x12345678U;
+    sample.id        = 0x0102U;
+    sample.value     = -42;
+    for (size_t i = 0U; i < sample.channels.size(); ++i)
+    {
+        sample.channels[i] = static_cast<uint16_t>(i * 1000U);
+    }
+    return sample;
+}
+
+/// Reference implementation packing each value byte by byte in little endian order.
+void packManually(Sample const& sample, uint8_t* const buffer)
+{
+    buffer[0] = static_cast<uint8_t>(sample.timestamp);
+    buffer[1] = static_cast<uint8_t>(sample.timestamp >> 8U);
+    buffer[2] = static_cast<uint8_t>(sample.timestamp >> 16U);
+    buffer[3] = static_cast<uint8_t>(sample.timestamp >> 24U);
+    buffer[4] = static_cast<uint8_t>(sample.id);
+    buffer[5] = static_cast<uint8_t>(sample.id >> 8U);
+    buffer[6] = static_cast<uint8_t>(static_cast<uint16_t>(sample.value));
+    buffer[7] = static_cast<uint8_t>(static_cast<uint16_t>(sample.value) >> 8U);
+    for (size_t i = 0U; i < sample.channels.size(); ++i)
+    {
+        buffer[8U + (2U * i)] = static_cast<uint8_t>(sample.channels[i]);
+        buffer[9U + (2U * i)] = static_cast<uint8_t>(sample.channels[i] >> 8U);
+    }
+}
+
+void BM_ManualPacking(benchmark::State& state)
+{
+    Sample sample = createSample();
+    etl::array<uint8_t, Serializer<Sample>::WIRE_SIZE> buffer{};
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(sample);
+        packManually(sample, buffer.data());
+        benchmark::DoNotOptimize(buffer);
+    }
+}
+
+template<etl::endian::enum_type WireOrder>
+void BM_Serializer(benchmark::State& state)
+{
+    Sample sample = createSample();
+    etl::array<uint8_t, Serializer<Sample, WireOrder>::WIRE_SIZE> buffer{};
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(sample);
+        Serializer<Sample, WireOrder>::serialize(sample, buffer);
+        benchmark::DoNotOptimize(buffer);
+    }
+}
+
+template<etl::endian::enum_type WireOrder>
+void BM_Deserializer(benchmark::State& state)
+{
+    Sample sample = createSample();
+    etl::array<uint8_t, Serializer<Sample, WireOrder>::WIRE_SIZE> buffer{};
+    Serializer<Sample, WireOrder>::serialize(sample, buffer);
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(buffer);
+        Serializer<Sample, WireOrder>::deserialize(buffer, sample);
+        benchmark::DoNotOptimize(sample);
+    }
+}
+
+} // namespace
+
+BENCHMARK(BM_ManualPacking);
+BENCHMARK_TEMPLATE(BM_Serializer, etl::endian::little);
+BENCHMARK_TEMPLATE(BM_Serializer, etl::endian::big);
+BENCHMARK_TEMPLATE(BM_Deserializer, etl::endian::little);
+BENCHMARK_TEMPLATE(BM_Deserializer, etl::endian::big);
@@ -74,6 +74,13 @@ public:
                           ///< occurred during the communication.
     };
 
+    /**
+     * \brief Creates an empty message without any type flag set, e.g. as placeholder for the
+     * elements of a queue.
+     *
+     */
+    constexpr Message() : _header(), _payload() {}
+
     ~Message()                                 = default;
     Message(Message const& other)              = default;
     Message& operator=(Message const& other) & = default;
@@ -308,6 +315,7 @@ public:
 
 private:
     friend class MessageAllocator;
+    friend class MessageSerializer;
 
     constexpr Message(Header const& header) : _header(header), _payload() {}
 
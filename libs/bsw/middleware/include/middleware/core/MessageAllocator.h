@@ -0,0 +1,307 @@
+// Copyright 2025 BMW AG
+
+#pragma once
+
+#include "middleware/core/Message.h"
+
+#include <etl/array.h>
+#include <etl/atomic.h>
+#include <etl/span.h>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace middleware
+{
+namespace core
+{
+
+/**
+ * \brief A struct that aggregates the statistics of a payload allocator.
+ * \details A non-zero blocksInUse value after all receivers have processed their messages
+ * indicates leaked payloads.
+ *
+ */
+struct AllocatorStats
+{
+    uint32_t allocations;        ///< Number of successfully allocated payloads.
+    uint32_t allocationFailures; ///< Number of allocations failed due to size or depletion.
+    uint32_t releases;           ///< Number of payloads returned after their last release.
+    uint32_t invalidReleases;    ///< Number of releases of messages without a valid payload.
+    uint16_t blocksInUse;        ///< Number of payloads currently referenced by messages.
+    uint16_t maxBlocksInUse;     ///< Maximum number of payloads referenced at the same time.
+};
+
+/**
+ * \brief Base class of the payload allocators, giving access to the external handle of messages.
+ *
+ */
+class MessageAllocator
+{
+protected:
+    MessageAllocator() = default;
+
+    /**
+     * \brief Attach an external payload to \param message.
+     *
+     * \param offset offset of the payload within the memory region of the allocator
+     * \param size size of the payload
+     * \param isShared whether the payload is shared between several messages
+     */
+    static void
+    attach(Message& message, ptrdiff_t const offset, size_t const size, bool const isShared)
+    {
+        message.unsetFlag(Message::Flags::UniqueExternalPayload);
+        message.unsetFlag(Message::Flags::SharedExternalPayload);
+        message.setExternalHandle(offset, size, isShared);
+    }
+
+    /**
+     * \brief Remove the external payload flags from \param message.
+     *
+     */
+    static void detach(Message& message)
+    {
+        message.unsetFlag(Message::Flags::UniqueExternalPayload);
+        message.unsetFlag(Message::Flags::SharedExternalPayload);
+    }
+
+    /**
+     * \brief Get the external handle of \param message.
+     *
+     * \return const Message::ExternalHandle&
+     */
+    static Message::ExternalHandle const& getHandle(Message const& message)
+    {
+        return message.getExternalHandle();
+    }
+
+    /**
+     * \brief Check if \param message references an external payload.
+     *
+     * \return true if the unique or shared external payload flag is set, otherwise false.
+     */
+    static bool hasExternalPayload(Message const& message)
+    {
+        return message.hasUniqueExternalPayload() || message.hasSharedExternalPayload();
+    }
+};
+
+/**
+ * \brief Lock-free, reference counted allocator for payloads exceeding Message::MAX_PAYLOAD_SIZE.
+ * \details The allocator manages BlockCount blocks of BlockSize bytes in a fixed memory region
+ * which is part of the object itself. Messages only carry the offset of their payload within this
+ * region, so the allocator can be placed in shared RAM and payloads are passed between clusters
+ * without copying. Each block has an atomic reference counter: allocate() takes the first
+ * reference, share() adds one reference per additional receiver of the same payload and every
+ * receiver calls release() once it has processed the message. The block is free again after the
+ * last release. Like the queues, the allocator must be initialized with init() before use.
+ *
+ * \tparam BlockSize the maximum size of a single payload in bytes.
+ * \tparam BlockCount the number of payloads that can be allocated at the same time.
+ */
+template<size_t BlockSize, uint16_t BlockCount>
+class PayloadAllocator final : public MessageAllocator
+{
+public:
+    static constexpr size_t BLOCK_SIZE    = BlockSize;
+    static constexpr uint16_t BLOCK_COUNT = BlockCount;
+
+    static_assert(BlockSize > Message::MAX_PAYLOAD_SIZE, "Small payloads are stored in place!");
+    static_assert(BlockCount > 0U, "At least one block is needed!");
+
+    /**
+     * \brief Default constructor is intentionally empty, since allocators will be placed in shared
+     * RAM and they will be initialized by the init method.
+     *
+     */
+    PayloadAllocator() : MessageAllocator() {}
+
+    /**
+     * \brief Init method which needs to be called before doing any work with the allocator.
+     *
+     */
+    void init()
+    {
+        for (auto& refCount : _refCounts)
+        {
+            refCount.store(0U);
+        }
+        _nextBlock.store(0U);
+        _blocksInUse.store(0U);
+        resetStats();
+    }
+
+    /**
+     * \brief Allocate a payload of \param size bytes and attach it to \param message as unique
+     * external payload.
+     *
+     * \return the memory of the payload to be filled by the caller, an empty span if the size
+     * exceeds BlockSize or all blocks are in use.
+     */
+    etl::span<uint8_t> allocate(Message& message, size_t const size)
+    {
+        if ((size == 0U) || (size > BlockSize))
+        {
+            _allocationFailures.fetch_add(1U);
+            return {};
+        }
+        uint16_t const start = _nextBlock.fetch_add(1U);
+        for (uint16_t i = 0U; i < BlockCount; ++i)
+        {
+            size_t const idx  = (static_cast<size_t>(start) + i) % BlockCount;
+            uint16_t expected = 0U;
+            if (_refCounts[idx].compare_exchange_strong(expected, 1U))
+            {
+                updateBlocksInUse();
+                _allocations.fetch_add(1U);
+                size_t const offset = idx * BlockSize;
+                attach(message, static_cast<ptrdiff_t>(offset), size, false);
+                return etl::span<uint8_t>(&_blocks[offset], size);
+            }
+        }
+        _allocationFailures.fetch_add(1U);
+        return {};
+    }
+
+    /**
+     * \brief Add \param additionalReceivers references to the payload of \param message and mark
+     * it as shared.
+     * \details This needs to be called before the copies of the message are sent, since each
+     * receiver releases its copy independently. Copies made afterwards carry the shared flag.
+     *
+     * \return true if the message references a valid payload, otherwise false.
+     */
+    bool share(Message& message, uint16_t const additionalReceivers)
+    {
+        size_t idx = 0U;
+        if (!getIndex(message, idx))
+        {
+            return false;
+        }
+        Message::ExternalHandle const handle = getHandle(message);
+        _refCounts[idx].fetch_add(additionalReceivers);
+        attach(message, handle.offset, handle.size, true);
+        return true;
+    }
+
+    /**
+     * \brief Get the payload that is attached to \param message.
+     *
+     * \return the payload, an empty span if the message references no valid payload.
+     */
+    etl::span<uint8_t const> getPayload(Message const& message) const
+    {
+        size_t idx = 0U;
+        if (!getIndex(message, idx))
+        {
+            return {};
+        }
+        Message::ExternalHandle const& handle = getHandle(message);
+        return etl::span<uint8_t const>(
+            &_blocks[static_cast<size_t>(handle.offset)], handle.size);
+    }
+
+    /**
+     * \brief Release the reference of \param message to its payload and detach it.
+     * \details The payload is free again once the last referencing message has been released.
+     *
+     */
+    void release(Message& message)
+    {
+        size_t idx = 0U;
+        if (!getIndex(message, idx))
+        {
+            _invalidReleases.fetch_add(1U);
+            return;
+        }
+        detach(message);
+        uint16_t refCount = _refCounts[idx].load();
+        do
+        {
+            if (refCount == 0U)
+            {
+                _invalidReleases.fetch_add(1U);
+                return;
+            }
+        } while (!_refCounts[idx].compare_exchange_weak(refCount, refCount - 1U));
+        if (refCount == 1U)
+        {
+            _blocksInUse.fetch_sub(1U);
+            _releases.fetch_add(1U);
+        }
+    }
+
+    /**
+     * \brief Get a snapshot of the allocator statistics.
+     *
+     * \return AllocatorStats
+     */
+    AllocatorStats getStats() const
+    {
+        AllocatorStats stats{};
+        stats.allocations        = _allocations.load();
+        stats.allocationFailures = _allocationFailures.load();
+        stats.releases           = _releases.load();
+        stats.invalidReleases    = _invalidReleases.load();
+        stats.blocksInUse        = _blocksInUse.load();
+        stats.maxBlocksInUse     = _maxBlocksInUse.load();
+        return stats;
+    }
+
+    /**
+     * \brief Resets the allocator statistics, except for the number of blocks in use.
+     *
+     */
+    void resetStats()
+    {
+        _allocations.store(0U);
+        _allocationFailures.store(0U);
+        _releases.store(0U);
+        _invalidReleases.store(0U);
+        _maxBlocksInUse.store(_blocksInUse.load());
+    }
+
+private:
+    bool getIndex(Message const& message, size_t& idx) const
+    {
+        if (!hasExternalPayload(message))
+        {
+            return false;
+        }
+        Message::ExternalHandle const& handle = getHandle(message);
+        if ((handle.offset < 0) || (handle.size > BlockSize))
+        {
+            return false;
+        }
+        size_t const offset = static_cast<size_t>(handle.offset);
+        if (((offset % BlockSize) != 0U) || (offset >= (BlockSize * BlockCount)))
+        {
+            return false;
+        }
+        idx = offset / BlockSize;
+        return true;
+    }
+
+    void updateBlocksInUse()
+    {
+        uint16_t const blocksInUse = static_cast<uint16_t>(_blocksInUse.fetch_add(1U) + 1U);
+        uint16_t maxBlocksInUse    = _maxBlocksInUse.load();
+        while ((blocksInUse > maxBlocksInUse)
+               && !_maxBlocksInUse.compare_exchange_weak(maxBlocksInUse, blocksInUse))
+        {}
+    }
+
+    etl::array<etl::atomic<uint16_t>, BlockCount> _refCounts;
+    etl::atomic<uint16_t> _nextBlock;
+    etl::atomic<uint16_t> _blocksInUse;
+    etl::atomic<uint16_t> _maxBlocksInUse;
+    etl::atomic<uint32_t> _allocations;
+    etl::atomic<uint32_t> _allocationFailures;
+    etl::atomic<uint32_t> _releases;
+    etl::atomic<uint32_t> _invalidReleases;
+    alignas(alignof(max_align_t)) etl::array<uint8_t, BlockSize * BlockCount> _blocks;
+};
+
+} // namespace core
+} // namespace middleware
@@ -0,0 +1,247 @@
+// Copyright 2025 BMW AG
+
+#pragma once
+
+#include "middleware/core/Message.h"
+
+#include <etl/array.h>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace middleware
+{
+namespace core
+{
+
+/**
+ * \brief The identifiers of a message that select its local recipient, a skeleton or a proxy.
+ *
+ */
+struct RouteKey
+{
+    uint16_t serviceId;
+    uint16_t serviceInstanceId;
+    uint16_t memberId;
+    uint8_t addressId;
+
+    /**
+     * \brief Get the route key of \param message.
+     *
+     * \return RouteKey
+     */
+    static RouteKey fromMessage(Message const& message)
+    {
+        return {
+            message.getHeader().serviceId,
+            message.getHeader().serviceInstanceId,
+            message.getHeader().memberId,
+            message.getHeader().addressId};
+    }
+
+    constexpr bool operator==(RouteKey const& other) const
+    {
+        return (serviceId == other.serviceId) && (serviceInstanceId == other.serviceInstanceId)
+               && (memberId == other.memberId) && (addressId == other.addressId);
+    }
+
+    /**
+     * \brief Pack all identifiers into a single integer.
+     *
+     * \return uint64_t
+     */
+    constexpr uint64_t pack() const
+    {
+        return (static_cast<uint64_t>(serviceId) << 40U)
+               | (static_cast<uint64_t>(serviceInstanceId) << 24U)
+               | (static_cast<uint64_t>(memberId) << 8U) | static_cast<uint64_t>(addressId);
+    }
+};
+
+namespace internal
+{
+/**
+ * \brief Get the smallest power of two that is at least twice \param routeCount.
+ *
+ */
+constexpr size_t getRoutingSlotCount(size_t const routeCount)
+{
+    size_t slots = 2U;
+    while (slots < (2U * routeCount))
+    {
+        slots *= 2U;
+    }
+    return slots;
+}
+} // namespace internal
+
+/**
+ * \brief A hash table mapping RouteKeys to the index of the route within a service manifest,
+ * which is completely built at compile time.
+ * \details The table uses open addressing with linear probing and at least twice as many slots as
+ * routes. The constructor tries SEED_COUNT seeds for the hash function and keeps the one with
+ * the shortest maximum probe sequence, which bounds the number of compared keys of find() by a
+ * small constant known at compile time. Keys that occur more than once in the manifest are
+ * reported by hasDuplicates().
+ *
+ * \tparam RouteCount the number of routes of the manifest.
+ */
+template<size_t RouteCount>
+class RoutingTable
+{
+public:
+    static constexpr uint16_t INVALID_ROUTE = 0xFFFFU;
+    static constexpr size_t ROUTE_COUNT     = RouteCount;
+    static constexpr size_t SLOT_COUNT      = internal::getRoutingSlotCount(RouteCount);
+    static constexpr uint32_t SEED_COUNT    = 16U;
+
+    static_assert(RouteCount > 0U, "A routing table needs at least one route!");
+    static_assert(RouteCount < INVALID_ROUTE, "Too many routes!");
+
+    /**
+     * \brief Builds the table for \param routes, where the position of a route within the array
+     * is the value returned by find().
+     *
+     */
+    constexpr explicit RoutingTable(etl::array<RouteKey, RouteCount> const& routes)
+    : _keys(), _routes(), _seed(0U), _maxProbe(0U), _hasDuplicates(false)
+    {
+        size_t bestProbe  = SLOT_COUNT;
+        uint32_t bestSeed = 0U;
+        for (uint32_t seed = 0U; seed < SEED_COUNT; ++seed)
+        {
+            size_t const probe = build(routes, seed);
+            if (probe < bestProbe)
+            {
+                bestProbe = probe;
+                bestSeed  = seed;
+            }
+        }
+        _maxProbe = build(routes, bestSeed);
+        _seed     = bestSeed;
+    }
+
+    /**
+     * \brief Get the index of the route of \param key.
+     *
+     * \return the index within the manifest, INVALID_ROUTE if the key has no route.
+     */
+    constexpr uint16_t find(RouteKey const& key) const
+    {
+        size_t const start = slotOf(key, _seed);
+        for (size_t i = 0U; i <= _maxProbe; ++i)
+        {
+            size_t const slot = (start + i) & (SLOT_COUNT - 1U);
+            if (_routes[slot] == INVALID_ROUTE)
+            {
+                break;
+            }
+            if (_keys[slot] == key)
+            {
+                return _routes[slot];
+            }
+        }
+        return INVALID_ROUTE;
+    }
+
+    /**
+     * \brief Get the index of the route of \param message.
+     *
+     * \return the index within the manifest, INVALID_ROUTE if the message has no route.
+     */
+    uint16_t find(Message const& message) const { return find(RouteKey::fromMessage(message)); }
+
+    /**
+     * \brief Check if the manifest contained the same key more than once.
+     *
+     * \return true if a key is duplicated, otherwise false.
+     */
+    constexpr bool hasDuplicates() const { return _hasDuplicates; }
+
+    /**
+     * \brief Get the maximum number of slots behind the hashed slot that find() inspects.
+     *
+     * \return size_t
+     */
+    constexpr size_t getMaxProbe() const { return _maxProbe; }
+
+private:
+    static constexpr size_t slotOf(RouteKey const& key, uint32_t const seed)
+    {
+        uint64_t hash = key.pack() ^ (static_cast<uint64_t>(seed + 1U) * 0x9E3779B97F4A7C15ULL);
+        hash ^= hash >> 32U;
+        hash *= 0xD6E8FEB86659FD93ULL;
+        hash ^= hash >> 32U;
+        return static_cast<size_t>(hash) & (SLOT_COUNT - 1U);
+    }
+
+    constexpr size_t build(etl::array<RouteKey, RouteCount> const& routes, uint32_t const seed)
+    {
+        for (size_t slot = 0U; slot < SLOT_COUNT; ++slot)
+        {
+            _routes[slot] = INVALID_ROUTE;
+        }
+        size_t maxProbe = 0U;
+        for (size_t route = 0U; route < RouteCount; ++route)
+        {
+            size_t const start = slotOf(routes[route], seed);
+            size_t probe       = 0U;
+            size_t slot        = start;
+            while (_routes[slot] != INVALID_ROUTE)
+            {
+                if (_keys[slot] == routes[route])
+                {
+                    _hasDuplicates = true;
+                }
+                ++probe;
+                slot = (start + probe) & (SLOT_COUNT - 1U);
+            }
+            _keys[slot]   = routes[route];
+            _routes[slot] = static_cast<uint16_t>(route);
+            if (probe > maxProbe)
+            {
+                maxProbe = probe;
+            }
+        }
+        return maxProbe;
+    }
+
+    RouteKey _keys[SLOT_COUNT];
+    uint16_t _routes[SLOT_COUNT];
+    uint32_t _seed;
+    size_t _maxProbe;
+    bool _hasDuplicates;
+};
+
+/**
+ * \brief The routing table of a static service manifest.
+ * \details Manifest is a type that provides the routes in a static constexpr function
+ * `routes()` returning an etl::array of RouteKeys. The table is built at compile time and a
+ * manifest containing the same route twice is rejected by a static_assert.
+ *
+ * \tparam Manifest the type providing the routes.
+ */
+template<typename Manifest>
+struct StaticRoutingTable
+{
+    static constexpr size_t ROUTE_COUNT = Manifest::routes().size();
+
+    using TableType = RoutingTable<ROUTE_COUNT>;
+
+    static constexpr TableType TABLE{Manifest::routes()};
+
+    static_assert(!TABLE.hasDuplicates(), "Service manifest contains the same route twice!");
+
+    /**
+     * \brief Get the index of the route of \param message within the manifest.
+     *
+     * \return the index of the route, TableType::INVALID_ROUTE if the message has no route.
+     */
+    static uint16_t find(Message const& message) { return TABLE.find(message); }
+};
+
+template<typename Manifest>
+constexpr typename StaticRoutingTable<Manifest>::TableType StaticRoutingTable<Manifest>::TABLE;
+
+} // namespace core
+} // namespace middleware
@@ -0,0 +1,443 @@
+// Copyright 2025 BMW AG
+
+#pragma once
+
+#include "middleware/core/Message.h"
+
+#include <etl/array.h>
+#include <etl/binary.h>
+#include <etl/endianness.h>
+#include <etl/error_handler.h>
+#include <etl/span.h>
+#include <etl/type_traits.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+namespace middleware
+{
+namespace core
+{
+
+/**
+ * \brief Describes the member \param Pointer of type MemberType of an aggregate type Class.
+ *
+ * \tparam Class the aggregate type containing the member.
+ * \tparam MemberType the type of the member.
+ * \tparam Pointer the pointer to the member.
+ */
+template<typename Class, typename MemberType, MemberType Class::*Pointer>
+struct Member
+{
+    using Type = MemberType;
+
+    static MemberType const& get(Class const& object) { return object.*Pointer; }
+
+    static MemberType& get(Class& object) { return object.*Pointer; }
+};
+
+/**
+ * \brief The list of Members describing an aggregate type, in the order of serialization.
+ *
+ */
+template<typename... Members>
+struct MemberList
+{};
+
+/**
+ * \brief Describes the members of an aggregate type T for the serializer.
+ * \details Specializations provide an alias `Members` to a MemberList, e.g.
+ * `using Members = MemberList<Member<Point, uint16_t, &Point::x>, ...>;`. Arithmetic types, enums
+ * and etl::arrays of serializable types don't need a description.
+ *
+ * \tparam T the aggregate type.
+ */
+template<typename T>
+struct PayloadLayout;
+
+namespace internal
+{
+template<size_t Size>
+struct UnsignedOfSize;
+
+template<>
+struct UnsignedOfSize<1U>
+{
+    using Type = uint8_t;
+};
+
+template<>
+struct UnsignedOfSize<2U>
+{
+    using Type = uint16_t;
+};
+
+template<>
+struct UnsignedOfSize<4U>
+{
+    using Type = uint32_t;
+};
+
+template<>
+struct UnsignedOfSize<8U>
+{
+    using Type = uint64_t;
+};
+
+template<typename T, typename = void>
+struct HasPayloadLayout : etl::false_type
+{};
+
+template<typename T>
+struct HasPayloadLayout<T, etl::void_t<typename PayloadLayout<T>::Members>> : etl::true_type
+{};
+
+template<typename T, etl::endian::enum_type Order, typename Specialization = void>
+struct WireFormat;
+
+/**
+ * \brief Wire format of arithmetic and enum types, which are copied as they are if the byte order
+ * of the host matches the wire order and byte reversed otherwise.
+ *
+ */
+template<typename T, etl::endian::enum_type Order>
+struct WireFormat<
+    T,
+    Order,
+    etl::enable_if_t<etl::is_arithmetic<T>::value || etl::is_enum<T>::value>>
+{
+    static constexpr size_t SIZE    = sizeof(T);
+    static constexpr bool IS_MEMCPY = (sizeof(T) == 1U) || (Order == etl::endian::native);
+
+    static void write(T const& value, uint8_t* const destination)
+    {
+        writeValue(value, destination, etl::bool_constant<IS_MEMCPY>());
+    }
+
+    static void read(uint8_t const* const source, T& value)
+    {
+        readValue(source, value, etl::bool_constant<IS_MEMCPY>());
+    }
+
+private:
+    using Bits = typename UnsignedOfSize<sizeof(T)>::Type;
+
+    static void writeValue(T const& value, uint8_t* const destination, etl::true_type)
+    {
+        (void)memcpy(destination, &value, SIZE);
+    }
+
+    static void writeValue(T const& value, uint8_t* const destination, etl::false_type)
+    {
+        Bits bits;
+        (void)memcpy(&bits, &value, SIZE);
+        bits = etl::reverse_bytes(bits);
+        (void)memcpy(destination, &bits, SIZE);
+    }
+
+    static void readValue(uint8_t const* const source, T& value, etl::true_type)
+    {
+        (void)memcpy(&value, source, SIZE);
+    }
+
+    static void readValue(uint8_t const* const source, T& value, etl::false_type)
+    {
+        Bits bits;
+        (void)memcpy(&bits, source, SIZE);
+        bits = etl::reverse_bytes(bits);
+        (void)memcpy(&value, &bits, SIZE);
+    }
+};
+
+/**
+ * \brief Wire format of arrays, which are copied at once if their elements are copied as they
+ * are and have no padding.
+ *
+ */
+template<typename E, size_t N, etl::endian::enum_type Order>
+struct WireFormat<etl::array<E, N>, Order>
+{
+    using ElementFormat = WireFormat<E, Order>;
+
+    static constexpr size_t SIZE = N * ElementFormat::SIZE;
+    static constexpr bool IS_MEMCPY
+        = ElementFormat::IS_MEMCPY && (sizeof(E) == ElementFormat::SIZE);
+
+    static void write(etl::array<E, N> const& value, uint8_t* const destination)
+    {
+        writeElements(value, destination, etl::bool_constant<IS_MEMCPY>());
+    }
+
+    static void read(uint8_t const* const source, etl::array<E, N>& value)
+    {
+        readElements(source, value, etl::bool_constant<IS_MEMCPY>());
+    }
+
+private:
+    static void
+    writeElements(etl::array<E, N> const& value, uint8_t* const destination, etl::true_type)
+    {
+        (void)memcpy(destination, value.data(), SIZE);
+    }
+
+    static void
+    writeElements(etl::array<E, N> const& value, uint8_t* const destination, etl::false_type)
+    {
+        for (size_t i = 0U; i < N; ++i)
+        {
+            ElementFormat::write(value[i], destination + (i * ElementFormat::SIZE));
+        }
+    }
+
+    static void readElements(uint8_t const* const source, etl::array<E, N>& value, etl::true_type)
+    {
+        (void)memcpy(value.data(), source, SIZE);
+    }
+
+    static void
+    readElements(uint8_t const* const source, etl::array<E, N>& value, etl::false_type)
+    {
+        for (size_t i = 0U; i < N; ++i)
+        {
+            ElementFormat::read(source + (i * ElementFormat::SIZE), value[i]);
+        }
+    }
+};
+
+template<typename T, etl::endian::enum_type Order, typename List>
+struct MemberListFormat;
+
+template<typename T, etl::endian::enum_type Order>
+struct MemberListFormat<T, Order, MemberList<>>
+{
+    static constexpr size_t SIZE = 0U;
+
+    static void write(T const&, uint8_t* const) {}
+
+    static void read(uint8_t const* const, T&) {}
+};
+
+template<typename T, etl::endian::enum_type Order, typename First, typename... Others>
+struct MemberListFormat<T, Order, MemberList<First, Others...>>
+{
+    using FirstFormat  = WireFormat<typename First::Type, Order>;
+    using OthersFormat = MemberListFormat<T, Order, MemberList<Others...>>;
+
+    static constexpr size_t SIZE = FirstFormat::SIZE + OthersFormat::SIZE;
+
+    static void write(T const& value, uint8_t* const destination)
+    {
+        FirstFormat::write(First::get(value), destination);
+        OthersFormat::write(value, destination + FirstFormat::SIZE);
+    }
+
+    static void read(uint8_t const* const source, T& value)
+    {
+        FirstFormat::read(source, First::get(value));
+        OthersFormat::read(source + FirstFormat::SIZE, value);
+    }
+};
+
+/**
+ * \brief Wire format of aggregates described by a PayloadLayout, whose members are serialized
+ * one after the other without padding.
+ *
+ */
+template<typename T, etl::endian::enum_type Order>
+struct WireFormat<T, Order, etl::enable_if_t<HasPayloadLayout<T>::value>>
+: MemberListFormat<T, Order, typename PayloadLayout<T>::Members>
+{
+    static constexpr bool IS_MEMCPY = false;
+};
+} // namespace internal
+
+/**
+ * \brief Serializer of values of type T into a byte buffer.
+ * \details The wire size is computed at compile time as the sum of the sizes of all arithmetic
+ * values contained in T, without any padding. Multi-byte values are stored in WireOrder, values
+ * are copied with memcpy if the byte order of the host matches.
+ *
+ * \tparam T an arithmetic type, an enum, an etl::array or an aggregate described by a
+ * PayloadLayout.
+ * \tparam WireOrder the byte order of the serialized data.
+ */
+template<typename T, etl::endian::enum_type WireOrder = etl::endian::little>
+struct Serializer
+{
+    using Format = internal::WireFormat<T, WireOrder>;
+
+    static constexpr size_t WIRE_SIZE = Format::SIZE;
+
+    /**
+     * \brief Whether the serialized value fits into the internal buffer of a message.
+     */
+    static constexpr bool IS_INLINE = (WIRE_SIZE <= Message::MAX_PAYLOAD_SIZE);
+
+    /**
+     * \brief Serialize \param value into \param destination.
+     *
+     * \return false if \param destination is smaller than WIRE_SIZE, otherwise true.
+     */
+    static bool serialize(T const& value, etl::span<uint8_t> const destination)
+    {
+        if (destination.size() < WIRE_SIZE)
+        {
+            return false;
+        }
+        Format::write(value, destination.data());
+        return true;
+    }
+
+    /**
+     * \brief Deserialize \param value from \param source.
+     *
+     * \return false if \param source is smaller than WIRE_SIZE, otherwise true.
+     */
+    static bool deserialize(etl::span<uint8_t const> const source, T& value)
+    {
+        if (source.size() < WIRE_SIZE)
+        {
+            return false;
+        }
+        Format::read(source.data(), value);
+        return true;
+    }
+};
+
+template<typename T, etl::endian::enum_type WireOrder>
+constexpr size_t Serializer<T, WireOrder>::WIRE_SIZE;
+
+template<typename T, etl::endian::enum_type WireOrder>
+constexpr bool Serializer<T, WireOrder>::IS_INLINE;
+
+/**
+ * \brief Writes values to and reads values from the payload of messages.
+ * \details The representation of the payload is selected at compile time: values whose wire size
+ * fits into Message::MAX_PAYLOAD_SIZE are serialized directly into the internal buffer of the
+ * message, larger values directly into an external payload allocated from the given allocator.
+ *
+ */
+class MessageSerializer
+{
+public:
+    /**
+     * \brief Serialize \param value into the internal buffer of \param message.
+     * \details The message must not reference an external payload, since it can't be released
+     * without its allocator.
+     *
+     */
+    template<typename T, etl::endian::enum_type WireOrder = etl::endian::little>
+    static void write(Message& message, T const& value)
+    {
+        using SerializerType = Serializer<T, WireOrder>;
+        static_assert(SerializerType::IS_INLINE, "Payload must be allocated externally!");
+
+        ETL_ASSERT(
+            !message.hasUniqueExternalPayload() && !message.hasSharedExternalPayload(),
+            ETL_ERROR_GENERIC("external payload must be released before writing inline"));
+        SerializerType::Format::write(value, message._payload.internalBuffer.data());
+    }
+
+    /**
+     * \brief Serialize \param value into the payload of \param message, which is allocated from
+     * \param allocator if it doesn't fit into the internal buffer.
+     * \details An external payload the message references already is released to \param
+     * allocator first.
+     *
+     * \return false if the external payload couldn't be allocated, otherwise true.
+     */
+    template<
+        typename T,
+        etl::endian::enum_type WireOrder = etl::endian::little,
+        typename Allocator>
+    static bool write(Message& message, T const& value, Allocator& allocator)
+    {
+        if (message.hasUniqueExternalPayload() || message.hasSharedExternalPayload())
+        {
+            allocator.release(message);
+        }
+        return writeTo<T, WireOrder>(
+            message,
+            value,
+            allocator,
+            etl::bool_constant<Serializer<T, WireOrder>::IS_INLINE>());
+    }
+
+    /**
+     * \brief Deserialize \param value from the internal buffer of \param message.
+     *
+     * \return false if the message has an external payload, otherwise true.
+     */
+    template<typename T, etl::endian::enum_type WireOrder = etl::endian::little>
+    static bool read(Message const& message, T& value)
+    {
+        using SerializerType = Serializer<T, WireOrder>;
+        static_assert(SerializerType::IS_INLINE, "Payload is allocated externally!");
+
+        if (message.hasUniqueExternalPayload() || message.hasSharedExternalPayload())
+        {
+            return false;
+        }
+        SerializerType::Format::read(message._payload.internalBuffer.data(), value);
+        return true;
+    }
+
+    /**
+     * \brief Deserialize \param value from the payload of \param message, which is looked up in
+     * \param allocator if it doesn't fit into the internal buffer.
+     *
+     * \return false if the message doesn't carry a payload of the expected representation and
+     * size, otherwise true.
+     */
+    template<
+        typename T,
+        etl::endian::enum_type WireOrder = etl::endian::little,
+        typename Allocator>
+    static bool read(Message const& message, T& value, Allocator const& allocator)
+    {
+        return readFrom<T, WireOrder>(
+            message,
+            value,
+            allocator,
+            etl::bool_constant<Serializer<T, WireOrder>::IS_INLINE>());
+    }
+
+private:
+    template<typename T, etl::endian::enum_type WireOrder, typename Allocator>
+    static bool writeTo(Message& message, T const& value, Allocator&, etl::true_type)
+    {
+        write<T, WireOrder>(message, value);
+        return true;
+    }
+
+    template<typename T, etl::endian::enum_type WireOrder, typename Allocator>
+    static bool writeTo(Message& message, T const& value, Allocator& allocator, etl::false_type)
+    {
+        using SerializerType             = Serializer<T, WireOrder>;
+        etl::span<uint8_t> const payload = allocator.allocate(message, SerializerType::WIRE_SIZE);
+        return SerializerType::serialize(value, payload);
+    }
+
+    template<typename T, etl::endian::enum_type WireOrder, typename Allocator>
+    static bool readFrom(Message const& message, T& value, Allocator const&, etl::true_type)
+    {
+        return read<T, WireOrder>(message, value);
+    }
+
+    template<typename T, etl::endian::enum_type WireOrder, typename Allocator>
+    static bool
+    readFrom(Message const& message, T& value, Allocator const& allocator, etl::false_type)
+    {
+        using SerializerType                   = Serializer<T, WireOrder>;
+        etl::span<uint8_t const> const payload = allocator.getPayload(message);
+        if (payload.size() != SerializerType::WIRE_SIZE)
+        {
+            return false;
+        }
+        return SerializerType::deserialize(payload, value);
+    }
+};
+
+} // namespace core
+} // namespace middleware
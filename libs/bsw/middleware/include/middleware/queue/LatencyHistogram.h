@@ -0,0 +1,178 @@
+// Copyright 2025 BMW AG
+
+#pragma once
+
+#include <etl/array.h>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace middleware
+{
+namespace queue
+{
+
+/**
+ * \brief A struct that aggregates the time elements have been waiting in a queue, measured in
+ * ticks of the timestamp source of the queue.
+ * \details The buckets are logarithmic: bucket 0 counts latencies of 0 ticks and bucket i counts
+ * latencies in the range [2^(i-1), 2^i[. The last bucket also counts all larger latencies.
+ *
+ */
+struct LatencyHistogram
+{
+    static constexpr size_t BUCKET_COUNT = 16U;
+
+    uint32_t count;                             ///< Number of measured elements.
+    uint32_t minLatency;                        ///< Minimum latency, 0 if nothing was measured.
+    uint32_t maxLatency;                        ///< Maximum latency.
+    uint64_t totalLatency;                      ///< Sum of all latencies, to compute the mean.
+    etl::array<uint32_t, BUCKET_COUNT> buckets; ///< Number of latencies per bucket.
+
+    /**
+     * \brief Get the index of the bucket counting \param latency.
+     *
+     * \return size_t
+     */
+    static size_t getBucket(uint32_t const latency)
+    {
+        size_t bucket  = 0U;
+        uint32_t value = latency;
+        while ((value != 0U) && (bucket < (BUCKET_COUNT - 1U)))
+        {
+            value >>= 1U;
+            ++bucket;
+        }
+        return bucket;
+    }
+
+    /**
+     * \brief Get the largest latency counted by \param bucket.
+     *
+     * \return the upper bound in ticks, UINT32_MAX for the last bucket.
+     */
+    static uint32_t getUpperBound(size_t const bucket)
+    {
+        return (bucket < (BUCKET_COUNT - 1U)) ? ((1U << bucket) - 1U) : UINT32_MAX;
+    }
+
+    /**
+     * \brief Add a single measured \param latency.
+     *
+     */
+    void add(uint32_t const latency)
+    {
+        if ((count == 0U) || (latency < minLatency))
+        {
+            minLatency = latency;
+        }
+        if (latency > maxLatency)
+        {
+            maxLatency = latency;
+        }
+        ++count;
+        totalLatency += latency;
+        ++buckets[getBucket(latency)];
+    }
+
+    /**
+     * \brief Remove all measured latencies.
+     *
+     */
+    void reset()
+    {
+        count        = 0U;
+        minLatency   = 0U;
+        maxLatency   = 0U;
+        totalLatency = 0U;
+        buckets.fill(0U);
+    }
+};
+
+/**
+ * \brief Stores the enqueue timestamp of each element of a queue and records the latency of the
+ * elements into a LatencyHistogram when they are released by the consumer.
+ * \details TimestampSource is a type providing a static `uint32_t now()` function, e.g. returning
+ * getSystemTicks32Bit(). The difference of two timestamps is computed modulo 2^32, so wrapping
+ * timestamps are handled as long as elements don't wait longer than a full period. Like the
+ * queue, the tracker must be initialized with init() before use.
+ *
+ * \tparam TimestampSource the source of the timestamps, void disables the measurement.
+ * \tparam Size the number of elements of the queue.
+ */
+template<typename TimestampSource, size_t Size>
+class LatencyTracker
+{
+public:
+    static constexpr bool IS_ENABLED = true;
+
+    /**
+     * \brief Default constructor is intentionally empty, since queues will be placed in shared RAM
+     * and they will be initialized by the init method.
+     *
+     */
+    LatencyTracker() {}
+
+    void init() { _histogram.reset(); }
+
+    /**
+     * \brief Stamp the \param count elements starting at cursor \param first with the current
+     * time, right before they are published.
+     *
+     */
+    void stamp(uint32_t const first, uint32_t const count)
+    {
+        uint32_t const now = TimestampSource::now();
+        for (uint32_t i = 0U; i < count; ++i)
+        {
+            _timestamps[(first + i) % Size] = now;
+        }
+    }
+
+    /**
+     * \brief Record the latency of the \param count elements starting at cursor \param first,
+     * right before they are released.
+     *
+     */
+    void record(uint32_t const first, uint32_t const count)
+    {
+        uint32_t const now = TimestampSource::now();
+        for (uint32_t i = 0U; i < count; ++i)
+        {
+            _histogram.add(now - _timestamps[(first + i) % Size]);
+        }
+    }
+
+    LatencyHistogram getHistogram() const { return _histogram; }
+
+    void reset() { _histogram.reset(); }
+
+private:
+    etl::array<uint32_t, Size> _timestamps;
+    LatencyHistogram _histogram;
+};
+
+/**
+ * \brief Specialization without timestamp source, which neither stores timestamps nor measures
+ * anything.
+ *
+ */
+template<size_t Size>
+class LatencyTracker<void, Size>
+{
+public:
+    static constexpr bool IS_ENABLED = false;
+
+    void init() {}
+
+    void stamp(uint32_t const, uint32_t const) {}
+
+    void record(uint32_t const, uint32_t const) {}
+
+    LatencyHistogram getHistogram() const { return LatencyHistogram{}; }
+
+    void reset() {}
+};
+
+} // namespace queue
+} // namespace middleware
@@ -2,11 +2,12 @@
 
 #pragma once
 
+#include "middleware/queue/LatencyHistogram.h"
 #include "middleware/queue/QueueBase.h"
 
 #include <etl/array.h>
 #include <etl/error_handler.h>
-#include <etl/optional.h>
+#include <etl/span.h>
 #include <etl/type_traits.h>
 
 namespace middleware
@@ -111,13 +112,21 @@ private:
  * \tparam Strategy the object that will be used to lock the mutex (by default is void, meaning no
  * lock mechanism should be used). \tparam TypeOfMutex the mutex type which according to QueueMutex
  * can only be an integer or a pointer to an integer.
+ * \tparam Timestamp the source of the enqueue timestamps used to measure the time elements wait in
+ * the queue, see LatencyTracker (by default is void, meaning no timestamps are taken).
  */
-template<typename Type, uint16_t Count, typename Strategy = void, typename TypeOfMutex = uint8_t>
+template<
+    typename Type,
+    uint16_t Count,
+    typename Strategy    = void,
+    typename TypeOfMutex = uint8_t,
+    typename Timestamp   = void>
 struct QueueTraits
 {
     using T                                 = Type;
     using LockStrategy                      = Strategy;
     using MutexType                         = TypeOfMutex;
+    using TimestampSource                   = Timestamp;
     static constexpr uint16_t ELEMENT_COUNT = Count;
 };
 
@@ -148,6 +157,7 @@ public:
     using LockStrategy               = typename Traits::LockStrategy;
     using MutexType                  = QueueMutex<typename Traits::MutexType>;
     static constexpr size_t MAX_SIZE = Traits::ELEMENT_COUNT;
+    using Latency                    = LatencyTracker<typename Traits::TimestampSource, MAX_SIZE>;
 
     /**
      * \brief Default constructor is intentionally empty, since queues will be placed in shared RAM
@@ -165,9 +175,28 @@ public:
     {
         _mutex.init(pmutex);
         Base::init(MAX_SIZE);
+        _latency.init();
         _buffer.fill(QueueItem{});
     }
 
+    /**
+     * \brief Get a snapshot of the time elements have been waiting in the queue.
+     *
+     * \return the histogram, which is empty if the queue has no timestamp source.
+     */
+    LatencyHistogram getLatencyHistogram() const { return _latency.getHistogram(); }
+
+    /**
+     * \brief Resets the queues statistics including the latency histogram.
+     * \remark Must be protected with ECU mutex from caller, to ensure concistency.
+     *
+     */
+    void resetStats()
+    {
+        Base::resetStats();
+        _latency.reset();
+    }
+
     /**
      * \brief Nested class to read elements from the queue.
      * \details After reading an element, the advance method needs to be called in order to clear
@@ -200,12 +229,31 @@ public:
          */
         QueueItem const& peek() const { return _queue._buffer[_queue.getReceived() % MAX_SIZE]; }
 
+        /**
+         * \brief Gets a reference to the element at position \param offset behind the top element.
+         * \details Together with size() and advance(uint32_t) this allows to process several
+         * elements before releasing them at once. \param offset must be less than size().
+         *
+         * \return const QueueItem&
+         */
+        QueueItem const& peek(uint32_t const offset) const
+        {
+            return _queue._buffer[(_queue.getReceived() + offset) % MAX_SIZE];
+        }
+
         /**
          * \brief Advance the reading cursor in the queue, thus effectively deleting the top
          * element.
          *
          */
-        void advance() { _queue.advanceReceived(); }
+        void advance() { _queue.release(1U); }
+
+        /**
+         * \brief Advance the reading cursor by \param count elements, thus effectively deleting
+         * them with a single update of the reading cursor. \param count must not exceed size().
+         *
+         */
+        void advance(uint32_t const count) { _queue.release(count); }
 
     private:
         Queue& _queue;
@@ -243,16 +291,21 @@ public:
          * \return true if the element was written successfully, otherwise false.
          */
         bool write(QueueItem const& value)
+        {
+            return write(etl::span<QueueItem const>(&value, 1U)) == 1U;
+        }
+
+        /**
+         * \brief Appends the elements of \param values to the end of the queue under a single
+         * lock and publishes them at once.
+         * \details Elements that don't fit into the queue are counted as lost messages.
+         *
+         * \return the number of elements written.
+         */
+        uint32_t write(etl::span<QueueItem const> const values)
         {
             LockStrategy const lock(_queue._mutex.get());
-            etl::optional<size_t> index = _queue.writeNext();
-            bool res                    = index.has_value();
-            if (res)
-            {
-                _queue._buffer[index.value()] = value;
-            }
-
-            return res;
+            return _queue.writeMany(values);
         }
 
     private:
@@ -260,7 +313,30 @@ public:
     };
 
 private:
+    uint32_t writeMany(etl::span<QueueItem const> const values)
+    {
+        uint32_t const requested = static_cast<uint32_t>(values.size());
+        uint32_t const free      = Base::getFree();
+        uint32_t const count     = (requested < free) ? requested : free;
+        uint32_t const sent      = Base::getSent();
+        for (uint32_t i = 0U; i < count; ++i)
+        {
+            _buffer[(sent + i) % MAX_SIZE] = values[i];
+        }
+        _latency.stamp(sent, count);
+        Base::publish(count);
+        Base::addLost(requested - count);
+        return count;
+    }
+
+    void release(uint32_t const count)
+    {
+        _latency.record(Base::getReceived(), count);
+        Base::advanceReceived(count);
+    }
+
     etl::array<QueueItem, MAX_SIZE> _buffer;
+    Latency _latency;
     MutexType _mutex __attribute__((aligned(4)));
 };
 
@@ -281,6 +357,7 @@ public:
     using QueueItem                  = typename Traits::T;
     using LockStrategy               = typename Traits::LockStrategy;
     static constexpr size_t MAX_SIZE = Traits::ELEMENT_COUNT;
+    using Latency                    = LatencyTracker<typename Traits::TimestampSource, MAX_SIZE>;
 
     /**
      * \brief Default constructor is intentionally empty, since queues will be placed in shared RAM
@@ -297,9 +374,28 @@ public:
     void init(char const* const = nullptr)
     {
         Base::init(MAX_SIZE);
+        _latency.init();
         _buffer.fill(QueueItem{});
     }
 
+    /**
+     * \brief Get a snapshot of the time elements have been waiting in the queue.
+     *
+     * \return the histogram, which is empty if the queue has no timestamp source.
+     */
+    LatencyHistogram getLatencyHistogram() const { return _latency.getHistogram(); }
+
+    /**
+     * \brief Resets the queues statistics including the latency histogram.
+     * \remark Must be protected with ECU mutex from caller, to ensure concistency.
+     *
+     */
+    void resetStats()
+    {
+        Base::resetStats();
+        _latency.reset();
+    }
+
     /**
      * \brief Nested class to read elements from the queue.
      * \details After reading an element, the advance method needs to be called in order to clear
@@ -332,12 +428,31 @@ public:
          */
         QueueItem const& peek() const { return _queue._buffer[_queue.getReceived() % MAX_SIZE]; }
 
+        /**
+         * \brief Gets a reference to the element at position \param offset behind the top element.
+         * \details Together with size() and advance(uint32_t) this allows to process several
+         * elements before releasing them at once. \param offset must be less than size().
+         *
+         * \return const QueueItem&
+         */
+        QueueItem const& peek(uint32_t const offset) const
+        {
+            return _queue._buffer[(_queue.getReceived() + offset) % MAX_SIZE];
+        }
+
         /**
          * \brief Advance the reading cursor in the queue, thus effectively deleting the top
          * element.
          *
          */
-        void advance() { _queue.advanceReceived(); }
+        void advance() { _queue.release(1U); }
+
+        /**
+         * \brief Advance the reading cursor by \param count elements, thus effectively deleting
+         * them with a single update of the reading cursor. \param count must not exceed size().
+         *
+         */
+        void advance(uint32_t const count) { _queue.release(count); }
 
     private:
         Queue& _queue;
@@ -376,14 +491,49 @@ public:
          */
         bool write(QueueItem const& value)
         {
-            etl::optional<size_t> index = _queue.writeNext();
-            bool const res              = index.has_value();
-            if (res)
-            {
-                _queue._buffer[index.value()] = value;
-            }
-
-            return res;
+            return write(etl::span<QueueItem const>(&value, 1U)) == 1U;
+        }
+
+        /**
+         * \brief Appends the elements of \param values to the end of the queue and publishes them
+         * at once.
+         * \details Elements that don't fit into the queue are counted as lost messages.
+         *
+         * \return the number of elements written.
+         */
+        uint32_t write(etl::span<QueueItem const> const values) { return _queue.writeMany(values); }
+
+        /**
+         * \brief Reserves up to \param count elements at the end of the queue, which can be
+         * filled in place using reserved() before they are made visible with publish().
+         *
+         * \return the number of reserved elements, which may be less than \param count.
+         */
+        uint32_t reserve(uint32_t const count)
+        {
+            uint32_t const free = _queue.getFree();
+            return (count < free) ? count : free;
+        }
+
+        /**
+         * \brief Gets a reference to the reserved element at position \param offset.
+         *
+         * \return QueueItem&
+         */
+        QueueItem& reserved(uint32_t const offset)
+        {
+            return _queue._buffer[(_queue.getSent() + offset) % MAX_SIZE];
+        }
+
+        /**
+         * \brief Makes the first \param count reserved elements visible to the receiver.
+         * \details \param count must not exceed the number returned by reserve().
+         *
+         */
+        void publish(uint32_t const count)
+        {
+            _queue._latency.stamp(_queue.getSent(), count);
+            _queue.publish(count);
         }
 
     private:
@@ -391,7 +541,30 @@ public:
     };
 
 private:
+    uint32_t writeMany(etl::span<QueueItem const> const values)
+    {
+        uint32_t const requested = static_cast<uint32_t>(values.size());
+        uint32_t const free      = Base::getFree();
+        uint32_t const count     = (requested < free) ? requested : free;
+        uint32_t const sent      = Base::getSent();
+        for (uint32_t i = 0U; i < count; ++i)
+        {
+            _buffer[(sent + i) % MAX_SIZE] = values[i];
+        }
+        _latency.stamp(sent, count);
+        Base::publish(count);
+        Base::addLost(requested - count);
+        return count;
+    }
+
+    void release(uint32_t const count)
+    {
+        _latency.record(Base::getReceived(), count);
+        Base::advanceReceived(count);
+    }
+
     etl::array<QueueItem, MAX_SIZE> _buffer;
+    Latency _latency;
 };
 
 static_assert(
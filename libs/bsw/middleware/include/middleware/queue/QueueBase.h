@@ -2,11 +2,14 @@
 
 #pragma once
 
-#include <etl/optional.h>
 
 #include <cstdint>
 #include <cstring>
 
+#ifndef MIDDLEWARE_QUEUE_CACHE_LINE_SIZE
+#define MIDDLEWARE_QUEUE_CACHE_LINE_SIZE (64U)
+#endif
+
 namespace middleware
 {
 namespace queue
@@ -14,20 +17,23 @@ namespace queue
 
 /**
  * \brief A struct that aggregates a series of statistics values related to queues.
+ * \details All counters are 32 bit wide, so that they don't saturate when accumulated over many
+ * snapshots. The time elements have been waiting in the queue is provided separately by a
+ * LatencyHistogram, if the queue has a timestamp source.
  *
  */
 struct QueueStats
 {
     uint32_t processedMessages;
     uint32_t lostMessages;
-    uint16_t loadSnapshot;
-    uint16_t processingCounter;
-    uint16_t realLoadSnapshot;
-    uint16_t realProcessingCounter;
-    uint8_t maxLoad;
-    uint8_t startupLoad;
-    uint8_t previousSnapshot;
-    uint8_t maxFillRate;
+    uint32_t loadSnapshot;
+    uint32_t processingCounter;
+    uint32_t realLoadSnapshot;
+    uint32_t realProcessingCounter;
+    uint32_t maxLoad;
+    uint32_t startupLoad;
+    uint32_t previousSnapshot;
+    uint32_t maxFillRate;
 };
 
 /**
@@ -39,31 +45,59 @@ struct QueueStats
  * the same element: 1) sent_ == received_ 2) sent_ == (received_ + MAX_SIZE) % (2*MAX_SIZE). Using
  * this trick the ambiguity between the empty and full cases of the queue is resolved without the
  * need for an unused element in the queue: Case 1) means "empty" and case 2) means "full".
+ * The producer state (writing cursor and the statistics updated on write) and the consumer state
+ * (reading cursor and the statistics updated on read) are placed on separate cache lines of
+ * MIDDLEWARE_QUEUE_CACHE_LINE_SIZE bytes, so that the cores only exchange cache lines when a cursor
+ * is published. Cursors are published with release semantics and read with acquire semantics, which
+ * makes the elements written before publishing visible to the other core. Plain integers accessed
+ * through atomic builtins are used instead of atomic objects, since the empty constructor must not
+ * touch the state of a queue placed in shared RAM.
  *
  */
 class QueueBase
 {
 public:
     /**
-     * \brief Get a constant reference to the current queue statistics.
-     *
-     * \return const QueueStats&
-     */
-    QueueStats const& getStats() const { return _stats; }
-
-    /**
-     * \brief Get a reference to the current queue statistics.
+     * \brief Get a snapshot of the current queue statistics, combined from the producer and the
+     * consumer side.
      *
-     * \return QueueStats&
+     * \return QueueStats
      */
-    QueueStats& getStats() { return _stats; }
+    QueueStats getStats() const
+    {
+        QueueStats stats{};
+        stats.processedMessages     = _consumer.processedMessages;
+        stats.lostMessages          = _producer.lostMessages;
+        stats.loadSnapshot          = _consumer.loadSnapshot;
+        stats.processingCounter     = _consumer.processingCounter;
+        stats.realLoadSnapshot      = _consumer.realLoadSnapshot;
+        stats.realProcessingCounter = _consumer.realProcessingCounter;
+        stats.maxLoad               = _producer.maxLoad;
+        stats.startupLoad           = _producer.startupLoad;
+        stats.previousSnapshot      = _consumer.previousSnapshot;
+        stats.maxFillRate           = _consumer.maxFillRate;
+        return stats;
+    }
 
     /**
      * \brief Resets the queues statistics.
      * \remark Must be protected with ECU mutex from caller, to ensure concistency.
      *
      */
-    void resetStats() { _stats = QueueStats(); }
+    void resetStats()
+    {
+        _producer.lostMessages          = 0U;
+        _producer.maxLoad               = 0U;
+        _producer.startupLoad           = 0U;
+        _producer.isStartupDone         = false;
+        _consumer.processedMessages     = 0U;
+        _consumer.loadSnapshot          = 0U;
+        _consumer.processingCounter     = 0U;
+        _consumer.realLoadSnapshot      = 0U;
+        _consumer.realProcessingCounter = 0U;
+        _consumer.previousSnapshot      = 0U;
+        _consumer.maxFillRate           = 0U;
+    }
 
     /**
      * \brief Get the current size of the queue.
@@ -72,10 +106,9 @@ public:
      */
     uint32_t size() const
     {
-        // Volatile is needed to to make sure the read is not optimized away when new elements have
-        // been added to the queue by the other core.
-        uint32_t const txPos = static_cast<uint32_t const volatile&>(_sent);
-        return (txPos >= _received) ? (txPos - _received) : (txPos + (2U * _maxSize)) - _received;
+        uint32_t const txPos = loadAcquire(_producer.sent);
+        uint32_t const rxPos = loadAcquire(_consumer.received);
+        return distance(rxPos, txPos, _consumer.maxSize);
     }
 
     /**
@@ -85,11 +118,9 @@ public:
      */
     bool isFull() const
     {
-        // Volatile is needed to make sure the read is not optimized away when full() is called in a
-        // loop like `while(sender.full()){}`.
         return (
-            _sent
-            == ((static_cast<uint32_t const volatile&>(_received) + _maxSize) % (2U * _maxSize)));
+            _producer.sent
+            == ((loadAcquire(_consumer.received) + _producer.maxSize) % (2U * _producer.maxSize)));
     }
 
     /**
@@ -97,12 +128,7 @@ public:
      *
      * \return true if empty, otherwise false.
      */
-    bool isEmpty() const
-    {
-        // Volatile is needed to prevent `isEmpty()` from returning `true` when in fact new elements
-        // have been added to the queue by the other core.
-        return static_cast<uint32_t const volatile&>(_sent) == _received;
-    }
+    bool isEmpty() const { return loadAcquire(_producer.sent) == _consumer.received; }
 
     /**
      * \brief Update some of the statistic values of the queue, like the max fill rate and the
@@ -116,27 +142,27 @@ public:
         uint32_t const currentSize = size();
         if (0U != currentSize)
         {
-            _stats.loadSnapshot += static_cast<uint16_t>(currentSize);
-            ++_stats.processingCounter;
+            _consumer.loadSnapshot += currentSize;
+            ++_consumer.processingCounter;
         }
-        _stats.realLoadSnapshot += static_cast<uint16_t>(currentSize);
-        ++_stats.realProcessingCounter;
-        if (_stats.previousSnapshot == 0U)
+        _consumer.realLoadSnapshot += currentSize;
+        ++_consumer.realProcessingCounter;
+        if (_consumer.previousSnapshot == 0U)
         {
-            _stats.maxFillRate      = static_cast<uint8_t>(currentSize);
-            _stats.previousSnapshot = static_cast<uint8_t>(currentSize);
+            _consumer.maxFillRate      = currentSize;
+            _consumer.previousSnapshot = currentSize;
         }
         else
         {
-            if (currentSize > _stats.previousSnapshot)
+            if (currentSize > _consumer.previousSnapshot)
             {
-                auto const diff = (currentSize - _stats.previousSnapshot);
-                if (diff > _stats.maxFillRate)
+                auto const diff = (currentSize - _consumer.previousSnapshot);
+                if (diff > _consumer.maxFillRate)
                 {
-                    _stats.maxFillRate = static_cast<uint8_t>(diff);
+                    _consumer.maxFillRate = diff;
                 }
             }
-            _stats.previousSnapshot = static_cast<uint8_t>(currentSize);
+            _consumer.previousSnapshot = currentSize;
         }
     }
 
@@ -151,79 +177,139 @@ protected:
      */
     void init(uint32_t const maxSize)
     {
-        _maxSize                     = maxSize;
-        _sent                        = 0U;
-        _received                    = 0U;
-        _stats.processedMessages     = 0U;
-        _stats.lostMessages          = 0U;
-        _stats.loadSnapshot          = 0U;
-        _stats.processingCounter     = 0U;
-        _stats.realLoadSnapshot      = 0U;
-        _stats.realProcessingCounter = 0U;
-        _stats.maxLoad               = 0U;
-        _stats.startupLoad           = 0U;
-        _stats.previousSnapshot      = 0U;
-        _stats.maxFillRate           = 0U;
+        _producer.maxSize          = maxSize;
+        _producer.receivedSnapshot = 0U;
+        _consumer.maxSize          = maxSize;
+        _consumer.received         = 0U;
+        resetStats();
+        storeRelease(_producer.sent, 0U);
     }
 
     /**
      * \brief Get the value of received_ attribute.
+     * \remark Must only be called by the consumer.
      *
      * \return uint32_t the value of the reading cursor.
      */
-    uint32_t getReceived() const { return _received; }
+    uint32_t getReceived() const { return _consumer.received; }
 
     /**
      * \brief Get the value of sent_ attribute
+     * \remark Must only be called by the producer.
      *
      * \return uint32_t the value of the writing cursor
      */
-    uint32_t getSent() const { return _sent; }
+    uint32_t getSent() const { return _producer.sent; }
 
     /**
-     * \brief Advance the reading cursor.
+     * \brief Advance the reading cursor by \param count elements.
+     * \details The elements are released to the producer, so they must not be accessed afterwards.
      *
      */
-    void advanceReceived()
+    void advanceReceived(uint32_t const count = 1U)
     {
-        _received = (_received + 1U) % (2U * _maxSize);
-        ++_stats.processedMessages;
+        storeRelease(
+            _consumer.received, (_consumer.received + count) % (2U * _consumer.maxSize));
+        _consumer.processedMessages += count;
     }
 
     /**
-     * \brief Updates the writing cursor to the next element in the buffer.
+     * \brief Get the number of elements that can be written without overwriting elements which
+     * have not been read yet.
+     * \remark Must only be called by the producer.
      *
-     * \return etl::optional<size_t>
+     * \return uint32_t
      */
-    etl::optional<size_t> writeNext()
+    uint32_t getFree()
     {
-        etl::optional<size_t> writableIndex{};
-        if (isFull())
+        _producer.receivedSnapshot = loadAcquire(_consumer.received);
+        return _producer.maxSize
+               - distance(_producer.receivedSnapshot, _producer.sent, _producer.maxSize);
+    }
+
+    /**
+     * \brief Make \param count elements written after the writing cursor visible to the consumer.
+     * \details \param count must not exceed the value returned by the preceding call to getFree().
+     *
+     */
+    void publish(uint32_t const count)
+    {
+        if (count == 0U)
         {
-            ++_stats.lostMessages;
+            return;
         }
-        else
+        uint32_t const sent = (_producer.sent + count) % (2U * _producer.maxSize);
+        storeRelease(_producer.sent, sent);
+        // the load is taken from the reading cursor seen by getFree(), which saves accessing the
+        // cache line of the consumer again
+        uint32_t const load = distance(_producer.receivedSnapshot, sent, _producer.maxSize);
+        if (load > _producer.maxLoad)
+        {
+            _producer.maxLoad = load;
+        }
+        if (!_producer.isStartupDone)
         {
-            writableIndex.emplace(_sent % _maxSize);
-            _sent = (_sent + 1U) % (2U * _maxSize);
-            if (size() > _stats.maxLoad)
+            // the reading cursor can't complete a full turn between two writes, so it only reads
+            // zero until the first element has been processed
+            if (_producer.receivedSnapshot == 0U)
             {
-                _stats.maxLoad = static_cast<uint8_t>(size());
+                _producer.startupLoad += count;
             }
-            if (0U == _stats.processedMessages)
+            else
             {
-                ++_stats.startupLoad;
+                _producer.isStartupDone = true;
             }
         }
-
-        return writableIndex;
     }
 
+    /**
+     * \brief Count \param count elements which couldn't be written because the queue was full.
+     *
+     */
+    void addLost(uint32_t const count) { _producer.lostMessages += count; }
+
 private:
-    uint32_t _maxSize;
-    uint32_t _sent;
-    uint32_t _received;
-    QueueStats _stats;
+    static uint32_t loadAcquire(uint32_t const& value)
+    {
+        return __atomic_load_n(&value, __ATOMIC_ACQUIRE);
+    }
+
+    static void storeRelease(uint32_t& value, uint32_t const newValue)
+    {
+        __atomic_store_n(&value, newValue, __ATOMIC_RELEASE);
+    }
+
+    static uint32_t distance(uint32_t const from, uint32_t const to, uint32_t const maxSize)
+    {
+        return (to >= from) ? (to - from) : (to + (2U * maxSize)) - from;
+    }
+
+    struct alignas(MIDDLEWARE_QUEUE_CACHE_LINE_SIZE) ProducerState
+    {
+        uint32_t maxSize;
+        uint32_t sent;
+        uint32_t receivedSnapshot;
+        uint32_t lostMessages;
+        uint32_t maxLoad;
+        uint32_t startupLoad;
+        bool isStartupDone;
+    };
+
+    struct alignas(MIDDLEWARE_QUEUE_CACHE_LINE_SIZE) ConsumerState
+    {
+        uint32_t maxSize;
+        uint32_t received;
+        uint32_t processedMessages;
+        uint32_t loadSnapshot;
+        uint32_t processingCounter;
+        uint32_t realLoadSnapshot;
+        uint32_t realProcessingCounter;
+        uint32_t previousSnapshot;
+        uint32_t maxFillRate;
+    };
+
+    ProducerState _producer;
+    ConsumerState _consumer;
 };
 
 } // namespace queue
@@ -0,0 +1,150 @@
+// Copyright 2025 BMW AG
+
+#pragma once
+
+#include "middleware/core/Serializer.h"
+#include "middleware/queue/LatencyHistogram.h"
+#include "middleware/queue/QueueBase.h"
+
+#include <etl/span.h>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace middleware
+{
+namespace core
+{
+
+template<>
+struct PayloadLayout<queue::QueueStats>
+{
+    using S       = queue::QueueStats;
+    using Members = MemberList<
+        Member<S, uint32_t, &S::processedMessages>,
+        Member<S, uint32_t, &S::lostMessages>,
+        Member<S, uint32_t, &S::loadSnapshot>,
+        Member<S, uint32_t, &S::processingCounter>,
+        Member<S, uint32_t, &S::realLoadSnapshot>,
+        Member<S, uint32_t, &S::realProcessingCounter>,
+        Member<S, uint32_t, &S::maxLoad>,
+        Member<S, uint32_t, &S::startupLoad>,
+        Member<S, uint32_t, &S::previousSnapshot>,
+        Member<S, uint32_t, &S::maxFillRate>>;
+};
+
+template<>
+struct PayloadLayout<queue::LatencyHistogram>
+{
+    using H       = queue::LatencyHistogram;
+    using Members = MemberList<
+        Member<H, uint32_t, &H::count>,
+        Member<H, uint32_t, &H::minLatency>,
+        Member<H, uint32_t, &H::maxLatency>,
+        Member<H, uint64_t, &H::totalLatency>,
+        Member<H, etl::array<uint32_t, H::BUCKET_COUNT>, &H::buckets>>;
+};
+
+} // namespace core
+
+namespace queue
+{
+
+/**
+ * \brief Exports the statistics of a queue without attaching a debugger, either as binary record,
+ * e.g. the content of a UDS data identifier, or as text, e.g. for a console command.
+ *
+ */
+struct QueueStatsExport
+{
+    using StatsSerializer     = core::Serializer<QueueStats, etl::endian::big>;
+    using HistogramSerializer = core::Serializer<LatencyHistogram, etl::endian::big>;
+
+    /**
+     * \brief The size of the binary record: all fields of QueueStats followed by all fields of
+     * LatencyHistogram in declaration order and big endian byte order.
+     */
+    static constexpr size_t SIZE = StatsSerializer::WIRE_SIZE + HistogramSerializer::WIRE_SIZE;
+
+    /**
+     * \brief Write the binary record of \param stats and \param histogram to \param destination.
+     *
+     * \return false if \param destination is smaller than SIZE, otherwise true.
+     */
+    static bool write(
+        QueueStats const& stats,
+        LatencyHistogram const& histogram,
+        etl::span<uint8_t> const destination)
+    {
+        if (destination.size() < SIZE)
+        {
+            return false;
+        }
+        (void)StatsSerializer::serialize(stats, destination);
+        return HistogramSerializer::serialize(
+            histogram, destination.subspan(StatsSerializer::WIRE_SIZE));
+    }
+
+    /**
+     * \brief Print \param stats and \param histogram of the queue \param name as text.
+     * \details Only non-empty buckets are printed, with the largest latency they count.
+     *
+     * \tparam Writer a type providing printf(), e.g. util::format::StringWriter.
+     */
+    template<typename Writer>
+    static void print(
+        Writer& writer,
+        char const* const name,
+        QueueStats const& stats,
+        LatencyHistogram const& histogram)
+    {
+        (void)writer.printf(
+            "%s: processed %u, lost %u, max load %u, startup load %u, max fill rate %u\n",
+            name,
+            toUnsigned(stats.processedMessages),
+            toUnsigned(stats.lostMessages),
+            toUnsigned(stats.maxLoad),
+            toUnsigned(stats.startupLoad),
+            toUnsigned(stats.maxFillRate));
+        if (histogram.count == 0U)
+        {
+            return;
+        }
+        (void)writer.printf(
+            "%s: latency count %u, min %u, mean %u, max %u ticks\n",
+            name,
+            toUnsigned(histogram.count),
+            toUnsigned(histogram.minLatency),
+            toUnsigned(static_cast<uint32_t>(histogram.totalLatency / histogram.count)),
+            toUnsigned(histogram.maxLatency));
+        for (size_t i = 0U; i < LatencyHistogram::BUCKET_COUNT; ++i)
+        {
+            if (histogram.buckets[i] == 0U)
+            {
+                continue;
+            }
+            if (i < (LatencyHistogram::BUCKET_COUNT - 1U))
+            {
+                (void)writer.printf(
+                    "%s:   <= %u: %u\n",
+                    name,
+                    toUnsigned(LatencyHistogram::getUpperBound(i)),
+                    toUnsigned(histogram.buckets[i]));
+            }
+            else
+            {
+                (void)writer.printf(
+                    "%s:   > %u: %u\n",
+                    name,
+                    toUnsigned(LatencyHistogram::getUpperBound(i - 1U)),
+                    toUnsigned(histogram.buckets[i]));
+            }
+        }
+    }
+
+private:
+    static unsigned int toUnsigned(uint32_t const value) { return static_cast<unsigned int>(value); }
+};
+
+} // namespace queue
+} // namespace middleware
@@ -0,0 +1,217 @@
+// Copyright 2025 BMW AG
+
+#include "middleware/core/MessageAllocator.h"
+
+#include <gtest/gtest.h>
+
+#include <thread>
+#include <vector>
+
+namespace middleware
+{
+namespace core
+{
+namespace test
+{
+
+using TestAllocator = PayloadAllocator<64U, 4U>;
+
+uint16_t const BLOCK_COUNT = TestAllocator::BLOCK_COUNT;
+size_t const BLOCK_SIZE    = TestAllocator::BLOCK_SIZE;
+
+class MiddlewareMessageAllocatorTest : public ::testing::Test
+{
+public:
+    MiddlewareMessageAllocatorTest() { _allocator.init(); }
+
+protected:
+    static Message createMessage() { return Message::createEvent(0x0100U, 0x8001U, 1U, 0xA0U); }
+
+    TestAllocator _allocator;
+};
+
+/**
+ * \brief Test that an allocated payload is attached to the message as unique external payload
+ *
+ */
+TEST_F(MiddlewareMessageAllocatorTest, TestAllocate)
+{
+    // ARRANGE
+    Message msg = createMessage();
+
+    // ACT
+    etl::span<uint8_t> const payload = _allocator.allocate(msg, 48U);
+
+    // ASSERT
+    ASSERT_EQ(payload.size(), 48U);
+    EXPECT_TRUE(msg.hasUniqueExternalPayload());
+    EXPECT_FALSE(msg.hasSharedExternalPayload());
+    payload[0]  = 0xAAU;
+    payload[47] = 0x55U;
+    etl::span<uint8_t const> const received = _allocator.getPayload(msg);
+    ASSERT_EQ(received.size(), 48U);
+    EXPECT_EQ(received.data(), payload.data());
+    EXPECT_EQ(received[0], 0xAAU);
+    EXPECT_EQ(received[47], 0x55U);
+
+    AllocatorStats const stats = _allocator.getStats();
+    EXPECT_EQ(stats.allocations, 1U);
+    EXPECT_EQ(stats.blocksInUse, 1U);
+    EXPECT_EQ(stats.maxBlocksInUse, 1U);
+}
+
+/**
+ * \brief Test that failing allocations are counted and leave the message untouched
+ *
+ */
+TEST_F(MiddlewareMessageAllocatorTest, TestAllocationFailures)
+{
+    // ARRANGE
+    Message const msg              = createMessage();
+    Message msgs[BLOCK_COUNT + 1U] = {msg, msg, msg, msg, msg};
+
+    // ACT && ASSERT
+    EXPECT_TRUE(_allocator.allocate(msgs[0], BLOCK_SIZE + 1U).empty());
+    EXPECT_TRUE(_allocator.allocate(msgs[0], 0U).empty());
+    for (uint16_t i = 0U; i < BLOCK_COUNT; ++i)
+    {
+        EXPECT_FALSE(_allocator.allocate(msgs[i], BLOCK_SIZE).empty());
+    }
+    EXPECT_TRUE(_allocator.allocate(msgs[BLOCK_COUNT], 1U).empty());
+    EXPECT_FALSE(msgs[BLOCK_COUNT].hasUniqueExternalPayload());
+
+    AllocatorStats const stats = _allocator.getStats();
+    EXPECT_EQ(stats.allocations, BLOCK_COUNT);
+    EXPECT_EQ(stats.allocationFailures, 3U);
+    EXPECT_EQ(stats.blocksInUse, BLOCK_COUNT);
+
+    // a released block can be allocated again
+    _allocator.release(msgs[1]);
+    EXPECT_FALSE(_allocator.allocate(msgs[BLOCK_COUNT], 1U).empty());
+}
+
+/**
+ * \brief Test that a shared payload is freed with the release of the last receiver
+ *
+ */
+TEST_F(MiddlewareMessageAllocatorTest, TestSharedPayloadFanOut)
+{
+    // ARRANGE
+    Message msg = createMessage();
+    ASSERT_FALSE(_allocator.allocate(msg, 40U).empty());
+
+    // ACT
+    ASSERT_TRUE(_allocator.share(msg, 2U));
+    Message receivers[3] = {msg, msg, msg};
+
+    // ASSERT
+    for (auto const& receiver : receivers)
+    {
+        EXPECT_TRUE(receiver.hasSharedExternalPayload());
+        EXPECT_FALSE(receiver.hasUniqueExternalPayload());
+        EXPECT_EQ(_allocator.getPayload(receiver).data(), _allocator.getPayload(msg).data());
+    }
+    _allocator.release(receivers[0]);
+    _allocator.release(receivers[1]);
+    EXPECT_TRUE(_allocator.getPayload(receivers[0]).empty());
+    EXPECT_EQ(_allocator.getStats().blocksInUse, 1U);
+    EXPECT_EQ(_allocator.getStats().releases, 0U);
+    _allocator.release(receivers[2]);
+    EXPECT_EQ(_allocator.getStats().blocksInUse, 0U);
+    EXPECT_EQ(_allocator.getStats().releases, 1U);
+}
+
+/**
+ * \brief Test that releases of messages without a valid payload are counted
+ *
+ */
+TEST_F(MiddlewareMessageAllocatorTest, TestInvalidRelease)
+{
+    // ARRANGE
+    Message msg = createMessage();
+    ASSERT_FALSE(_allocator.allocate(msg, 40U).empty());
+    Message copy = msg;
+
+    // ACT
+    _allocator.release(msg);
+    _allocator.release(msg);
+    _allocator.release(copy);
+
+    // ASSERT
+    AllocatorStats const stats = _allocator.getStats();
+    EXPECT_EQ(stats.releases, 1U);
+    EXPECT_EQ(stats.invalidReleases, 2U);
+    EXPECT_EQ(stats.blocksInUse, 0U);
+    EXPECT_FALSE(_allocator.share(msg, 1U));
+}
+
+/**
+ * \brief Test that resetting the statistics keeps the blocks in use
+ *
+ */
+TEST_F(MiddlewareMessageAllocatorTest, TestResetStats)
+{
+    // ARRANGE
+    Message msg1 = createMessage();
+    Message msg2 = createMessage();
+    ASSERT_FALSE(_allocator.allocate(msg1, 40U).empty());
+    ASSERT_FALSE(_allocator.allocate(msg2, 40U).empty());
+    _allocator.release(msg2);
+
+    // ACT
+    _allocator.resetStats();
+
+    // ASSERT
+    AllocatorStats const stats = _allocator.getStats();
+    EXPECT_EQ(stats.allocations, 0U);
+    EXPECT_EQ(stats.releases, 0U);
+    EXPECT_EQ(stats.blocksInUse, 1U);
+    EXPECT_EQ(stats.maxBlocksInUse, 1U);
+}
+
+/**
+ * \brief Test concurrent allocations and releases from several threads
+ *
+ */
+TEST_F(MiddlewareMessageAllocatorTest, TestConcurrentUse)
+{
+    // ARRANGE
+    size_t const threadCount    = 4U;
+    uint32_t const iterations   = 10000U;
+    auto const allocateReleases = [this]()
+    {
+        for (uint32_t i = 0U; i < iterations; ++i)
+        {
+            Message msg                      = createMessage();
+            etl::span<uint8_t> const payload = _allocator.allocate(msg, 33U);
+            if (!payload.empty())
+            {
+                payload[0] = static_cast<uint8_t>(i);
+                _allocator.release(msg);
+            }
+        }
+    };
+
+    // ACT
+    std::vector<std::thread> threads;
+    for (size_t i = 0U; i < threadCount; ++i)
+    {
+        threads.emplace_back(allocateReleases);
+    }
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    // ASSERT
+    AllocatorStats const stats = _allocator.getStats();
+    EXPECT_EQ(stats.allocations + stats.allocationFailures, threadCount * iterations);
+    EXPECT_EQ(stats.releases, stats.allocations);
+    EXPECT_EQ(stats.invalidReleases, 0U);
+    EXPECT_EQ(stats.blocksInUse, 0U);
+    EXPECT_LE(stats.maxBlocksInUse, BLOCK_COUNT);
+}
+
+} // namespace test
+} // namespace core
+} // namespace middleware
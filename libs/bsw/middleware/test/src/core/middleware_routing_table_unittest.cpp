@@ -0,0 +1,106 @@
+// Copyright 2025 BMW AG
+
+#include "middleware/core/RoutingTable.h"
+#include "middleware/core/types.h"
+
+#include <gtest/gtest.h>
+
+namespace middleware
+{
+namespace core
+{
+namespace test
+{
+
+struct TestManifest
+{
+    static constexpr etl::array<RouteKey, 4U> routes()
+    {
+        return {{
+            {0x0100U, 1U, 0x8001U, 0U},
+            {0x0100U, 2U, 0x8001U, 0U},
+            {0x0100U, 1U, 0x0001U, 3U},
+            {0x0FD9U, 1U, 0x8001U, INVALID_ADDRESS_ID},
+        }};
+    }
+};
+
+using TestRoutingTable = StaticRoutingTable<TestManifest>;
+
+constexpr uint16_t INVALID_ROUTE = TestRoutingTable::TableType::INVALID_ROUTE;
+
+// the table is built and can be queried at compile time
+static_assert(TestRoutingTable::ROUTE_COUNT == 4U, "");
+static_assert(TestRoutingTable::TableType::SLOT_COUNT == 8U, "");
+static_assert(TestRoutingTable::TABLE.find(RouteKey{0x0100U, 2U, 0x8001U, 0U}) == 1U, "");
+static_assert(
+    TestRoutingTable::TABLE.find(RouteKey{0x0100U, 3U, 0x8001U, 0U}) == INVALID_ROUTE, "");
+
+constexpr etl::array<RouteKey, 3U> DUPLICATED_ROUTES{{
+    {0x0100U, 1U, 0x8001U, 0U},
+    {0x0200U, 1U, 0x8001U, 0U},
+    {0x0100U, 1U, 0x8001U, 0U},
+}};
+static_assert(RoutingTable<3U>(DUPLICATED_ROUTES).hasDuplicates(), "");
+
+/**
+ * \brief Generates a manifest with many services, each having several members and instances.
+ *
+ */
+constexpr etl::array<RouteKey, 512U> createLargeManifest()
+{
+    etl::array<RouteKey, 512U> routes{};
+    for (size_t i = 0U; i < routes.size(); ++i)
+    {
+        routes[i] = RouteKey{
+            static_cast<uint16_t>(0x0100U + (i / 8U)),
+            static_cast<uint16_t>(1U + (i % 2U)),
+            static_cast<uint16_t>(0x8000U + ((i / 2U) % 4U)),
+            static_cast<uint8_t>(i % 3U)};
+    }
+    return routes;
+}
+
+constexpr RoutingTable<512U> LARGE_TABLE{createLargeManifest()};
+
+/**
+ * \brief Test that messages are resolved to the position of their route in the manifest
+ *
+ */
+TEST(MiddlewareRoutingTableTest, TestFindMessage)
+{
+    // ARRANGE
+    Message const event    = Message::createEvent(0x0FD9U, 0x8001U, 1U, 0xA0U);
+    Message const request
+        = Message::createRequest(0x0100U, 0x0001U, 0x0010U, 1U, 0xA0U, 0x10U, 3U);
+    Message const unrouted = Message::createEvent(0x0FD9U, 0x8002U, 1U, 0xA0U);
+
+    // ACT && ASSERT
+    EXPECT_EQ(TestRoutingTable::find(event), 3U);
+    EXPECT_EQ(TestRoutingTable::find(request), 2U);
+    EXPECT_EQ(TestRoutingTable::find(unrouted), INVALID_ROUTE);
+}
+
+/**
+ * \brief Test that all routes of a large manifest are found with a short probe sequence
+ *
+ */
+TEST(MiddlewareRoutingTableTest, TestLargeManifest)
+{
+    // ARRANGE
+    etl::array<RouteKey, 512U> const routes = createLargeManifest();
+
+    // ACT && ASSERT
+    EXPECT_FALSE(LARGE_TABLE.hasDuplicates());
+    EXPECT_LE(LARGE_TABLE.getMaxProbe(), 16U);
+    for (size_t i = 0U; i < routes.size(); ++i)
+    {
+        EXPECT_EQ(LARGE_TABLE.find(routes[i]), i);
+    }
+    EXPECT_EQ(LARGE_TABLE.find(RouteKey{0x0100U, 1U, 0x8000U, 1U}), INVALID_ROUTE);
+    EXPECT_EQ(LARGE_TABLE.find(RouteKey{0x0500U, 1U, 0x8000U, 0U}), INVALID_ROUTE);
+}
+
+} // namespace test
+} // namespace core
+} // namespace middleware
@@ -0,0 +1,240 @@
+// Copyright 2025 BMW AG
+
+#include "middleware/core/Serializer.h"
+
+#include "middleware/core/MessageAllocator.h"
+
+#include <gtest/gtest.h>
+
+namespace middleware
+{
+namespace core
+{
+namespace test
+{
+
+enum class Mode : uint8_t
+{
+    Off = 0U,
+    On  = 1U,
+};
+
+struct Position
+{
+    int16_t x;
+    int16_t y;
+};
+
+struct Status
+{
+    uint32_t timestamp;
+    Mode mode;
+    Position position;
+    float speed;
+};
+
+struct Trace
+{
+    uint16_t count;
+    etl::array<Position, 16U> positions;
+    etl::array<uint8_t, 7U> name;
+};
+
+} // namespace test
+
+template<>
+struct PayloadLayout<test::Position>
+{
+    using Members = MemberList<
+        Member<test::Position, int16_t, &test::Position::x>,
+        Member<test::Position, int16_t, &test::Position::y>>;
+};
+
+template<>
+struct PayloadLayout<test::Status>
+{
+    using Members = MemberList<
+        Member<test::Status, uint32_t, &test::Status::timestamp>,
+        Member<test::Status, test::Mode, &test::Status::mode>,
+        Member<test::Status, test::Position, &test::Status::position>,
+        Member<test::Status, float, &test::Status::speed>>;
+};
+
+template<>
+struct PayloadLayout<test::Trace>
+{
+    using Members = MemberList<
+        Member<test::Trace, uint16_t, &test::Trace::count>,
+        Member<test::Trace, etl::array<test::Position, 16U>, &test::Trace::positions>,
+        Member<test::Trace, etl::array<uint8_t, 7U>, &test::Trace::name>>;
+};
+
+namespace test
+{
+
+// the wire size doesn't contain any padding
+static_assert(Serializer<Position>::WIRE_SIZE == 4U, "");
+static_assert(Serializer<Status>::WIRE_SIZE == 13U, "");
+static_assert(Serializer<Status>::IS_INLINE, "");
+static_assert(Serializer<Trace>::WIRE_SIZE == 73U, "");
+static_assert(!Serializer<Trace>::IS_INLINE, "");
+static_assert(internal::WireFormat<etl::array<uint32_t, 4U>, etl::endian::native>::IS_MEMCPY, "");
+
+using TestAllocator = PayloadAllocator<128U, 2U>;
+
+class MiddlewareSerializerTest : public ::testing::Test
+{
+protected:
+    static Message createMessage() { return Message::createEvent(0x0100U, 0x8001U, 1U, 0xA0U); }
+};
+
+/**
+ * \brief Test that values are stored in the requested byte order
+ *
+ */
+TEST_F(MiddlewareSerializerTest, TestByteOrder)
+{
+    // ARRANGE
+    etl::array<uint8_t, 6U> buffer{};
+    Position const position{0x0102, -2};
+
+    // ACT && ASSERT
+    EXPECT_TRUE((Serializer<uint32_t, etl::endian::big>::serialize(0x01020304U, buffer)));
+    EXPECT_EQ(buffer[0], 0x01U);
+    EXPECT_EQ(buffer[3], 0x04U);
+    EXPECT_TRUE((Serializer<uint32_t, etl::endian::little>::serialize(0x01020304U, buffer)));
+    EXPECT_EQ(buffer[0], 0x04U);
+    EXPECT_EQ(buffer[3], 0x01U);
+
+    EXPECT_TRUE((Serializer<Position, etl::endian::big>::serialize(position, buffer)));
+    EXPECT_EQ(buffer[0], 0x01U);
+    EXPECT_EQ(buffer[1], 0x02U);
+    EXPECT_EQ(buffer[2], 0xFFU);
+    EXPECT_EQ(buffer[3], 0xFEU);
+    Position result{};
+    EXPECT_TRUE((Serializer<Position, etl::endian::big>::deserialize(buffer, result)));
+    EXPECT_EQ(result.x, 0x0102);
+    EXPECT_EQ(result.y, -2);
+
+    EXPECT_FALSE(Serializer<Status>::serialize(Status{}, buffer));
+    EXPECT_FALSE(Serializer<Status>::deserialize(buffer, *reinterpret_cast<Status*>(&result)));
+}
+
+/**
+ * \brief Test that small values are serialized into the internal buffer of the message
+ *
+ */
+TEST_F(MiddlewareSerializerTest, TestInlinePayload)
+{
+    // ARRANGE
+    TestAllocator allocator;
+    allocator.init();
+    Message msg = createMessage();
+    Status const status{123456U, Mode::On, {10, -20}, 1.5F};
+
+    // ACT
+    EXPECT_TRUE(MessageSerializer::write(msg, status, allocator));
+
+    // ASSERT
+    EXPECT_FALSE(msg.hasUniqueExternalPayload());
+    EXPECT_EQ(allocator.getStats().allocations, 0U);
+    Status result{};
+    EXPECT_TRUE(MessageSerializer::read(msg, result, allocator));
+    EXPECT_EQ(result.timestamp, 123456U);
+    EXPECT_EQ(result.mode, Mode::On);
+    EXPECT_EQ(result.position.x, 10);
+    EXPECT_EQ(result.position.y, -20);
+    EXPECT_EQ(result.speed, 1.5F);
+
+    Status big{};
+    EXPECT_TRUE((MessageSerializer::read<Status, etl::endian::big>(msg, big)));
+    EXPECT_NE(big.timestamp, 123456U);
+}
+
+/**
+ * \brief Test that large values are serialized into an external payload
+ *
+ */
+TEST_F(MiddlewareSerializerTest, TestExternalPayload)
+{
+    // ARRANGE
+    TestAllocator allocator;
+    allocator.init();
+    Message msg = createMessage();
+    Trace trace{};
+    trace.count = 16U;
+    for (uint16_t i = 0U; i < trace.positions.size(); ++i)
+    {
+        trace.positions[i] = Position{static_cast<int16_t>(i), static_cast<int16_t>(-i)};
+    }
+    trace.name = {{'s', 'e', 'n', 's', 'o', 'r', '1'}};
+
+    // ACT
+    EXPECT_TRUE(MessageSerializer::write(msg, trace, allocator));
+
+    // ASSERT
+    EXPECT_TRUE(msg.hasUniqueExternalPayload());
+    EXPECT_EQ(allocator.getPayload(msg).size(), Serializer<Trace>::WIRE_SIZE);
+    Trace result{};
+    EXPECT_TRUE(MessageSerializer::read(msg, result, allocator));
+    EXPECT_EQ(result.count, 16U);
+    EXPECT_EQ(result.positions[15].x, 15);
+    EXPECT_EQ(result.positions[15].y, -15);
+    EXPECT_EQ(result.name[6], '1');
+
+    // a message without external payload can't be read
+    Message inlineMsg = createMessage();
+    EXPECT_FALSE(MessageSerializer::read(inlineMsg, result, allocator));
+    EXPECT_FALSE(MessageSerializer::read(msg, *reinterpret_cast<Status*>(&result)));
+}
+
+/**
+ * \brief Test that writing to a message releases the external payload it references
+ *
+ */
+TEST_F(MiddlewareSerializerTest, TestWriteReleasesExternalPayload)
+{
+    // ARRANGE
+    TestAllocator allocator;
+    allocator.init();
+    Message msg = createMessage();
+    Trace const trace{};
+    Status const status{};
+
+    // ACT && ASSERT
+    EXPECT_TRUE(MessageSerializer::write(msg, trace, allocator));
+    EXPECT_TRUE(MessageSerializer::write(msg, trace, allocator));
+    EXPECT_EQ(allocator.getStats().blocksInUse, 1U);
+    EXPECT_THROW(MessageSerializer::write(msg, status), ::etl::exception);
+    EXPECT_EQ(allocator.getStats().blocksInUse, 1U);
+
+    EXPECT_TRUE(MessageSerializer::write(msg, status, allocator));
+    EXPECT_FALSE(msg.hasUniqueExternalPayload());
+    EXPECT_EQ(allocator.getStats().blocksInUse, 0U);
+    EXPECT_EQ(allocator.getStats().invalidReleases, 0U);
+}
+
+/**
+ * \brief Test that writing fails if no external payload can be allocated
+ *
+ */
+TEST_F(MiddlewareSerializerTest, TestAllocationFailure)
+{
+    // ARRANGE
+    TestAllocator allocator;
+    allocator.init();
+    Message msg1 = createMessage();
+    Message msg2 = createMessage();
+    Message msg3 = createMessage();
+    Trace const trace{};
+
+    // ACT && ASSERT
+    EXPECT_TRUE(MessageSerializer::write(msg1, trace, allocator));
+    EXPECT_TRUE(MessageSerializer::write(msg2, trace, allocator));
+    EXPECT_FALSE(MessageSerializer::write(msg3, trace, allocator));
+    EXPECT_EQ(allocator.getStats().allocationFailures, 1U);
+}
+
+} // namespace test
+} // namespace core
+} // namespace middleware
@@ -0,0 +1,212 @@
+// Copyright 2025 BMW AG
+
+#include "middleware/queue/LatencyHistogram.h"
+#include "middleware/queue/Queue.h"
+#include "middleware/queue/QueueStatsExport.h"
+
+#include <gtest/gtest.h>
+
+#include <cstdarg>
+#include <cstdio>
+#include <string>
+
+namespace middleware
+{
+namespace queue
+{
+namespace test
+{
+
+struct FakeLock
+{
+    FakeLock(void volatile*) {}
+};
+
+struct FakeTimestamp
+{
+    static uint32_t now() { return ticks; }
+
+    static uint32_t ticks;
+};
+
+uint32_t FakeTimestamp::ticks = 0U;
+
+/// Writer collecting the printed text, like util::format::StringWriter.
+struct StringPrinter
+{
+    StringPrinter& printf(char const* const format, ...)
+    {
+        char line[128];
+        va_list ap;
+        va_start(ap, format);
+        (void)vsnprintf(line, sizeof(line), format, ap);
+        va_end(ap);
+        text += line;
+        return *this;
+    }
+
+    std::string text;
+};
+
+using TimedQueue       = Queue<QueueTraits<uint32_t, 8U, void, uint8_t, FakeTimestamp>>;
+using TimedLockedQueue = Queue<QueueTraits<uint32_t, 8U, FakeLock, uint8_t, FakeTimestamp>>;
+using UntimedQueue     = Queue<QueueTraits<uint32_t, 8U>>;
+
+TEST(TestQueueLatency, HistogramBuckets)
+{
+    EXPECT_EQ(LatencyHistogram::getBucket(0U), 0U);
+    EXPECT_EQ(LatencyHistogram::getBucket(1U), 1U);
+    EXPECT_EQ(LatencyHistogram::getBucket(2U), 2U);
+    EXPECT_EQ(LatencyHistogram::getBucket(3U), 2U);
+    EXPECT_EQ(LatencyHistogram::getBucket(4U), 3U);
+    EXPECT_EQ(LatencyHistogram::getBucket(16383U), 14U);
+    EXPECT_EQ(LatencyHistogram::getBucket(16384U), 15U);
+    EXPECT_EQ(LatencyHistogram::getBucket(UINT32_MAX), 15U);
+    EXPECT_EQ(LatencyHistogram::getUpperBound(0U), 0U);
+    EXPECT_EQ(LatencyHistogram::getUpperBound(3U), 7U);
+    EXPECT_EQ(LatencyHistogram::getUpperBound(15U), UINT32_MAX);
+
+    LatencyHistogram histogram{};
+    histogram.add(5U);
+    histogram.add(2U);
+    histogram.add(100U);
+    EXPECT_EQ(histogram.count, 3U);
+    EXPECT_EQ(histogram.minLatency, 2U);
+    EXPECT_EQ(histogram.maxLatency, 100U);
+    EXPECT_EQ(histogram.totalLatency, 107U);
+    EXPECT_EQ(histogram.buckets[2], 1U);
+    EXPECT_EQ(histogram.buckets[3], 1U);
+    EXPECT_EQ(histogram.buckets[7], 1U);
+    histogram.reset();
+    EXPECT_EQ(histogram.count, 0U);
+    EXPECT_EQ(histogram.buckets[7], 0U);
+}
+
+TEST(TestQueueLatency, SingleElements)
+{
+    TimedQueue t;
+    t.init();
+    TimedQueue::Sender writer(t);
+    TimedQueue::Receiver receiver(t);
+
+    FakeTimestamp::ticks = 1000U;
+    writer.write(1U);
+    FakeTimestamp::ticks = 1003U;
+    writer.write(2U);
+    FakeTimestamp::ticks = 1010U;
+    receiver.advance();
+    receiver.advance();
+
+    LatencyHistogram const histogram = t.getLatencyHistogram();
+    EXPECT_EQ(histogram.count, 2U);
+    EXPECT_EQ(histogram.minLatency, 7U);
+    EXPECT_EQ(histogram.maxLatency, 10U);
+    EXPECT_EQ(histogram.buckets[3], 1U);
+    EXPECT_EQ(histogram.buckets[4], 1U);
+
+    t.resetStats();
+    EXPECT_EQ(t.getLatencyHistogram().count, 0U);
+}
+
+TEST(TestQueueLatency, BatchesAndWrappingTimestamps)
+{
+    TimedQueue t;
+    t.init();
+    TimedQueue::Sender writer(t);
+    TimedQueue::Receiver receiver(t);
+
+    // the timestamps wrap around while the elements are queued
+    FakeTimestamp::ticks = UINT32_MAX - 1U;
+    ASSERT_EQ(writer.reserve(3U), 3U);
+    writer.reserved(0U) = 1U;
+    writer.reserved(1U) = 2U;
+    writer.reserved(2U) = 3U;
+    writer.publish(3U);
+    FakeTimestamp::ticks = 2U;
+    receiver.advance(3U);
+
+    LatencyHistogram const histogram = t.getLatencyHistogram();
+    EXPECT_EQ(histogram.count, 3U);
+    EXPECT_EQ(histogram.minLatency, 4U);
+    EXPECT_EQ(histogram.maxLatency, 4U);
+    EXPECT_EQ(histogram.buckets[3], 3U);
+}
+
+TEST(TestQueueLatency, LockedQueue)
+{
+    TimedLockedQueue t;
+    t.init();
+    TimedLockedQueue::Sender writer(t);
+    TimedLockedQueue::Receiver receiver(t);
+
+    uint32_t const values[] = {1U, 2U};
+    FakeTimestamp::ticks    = 50U;
+    EXPECT_EQ(writer.write(etl::span<uint32_t const>(values)), 2U);
+    FakeTimestamp::ticks = 50U;
+    receiver.advance(2U);
+
+    EXPECT_EQ(t.getLatencyHistogram().count, 2U);
+    EXPECT_EQ(t.getLatencyHistogram().buckets[0], 2U);
+}
+
+TEST(TestQueueLatency, NoTimestampSource)
+{
+    static_assert(!UntimedQueue::Latency::IS_ENABLED, "");
+    static_assert(TimedQueue::Latency::IS_ENABLED, "");
+
+    UntimedQueue t;
+    t.init();
+    UntimedQueue::Sender(t).write(1U);
+    UntimedQueue::Receiver(t).advance();
+
+    EXPECT_EQ(t.getStats().processedMessages, 1U);
+    EXPECT_EQ(t.getLatencyHistogram().count, 0U);
+}
+
+TEST(TestQueueLatency, BinaryExport)
+{
+    size_t const exportSize = QueueStatsExport::SIZE;
+    EXPECT_EQ(exportSize, 124U);
+
+    QueueStats stats{};
+    stats.processedMessages = 0x01020304U;
+    stats.maxFillRate       = 0x0A0B0C0DU;
+    LatencyHistogram histogram{};
+    histogram.add(3U);
+    uint8_t buffer[124U] = {};
+
+    EXPECT_FALSE(QueueStatsExport::write(stats, histogram, etl::span<uint8_t>(buffer, 123U)));
+    EXPECT_TRUE(QueueStatsExport::write(stats, histogram, buffer));
+    EXPECT_EQ(buffer[0], 0x01U);
+    EXPECT_EQ(buffer[3], 0x04U);
+    EXPECT_EQ(buffer[36], 0x0AU);
+    EXPECT_EQ(buffer[39], 0x0DU);
+    // histogram count
+    EXPECT_EQ(buffer[43], 1U);
+    // bucket 2
+    EXPECT_EQ(buffer[40 + 20 + 8 + 3], 1U);
+}
+
+TEST(TestQueueLatency, PrintStats)
+{
+    QueueStats stats{};
+    stats.processedMessages = 3U;
+    LatencyHistogram histogram{};
+    histogram.add(3U);
+    histogram.add(3U);
+    histogram.add(100000U);
+    StringPrinter printer;
+
+    QueueStatsExport::print(printer, "q", stats, histogram);
+
+    EXPECT_EQ(
+        printer.text,
+        "q: processed 3, lost 0, max load 0, startup load 0, max fill rate 0\n"
+        "q: latency count 3, min 3, mean 33335, max 100000 ticks\n"
+        "q:   <= 3: 2\n"
+        "q:   > 16383: 1\n");
+}
+
+} // namespace test
+} // namespace queue
+} // namespace middleware
@@ -4,6 +4,8 @@
 
 #include <gtest/gtest.h>
 
+#include <thread>
+
 namespace middleware
 {
 namespace queue
@@ -187,6 +189,135 @@ TEST(TestQueue, LostMessagesTestNoLockSpecialization)
     }
 }
 
+TEST(TestQueue, BatchedWriteTest)
+{
+    TestQueue t;
+    t.init();
+
+    etl::array<uint32_t, 60U> values;
+    for (uint32_t i = 0U; i < values.size(); ++i)
+    {
+        values[i] = i;
+    }
+    TestQueue::Sender writer(t);
+    EXPECT_EQ(writer.write(values), 60U);
+    EXPECT_EQ(writer.write(values), 40U);
+    EXPECT_TRUE(t.isFull());
+    EXPECT_EQ(t.getStats().maxLoad, 100U);
+    EXPECT_EQ(t.getStats().lostMessages, 20U);
+    EXPECT_EQ(t.getStats().startupLoad, 100U);
+
+    TestQueue::Receiver receiver(t);
+    EXPECT_EQ(receiver.peek(59U), 59U);
+    EXPECT_EQ(receiver.peek(60U), 0U);
+    EXPECT_EQ(receiver.peek(99U), 39U);
+    receiver.advance(70U);
+    EXPECT_EQ(t.size(), 30U);
+    EXPECT_EQ(receiver.peek(), 10U);
+    EXPECT_EQ(t.getStats().processedMessages, 70U);
+
+    // elements wrap around the end of the buffer
+    EXPECT_EQ(writer.write(etl::span<uint32_t const>(values.data(), 50U)), 50U);
+    EXPECT_EQ(t.getStats().startupLoad, 100U);
+    EXPECT_EQ(t.size(), 80U);
+    EXPECT_EQ(receiver.peek(30U), 0U);
+    EXPECT_EQ(receiver.peek(79U), 49U);
+}
+
+TEST(TestQueue, ReserveAndPublishTestNoLockSpecialization)
+{
+    TestQueueNoLockSpecialization t;
+    t.init();
+
+    TestQueueNoLockSpecialization::Sender writer(t);
+    TestQueueNoLockSpecialization::Receiver receiver(t);
+    EXPECT_EQ(writer.reserve(120U), 100U);
+    EXPECT_EQ(writer.reserve(10U), 10U);
+    for (uint32_t i = 0U; i < 10U; ++i)
+    {
+        writer.reserved(i) = i + 1U;
+    }
+    // nothing is visible before publishing
+    EXPECT_TRUE(t.isEmpty());
+    writer.publish(10U);
+    EXPECT_EQ(t.size(), 10U);
+    EXPECT_EQ(t.getStats().maxLoad, 10U);
+    EXPECT_EQ(t.getStats().lostMessages, 0U);
+    EXPECT_EQ(receiver.peek(), 1U);
+    EXPECT_EQ(receiver.peek(9U), 10U);
+    receiver.advance(10U);
+    EXPECT_TRUE(t.isEmpty());
+    EXPECT_EQ(t.getStats().processedMessages, 10U);
+}
+
+TEST(TestQueue, ProducerAndConsumerThreadsNoLockSpecialization)
+{
+    TestQueueNoLockSpecialization t;
+    t.init();
+
+    uint32_t const count = 10000U;
+    std::thread producer(
+        [&t, count]()
+        {
+            TestQueueNoLockSpecialization::Sender writer(t);
+            uint32_t next = 0U;
+            while (next < count)
+            {
+                uint32_t const reserved = writer.reserve(count - next);
+                for (uint32_t i = 0U; i < reserved; ++i)
+                {
+                    writer.reserved(i) = next + i;
+                }
+                writer.publish(reserved);
+                next += reserved;
+                std::this_thread::yield();
+            }
+        });
+
+    TestQueueNoLockSpecialization::Receiver receiver(t);
+    uint32_t expected = 0U;
+    bool inOrder      = true;
+    while (expected < count)
+    {
+        uint32_t const available = receiver.size();
+        for (uint32_t i = 0U; i < available; ++i)
+        {
+            inOrder = inOrder && (receiver.peek(i) == (expected + i));
+        }
+        receiver.advance(available);
+        expected += available;
+        std::this_thread::yield();
+    }
+    producer.join();
+    EXPECT_TRUE(inOrder);
+    EXPECT_TRUE(t.isEmpty());
+    EXPECT_EQ(t.getStats().processedMessages, count);
+    EXPECT_EQ(t.getStats().lostMessages, 0U);
+}
+
+TEST(TestQueue, WideStatisticsNoLockSpecialization)
+{
+    using LargeQueue = Queue<QueueTraits<uint32_t, 1000U>>;
+    LargeQueue t;
+    t.init();
+
+    LargeQueue::Sender writer(t);
+    for (uint32_t i = 0U; i < 600U; ++i)
+    {
+        writer.write(i);
+    }
+    t.takeSnapshot();
+    EXPECT_EQ(t.getStats().maxLoad, 600U);
+    EXPECT_EQ(t.getStats().startupLoad, 600U);
+    EXPECT_EQ(t.getStats().maxFillRate, 600U);
+    for (uint32_t i = 0U; i < 200U; ++i)
+    {
+        t.takeSnapshot();
+    }
+    EXPECT_EQ(t.getStats().loadSnapshot, 201U * 600U);
+    EXPECT_EQ(t.getStats().processingCounter, 201U);
+}
+
 TEST(TestQueue, ExternalMutexTest)
 {
     uint8_t volatile queue_mutex{
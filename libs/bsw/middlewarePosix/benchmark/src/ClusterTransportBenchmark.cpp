@@ -0,0 +1,200 @@
+// Copyright 2025 BMW AG
+
+#include "middleware/posix/ClusterTransport.h"
+
+#include <benchmark/benchmark.h>
+
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include <string>
+
+namespace
+{
+using Memory    = ::middleware::posix::ClusterMemory<64U, 1024U, 16U, 2U>;
+using Transport = ::middleware::posix::ClusterTransport<Memory>;
+using Message   = ::middleware::core::Message;
+
+uint8_t const CLUSTER_A              = 0U;
+uint8_t const CLUSTER_B              = 1U;
+uint16_t const MEMBER_STOP           = 0U;
+uint16_t const MEMBER_PING           = 1U;
+uint16_t const MEMBER_DATA           = 2U;
+uint32_t const WAIT_TIMEOUT          = 1000000U;
+uint32_t const MESSAGES_PER_TRANSFER = 1024U;
+
+Message createEvent(uint8_t const source, uint8_t const target, uint16_t const memberId)
+{
+    Message msg = Message::createEvent(0x0100U, memberId, 1U, source);
+    msg.setTargetClusterId(target);
+    return msg;
+}
+
+void sendBlocking(Transport& transport, Message const& message)
+{
+    while (!transport.send(message))
+    {
+        (void)sched_yield();
+    }
+}
+
+/**
+ * Cluster B running in a child process: answers each ping and acknowledges each complete
+ * transfer of data messages with a ping, until it receives a stop message.
+ */
+class Echo
+{
+public:
+    explicit Echo(Transport& transport) : _transport(transport) {}
+
+    void run()
+    {
+        while (_running)
+        {
+            if (_transport.waitForMessages(WAIT_TIMEOUT))
+            {
+                (void)_transport.receive(
+                    Transport::MessageHandler::create<Echo, &Echo::onMessage>(*this));
+            }
+        }
+    }
+
+private:
+    void onMessage(Message const& message)
+    {
+        uint16_t const memberId = message.getHeader().memberId;
+        if (memberId == MEMBER_STOP)
+        {
+            _running = false;
+        }
+        else if (memberId == MEMBER_PING)
+        {
+            sendBlocking(_transport, createEvent(CLUSTER_B, CLUSTER_A, MEMBER_PING));
+        }
+        else if (++_dataCount == MESSAGES_PER_TRANSFER)
+        {
+            _dataCount = 0U;
+            sendBlocking(_transport, createEvent(CLUSTER_B, CLUSTER_A, MEMBER_PING));
+        }
+    }
+
+    Transport& _transport;
+    uint32_t _dataCount = 0U;
+    bool _running       = true;
+};
+
+struct Counter
+{
+    void onMessage(Message const&) { ++_count; }
+
+    Transport::MessageHandler handler()
+    {
+        return Transport::MessageHandler::create<Counter, &Counter::onMessage>(*this);
+    }
+
+    uint32_t _count = 0U;
+};
+
+/**
+ * Creates the shared memory as cluster A and forks cluster B.
+ */
+class Clusters
+{
+public:
+    Clusters() : _name("/middlewareBenchmark" + std::to_string(getpid())), _transport(CLUSTER_A)
+    {
+        if (!_transport.create(_name.c_str()))
+        {
+            return;
+        }
+        _child = fork();
+        if (_child == 0)
+        {
+            Transport transport(CLUSTER_B);
+            if (transport.open(_name.c_str()))
+            {
+                Echo(transport).run();
+            }
+            _exit(0);
+        }
+    }
+
+    ~Clusters()
+    {
+        if (_child > 0)
+        {
+            sendBlocking(_transport, createEvent(CLUSTER_A, CLUSTER_B, MEMBER_STOP));
+            (void)waitpid(_child, nullptr, 0);
+        }
+    }
+
+    bool isValid() const { return _child > 0; }
+
+    void waitForAnswer()
+    {
+        Counter counter;
+        while (counter._count == 0U)
+        {
+            if (_transport.waitForMessages(WAIT_TIMEOUT))
+            {
+                (void)_transport.receive(counter.handler());
+            }
+        }
+    }
+
+    Transport& transport() { return _transport; }
+
+private:
+    std::string const _name;
+    Transport _transport;
+    pid_t _child = -1;
+};
+} // namespace
+
+/**
+ * Benchmarks the round trip latency of a message to a cluster in another process and back,
+ * including the wake-up of the sleeping receivers through the doorbells.
+ */
+void BM_cluster_round_trip(benchmark::State& state)
+{
+    Clusters clusters;
+    if (!clusters.isValid())
+    {
+        state.SkipWithError("shared memory not available");
+        return;
+    }
+    Message const ping = createEvent(CLUSTER_A, CLUSTER_B, MEMBER_PING);
+    for (auto _ : state)
+    {
+        sendBlocking(clusters.transport(), ping);
+        clusters.waitForAnswer();
+    }
+}
+
+BENCHMARK(BM_cluster_round_trip)->UseRealTime();
+
+/**
+ * Benchmarks the throughput of messages to a cluster in another process, which acknowledges each
+ * transfer of MESSAGES_PER_TRANSFER messages.
+ */
+void BM_cluster_throughput(benchmark::State& state)
+{
+    Clusters clusters;
+    if (!clusters.isValid())
+    {
+        state.SkipWithError("shared memory not available");
+        return;
+    }
+    Message const data = createEvent(CLUSTER_A, CLUSTER_B, MEMBER_DATA);
+    for (auto _ : state)
+    {
+        for (uint32_t i = 0U; i < MESSAGES_PER_TRANSFER; ++i)
+        {
+            sendBlocking(clusters.transport(), data);
+        }
+        clusters.waitForAnswer();
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * MESSAGES_PER_TRANSFER);
+}
+
+BENCHMARK(BM_cluster_throughput)->UseRealTime();
@@ -0,0 +1,263 @@
+// Copyright 2025 BMW AG
+
+#pragma once
+
+#include "middleware/core/Message.h"
+#include "middleware/core/MessageAllocator.h"
+#include "middleware/posix/Doorbell.h"
+#include "middleware/posix/SharedMemory.h"
+#include "middleware/posix/SpinLock.h"
+#include "middleware/queue/Queue.h"
+
+#include <etl/array.h>
+#include <etl/delegate.h>
+
+#include <new>
+
+namespace middleware
+{
+namespace posix
+{
+
+/**
+ * \brief Layout of the shared memory used by the clusters of a ClusterTransport.
+ * \details Each cluster owns a receive queue, which is written by all other clusters under a
+ * SpinLock, and a doorbell that is rung after writing to the queue. Payloads exceeding
+ * core::Message::MAX_PAYLOAD_SIZE are allocated from a payload allocator shared by all clusters.
+ *
+ * \tparam QueueSize the number of messages each receive queue can store.
+ * \tparam BlockSize the maximum size of an external payload in bytes.
+ * \tparam BlockCount the number of external payloads that can be allocated at the same time.
+ * \tparam ClusterCount the number of clusters, i.e. the range of valid cluster ids.
+ */
+template<uint16_t QueueSize, size_t BlockSize, uint16_t BlockCount, uint8_t ClusterCount>
+struct ClusterMemory
+{
+    using QueueType     = queue::Queue<queue::QueueTraits<core::Message, QueueSize, SpinLock>>;
+    using AllocatorType = core::PayloadAllocator<BlockSize, BlockCount>;
+
+    static constexpr uint8_t CLUSTER_COUNT = ClusterCount;
+    static uint32_t const READY            = 0x4D57434CU;
+
+    /**
+     * \brief Default constructor is intentionally empty, the memory is initialized by the init
+     * method of the creating process.
+     *
+     */
+    ClusterMemory() {}
+
+    /**
+     * \brief Initialize all queues, doorbells and the payload allocator, and mark the memory as
+     * ready to be opened by other processes.
+     *
+     */
+    void init()
+    {
+        for (auto& queue : queues)
+        {
+            queue.init();
+        }
+        for (auto& doorbell : doorbells)
+        {
+            doorbell.init();
+        }
+        allocator.init();
+        __atomic_store_n(&state, READY, __ATOMIC_RELEASE);
+    }
+
+    /**
+     * \brief Check if the memory has been initialized by the creating process.
+     *
+     * \return true if ready, otherwise false.
+     */
+    bool isReady() const { return __atomic_load_n(&state, __ATOMIC_ACQUIRE) == READY; }
+
+    uint32_t state;
+    etl::array<QueueType, ClusterCount> queues;
+    etl::array<Doorbell, ClusterCount> doorbells;
+    AllocatorType allocator;
+};
+
+/**
+ * \brief Transport of middleware messages between clusters living in separate processes.
+ * \details The queues and the payload region of a ClusterMemory are placed in POSIX shared memory,
+ * which is created by one process and opened by the others. Messages are routed by the target
+ * cluster id of their header. Since queues and external handles only contain indices and offsets,
+ * messages and payloads are exchanged without any translation, like between the cores of a
+ * multi-core SoC.
+ *
+ * \tparam Memory the layout of the shared memory, a ClusterMemory type.
+ */
+template<typename Memory>
+class ClusterTransport
+{
+public:
+    using QueueType      = typename Memory::QueueType;
+    using AllocatorType  = typename Memory::AllocatorType;
+    using MessageHandler = etl::delegate<void(core::Message const&)>;
+
+    /**
+     * \brief Constructs the transport of cluster \param clusterId, which receives the messages
+     * targeted to this id.
+     *
+     */
+    explicit ClusterTransport(uint8_t const clusterId)
+    : _sharedMemory(), _memory(nullptr), _clusterId(clusterId)
+    {}
+
+    /**
+     * \brief Create and initialize the shared memory \param name.
+     * \details Fails if the shared memory exists already. A stale object can be removed with
+     * SharedMemory::removeStale() before.
+     *
+     * \return true if successful, otherwise false.
+     */
+    bool create(char const* const name)
+    {
+        if ((_clusterId >= Memory::CLUSTER_COUNT) || !_sharedMemory.create(name, sizeof(Memory)))
+        {
+            return false;
+        }
+        _memory = new (_sharedMemory.getAddress()) Memory();
+        _memory->init();
+        return true;
+    }
+
+    /**
+     * \brief Open the shared memory \param name, which has been created by another process.
+     *
+     * \return true if successful, false if the memory doesn't exist or isn't initialized yet.
+     */
+    bool open(char const* const name)
+    {
+        if ((_clusterId >= Memory::CLUSTER_COUNT) || !_sharedMemory.open(name, sizeof(Memory)))
+        {
+            return false;
+        }
+        Memory* const memory = static_cast<Memory*>(_sharedMemory.getAddress());
+        if (!memory->isReady())
+        {
+            _sharedMemory.close();
+            return false;
+        }
+        _memory = memory;
+        return true;
+    }
+
+    /**
+     * \brief Unmap the shared memory, which is removed if it has been created by this transport.
+     *
+     */
+    void close()
+    {
+        _memory = nullptr;
+        _sharedMemory.close();
+    }
+
+    /**
+     * \brief Check if the transport is connected to the shared memory.
+     *
+     * \return true if open, otherwise false.
+     */
+    bool isOpen() const { return _memory != nullptr; }
+
+    /**
+     * \brief Get the cluster id of this transport.
+     *
+     * \return uint8_t
+     */
+    uint8_t getClusterId() const { return _clusterId; }
+
+    /**
+     * \brief Write \param message to the queue of its target cluster and ring the doorbell of
+     * that cluster.
+     * \details To send an external payload to several clusters, it has to be shared with
+     * AllocatorType::share() before sending the copies.
+     *
+     * \return true if the message has been written, false if the target cluster is invalid or its
+     * queue is full.
+     */
+    bool send(core::Message const& message)
+    {
+        uint8_t const target = message.getHeader().tgtClusterId;
+        if ((_memory == nullptr) || (target >= Memory::CLUSTER_COUNT))
+        {
+            return false;
+        }
+        if (!typename QueueType::Sender(_memory->queues[target]).write(message))
+        {
+            return false;
+        }
+        _memory->doorbells[target].ring();
+        return true;
+    }
+
+    /**
+     * \brief Pass all messages in the queue of this cluster to \param handler and release them
+     * afterwards at once.
+     *
+     * \return the number of received messages.
+     */
+    uint32_t receive(MessageHandler const handler)
+    {
+        if (_memory == nullptr)
+        {
+            return 0U;
+        }
+        QueueType& queue = _memory->queues[_clusterId];
+        queue.takeSnapshot();
+        typename QueueType::Receiver receiver(queue);
+        uint32_t const count = receiver.size();
+        for (uint32_t i = 0U; i < count; ++i)
+        {
+            handler(receiver.peek(i));
+        }
+        receiver.advance(count);
+        return count;
+    }
+
+    /**
+     * \brief Wait until the queue of this cluster contains messages.
+     *
+     * \param timeoutUs the maximum time to wait in microseconds.
+     * \return true if messages are available, false on timeout.
+     */
+    bool waitForMessages(uint32_t const timeoutUs)
+    {
+        if (_memory == nullptr)
+        {
+            return false;
+        }
+        QueueType const& queue  = _memory->queues[_clusterId];
+        Doorbell& doorbell      = _memory->doorbells[_clusterId];
+        uint32_t const sequence = doorbell.getSequence();
+        if (!queue.isEmpty())
+        {
+            return true;
+        }
+        (void)doorbell.wait(sequence, timeoutUs);
+        return !queue.isEmpty();
+    }
+
+    /**
+     * \brief Get the allocator for external payloads, which is shared by all clusters.
+     *
+     * \return AllocatorType&
+     */
+    AllocatorType& getAllocator() { return _memory->allocator; }
+
+    /**
+     * \brief Get a snapshot of the statistics of the queue of this cluster.
+     *
+     * \return queue::QueueStats
+     */
+    queue::QueueStats getStats() const { return _memory->queues[_clusterId].getStats(); }
+
+private:
+    SharedMemory _sharedMemory;
+    Memory* _memory;
+    uint8_t const _clusterId;
+};
+
+} // namespace posix
+} // namespace middleware
@@ -0,0 +1,59 @@
+// Copyright 2025 BMW AG
+
+#pragma once
+
+#include <cstdint>
+
+namespace middleware
+{
+namespace posix
+{
+
+/**
+ * \brief A doorbell placed in shared memory, which lets a process sleep until another process has
+ * rung it.
+ * \details The doorbell is a sequence counter used as futex word. Waiting processes block in the
+ * kernel until the counter differs from the value they have seen, ringing increments it and only
+ * issues a wake-up system call if a process is waiting. Like the queues, the default constructor
+ * is intentionally empty and the doorbell must be initialized with init() by a single process.
+ *
+ */
+class Doorbell
+{
+public:
+    Doorbell() {}
+
+    /**
+     * \brief Init method which needs to be called before doing any work with the doorbell.
+     *
+     */
+    void init();
+
+    /**
+     * \brief Get the current sequence, to be passed to wait() after checking for work.
+     *
+     * \return uint32_t
+     */
+    uint32_t getSequence() const;
+
+    /**
+     * \brief Wake up all processes waiting for the doorbell.
+     *
+     */
+    void ring();
+
+    /**
+     * \brief Wait until the doorbell has been rung after \param sequence has been read.
+     *
+     * \param timeoutUs the maximum time to wait in microseconds.
+     * \return true if the doorbell has been rung, false on timeout.
+     */
+    bool wait(uint32_t sequence, uint32_t timeoutUs);
+
+private:
+    uint32_t _sequence;
+    uint32_t _waiters;
+};
+
+} // namespace posix
+} // namespace middleware
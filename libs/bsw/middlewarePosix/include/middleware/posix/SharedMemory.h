@@ -0,0 +1,89 @@
+// Copyright 2025 BMW AG
+
+#pragma once
+
+#include <cstddef>
+
+namespace middleware
+{
+namespace posix
+{
+
+/**
+ * \brief A named POSIX shared memory object (shm_open) mapped into the address space of the
+ * process.
+ * \details The memory is mapped at a different address in each process, so objects placed in it
+ * must not contain pointers. The middleware queues and the payload allocator only use indices and
+ * offsets, which makes them suitable for being shared between processes.
+ *
+ */
+class SharedMemory
+{
+public:
+    SharedMemory();
+    SharedMemory(SharedMemory const&)            = delete;
+    SharedMemory& operator=(SharedMemory const&) = delete;
+    ~SharedMemory();
+
+    /**
+     * \brief Create the shared memory object \param name with \param size bytes and map it.
+     * \details The memory is zero-initialized. An existing object of the same name is never
+     * replaced, since it may still be in use by another process.
+     *
+     * \return true if the memory has been created and mapped, false if the object exists already
+     * or creating it failed.
+     */
+    bool create(char const* name, size_t size);
+
+    /**
+     * \brief Map the existing shared memory object \param name, which must provide at least
+     * \param size bytes.
+     *
+     * \return true if the memory has been mapped, otherwise false.
+     */
+    bool open(char const* name, size_t size);
+
+    /**
+     * \brief Remove the shared memory object \param name, e.g. one left behind by a process that
+     * terminated without closing it.
+     * \details Processes that have mapped the object keep their mapping, but the name can be used
+     * to create a new object. Must only be called if the object is known to be unused.
+     *
+     * \return true if the object has been removed, otherwise false.
+     */
+    static bool removeStale(char const* name);
+
+    /**
+     * \brief Unmap the memory. The shared memory object is removed if it has been created by
+     * this object.
+     *
+     */
+    void close();
+
+    /**
+     * \brief Get the address where the memory is mapped, nullptr if no memory is mapped.
+     *
+     * \return void*
+     */
+    void* getAddress() const { return _address; }
+
+    /**
+     * \brief Get the size of the mapped memory.
+     *
+     * \return size_t
+     */
+    size_t getSize() const { return _size; }
+
+private:
+    static size_t const MAX_NAME_LENGTH = 64U;
+
+    bool map(int fileDescriptor, size_t size);
+
+    void* _address;
+    size_t _size;
+    char _name[MAX_NAME_LENGTH];
+    bool _isOwner;
+};
+
+} // namespace posix
+} // namespace middleware
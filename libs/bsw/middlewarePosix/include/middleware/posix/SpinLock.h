@@ -0,0 +1,42 @@
+// Copyright 2025 BMW AG
+
+#pragma once
+
+#include <sched.h>
+
+#include <cstdint>
+
+namespace middleware
+{
+namespace posix
+{
+
+/**
+ * \brief Lock strategy for queues that are shared between processes.
+ * \details The lock spins on the mutex byte of the queue, which lives in shared memory, and yields
+ * the processor while it is taken by another process. The lock is only held while copying
+ * elements to the queue, a process terminating within this section leaves the queue locked.
+ *
+ */
+class SpinLock
+{
+public:
+    explicit SpinLock(uint8_t volatile* const mutex) : _mutex(mutex)
+    {
+        while (__atomic_exchange_n(_mutex, static_cast<uint8_t>(1U), __ATOMIC_ACQUIRE) != 0U)
+        {
+            (void)sched_yield();
+        }
+    }
+
+    SpinLock(SpinLock const&)            = delete;
+    SpinLock& operator=(SpinLock const&) = delete;
+
+    ~SpinLock() { __atomic_store_n(_mutex, static_cast<uint8_t>(0U), __ATOMIC_RELEASE); }
+
+private:
+    uint8_t volatile* const _mutex;
+};
+
+} // namespace posix
+} // namespace middleware
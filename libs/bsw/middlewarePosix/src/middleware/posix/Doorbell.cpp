@@ -0,0 +1,59 @@
+// Copyright 2025 BMW AG
+
+#include "middleware/posix/Doorbell.h"
+
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include <climits>
+#include <ctime>
+
+namespace middleware
+{
+namespace posix
+{
+namespace
+{
+long futex(uint32_t* const address, int const operation, uint32_t const value, timespec* timeout)
+{
+    // FUTEX_PRIVATE_FLAG must not be used, since the futex word is shared between processes
+    return syscall(SYS_futex, address, operation, value, timeout, nullptr, 0);
+}
+} // namespace
+
+void Doorbell::init()
+{
+    __atomic_store_n(&_waiters, 0U, __ATOMIC_SEQ_CST);
+    __atomic_store_n(&_sequence, 0U, __ATOMIC_SEQ_CST);
+}
+
+uint32_t Doorbell::getSequence() const { return __atomic_load_n(&_sequence, __ATOMIC_SEQ_CST); }
+
+void Doorbell::ring()
+{
+    (void)__atomic_add_fetch(&_sequence, 1U, __ATOMIC_SEQ_CST);
+    if (__atomic_load_n(&_waiters, __ATOMIC_SEQ_CST) != 0U)
+    {
+        (void)futex(&_sequence, FUTEX_WAKE, INT_MAX, nullptr);
+    }
+}
+
+bool Doorbell::wait(uint32_t const sequence, uint32_t const timeoutUs)
+{
+    (void)__atomic_add_fetch(&_waiters, 1U, __ATOMIC_SEQ_CST);
+    if (getSequence() == sequence)
+    {
+        timespec timeout;
+        timeout.tv_sec  = static_cast<time_t>(timeoutUs / 1000000U);
+        timeout.tv_nsec = static_cast<long>((timeoutUs % 1000000U) * 1000U);
+        // the kernel only sleeps if the futex word still contains sequence, so a ring between the
+        // check above and the system call isn't lost
+        (void)futex(&_sequence, FUTEX_WAIT, sequence, &timeout);
+    }
+    (void)__atomic_sub_fetch(&_waiters, 1U, __ATOMIC_SEQ_CST);
+    return getSequence() != sequence;
+}
+
+} // namespace posix
+} // namespace middleware
@@ -0,0 +1,106 @@
+// Copyright 2025 BMW AG
+
+#include "middleware/posix/SharedMemory.h"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <cstring>
+
+namespace middleware
+{
+namespace posix
+{
+
+SharedMemory::SharedMemory() : _address(nullptr), _size(0U), _name(), _isOwner(false) {}
+
+SharedMemory::~SharedMemory() { close(); }
+
+bool SharedMemory::create(char const* const name, size_t const size)
+{
+    if ((_address != nullptr) || (name == nullptr) || (strlen(name) >= MAX_NAME_LENGTH))
+    {
+        return false;
+    }
+    // fails with EEXIST if the object exists already, see removeStale()
+    int const fileDescriptor = shm_open(name, O_CREAT | O_EXCL | O_RDWR, S_IRUSR | S_IWUSR);
+    if (fileDescriptor < 0)
+    {
+        return false;
+    }
+    if (ftruncate(fileDescriptor, static_cast<off_t>(size)) != 0)
+    {
+        (void)::close(fileDescriptor);
+        (void)shm_unlink(name);
+        return false;
+    }
+    if (!map(fileDescriptor, size))
+    {
+        (void)shm_unlink(name);
+        return false;
+    }
+    (void)strncpy(_name, name, MAX_NAME_LENGTH - 1U);
+    _isOwner = true;
+    return true;
+}
+
+bool SharedMemory::open(char const* const name, size_t const size)
+{
+    if ((_address != nullptr) || (name == nullptr))
+    {
+        return false;
+    }
+    int const fileDescriptor = shm_open(name, O_RDWR, 0);
+    if (fileDescriptor < 0)
+    {
+        return false;
+    }
+    struct stat status;
+    if ((fstat(fileDescriptor, &status) != 0) || (static_cast<size_t>(status.st_size) < size))
+    {
+        (void)::close(fileDescriptor);
+        return false;
+    }
+    return map(fileDescriptor, size);
+}
+
+bool SharedMemory::removeStale(char const* const name)
+{
+    return (name != nullptr) && (shm_unlink(name) == 0);
+}
+
+void SharedMemory::close()
+{
+    if (_address == nullptr)
+    {
+        return;
+    }
+    (void)munmap(_address, _size);
+    if (_isOwner)
+    {
+        (void)shm_unlink(_name);
+    }
+    _address = nullptr;
+    _size    = 0U;
+    _isOwner = false;
+}
+
+bool SharedMemory::map(int const fileDescriptor, size_t const size)
+{
+    void* const address
+        = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fileDescriptor, 0);
+    // the mapping stays valid after closing the file descriptor
+    (void)::close(fileDescriptor);
+    if (address == MAP_FAILED)
+    {
+        return false;
+    }
+    _address = address;
+    _size    = size;
+    return true;
+}
+
+} // namespace posix
+} // namespace middleware
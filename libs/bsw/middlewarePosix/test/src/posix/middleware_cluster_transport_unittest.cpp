@@ -0,0 +1,166 @@
+// Copyright 2025 BMW AG
+
+#include "middleware/posix/ClusterTransport.h"
+
+#include <gtest/gtest.h>
+
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include <string>
+
+namespace middleware
+{
+namespace posix
+{
+namespace test
+{
+
+using TestMemory    = ClusterMemory<16U, 256U, 8U, 3U>;
+using TestTransport = ClusterTransport<TestMemory>;
+
+uint16_t const SERVICE_ID   = 0x0100U;
+uint16_t const MEMBER_ID    = 0x8001U;
+uint16_t const INSTANCE_ID  = 0x0001U;
+uint8_t const CLUSTER_A     = 0U;
+uint8_t const CLUSTER_B     = 1U;
+uint8_t const CLUSTER_C     = 2U;
+uint32_t const WAIT_TIMEOUT = 5000000U;
+
+class MiddlewareClusterTransportTest : public ::testing::Test
+{
+public:
+    MiddlewareClusterTransportTest()
+    : _name("/middlewareClusterTest" + std::to_string(getpid())), _received(0U), _lastMember(0U)
+    {}
+
+protected:
+    static core::Message createEvent(uint8_t const target, uint16_t const memberId = MEMBER_ID)
+    {
+        core::Message msg
+            = core::Message::createEvent(SERVICE_ID, memberId, INSTANCE_ID, CLUSTER_A);
+        msg.setTargetClusterId(target);
+        return msg;
+    }
+
+    void onMessage(core::Message const& message)
+    {
+        ++_received;
+        _lastMember = message.getHeader().memberId;
+    }
+
+    TestTransport::MessageHandler handler()
+    {
+        return TestTransport::MessageHandler::
+            create<MiddlewareClusterTransportTest, &MiddlewareClusterTransportTest::onMessage>(
+                *this);
+    }
+
+    std::string const _name;
+    uint32_t _received;
+    uint16_t _lastMember;
+};
+
+/**
+ * \brief Test that a transport can only be opened after the memory has been created
+ *
+ */
+TEST_F(MiddlewareClusterTransportTest, TestCreateAndOpen)
+{
+    // ARRANGE
+    TestTransport clusterA(CLUSTER_A);
+    TestTransport clusterB(CLUSTER_B);
+    TestTransport invalid(3U);
+
+    // ACT && ASSERT
+    EXPECT_FALSE(clusterB.open(_name.c_str()));
+    EXPECT_FALSE(invalid.create(_name.c_str()));
+    ASSERT_TRUE(clusterA.create(_name.c_str()));
+    ASSERT_TRUE(clusterB.open(_name.c_str()));
+    EXPECT_TRUE(clusterA.isOpen());
+    EXPECT_TRUE(clusterB.isOpen());
+    EXPECT_FALSE(invalid.open(_name.c_str()));
+}
+
+/**
+ * \brief Test that messages are routed to the queue of their target cluster
+ *
+ */
+TEST_F(MiddlewareClusterTransportTest, TestRouting)
+{
+    // ARRANGE
+    TestTransport clusterA(CLUSTER_A);
+    TestTransport clusterB(CLUSTER_B);
+    TestTransport clusterC(CLUSTER_C);
+    ASSERT_TRUE(clusterA.create(_name.c_str()));
+    ASSERT_TRUE(clusterB.open(_name.c_str()));
+    ASSERT_TRUE(clusterC.open(_name.c_str()));
+
+    // ACT
+    EXPECT_TRUE(clusterA.send(createEvent(CLUSTER_B, 1U)));
+    EXPECT_TRUE(clusterA.send(createEvent(CLUSTER_B, 2U)));
+    EXPECT_TRUE(clusterC.send(createEvent(CLUSTER_B, 3U)));
+    EXPECT_FALSE(clusterA.send(createEvent(3U)));
+
+    // ASSERT
+    EXPECT_FALSE(clusterC.waitForMessages(0U));
+    EXPECT_TRUE(clusterB.waitForMessages(WAIT_TIMEOUT));
+    EXPECT_EQ(clusterC.receive(handler()), 0U);
+    EXPECT_EQ(clusterB.receive(handler()), 3U);
+    EXPECT_EQ(_received, 3U);
+    EXPECT_EQ(_lastMember, 3U);
+    EXPECT_EQ(clusterB.getStats().processedMessages, 3U);
+    EXPECT_EQ(clusterB.getStats().maxLoad, 3U);
+}
+
+/**
+ * \brief Test that messages and a shared payload are exchanged with a cluster in another process
+ *
+ */
+TEST_F(MiddlewareClusterTransportTest, TestSeparateProcesses)
+{
+    // ARRANGE
+    TestTransport clusterA(CLUSTER_A);
+    ASSERT_TRUE(clusterA.create(_name.c_str()));
+    core::Message msg          = createEvent(CLUSTER_B);
+    etl::span<uint8_t> payload = clusterA.getAllocator().allocate(msg, 200U);
+    ASSERT_EQ(payload.size(), 200U);
+    payload[199] = 0x5AU;
+    ASSERT_TRUE(clusterA.getAllocator().share(msg, 1U));
+
+    pid_t const pid = fork();
+    ASSERT_GE(pid, 0);
+    if (pid == 0)
+    {
+        // cluster B: receives the event, checks and releases the payload and answers
+        TestTransport clusterB(CLUSTER_B);
+        bool ok = clusterB.open(_name.c_str()) && clusterB.waitForMessages(WAIT_TIMEOUT);
+        core::Message received;
+        auto const copy = [&received](core::Message const& message) { received = message; };
+        ok = ok && (clusterB.receive(TestTransport::MessageHandler(copy)) == 1U);
+        etl::span<uint8_t const> const data = clusterB.getAllocator().getPayload(received);
+        ok = ok && (data.size() == 200U) && (data[199] == 0x5AU);
+        clusterB.getAllocator().release(received);
+        ok = ok && clusterB.send(createEvent(CLUSTER_A, 2U));
+        _exit(ok ? 0 : 1);
+    }
+
+    // ACT
+    EXPECT_TRUE(clusterA.send(msg));
+    ASSERT_TRUE(clusterA.waitForMessages(WAIT_TIMEOUT));
+
+    // ASSERT
+    EXPECT_EQ(clusterA.receive(handler()), 1U);
+    EXPECT_EQ(_lastMember, 2U);
+    int status = 0;
+    ASSERT_EQ(waitpid(pid, &status, 0), pid);
+    EXPECT_TRUE(WIFEXITED(status));
+    EXPECT_EQ(WEXITSTATUS(status), 0);
+    EXPECT_EQ(clusterA.getAllocator().getStats().blocksInUse, 1U);
+    clusterA.getAllocator().release(msg);
+    EXPECT_EQ(clusterA.getAllocator().getStats().blocksInUse, 0U);
+}
+
+} // namespace test
+} // namespace posix
+} // namespace middleware
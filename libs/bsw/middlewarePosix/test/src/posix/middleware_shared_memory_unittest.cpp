@@ -0,0 +1,143 @@
+// Copyright 2025 BMW AG
+
+#include "middleware/posix/Doorbell.h"
+#include "middleware/posix/SharedMemory.h"
+
+#include <gtest/gtest.h>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <chrono>
+#include <string>
+#include <thread>
+
+namespace middleware
+{
+namespace posix
+{
+namespace test
+{
+
+class MiddlewareSharedMemoryTest : public ::testing::Test
+{
+public:
+    MiddlewareSharedMemoryTest() : _name("/middlewareShmTest" + std::to_string(getpid())) {}
+
+protected:
+    std::string const _name;
+};
+
+/**
+ * \brief Test that the memory created by one object is visible through another one
+ *
+ */
+TEST_F(MiddlewareSharedMemoryTest, TestCreateAndOpen)
+{
+    // ARRANGE
+    SharedMemory creator;
+    SharedMemory opener;
+
+    // ACT && ASSERT
+    EXPECT_FALSE(opener.open(_name.c_str(), 4096U));
+    ASSERT_TRUE(creator.create(_name.c_str(), 4096U));
+    EXPECT_FALSE(creator.create(_name.c_str(), 4096U));
+    EXPECT_EQ(creator.getSize(), 4096U);
+    EXPECT_FALSE(opener.open(_name.c_str(), 8192U));
+    ASSERT_TRUE(opener.open(_name.c_str(), 4096U));
+    EXPECT_NE(opener.getAddress(), creator.getAddress());
+
+    static_cast<uint8_t*>(creator.getAddress())[100] = 0xA5U;
+    EXPECT_EQ(static_cast<uint8_t*>(opener.getAddress())[100], 0xA5U);
+    EXPECT_EQ(static_cast<uint8_t*>(opener.getAddress())[101], 0U);
+}
+
+/**
+ * \brief Test that closing the creator removes the shared memory object
+ *
+ */
+TEST_F(MiddlewareSharedMemoryTest, TestCloseRemovesObject)
+{
+    // ARRANGE
+    SharedMemory creator;
+    SharedMemory opener;
+    ASSERT_TRUE(creator.create(_name.c_str(), 4096U));
+
+    // ACT
+    creator.close();
+
+    // ASSERT
+    EXPECT_EQ(creator.getAddress(), nullptr);
+    EXPECT_FALSE(opener.open(_name.c_str(), 4096U));
+}
+
+/**
+ * \brief Test that an existing object isn't replaced unless it is removed explicitly
+ *
+ */
+TEST_F(MiddlewareSharedMemoryTest, TestCreateFailsForExistingObject)
+{
+    // ARRANGE
+    int const fileDescriptor
+        = shm_open(_name.c_str(), O_CREAT | O_EXCL | O_RDWR, S_IRUSR | S_IWUSR);
+    ASSERT_GE(fileDescriptor, 0);
+    (void)close(fileDescriptor);
+    SharedMemory creator;
+
+    // ACT && ASSERT
+    EXPECT_FALSE(creator.create(_name.c_str(), 4096U));
+    EXPECT_EQ(creator.getAddress(), nullptr);
+    EXPECT_TRUE(SharedMemory::removeStale(_name.c_str()));
+    EXPECT_FALSE(SharedMemory::removeStale(_name.c_str()));
+    ASSERT_TRUE(creator.create(_name.c_str(), 4096U));
+    EXPECT_EQ(creator.getSize(), 4096U);
+}
+
+/**
+ * \brief Test that waiting for a doorbell times out without ringing
+ *
+ */
+TEST_F(MiddlewareSharedMemoryTest, TestDoorbellTimeout)
+{
+    // ARRANGE
+    Doorbell doorbell;
+    doorbell.init();
+    uint32_t const sequence = doorbell.getSequence();
+
+    // ACT
+    auto const start = std::chrono::steady_clock::now();
+    bool const rung  = doorbell.wait(sequence, 5000U);
+
+    // ASSERT
+    EXPECT_FALSE(rung);
+    EXPECT_GE(std::chrono::steady_clock::now() - start, std::chrono::milliseconds(5));
+}
+
+/**
+ * \brief Test that ringing before waiting isn't lost and ringing wakes up a waiting thread
+ *
+ */
+TEST_F(MiddlewareSharedMemoryTest, TestDoorbellRing)
+{
+    // ARRANGE
+    Doorbell doorbell;
+    doorbell.init();
+    uint32_t const sequence = doorbell.getSequence();
+
+    // ACT && ASSERT
+    doorbell.ring();
+    EXPECT_TRUE(doorbell.wait(sequence, 1000000U));
+
+    uint32_t const nextSequence = doorbell.getSequence();
+    std::thread waiter([&doorbell, nextSequence]()
+                       { EXPECT_TRUE(doorbell.wait(nextSequence, 5000000U)); });
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    doorbell.ring();
+    waiter.join();
+}
+
+} // namespace test
+} // namespace posix
+} // namespace middleware
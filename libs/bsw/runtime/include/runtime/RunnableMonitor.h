@@ -0,0 +1,132 @@
+// Copyright 2025 Accenture.
+
+/**
+ * \ingroup runtime
+ */
+#pragma once
+
+#include "async/Types.h"
+#include "runtime/RunnableStatistics.h"
+#include "runtime/StatisticsContainer.h"
+
+#include <etl/array.h>
+#include <etl/atomic.h>
+#include <etl/span.h>
+#include <timer/Timeout.h>
+
+#include <cstdint>
+
+namespace runtime
+{
+/**
+ * Monitor attributing the execution time of runnables to the individual runnables. It's called
+ * by the async executors through a ::async::StaticRunnableHook if ASYNC_CONFIG_RUNNABLE_MONITOR
+ * is enabled.
+ *
+ * Each runnable gets an entry on its first execution, identified by its address or by the name
+ * given on registration. Runnables exceeding the capacity are collected in a common entry.
+ * Runtimes and queueing delays are measured in system ticks, the lateness of expired timeouts in
+ * microseconds. A runnable executed within another runnable counts for both.
+ *
+ * The entry of a runnable is found through a hash table of slots that is only written under the
+ * async lock when a runnable gets its entry. Looking up and marking a runnable as enqueued are
+ * lock free, the statistics of an execution are updated under a single lock after it.
+ */
+class RunnableMonitor
+{
+public:
+    struct Entry
+    {
+        ::async::RunnableType const* _runnable = nullptr;
+        char const* _name                      = nullptr;
+        ::etl::atomic<uint32_t> _enqueueTimestamp{0U};
+        ::etl::atomic<bool> _isEnqueued{false};
+    };
+
+    /// Slot of the hash table, 0 if empty and the index of an entry plus one otherwise.
+    using SlotType = ::etl::atomic<uint16_t>;
+
+    using StatisticsContainerType = StatisticsContainer<RunnableStatistics>;
+    using EntrySliceType          = ::etl::span<Entry>;
+    using StatisticsSliceType     = ::etl::span<RunnableStatistics>;
+    using SlotSliceType           = ::etl::span<SlotType>;
+
+    /**
+     * \param entryCount number of entries
+     * \return the number of slots of the hash table, a power of two of at least twice entryCount
+     */
+    static constexpr size_t getSlotCount(size_t const entryCount)
+    {
+        size_t slotCount = 1U;
+        while (slotCount < (2U * entryCount))
+        {
+            slotCount *= 2U;
+        }
+        return slotCount;
+    }
+
+    /**
+     * \param entries entries of the runnables, the last one collects runnables exceeding capacity
+     * \param statistics statistics of the runnables, same size as entries
+     * \param slots hash table of the entries, getSlotCount() of the size of entries
+     */
+    RunnableMonitor(
+        EntrySliceType const& entries,
+        StatisticsSliceType const& statistics,
+        SlotSliceType const& slots);
+
+    /**
+     * Assign a name to a runnable.
+     * \return false if there's no entry left for the runnable
+     */
+    bool registerRunnable(::async::RunnableType const& runnable, char const* name);
+
+    StatisticsContainerType const& getStatistics() const { return _statistics; }
+
+    void reset();
+
+    void enqueue(::async::RunnableType& runnable);
+    void execute(::async::RunnableType& runnable);
+    void expire(::async::RunnableType& runnable, ::timer::Timeout const& timeout);
+
+private:
+    static size_t const NAME_BUFFER_SIZE = 2U + (2U * sizeof(uintptr_t)) + 1U;
+
+    size_t getIndex(::async::RunnableType const& runnable);
+    size_t findIndex(::async::RunnableType const& runnable) const;
+    size_t getSlot(::async::RunnableType const& runnable) const;
+    char const* getName(size_t idx) const;
+
+    EntrySliceType _entries;
+    StatisticsContainerType _statistics;
+    SlotSliceType _slots;
+    size_t _entryCount;
+    mutable char _nameBuffer[NAME_BUFFER_SIZE];
+};
+
+namespace declare
+{
+template<size_t N>
+class RunnableMonitor : public ::runtime::RunnableMonitor
+{
+public:
+    static size_t const ENTRY_COUNT = N + 1U;
+    static size_t const SLOT_COUNT  = getSlotCount(ENTRY_COUNT);
+
+    static_assert(ENTRY_COUNT < 0xFFFFU, "entry indices are stored in 16 bit slots");
+
+    RunnableMonitor()
+    : ::runtime::RunnableMonitor(_entries, _statistics, _slots)
+    , _entries()
+    , _statistics()
+    , _slots()
+    {}
+
+private:
+    ::etl::array<Entry, ENTRY_COUNT> _entries;
+    ::etl::array<RunnableStatistics, ENTRY_COUNT> _statistics;
+    ::etl::array<SlotType, SLOT_COUNT> _slots;
+};
+
+} // namespace declare
+} // namespace runtime
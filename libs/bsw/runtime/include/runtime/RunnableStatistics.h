@@ -0,0 +1,72 @@
+// Copyright 2025 Accenture.
+
+/**
+ * \ingroup runtime
+ */
+#pragma once
+
+#include "runtime/RuntimeStatistics.h"
+
+#include <cstdint>
+
+namespace runtime
+{
+/**
+ * Execution statistics of a single runnable. The runtime statistics cover the execution time,
+ * additionally the queueing delay from enqueuing to executing and the lateness of timeouts are
+ * collected.
+ */
+class RunnableStatistics : public RuntimeStatistics
+{
+public:
+    RunnableStatistics() = default;
+
+    /**
+     * Add the delay between enqueuing and executing the runnable.
+     * \param delay queueing delay in ticks
+     */
+    void addDelay(uint32_t const delay) { _delay.addRun(delay); }
+
+    /**
+     * Add the lateness of an expired timeout executing the runnable.
+     * \param lateness difference between actual and planned expiry in microseconds
+     * \param isDeadlineMissed true if the next cycle of a cyclic timeout has been due already
+     */
+    void addExpiry(uint32_t const lateness, bool const isDeadlineMissed)
+    {
+        ++_expiryCount;
+        if (lateness > _maxLateness)
+        {
+            _maxLateness = lateness;
+        }
+        if (isDeadlineMissed)
+        {
+            ++_deadlineMissCount;
+        }
+    }
+
+    void reset()
+    {
+        RuntimeStatistics::reset();
+        _delay.reset();
+        _expiryCount       = 0U;
+        _maxLateness       = 0U;
+        _deadlineMissCount = 0U;
+    }
+
+    RuntimeStatistics const& getDelay() const { return _delay; }
+
+    uint32_t getExpiryCount() const { return _expiryCount; }
+
+    uint32_t getMaxLateness() const { return _maxLateness; }
+
+    uint32_t getDeadlineMissCount() const { return _deadlineMissCount; }
+
+private:
+    RuntimeStatistics _delay;
+    uint32_t _expiryCount       = 0U;
+    uint32_t _maxLateness       = 0U;
+    uint32_t _deadlineMissCount = 0U;
+};
+
+} // namespace runtime
@@ -0,0 +1,187 @@
+// Copyright 2025 Accenture.
+
+#include "runtime/RunnableMonitor.h"
+
+#include "bsp/timer/SystemTimer.h"
+
+#include <cinttypes>
+#include <cstdio>
+
+namespace runtime
+{
+RunnableMonitor::RunnableMonitor(
+    EntrySliceType const& entries,
+    StatisticsSliceType const& statistics,
+    SlotSliceType const& slots)
+: _entries(entries)
+, _statistics(
+      statistics,
+      StatisticsContainerType::GetNameType::create<RunnableMonitor, &RunnableMonitor::getName>(
+          *this))
+, _slots(slots)
+, _entryCount(0U)
+, _nameBuffer()
+{}
+
+bool RunnableMonitor::registerRunnable(
+    ::async::RunnableType const& runnable, char const* const name)
+{
+    size_t const idx = getIndex(runnable);
+    if (idx < (_entries.size() - 1U))
+    {
+        ::async::LockType const lock;
+        _entries[idx]._name = name;
+        return true;
+    }
+    return false;
+}
+
+void RunnableMonitor::reset()
+{
+    ::async::LockType const lock;
+    _statistics.reset();
+}
+
+void RunnableMonitor::enqueue(::async::RunnableType& runnable)
+{
+    uint32_t const timestamp = getSystemTicks32Bit();
+    size_t const idx         = getIndex(runnable);
+    if (idx < (_entries.size() - 1U))
+    {
+        Entry& entry    = _entries[idx];
+        bool isEnqueued = false;
+        // a runnable that is enqueued already keeps its position in the queue
+        if (entry._isEnqueued.compare_exchange_strong(isEnqueued, true))
+        {
+            entry._enqueueTimestamp.store(timestamp, ::etl::memory_order_relaxed);
+        }
+    }
+}
+
+void RunnableMonitor::execute(::async::RunnableType& runnable)
+{
+    uint32_t const startTimestamp = getSystemTicks32Bit();
+    size_t const idx              = getIndex(runnable);
+    bool isDelayed                = false;
+    uint32_t delay                = 0U;
+    if (idx < (_entries.size() - 1U))
+    {
+        Entry& entry = _entries[idx];
+        // cleared before executing, so that the runnable can enqueue itself again
+        if (entry._isEnqueued.exchange(false))
+        {
+            isDelayed = true;
+            delay = startTimestamp - entry._enqueueTimestamp.load(::etl::memory_order_relaxed);
+        }
+    }
+    runnable.execute();
+    uint32_t const runtime = getSystemTicks32Bit() - startTimestamp;
+    ::async::LockType const lock;
+    RunnableStatistics& statistics = _statistics.getEntry(idx);
+    if (isDelayed)
+    {
+        statistics.addDelay(delay);
+    }
+    statistics.addRun(runtime);
+}
+
+void RunnableMonitor::expire(::async::RunnableType& runnable, ::timer::Timeout const& timeout)
+{
+    uint32_t const startTimestamp = getSystemTicks32Bit();
+    uint32_t const now            = getSystemTimeUs32Bit();
+    // cyclic timeouts have been rescheduled to their next expiry before expiring
+    int32_t const lateness = static_cast<int32_t>(now - (timeout._time - timeout._cycleTime));
+    bool const isDeadlineMissed
+        = (timeout._cycleTime > 0U) && (static_cast<int32_t>(now - timeout._time) >= 0);
+    size_t const idx = getIndex(runnable);
+    runnable.execute();
+    uint32_t const runtime = getSystemTicks32Bit() - startTimestamp;
+    ::async::LockType const lock;
+    RunnableStatistics& statistics = _statistics.getEntry(idx);
+    statistics.addExpiry((lateness > 0) ? static_cast<uint32_t>(lateness) : 0U, isDeadlineMissed);
+    statistics.addRun(runtime);
+}
+
+size_t RunnableMonitor::getIndex(::async::RunnableType const& runnable)
+{
+    size_t idx = findIndex(runnable);
+    if (idx < _entries.size())
+    {
+        return idx;
+    }
+    ::async::LockType const lock;
+    // another context may have added the runnable in the meantime
+    idx = findIndex(runnable);
+    if (idx < _entries.size())
+    {
+        return idx;
+    }
+    if (_entryCount < (_entries.size() - 1U))
+    {
+        idx                     = _entryCount;
+        _entries[idx]._runnable = &runnable;
+        ++_entryCount;
+        size_t const mask = _slots.size() - 1U;
+        size_t slot       = getSlot(runnable);
+        while (_slots[slot].load(::etl::memory_order_relaxed) != 0U)
+        {
+            slot = (slot + 1U) & mask;
+        }
+        // publishing the slot last makes the entry visible to lock free lookups
+        _slots[slot].store(static_cast<uint16_t>(idx + 1U), ::etl::memory_order_release);
+        return idx;
+    }
+    return _entries.size() - 1U;
+}
+
+size_t RunnableMonitor::findIndex(::async::RunnableType const& runnable) const
+{
+    // the table has more slots than entries, so the search ends at an empty slot
+    size_t const mask = _slots.size() - 1U;
+    for (size_t slot = getSlot(runnable);; slot = (slot + 1U) & mask)
+    {
+        size_t const value = _slots[slot].load(::etl::memory_order_acquire);
+        if (value == 0U)
+        {
+            return _entries.size();
+        }
+        if (_entries[value - 1U]._runnable == &runnable)
+        {
+            return value - 1U;
+        }
+    }
+}
+
+size_t RunnableMonitor::getSlot(::async::RunnableType const& runnable) const
+{
+    // Fibonacci hashing of the address, the lowest bits are equal due to alignment
+    uint32_t const hash
+        = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(&runnable) >> 3U) * 2654435769U;
+    return static_cast<size_t>(hash ^ (hash >> 16U)) & (_slots.size() - 1U);
+}
+
+char const* RunnableMonitor::getName(size_t const idx) const
+{
+    if (idx == (_entries.size() - 1U))
+    {
+        return "<other>";
+    }
+    if (idx >= _entryCount)
+    {
+        return nullptr;
+    }
+    Entry const& entry = _entries[idx];
+    if (entry._name != nullptr)
+    {
+        return entry._name;
+    }
+    // the name is valid until the next name of an anonymous runnable is requested
+    (void)snprintf(
+        _nameBuffer,
+        sizeof(_nameBuffer),
+        "0x%" PRIxPTR,
+        reinterpret_cast<uintptr_t>(entry._runnable));
+    return _nameBuffer;
+}
+
+} // namespace runtime
@@ -0,0 +1,218 @@
+// Copyright 2025 Accenture.
+
+#include "runtime/RunnableMonitor.h"
+
+#include "async/RunnableMock.h"
+#include "bsp/timer/SystemTimerMock.h"
+
+#include <gmock/gmock.h>
+
+#include <cstring>
+
+namespace
+{
+using namespace ::testing;
+using namespace ::runtime;
+
+struct TestTimeout : public ::timer::Timeout
+{
+    void expired() override {}
+};
+
+class RunnableMonitorTest : public Test
+{
+protected:
+    StrictMock<SystemTimerMock> _systemTimerMock;
+    StrictMock<::async::RunnableMock> _runnableMock1;
+    StrictMock<::async::RunnableMock> _runnableMock2;
+    StrictMock<::async::RunnableMock> _runnableMock3;
+    declare::RunnableMonitor<2U> _cut;
+};
+
+/**
+ * \desc
+ * The runtime and the queueing delay of an executed runnable are attributed to the runnable.
+ */
+TEST_F(RunnableMonitorTest, testExecute)
+{
+    EXPECT_TRUE(_cut.registerRunnable(_runnableMock1, "first"));
+
+    EXPECT_CALL(_systemTimerMock, getSystemTicks32Bit())
+        .WillOnce(Return(100U))
+        .WillOnce(Return(130U))
+        .WillOnce(Return(170U))
+        .WillOnce(Return(200U))
+        .WillOnce(Return(205U))
+        .WillOnce(Return(210U));
+    _cut.enqueue(_runnableMock1);
+    // enqueuing again keeps the first timestamp
+    _cut.enqueue(_runnableMock1);
+    EXPECT_CALL(_runnableMock1, execute());
+    _cut.execute(_runnableMock1);
+    // executing without enqueuing doesn't add a delay
+    EXPECT_CALL(_runnableMock2, execute());
+    _cut.execute(_runnableMock2);
+    Mock::VerifyAndClearExpectations(&_systemTimerMock);
+
+    StatisticsContainer<RunnableStatistics> const& statistics = _cut.getStatistics();
+    ASSERT_EQ(3U, statistics.getSize());
+    EXPECT_STREQ("first", statistics.getName(0U));
+    EXPECT_EQ(1U, statistics.getStatistics(0U).getTotalRunCount());
+    EXPECT_EQ(30U, statistics.getStatistics(0U).getTotalRuntime());
+    EXPECT_EQ(1U, statistics.getStatistics(0U).getDelay().getTotalRunCount());
+    EXPECT_EQ(70U, statistics.getStatistics(0U).getDelay().getTotalRuntime());
+    EXPECT_EQ(0U, strncmp("0x", statistics.getName(1U), 2U));
+    EXPECT_EQ(1U, statistics.getStatistics(1U).getTotalRunCount());
+    EXPECT_EQ(5U, statistics.getStatistics(1U).getTotalRuntime());
+    EXPECT_EQ(0U, statistics.getStatistics(1U).getDelay().getTotalRunCount());
+    EXPECT_STREQ("<other>", statistics.getName(2U));
+    EXPECT_EQ(0U, statistics.getStatistics(2U).getTotalRunCount());
+}
+
+/**
+ * \desc
+ * A runnable that enqueues itself while it is executed gets the queueing delay of its next
+ * execution measured from this enqueue.
+ */
+TEST_F(RunnableMonitorTest, testEnqueueWhileExecuting)
+{
+    EXPECT_CALL(_systemTimerMock, getSystemTicks32Bit())
+        .WillOnce(Return(100U))
+        .WillOnce(Return(110U))
+        .WillOnce(Return(115U))
+        .WillOnce(Return(120U))
+        .WillOnce(Return(130U))
+        .WillOnce(Return(135U));
+    _cut.enqueue(_runnableMock1);
+    EXPECT_CALL(_runnableMock1, execute())
+        .WillOnce(Invoke([this]() { _cut.enqueue(_runnableMock1); }))
+        .WillOnce(Return());
+    _cut.execute(_runnableMock1);
+    _cut.execute(_runnableMock1);
+
+    RunnableStatistics const& statistics = _cut.getStatistics().getStatistics(0U);
+    EXPECT_EQ(2U, statistics.getTotalRunCount());
+    EXPECT_EQ(15U, statistics.getTotalRuntime());
+    EXPECT_EQ(2U, statistics.getDelay().getTotalRunCount());
+    EXPECT_EQ(25U, statistics.getDelay().getTotalRuntime());
+}
+
+/**
+ * \desc
+ * Each of many runnables is attributed to its own entry, independent of the order of lookups.
+ */
+TEST_F(RunnableMonitorTest, testManyRunnables)
+{
+    static size_t const COUNT = 40U;
+    declare::RunnableMonitor<COUNT> cut;
+    NiceMock<::async::RunnableMock> runnables[COUNT];
+
+    EXPECT_CALL(_systemTimerMock, getSystemTicks32Bit()).WillRepeatedly(Return(0U));
+    for (size_t i = 0U; i < COUNT; ++i)
+    {
+        cut.execute(runnables[i]);
+    }
+    for (size_t i = COUNT; i > 0U; --i)
+    {
+        for (size_t run = 0U; run < i; ++run)
+        {
+            cut.execute(runnables[i - 1U]);
+        }
+    }
+
+    StatisticsContainer<RunnableStatistics> const& statistics = cut.getStatistics();
+    for (size_t i = 0U; i < COUNT; ++i)
+    {
+        EXPECT_EQ(i + 2U, statistics.getStatistics(i).getTotalRunCount());
+    }
+    EXPECT_EQ(0U, statistics.getStatistics(COUNT).getTotalRunCount());
+}
+
+/**
+ * \desc
+ * Runnables exceeding the capacity of the monitor are collected in a common entry.
+ */
+TEST_F(RunnableMonitorTest, testCapacityExceeded)
+{
+    EXPECT_TRUE(_cut.registerRunnable(_runnableMock1, "first"));
+    EXPECT_TRUE(_cut.registerRunnable(_runnableMock2, "second"));
+    EXPECT_FALSE(_cut.registerRunnable(_runnableMock3, "third"));
+
+    EXPECT_CALL(_systemTimerMock, getSystemTicks32Bit())
+        .WillOnce(Return(100U))
+        .WillOnce(Return(110U))
+        .WillOnce(Return(120U));
+    _cut.enqueue(_runnableMock3);
+    EXPECT_CALL(_runnableMock3, execute());
+    _cut.execute(_runnableMock3);
+
+    StatisticsContainer<RunnableStatistics> const& statistics = _cut.getStatistics();
+    EXPECT_EQ(1U, statistics.getStatistics(2U).getTotalRunCount());
+    EXPECT_EQ(10U, statistics.getStatistics(2U).getTotalRuntime());
+    EXPECT_EQ(0U, statistics.getStatistics(2U).getDelay().getTotalRunCount());
+
+    // the iterator only covers used entries
+    auto iterator = statistics.getIterator();
+    EXPECT_STREQ("first", iterator.getName());
+    iterator.next();
+    EXPECT_STREQ("second", iterator.getName());
+    iterator.next();
+    EXPECT_STREQ("<other>", iterator.getName());
+    iterator.next();
+    EXPECT_FALSE(iterator.hasValue());
+}
+
+/**
+ * \desc
+ * The lateness of expired timeouts is measured against the planned expiry. A cyclic timeout that
+ * is executed after its next planned expiry misses its deadline.
+ */
+TEST_F(RunnableMonitorTest, testExpire)
+{
+    TestTimeout timeout;
+    timeout._cycleTime = 1000U;
+    // the timer reschedules cyclic timeouts before expiring them
+    timeout._time      = 2000U;
+
+    EXPECT_CALL(_systemTimerMock, getSystemTicks32Bit()).WillRepeatedly(Return(0U));
+    EXPECT_CALL(_systemTimerMock, getSystemTimeUs32Bit())
+        .WillOnce(Return(1200U))
+        .WillOnce(Return(2000U))
+        .WillOnce(Return(900U));
+    EXPECT_CALL(_runnableMock1, execute()).Times(3);
+    _cut.expire(_runnableMock1, timeout);
+    _cut.expire(_runnableMock1, timeout);
+    // single shot timeouts never miss a deadline, early execution isn't late
+    timeout._cycleTime = 0U;
+    timeout._time      = 1000U;
+    _cut.expire(_runnableMock1, timeout);
+
+    RunnableStatistics const& statistics = _cut.getStatistics().getStatistics(0U);
+    EXPECT_EQ(3U, statistics.getTotalRunCount());
+    EXPECT_EQ(3U, statistics.getExpiryCount());
+    EXPECT_EQ(1000U, statistics.getMaxLateness());
+    EXPECT_EQ(1U, statistics.getDeadlineMissCount());
+    EXPECT_EQ(0U, statistics.getDelay().getTotalRunCount());
+}
+
+/**
+ * \desc
+ * Resetting clears the statistics but keeps the runnables.
+ */
+TEST_F(RunnableMonitorTest, testReset)
+{
+    EXPECT_CALL(_systemTimerMock, getSystemTicks32Bit())
+        .WillOnce(Return(100U))
+        .WillOnce(Return(110U));
+    EXPECT_CALL(_runnableMock1, execute());
+    _cut.execute(_runnableMock1);
+    EXPECT_TRUE(_cut.registerRunnable(_runnableMock1, "first"));
+    _cut.reset();
+
+    StatisticsContainer<RunnableStatistics> const& statistics = _cut.getStatistics();
+    EXPECT_STREQ("first", statistics.getName(0U));
+    EXPECT_EQ(0U, statistics.getStatistics(0U).getTotalRunCount());
+    EXPECT_EQ(nullptr, statistics.getName(1U));
+}
+
+} // namespace
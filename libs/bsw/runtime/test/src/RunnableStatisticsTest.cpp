@@ -0,0 +1,58 @@
+// Copyright 2025 Accenture.
+
+#include "runtime/RunnableStatistics.h"
+
+#include <gmock/gmock.h>
+
+namespace
+{
+using namespace ::testing;
+using namespace ::runtime;
+
+TEST(RunnableStatisticsTest, testConstructor)
+{
+    RunnableStatistics cut;
+    EXPECT_EQ(0U, cut.getTotalRunCount());
+    EXPECT_EQ(0U, cut.getDelay().getTotalRunCount());
+    EXPECT_EQ(0U, cut.getExpiryCount());
+    EXPECT_EQ(0U, cut.getMaxLateness());
+    EXPECT_EQ(0U, cut.getDeadlineMissCount());
+}
+
+TEST(RunnableStatisticsTest, testAddDelayAndExpiry)
+{
+    RunnableStatistics cut;
+    cut.addRun(15U);
+    cut.addDelay(30U);
+    cut.addDelay(10U);
+    EXPECT_EQ(1U, cut.getTotalRunCount());
+    EXPECT_EQ(15U, cut.getMaxRuntime());
+    EXPECT_EQ(2U, cut.getDelay().getTotalRunCount());
+    EXPECT_EQ(10U, cut.getDelay().getMinRuntime());
+    EXPECT_EQ(30U, cut.getDelay().getMaxRuntime());
+    EXPECT_EQ(20U, cut.getDelay().getAverageRuntime());
+
+    cut.addExpiry(120U, false);
+    cut.addExpiry(1500U, true);
+    cut.addExpiry(40U, false);
+    EXPECT_EQ(3U, cut.getExpiryCount());
+    EXPECT_EQ(1500U, cut.getMaxLateness());
+    EXPECT_EQ(1U, cut.getDeadlineMissCount());
+}
+
+TEST(RunnableStatisticsTest, testReset)
+{
+    RunnableStatistics cut;
+    cut.addRun(15U);
+    cut.addDelay(30U);
+    cut.addExpiry(1500U, true);
+    cut.reset();
+    EXPECT_EQ(0U, cut.getTotalRunCount());
+    EXPECT_EQ(0U, cut.getTotalRuntime());
+    EXPECT_EQ(0U, cut.getDelay().getTotalRunCount());
+    EXPECT_EQ(0U, cut.getExpiryCount());
+    EXPECT_EQ(0U, cut.getMaxLateness());
+    EXPECT_EQ(0U, cut.getDeadlineMissCount());
+}
+
+} // namespace
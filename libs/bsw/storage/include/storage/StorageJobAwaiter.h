@@ -0,0 +1,66 @@
+// Copyright 2025 Accenture.
+
+#pragma once
+
+#include "storage/IStorage.h"
+#include "storage/StorageJob.h"
+
+#include <async/Coroutine.h>
+
+namespace storage
+{
+
+/**
+ * Awaitable processing a StorageJob within an async::Task.
+ *
+ * The job is passed to the storage when the task suspends. The task is resumed within its
+ * context once the storage has sent the result, which is returned by co_await. The callback of
+ * the job is replaced by the awaiter, the ID and the read or write request are kept.
+ *
+ * \code
+ * job.initRead(buffer);
+ * auto const result = co_await ::storage::process(storage, job);
+ * \endcode
+ */
+class StorageJobAwaiter
+{
+public:
+    StorageJobAwaiter(IStorage& storage, StorageJob& job) : _storage(storage), _job(job) {}
+
+    StorageJobAwaiter(StorageJobAwaiter const&)            = delete;
+    StorageJobAwaiter& operator=(StorageJobAwaiter const&) = delete;
+
+    bool await_ready() const noexcept { return false; }
+
+    void await_suspend(::async::Task::HandleType const handle)
+    {
+        _task = &handle.promise();
+        _job.init(
+            _job.getId(),
+            StorageJob::JobDoneCallback::create<StorageJobAwaiter, &StorageJobAwaiter::jobDone>(
+                *this));
+        _storage.process(_job);
+    }
+
+    StorageJob::ResultType await_resume() const { return _job.getResult(); }
+
+private:
+    // the storage may send the result from any context, even while the task is suspending
+    void jobDone(StorageJob& /* job */) { _task->resume(); }
+
+    IStorage& _storage;
+    StorageJob& _job;
+    ::async::Task::promise_type* _task = nullptr;
+};
+
+/**
+ * Process a job by the storage and continue the awaiting task once the job is done.
+ * \param storage Storage processing the job
+ * \param job Job to process
+ */
+inline StorageJobAwaiter process(IStorage& storage, StorageJob& job)
+{
+    return StorageJobAwaiter(storage, job);
+}
+
+} // namespace storage
@@ -0,0 +1,77 @@
+// Copyright 2025 Accenture.
+
+#include <async/AsyncMock.h>
+#include <async/TestContext.h>
+#include <storage/IStorageMock.h>
+#include <storage/StorageJobAwaiter.h>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+namespace
+{
+using namespace ::testing;
+
+::async::ContextType const CONTEXT = 1U;
+
+::async::Task readJob(
+    ::async::ContextType const /* context */,
+    ::storage::IStorage& storage,
+    ::storage::StorageJob& job,
+    bool& success)
+{
+    auto const result = co_await ::storage::process(storage, job);
+    success           = ::etl::holds_alternative<::storage::StorageJob::Result::Success>(result);
+}
+
+class StorageJobAwaiterTest : public Test
+{
+public:
+    StorageJobAwaiterTest() : _context(CONTEXT), _arena(CONTEXT) { _context.handleAll(); }
+
+protected:
+    NiceMock<::async::AsyncMock> _asyncMock;
+    ::async::TestContext _context;
+    ::async::StaticFrameArena<256U, 1U> _arena;
+    StrictMock<::storage::IStorageMock> _storage;
+    ::storage::StorageJob _job;
+    bool _success = false;
+};
+
+/**
+ * \desc
+ * The task continues within its context after the storage has sent the result of the job.
+ */
+TEST_F(StorageJobAwaiterTest, testTaskContinuesAfterJobIsDone)
+{
+    _job.init(5U, ::storage::StorageJob::JobDoneCallback());
+    readJob(CONTEXT, _storage, _job, _success).start();
+    EXPECT_CALL(_storage, process(Ref(_job)));
+    _context.execute();
+    EXPECT_EQ(5U, _job.getId());
+    EXPECT_FALSE(_success);
+
+    _job.sendResult(::storage::StorageJob::Result::Success());
+    EXPECT_FALSE(_success);
+    _context.execute();
+    EXPECT_TRUE(_success);
+    EXPECT_EQ(1U, _arena.getFreeCount());
+}
+
+/**
+ * \desc
+ * A result sent while processing the job resumes the task within its context afterwards.
+ */
+TEST_F(StorageJobAwaiterTest, testResultSentWhileProcessing)
+{
+    readJob(CONTEXT, _storage, _job, _success).start();
+    EXPECT_CALL(_storage, process(Ref(_job)))
+        .WillOnce([](::storage::StorageJob& job)
+                  { job.sendResult(::storage::StorageJob::Result::Error()); });
+    _context.execute();
+    EXPECT_FALSE(_success);
+    EXPECT_TRUE(_job.hasResult<::storage::StorageJob::Result::Error>());
+    EXPECT_EQ(1U, _arena.getFreeCount());
+}
+
+} // namespace
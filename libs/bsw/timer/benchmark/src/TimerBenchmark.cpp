@@ -0,0 +1,213 @@
+// Copyright 2025 Accenture.
+
+#include <benchmark/benchmark.h>
+#include <timer/Timeout.h>
+#include <timer/Timer.h>
+#include <timer/TimingWheelTimer.h>
+
+#include <mutex>
+#include <vector>
+
+namespace
+{
+struct NoLock
+{
+    NoLock() {}
+};
+
+/// Lock with real acquisition cost to make the number of lock/unlock pairs visible.
+struct MutexLock
+{
+    MutexLock() { mutex().lock(); }
+
+    ~MutexLock() { mutex().unlock(); }
+
+    static std::mutex& mutex()
+    {
+        static std::mutex m;
+        return m;
+    }
+};
+
+struct CountingTimeout : public ::timer::Timeout
+{
+    void expired() override { ++_count; }
+
+    uint32_t _count = 0U;
+};
+
+using SortedListTimer        = ::timer::Timer<NoLock>;
+using TimingWheelTimer       = ::timer::TimingWheelTimer<NoLock>;
+using LockedSortedListTimer  = ::timer::Timer<MutexLock>;
+using LockedTimingWheelTimer = ::timer::TimingWheelTimer<MutexLock>;
+
+/**
+ * Simple linear congruential generator to get reproducible delays without depending on the
+ * standard library random engines.
+ */
+uint32_t nextDelay(uint32_t& seed)
+{
+    seed = (seed * 1664525U) + 1013904223U;
+    // delays between 1ms and ~1s
+    return 1000U + ((seed >> 8U) % 1000000U);
+}
+
+template<class T>
+void fill(T& timer, std::vector<CountingTimeout>& timeouts, uint32_t& seed, uint32_t const now)
+{
+    for (auto& timeout : timeouts)
+    {
+        timer.set(timeout, nextDelay(seed), now);
+    }
+}
+
+template<class T>
+void processSingle(T& timer, uint32_t const now)
+{
+    uint32_t delta = 0U;
+    do
+    {
+        while (timer.processNextTimeout(now)) {}
+    } while (timer.getNextDelta(now, delta) && (delta == 0U));
+}
+
+template<class T>
+void processBatched(T& timer, uint32_t const now)
+{
+    while (timer.processDueTimeouts(now)) {}
+}
+
+template<class T>
+void drain(T& timer, std::vector<CountingTimeout>& timeouts)
+{
+    for (auto& timeout : timeouts)
+    {
+        timer.cancel(timeout);
+    }
+}
+} // namespace
+
+/**
+ * Benchmarks rescheduling a single timeout (cancel followed by set) while state.range(0) other
+ * timeouts are active. This is the typical pattern of a supervision timeout that is retriggered
+ * on every received message.
+ */
+template<class T>
+void BM_timer_reschedule(benchmark::State& state)
+{
+    T timer;
+    std::vector<CountingTimeout> timeouts(static_cast<size_t>(state.range(0)));
+    uint32_t seed = 1U;
+    uint32_t now  = 0U;
+    fill(timer, timeouts, seed, now);
+
+    size_t idx = 0U;
+    for (auto _ : state)
+    {
+        auto& timeout = timeouts[idx];
+        timer.cancel(timeout);
+        benchmark::DoNotOptimize(timer.set(timeout, nextDelay(seed), now));
+        idx = (idx + 1U) % timeouts.size();
+        ++now;
+    }
+    drain(timer, timeouts);
+}
+
+/**
+ * Benchmarks the expiry path: state.range(0) cyclic timeouts with different periods are active,
+ * each iteration advances the time to the next due timeout and processes everything that expired.
+ */
+template<class T>
+void BM_timer_expire_cyclic(benchmark::State& state)
+{
+    T timer;
+    std::vector<CountingTimeout> timeouts(static_cast<size_t>(state.range(0)));
+    uint32_t seed = 1U;
+    uint32_t now  = 0U;
+    for (auto& timeout : timeouts)
+    {
+        timer.setCyclic(timeout, nextDelay(seed), now);
+    }
+
+    for (auto _ : state)
+    {
+        uint32_t delta = 0U;
+        if (timer.getNextDelta(now, delta))
+        {
+            now += delta;
+        }
+        do
+        {
+            while (timer.processNextTimeout(now)) {}
+        } while (timer.getNextDelta(now, delta) && (delta == 0U));
+    }
+    int64_t expired = 0;
+    for (auto const& timeout : timeouts)
+    {
+        expired += timeout._count;
+    }
+    state.SetItemsProcessed(expired);
+    drain(timer, timeouts);
+}
+
+/**
+ * Benchmarks the 1ms tick storm seen at startup: state.range(0) cyclic timeouts with a period of
+ * 1ms are started at the same time, so all of them expire in the same tick. Each iteration
+ * processes one tick either timeout by timeout (one lock per timeout) or in batches (one lock per
+ * batch).
+ */
+template<class T, bool Batched>
+void BM_timer_tick_storm(benchmark::State& state)
+{
+    static uint32_t const TICK_US = 1000U;
+
+    T timer;
+    std::vector<CountingTimeout> timeouts(static_cast<size_t>(state.range(0)));
+    uint32_t now = 0U;
+    for (auto& timeout : timeouts)
+    {
+        timer.setCyclic(timeout, TICK_US, now);
+    }
+
+    for (auto _ : state)
+    {
+        now += TICK_US;
+        if (Batched)
+        {
+            processBatched(timer, now);
+        }
+        else
+        {
+            processSingle(timer, now);
+        }
+    }
+
+    int64_t expired = 0;
+    for (auto const& timeout : timeouts)
+    {
+        expired += timeout._count;
+    }
+    state.SetItemsProcessed(expired);
+    drain(timer, timeouts);
+}
+
+BENCHMARK_TEMPLATE(BM_timer_reschedule, SortedListTimer)->Arg(10)->Arg(100)->Arg(10000);
+BENCHMARK_TEMPLATE(BM_timer_reschedule, TimingWheelTimer)->Arg(10)->Arg(100)->Arg(10000);
+BENCHMARK_TEMPLATE(BM_timer_expire_cyclic, SortedListTimer)->Arg(10)->Arg(100)->Arg(10000);
+BENCHMARK_TEMPLATE(BM_timer_expire_cyclic, TimingWheelTimer)->Arg(10)->Arg(100)->Arg(10000);
+BENCHMARK_TEMPLATE(BM_timer_tick_storm, LockedSortedListTimer, false)
+    ->Arg(10)
+    ->Arg(100)
+    ->Arg(1000);
+BENCHMARK_TEMPLATE(BM_timer_tick_storm, LockedSortedListTimer, true)
+    ->Arg(10)
+    ->Arg(100)
+    ->Arg(1000);
+BENCHMARK_TEMPLATE(BM_timer_tick_storm, LockedTimingWheelTimer, false)
+    ->Arg(10)
+    ->Arg(100)
+    ->Arg(1000);
+BENCHMARK_TEMPLATE(BM_timer_tick_storm, LockedTimingWheelTimer, true)
+    ->Arg(10)
+    ->Arg(100)
+    ->Arg(1000);
@@ -0,0 +1,167 @@
+// Copyright 2025 Accenture.
+
+#pragma once
+
+#include "timer/Timeout.h"
+
+#include <etl/array.h>
+#include <etl/atomic.h>
+
+#include <cstddef>
+
+namespace timer
+{
+
+/**
+ * A fixed size batch of due timeouts that have been detached from a timer under a single lock
+ * and are expired afterwards outside of the lock.
+ *
+ * The entries of the batch are guarded by the lock of the timer. While a timeout is part of the
+ * batch it is still considered active: cancelling it clears its entries, so it won't expire
+ * anymore. Before a timeout expires, its entry is claimed under the lock, so a timeout that has
+ * been cancelled (and possibly destroyed) by the expiry of a previous timeout is never touched.
+ *
+ * \tparam N maximum number of timeouts in a single batch. It bounds the time the lock of the timer
+ * is held while detaching due timeouts and the time spent searching the batch.
+ */
+template<size_t N = 8U>
+class TimeoutBatch
+{
+    static_assert(N > 0U, "batch must hold at least one timeout");
+
+public:
+    static size_t const CAPACITY = N;
+
+    TimeoutBatch();
+
+    /**
+     * Check whether no timeout is waiting for its expiry in the batch. May be called without
+     * holding the lock of the timer to skip searching an empty batch.
+     */
+    bool isEmpty() const;
+
+    /**
+     * Check whether no further timeout can be added to the batch.
+     * Must be called by the expiring context only.
+     */
+    bool isFull() const;
+
+    /**
+     * Add a due timeout to the batch. The same timeout may be added multiple times, e.g. if a
+     * cyclic timeout is due again after being rescheduled.
+     * Must be called by the expiring context with the lock of the timer held.
+     * \param timeout Reference to Timeout
+     */
+    void add(Timeout& timeout);
+
+    /**
+     * Check whether the timeout is still waiting for its expiry in the batch.
+     * Must be called with the lock of the timer held.
+     * \param timeout Reference to Timeout
+     */
+    bool contains(Timeout const& timeout) const;
+
+    /**
+     * Clear all entries of the timeout in the batch, so it won't expire anymore.
+     * Must be called with the lock of the timer held.
+     * \param timeout Reference to Timeout
+     */
+    void remove(Timeout const& timeout);
+
+    /**
+     * Expire all timeouts in order that haven't been removed and empty the batch. Each entry is
+     * claimed under the lock of the timer, the timeout expires outside of the lock.
+     * Must be called by the expiring context without holding the lock of the timer.
+     * \tparam LockGuard RAII lock type of the timer
+     * \return number of expired timeouts
+     */
+    template<class LockGuard>
+    size_t expire();
+
+private:
+    ::etl::array<Timeout*, N> _timeouts;
+    ::etl::atomic<size_t> _size;
+};
+
+/**
+ * Inline implementations.
+ */
+template<size_t N>
+TimeoutBatch<N>::TimeoutBatch() : _timeouts(), _size(0U)
+{}
+
+template<size_t N>
+inline bool TimeoutBatch<N>::isEmpty() const
+{
+    return _size.load() == 0U;
+}
+
+template<size_t N>
+inline bool TimeoutBatch<N>::isFull() const
+{
+    return _size.load() == N;
+}
+
+template<size_t N>
+inline void TimeoutBatch<N>::add(Timeout& timeout)
+{
+    size_t const size = _size.load();
+    _timeouts[size]   = &timeout;
+    _size.store(size + 1U);
+}
+
+template<size_t N>
+inline bool TimeoutBatch<N>::contains(Timeout const& timeout) const
+{
+    size_t const size = _size.load();
+    for (size_t idx = 0U; idx < size; ++idx)
+    {
+        if (_timeouts[idx] == &timeout)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+template<size_t N>
+inline void TimeoutBatch<N>::remove(Timeout const& timeout)
+{
+    size_t const size = _size.load();
+    for (size_t idx = 0U; idx < size; ++idx)
+    {
+        if (_timeouts[idx] == &timeout)
+        {
+            _timeouts[idx] = nullptr;
+        }
+    }
+}
+
+template<size_t N>
+template<class LockGuard>
+size_t TimeoutBatch<N>::expire()
+{
+    size_t count      = 0U;
+    size_t const size = _size.load();
+    for (size_t idx = 0U; idx < size; ++idx)
+    {
+        Timeout* timeout;
+        {
+            LockGuard const scopedLock;
+            timeout        = _timeouts[idx];
+            _timeouts[idx] = nullptr;
+            if ((idx + 1U) == size)
+            {
+                _size.store(0U);
+            }
+        }
+        if (timeout != nullptr)
+        {
+            timeout->expired();
+            ++count;
+        }
+    }
+    return count;
+}
+
+} // namespace timer
@@ -3,6 +3,7 @@
 #pragma once
 
 #include "timer/Timeout.h"
+#include "timer/TimeoutBatch.h"
 
 #include <cstdint>
 
@@ -32,6 +33,19 @@ public:
      */
     bool processNextTimeout(uint32_t now);
 
+    /**
+     * Called by the system to process a batch of elapsed timeouts. All due timeouts (up to the
+     * capacity of the batch) are detached and cyclic timeouts are rescheduled under a single lock.
+     * The timeouts expire afterwards in order, outside of the lock. A timeout that is cancelled by
+     * the expiry of a previous timeout of the same batch won't expire.
+     * Must not be called from within the expiry of a timeout.
+     * \param now Current system time
+     * \return
+     * - true if the batch was full and further due timeouts should be processed
+     * - false otherwise
+     */
+    bool processDueTimeouts(uint32_t now);
+
     /**
      * Get the next timeout delta to set.
      * The caller has to make sure, that now is the current system time.
@@ -88,10 +102,12 @@ private:
     void rescheduleCyclicTimeout(Timeout& timeout, uint32_t now);
 
     bool addTimeout(Timeout& timeout, uint32_t absoluteTimeout, uint32_t cycleTime, uint32_t now);
+    bool insert(Timeout& timeout, uint32_t now);
 
     static int32_t diff(uint32_t a, uint32_t const b);
 
     TimeoutList _timeoutList;
+    TimeoutBatch<> _dueTimeouts;
 };
 
 template<class LockGuard>
@@ -125,6 +141,34 @@ bool Timer<LockGuard>::processNextTimeout(uint32_t const now)
     return diffTimeout == 0U;
 }
 
+template<class LockGuard>
+bool Timer<LockGuard>::processDueTimeouts(uint32_t const now)
+{
+    bool full;
+    {
+        LockGuard const scopedLock;
+        while ((!_timeoutList.empty()) && (!_dueTimeouts.isFull()))
+        {
+            Timeout& timeout = _timeoutList.front();
+            if (diff(timeout._time, now) > 0)
+            {
+                break;
+            }
+            _timeoutList.pop_front();
+            if (timeout._cycleTime > 0U)
+            {
+                timeout._time += timeout._cycleTime;
+                (void)insert(timeout, now);
+            }
+            _dueTimeouts.add(timeout);
+        }
+        full = _dueTimeouts.isFull();
+    }
+
+    (void)_dueTimeouts.expire<LockGuard>();
+    return full;
+}
+
 template<class LockGuard>
 bool Timer<LockGuard>::getNextDelta(uint32_t const now, uint32_t& nextDelta) const
 {
@@ -151,7 +195,17 @@ bool
 
 Timer<LockGuard>::isActive( Timeout const & timeout) const
 {
-    return timeout.is_linked();
+    if (timeout.is_linked())
+    {
+        return true;
+    }
+    if (_dueTimeouts.isEmpty())
+    {
+        return false;
+    }
+
+    LockGuard const scopedLock;
+    return _dueTimeouts.contains(timeout);
 }
 
 template<class LockGuard>
@@ -169,10 +223,14 @@ bool Timer<LockGuard>::setCyclic(Timeout& timeout, uint32_t const period, uint32
 template<class LockGuard>
 void Timer<LockGuard>::cancel(Timeout& timeout)
 {
-    if (timeout.is_linked())
+    if (timeout.is_linked() || (!_dueTimeouts.isEmpty()))
     {
         LockGuard const scopedLock;
-        _timeoutList.erase(timeout);
+        if (timeout.is_linked())
+        {
+            _timeoutList.erase(timeout);
+        }
+        _dueTimeouts.remove(timeout);
     }
 }
 
@@ -194,11 +252,20 @@ bool Timer<LockGuard>::addTimeout(
         return false;
     }
 
+    LockGuard const lock;
+    if (_dueTimeouts.contains(timeout))
+    {
+        return false;
+    }
+
     timeout._time      = absoluteTimeout;
     timeout._cycleTime = cycleTime;
+    return insert(timeout, now);
+}
 
-    LockGuard const lock;
-
+template<class LockGuard>
+bool Timer<LockGuard>::insert(Timeout& timeout, uint32_t const now)
+{
     int32_t const timeoutDiff  = diff(timeout._time, now);
     TimeoutList::iterator prev = _timeoutList.before_begin();
 
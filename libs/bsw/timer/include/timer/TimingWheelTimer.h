@@ -0,0 +1,588 @@
+// Copyright 2025 Accenture.
+
+#pragma once
+
+#include "timer/Timeout.h"
+#include "timer/TimeoutBatch.h"
+
+#include <etl/array.h>
+#include <etl/binary.h>
+
+#include <cstdint>
+
+namespace timer
+{
+
+/**
+ * A template class that serves as collection of timeouts, organized as hierarchical timing wheel.
+ * It provides the same interface and the same expiry semantics as Timer, but doesn't keep the
+ * timeouts in a single sorted list. Instead each timeout is stored in a bucket that is selected
+ * by the bits of its absolute expiry time. Every level of the wheel covers SlotBits bits of the
+ * 32 bit time. A timeout is placed on the level of the most significant bit in which its expiry
+ * time differs from the current time of the wheel. While the wheel time advances, the timeouts
+ * of a reached bucket cascade down to the lower levels until they are due on the lowest level.
+ *
+ * Setting a timeout takes constant time, independent of the number of active timeouts. Cancelling
+ * a timeout and determining the next delta of a timeout that hasn't reached the lowest level yet
+ * only walk the bucket the timeout is stored in.
+ *
+ * \tparam LockGuard is the type that implements RAII-based lock for secure section.
+ * \tparam SlotBits number of time bits covered by a single level of the wheel.
+ */
+template<class LockGuard, uint8_t SlotBits = 4U>
+class TimingWheelTimer
+{
+    static_assert((SlotBits > 0U) && (SlotBits <= 5U), "SlotBits must be in range [1, 5]");
+
+public:
+    TimingWheelTimer();
+
+    /**
+     * Called by the system to process the next elapsed timeout.
+     * \param now Current system time
+     * \return
+     * - true if a timeout has been processed successfully and a next timeout should be processed
+     * - false otherwise
+     */
+    bool processNextTimeout(uint32_t now);
+
+    /**
+     * Called by the system to process a batch of elapsed timeouts. All due timeouts (up to the
+     * capacity of the batch) are detached and cyclic timeouts are rescheduled under a single lock.
+     * The timeouts expire afterwards in order, outside of the lock. A timeout that is cancelled by
+     * the expiry of a previous timeout of the same batch won't expire.
+     * Must not be called from within the expiry of a timeout.
+     * \param now Current system time
+     * \return
+     * - true if the batch was full and further due timeouts should be processed
+     * - false otherwise
+     */
+    bool processDueTimeouts(uint32_t now);
+
+    /**
+     * Get the next timeout delta to set.
+     * The caller has to make sure, that now is the current system time.
+     * It shouldn't be reused from previous a processNextTimeout() call.
+     * \param now Current system time
+     * \param nextDelta reference to variable that receives next delta to set
+     * \return
+     * - true && nextDelta > 0 if the systems timeout should be rescheduled with nextTimeout
+     * - true && nextDelta == 0 if an event in the system should be triggered immediately
+     * - false otherwise
+     */
+    bool getNextDelta(uint32_t now, uint32_t& nextDelta) const;
+
+    /**
+     * Check whether a timer is active.
+     * \param timeout Reference to Timeout
+     * \return
+     * - true if timer is event
+     * - false otherwise
+     */
+    bool isActive(Timeout const& timeout) const;
+
+    /**
+     * Set a single shot timeout.
+     * \param timeout Reference to Timeout
+     * \param Delay relative value, indicating when the timer will be triggered
+     * \param now Current system time
+     * \return
+     * - true if an event in the system should be triggered
+     * - false otherwise
+     */
+    bool set(Timeout& timeout, uint32_t delay, uint32_t now);
+
+    /**
+     * Set a cyclic timeout.
+     * \param timeout Reference to Timeout
+     * \param period Time between cyclic timeouts
+     * \param now Current system time
+     * \return
+     * - true if an event in the system should be triggered
+     * - false otherwise
+     */
+    bool setCyclic(Timeout& timeout, uint32_t period, uint32_t now);
+
+    /**
+     * Cancel running timeout.
+     * If the timeout is not scheduled (part of a bucket), cancel won't do anything.
+     *
+     * \param timeout Reference to Timeout
+     */
+    void cancel(Timeout& timeout);
+
+private:
+    static uint8_t const TIME_BITS   = 32U;
+    static uint8_t const LEVEL_COUNT = static_cast<uint8_t>((TIME_BITS + SlotBits - 1U) / SlotBits);
+    static uint32_t const SLOT_COUNT = static_cast<uint32_t>(1U) << SlotBits;
+    static uint32_t const SLOT_MASK  = SLOT_COUNT - 1U;
+
+    /// Timeouts with the same slot in FIFO order. The last timeout is linked to itself.
+    struct Bucket
+    {
+        Timeout* _first;
+        Timeout* _last;
+    };
+
+    struct Level
+    {
+        uint32_t _usedSlots;
+        ::etl::array<Bucket, SLOT_COUNT> _buckets;
+    };
+
+    void rescheduleCyclicTimeout(Timeout& timeout, uint32_t now);
+
+    bool addTimeout(Timeout& timeout, uint32_t absoluteTimeout, uint32_t cycleTime, uint32_t now);
+    bool insert(Timeout& timeout, uint32_t now);
+
+    bool advance(uint32_t now, uint32_t& slot);
+    bool findNextSlot(uint8_t& level, uint32_t& slot) const;
+    uint32_t getSlotStart(uint8_t level, uint32_t slot) const;
+    Timeout const& getEarliest(uint8_t level, uint32_t slot) const;
+
+    void link(Timeout& timeout, uint8_t& level, uint32_t& slot);
+    void unlink(Timeout& timeout);
+    void cascade(uint8_t level, uint32_t slot);
+    Timeout& popFront(uint8_t level, uint32_t slot);
+
+    uint32_t getKey(Timeout const& timeout) const;
+
+    static uint8_t getLevel(uint32_t key, uint32_t current);
+    static uint32_t getSlot(uint32_t key, uint8_t level);
+    static Timeout* getNext(Timeout const& timeout);
+    static int32_t diff(uint32_t a, uint32_t const b);
+
+    ::etl::array<Level, LEVEL_COUNT> _levels;
+    uint32_t _current;
+    TimeoutBatch<> _dueTimeouts;
+};
+
+/**
+ * Inline implementations.
+ */
+template<class LockGuard, uint8_t SlotBits>
+TimingWheelTimer<LockGuard, SlotBits>::TimingWheelTimer()
+: _levels(), _current(0U), _dueTimeouts()
+{}
+
+template<class LockGuard, uint8_t SlotBits>
+bool TimingWheelTimer<LockGuard, SlotBits>::processNextTimeout(uint32_t const now)
+{
+    Timeout* timeout    = nullptr;
+    int32_t diffTimeout = 0;
+    {
+        LockGuard const scopedLock;
+        uint32_t slot;
+        if (!advance(now, slot))
+        {
+            return false;
+        }
+        timeout     = &popFront(0U, slot);
+        diffTimeout = diff(timeout->_time, now);
+    }
+
+    rescheduleCyclicTimeout(*timeout, now);
+    timeout->expired();
+    return diffTimeout == 0U;
+}
+
+template<class LockGuard, uint8_t SlotBits>
+bool TimingWheelTimer<LockGuard, SlotBits>::processDueTimeouts(uint32_t const now)
+{
+    bool full;
+    {
+        LockGuard const scopedLock;
+        uint32_t slot;
+        while ((!_dueTimeouts.isFull()) && advance(now, slot))
+        {
+            Timeout& timeout = popFront(0U, slot);
+            if (timeout._cycleTime > 0U)
+            {
+                timeout._time += timeout._cycleTime;
+                (void)insert(timeout, now);
+            }
+            _dueTimeouts.add(timeout);
+        }
+        full = _dueTimeouts.isFull();
+    }
+
+    (void)_dueTimeouts.expire<LockGuard>();
+    return full;
+}
+
+template<class LockGuard, uint8_t SlotBits>
+bool TimingWheelTimer<LockGuard, SlotBits>::getNextDelta(
+    uint32_t const now, uint32_t& nextDelta) const
+{
+    LockGuard const scopedLock;
+    uint8_t level;
+    uint32_t slot;
+    if (findNextSlot(level, slot))
+    {
+        Timeout const& next = getEarliest(level, slot);
+        if (diff(next._time, now) < 0)
+        {
+            nextDelta = 0U;
+        }
+        else
+        {
+            nextDelta = next._time - now;
+        }
+        return true;
+    }
+
+    nextDelta = 0U;
+    return false;
+}
+
+template<class LockGuard, uint8_t SlotBits>
+bool TimingWheelTimer<LockGuard, SlotBits>::isActive(Timeout const& timeout) const
+{
+    if (timeout.is_linked())
+    {
+        return true;
+    }
+    if (_dueTimeouts.isEmpty())
+    {
+        return false;
+    }
+
+    LockGuard const scopedLock;
+    return _dueTimeouts.contains(timeout);
+}
+
+template<class LockGuard, uint8_t SlotBits>
+bool TimingWheelTimer<LockGuard, SlotBits>::set(
+    Timeout& timeout, uint32_t const delay, uint32_t const now)
+{
+    return addTimeout(timeout, delay + now, 0U, now);
+}
+
+template<class LockGuard, uint8_t SlotBits>
+bool TimingWheelTimer<LockGuard, SlotBits>::setCyclic(
+    Timeout& timeout, uint32_t const period, uint32_t const now)
+{
+    return addTimeout(timeout, period + now, period, now);
+}
+
+template<class LockGuard, uint8_t SlotBits>
+void TimingWheelTimer<LockGuard, SlotBits>::cancel(Timeout& timeout)
+{
+    if (timeout.is_linked() || (!_dueTimeouts.isEmpty()))
+    {
+        LockGuard const scopedLock;
+        if (timeout.is_linked())
+        {
+            unlink(timeout);
+        }
+        _dueTimeouts.remove(timeout);
+    }
+}
+
+template<class LockGuard, uint8_t SlotBits>
+void TimingWheelTimer<LockGuard, SlotBits>::rescheduleCyclicTimeout(
+    Timeout& timeout, uint32_t const now)
+{
+    if (timeout._cycleTime > 0U)
+    {
+        (void)addTimeout(timeout, timeout._cycleTime + timeout._time, timeout._cycleTime, now);
+    }
+}
+
+template<class LockGuard, uint8_t SlotBits>
+bool TimingWheelTimer<LockGuard, SlotBits>::addTimeout(
+    Timeout& timeout, uint32_t const absoluteTimeout, uint32_t const cycleTime, uint32_t const now)
+{
+    if (timeout.is_linked())
+    {
+        return false;
+    }
+
+    LockGuard const lock;
+    if (_dueTimeouts.contains(timeout))
+    {
+        return false;
+    }
+
+    timeout._time      = absoluteTimeout;
+    timeout._cycleTime = cycleTime;
+    return insert(timeout, now);
+}
+
+template<class LockGuard, uint8_t SlotBits>
+bool TimingWheelTimer<LockGuard, SlotBits>::insert(Timeout& timeout, uint32_t const now)
+{
+    // Bring the wheel time close to now, the expiry time of the timeout is placed relative to it.
+    // The wheel time must not pass the expiry time of an overdue cyclic timeout.
+    uint32_t dueSlot;
+    (void)advance((diff(timeout._time, now) < 0) ? timeout._time : now, dueSlot);
+
+    uint8_t level;
+    uint32_t slot;
+    link(timeout, level, slot);
+
+    uint8_t nextLevel;
+    uint32_t nextSlot;
+    (void)findNextSlot(nextLevel, nextSlot);
+    if ((nextLevel != level) || (nextSlot != slot))
+    {
+        return false;
+    }
+    Bucket const& bucket = _levels[level]._buckets[slot];
+    if (level == 0U)
+    {
+        // all timeouts of a bucket on the lowest level expire at the same time
+        return bucket._first == &timeout;
+    }
+    for (Timeout const* current = bucket._first; current != &timeout; current = getNext(*current))
+    {
+        if (diff(current->_time, timeout._time) <= 0)
+        {
+            return false;
+        }
+    }
+    return true; // will expire before all other
+}
+
+/**
+ * Moves the wheel time forward towards now and cascades all buckets that have been reached on the
+ * way. Stops at the first bucket on the lowest level that is due.
+ * \param now Current system time
+ * \param slot reference to variable that receives the slot of the due bucket on the lowest level
+ * \return
+ * - true if a bucket with due timeouts is available at slot
+ * - false otherwise
+ */
+template<class LockGuard, uint8_t SlotBits>
+bool TimingWheelTimer<LockGuard, SlotBits>::advance(uint32_t const now, uint32_t& slot)
+{
+    uint8_t level;
+    while (findNextSlot(level, slot))
+    {
+        uint32_t const slotStart = getSlotStart(level, slot);
+        if (diff(slotStart, now) > 0)
+        {
+            if (diff(now, _current) > 0)
+            {
+                _current = now;
+            }
+            return false;
+        }
+        if (level == 0U)
+        {
+            return true;
+        }
+        _current = slotStart;
+        cascade(level, slot);
+    }
+    _current = now;
+    return false;
+}
+
+/**
+ * Finds the bucket that contains the earliest timeout. Timeouts on a lower level always expire
+ * before the timeouts on a higher level. The highest level wraps around with the 32 bit time.
+ */
+template<class LockGuard, uint8_t SlotBits>
+bool TimingWheelTimer<LockGuard, SlotBits>::findNextSlot(uint8_t& level, uint32_t& slot) const
+{
+    for (uint8_t idx = 0U; idx < LEVEL_COUNT; ++idx)
+    {
+        uint32_t const usedSlots = _levels[idx]._usedSlots;
+        if (usedSlots != 0U)
+        {
+            uint32_t const first = getSlot(_current, idx) + ((idx == 0U) ? 0U : 1U);
+            uint32_t candidates
+                = (first < SLOT_COUNT) ? (usedSlots & ~((static_cast<uint32_t>(1U) << first) - 1U))
+                                       : 0U;
+            if ((candidates == 0U) && (idx == (LEVEL_COUNT - 1U)))
+            {
+                candidates = usedSlots;
+            }
+            if (candidates != 0U)
+            {
+                level = idx;
+                slot  = ::etl::count_trailing_zeros(candidates);
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+template<class LockGuard, uint8_t SlotBits>
+uint32_t
+TimingWheelTimer<LockGuard, SlotBits>::getSlotStart(uint8_t const level, uint32_t const slot) const
+{
+    uint32_t const shift      = static_cast<uint32_t>(level) * SlotBits;
+    uint32_t const upperShift = shift + SlotBits;
+    uint32_t const upperMask
+        = (upperShift < TIME_BITS) ? ~((static_cast<uint32_t>(1U) << upperShift) - 1U) : 0U;
+    return (_current & upperMask) | (slot << shift);
+}
+
+template<class LockGuard, uint8_t SlotBits>
+Timeout const&
+TimingWheelTimer<LockGuard, SlotBits>::getEarliest(uint8_t const level, uint32_t const slot) const
+{
+    Bucket const& bucket     = _levels[level]._buckets[slot];
+    Timeout const* earliest = bucket._first;
+    if (level > 0U)
+    {
+        for (Timeout const* current = bucket._first; current != bucket._last;)
+        {
+            current = getNext(*current);
+            if (diff(current->_time, earliest->_time) < 0)
+            {
+                earliest = current;
+            }
+        }
+    }
+    return *earliest;
+}
+
+template<class LockGuard, uint8_t SlotBits>
+void TimingWheelTimer<LockGuard, SlotBits>::link(Timeout& timeout, uint8_t& level, uint32_t& slot)
+{
+    uint32_t const key = getKey(timeout);
+    level              = getLevel(key, _current);
+    slot               = getSlot(key, level);
+
+    Level& wheelLevel = _levels[level];
+    Bucket& bucket    = wheelLevel._buckets[slot];
+    timeout.etl_next  = &timeout;
+    if (bucket._last != nullptr)
+    {
+        bucket._last->etl_next = &timeout;
+    }
+    else
+    {
+        bucket._first = &timeout;
+        wheelLevel._usedSlots |= static_cast<uint32_t>(1U) << slot;
+    }
+    bucket._last = &timeout;
+}
+
+template<class LockGuard, uint8_t SlotBits>
+void TimingWheelTimer<LockGuard, SlotBits>::unlink(Timeout& timeout)
+{
+    uint32_t const key = getKey(timeout);
+    uint8_t const level = getLevel(key, _current);
+    uint32_t const slot = getSlot(key, level);
+
+    Level& wheelLevel = _levels[level];
+    Bucket& bucket    = wheelLevel._buckets[slot];
+    Timeout* prev     = nullptr;
+    for (Timeout* current = bucket._first; current != nullptr;)
+    {
+        Timeout* const next = (current == bucket._last) ? nullptr : getNext(*current);
+        if (current == &timeout)
+        {
+            if (prev != nullptr)
+            {
+                prev->etl_next = (next != nullptr) ? next : prev;
+            }
+            else
+            {
+                bucket._first = next;
+            }
+            if (bucket._last == &timeout)
+            {
+                bucket._last = prev;
+            }
+            if (bucket._first == nullptr)
+            {
+                wheelLevel._usedSlots &= ~(static_cast<uint32_t>(1U) << slot);
+            }
+            timeout.clear();
+            return;
+        }
+        prev    = current;
+        current = next;
+    }
+}
+
+template<class LockGuard, uint8_t SlotBits>
+void TimingWheelTimer<LockGuard, SlotBits>::cascade(uint8_t const level, uint32_t const slot)
+{
+    Level& wheelLevel = _levels[level];
+    Bucket& bucket    = wheelLevel._buckets[slot];
+    Timeout* current  = bucket._first;
+    Timeout* last     = bucket._last;
+    bucket._first     = nullptr;
+    bucket._last      = nullptr;
+    wheelLevel._usedSlots &= ~(static_cast<uint32_t>(1U) << slot);
+
+    // re-link in original order to keep timeouts with the same expiry time in FIFO order
+    while (current != nullptr)
+    {
+        Timeout* const next = (current == last) ? nullptr : getNext(*current);
+        uint8_t newLevel;
+        uint32_t newSlot;
+        link(*current, newLevel, newSlot);
+        current = next;
+    }
+}
+
+template<class LockGuard, uint8_t SlotBits>
+Timeout& TimingWheelTimer<LockGuard, SlotBits>::popFront(uint8_t const level, uint32_t const slot)
+{
+    Level& wheelLevel = _levels[level];
+    Bucket& bucket    = wheelLevel._buckets[slot];
+    Timeout& timeout  = *bucket._first;
+    if (bucket._last == &timeout)
+    {
+        bucket._first = nullptr;
+        bucket._last  = nullptr;
+        wheelLevel._usedSlots &= ~(static_cast<uint32_t>(1U) << slot);
+    }
+    else
+    {
+        bucket._first = getNext(timeout);
+    }
+    timeout.clear();
+    return timeout;
+}
+
+/**
+ * A timeout that has been set with a time older than the wheel time (e.g. with an outdated now)
+ * is kept in the current bucket of the lowest level, which makes it due immediately.
+ */
+template<class LockGuard, uint8_t SlotBits>
+uint32_t TimingWheelTimer<LockGuard, SlotBits>::getKey(Timeout const& timeout) const
+{
+    return (diff(timeout._time, _current) < 0) ? _current : timeout._time;
+}
+
+template<class LockGuard, uint8_t SlotBits>
+uint8_t TimingWheelTimer<LockGuard, SlotBits>::getLevel(uint32_t const key, uint32_t const current)
+{
+    uint32_t const differentBits = key ^ current;
+    if (differentBits == 0U)
+    {
+        return 0U;
+    }
+    uint32_t const highestBit
+        = (TIME_BITS - 1U) - static_cast<uint32_t>(::etl::count_leading_zeros(differentBits));
+    return static_cast<uint8_t>(highestBit / SlotBits);
+}
+
+template<class LockGuard, uint8_t SlotBits>
+uint32_t TimingWheelTimer<LockGuard, SlotBits>::getSlot(uint32_t const key, uint8_t const level)
+{
+    return (key >> (static_cast<uint32_t>(level) * SlotBits)) & SLOT_MASK;
+}
+
+template<class LockGuard, uint8_t SlotBits>
+Timeout* TimingWheelTimer<LockGuard, SlotBits>::getNext(Timeout const& timeout)
+{
+    return static_cast<Timeout*>(timeout.etl_next);
+}
+
+template<class LockGuard, uint8_t SlotBits>
+int32_t TimingWheelTimer<LockGuard, SlotBits>::diff(uint32_t const a, uint32_t const b)
+{
+    return static_cast<int32_t>(a - b);
+}
+
+} // namespace timer
@@ -6,6 +6,8 @@
 
 #include <gmock/gmock.h>
 
+#include <memory>
+
 namespace
 {
 using ::timer::Timeout;
@@ -931,4 +933,134 @@ TEST_F(TimerTest, can_handle_delays_between_processing_timeouts_and_getting_next
     EXPECT_TRUE(fTimer.getNextDelta(fNow, nextTimeout));
     EXPECT_EQ(5, nextTimeout);
 }
+
+TEST_F(TimerTest, due_timeouts_are_detached_as_batch_under_a_single_lock)
+{
+    setAndExpectTrigger(fTimer, fTimeoutMock1, 100);
+    fTimer.set(fTimeoutMock2, 100, fNow);
+    fTimer.setCyclic(fTimeoutMock3, 100, fNow);
+
+    fNow = 100U;
+    {
+        InSequence seq;
+        EXPECT_CALL(fLockMock, lock());
+        EXPECT_CALL(fLockMock, unlock());
+        // each entry of the batch is claimed under the lock before it expires outside of it
+        for (TimeoutMock* const timeout : {&fTimeoutMock1, &fTimeoutMock2, &fTimeoutMock3})
+        {
+            EXPECT_CALL(fLockMock, lock());
+            EXPECT_CALL(fLockMock, unlock());
+            EXPECT_CALL(*timeout, expired());
+        }
+    }
+    EXPECT_FALSE(fTimer.processDueTimeouts(fNow));
+    Mock::VerifyAndClearExpectations(&fLockMock);
+
+    EXPECT_FALSE(fTimer.isActive(fTimeoutMock1));
+    EXPECT_FALSE(fTimer.isActive(fTimeoutMock2));
+    EXPECT_TRUE(fTimer.isActive(fTimeoutMock3));
+    EXPECT_TRUE(fTimer.getNextDelta(fNow, fNextTimeout));
+    EXPECT_EQ(100U, fNextTimeout);
+}
+
+TEST_F(TimerTest, pending_timeout_of_batch_is_active_and_can_be_canceled)
+{
+    setAndExpectTrigger(fTimer, fTimeoutMock1, 100);
+    fTimer.set(fTimeoutMock2, 100, fNow);
+
+    fNow = 100U;
+    EXPECT_CALL(fTimeoutMock1, expired())
+        .WillOnce(Invoke(
+            [this]()
+            {
+                EXPECT_FALSE(fTimer.isActive(fTimeoutMock1));
+                EXPECT_TRUE(fTimer.isActive(fTimeoutMock2));
+                EXPECT_FALSE(fTimer.set(fTimeoutMock2, 50, fNow));
+                fTimer.cancel(fTimeoutMock2);
+                EXPECT_FALSE(fTimer.isActive(fTimeoutMock2));
+            }));
+    EXPECT_FALSE(fTimer.processDueTimeouts(fNow));
+    EXPECT_FALSE(fTimer.getNextDelta(fNow, fNextTimeout));
+}
+
+TEST_F(TimerTest, canceled_timeout_of_batch_can_be_set_again)
+{
+    setAndExpectTrigger(fTimer, fTimeoutMock1, 100);
+    fTimer.set(fTimeoutMock2, 100, fNow);
+
+    fNow = 100U;
+    EXPECT_CALL(fTimeoutMock1, expired())
+        .WillOnce(Invoke(
+            [this]()
+            {
+                fTimer.cancel(fTimeoutMock2);
+                EXPECT_TRUE(fTimer.set(fTimeoutMock2, 50, fNow));
+                EXPECT_TRUE(fTimer.isActive(fTimeoutMock2));
+            }));
+    // the canceled entry of the batch doesn't expire the timeout that has been set again
+    EXPECT_FALSE(fTimer.processDueTimeouts(fNow));
+    Mock::VerifyAndClearExpectations(&fTimeoutMock2);
+    EXPECT_TRUE(fTimer.isActive(fTimeoutMock2));
+
+    fNow = 150U;
+    EXPECT_CALL(fTimeoutMock2, expired());
+    EXPECT_FALSE(fTimer.processDueTimeouts(fNow));
+    EXPECT_FALSE(fTimer.isActive(fTimeoutMock2));
+}
+
+TEST_F(TimerTest, canceled_and_destroyed_timeout_of_batch_is_not_touched)
+{
+    setAndExpectTrigger(fTimer, fTimeoutMock1, 100);
+    ::std::unique_ptr<StrictMock<TimeoutMock>> timeout(new StrictMock<TimeoutMock>());
+    fTimer.set(*timeout, 100, fNow);
+    fTimer.set(fTimeoutMock2, 100, fNow);
+
+    fNow = 100U;
+    {
+        InSequence seq;
+        EXPECT_CALL(fTimeoutMock1, expired())
+            .WillOnce(Invoke(
+                [this, &timeout]()
+                {
+                    fTimer.cancel(*timeout);
+                    timeout.reset();
+                }));
+        EXPECT_CALL(fTimeoutMock2, expired());
+    }
+    EXPECT_FALSE(fTimer.processDueTimeouts(fNow));
+    EXPECT_FALSE(fTimer.getNextDelta(fNow, fNextTimeout));
+}
+
+TEST_F(TimerTest, one_shot_timeout_can_be_rescheduled_in_batch)
+{
+    setAndExpectTrigger(fTimer, fTimeoutMock1, 100);
+
+    fNow = 100U;
+    EXPECT_CALL(fTimeoutMock1, expired())
+        .WillOnce(rescheduleOneShotInExpiredCallback(&fTimer, &fTimeoutMock1, 50, fNow));
+    EXPECT_FALSE(fTimer.processDueTimeouts(fNow));
+    EXPECT_TRUE(fTimer.isActive(fTimeoutMock1));
+
+    fNow = 150U;
+    EXPECT_CALL(fTimeoutMock1, expired());
+    EXPECT_FALSE(fTimer.processDueTimeouts(fNow));
+    EXPECT_FALSE(fTimer.isActive(fTimeoutMock1));
+}
+
+TEST_F(TimerTest, full_batch_requests_further_processing)
+{
+    static size_t const TIMEOUT_COUNT = ::timer::TimeoutBatch<>::CAPACITY + 2U;
+    StrictMock<TimeoutMock> timeouts[TIMEOUT_COUNT];
+    for (auto& timeout : timeouts)
+    {
+        fTimer.set(timeout, 100, fNow);
+        EXPECT_CALL(timeout, expired());
+    }
+
+    fNow = 150U;
+    EXPECT_TRUE(fTimer.processDueTimeouts(fNow));
+    EXPECT_FALSE(fTimer.processDueTimeouts(fNow));
+    EXPECT_FALSE(fTimer.getNextDelta(fNow, fNextTimeout));
+}
+
 } // anonymous namespace
@@ -0,0 +1,417 @@
+// Copyright 2025 Accenture.
+
+#include "timer/TimingWheelTimer.h"
+
+#include "timer/Timeout.h"
+#include "timer/Timer.h"
+
+#include <etl/vector.h>
+
+#include <gmock/gmock.h>
+
+namespace
+{
+using ::timer::Timeout;
+using ::timer::TimingWheelTimer;
+using namespace ::testing;
+
+struct TimeoutMock : public Timeout
+{
+    MOCK_METHOD(void, expired, ());
+};
+
+struct NoLock
+{
+    NoLock() {}
+};
+
+struct RecordingTimeout : public Timeout
+{
+    void expired() override { _expired->push_back(this); }
+
+    ::etl::vector<RecordingTimeout const*, 1000U>* _expired = nullptr;
+};
+
+using Timer_t = TimingWheelTimer<NoLock>;
+
+class TimingWheelTimerTest : public Test
+{
+protected:
+    /// Processes all due timeouts like the event loop of a task context does.
+    template<class Timer>
+    static void update(Timer& timer, uint32_t const now)
+    {
+        uint32_t nextDelta = 0U;
+        do
+        {
+            while (timer.processNextTimeout(now)) {}
+        } while (timer.getNextDelta(now, nextDelta) && (nextDelta == 0U));
+    }
+
+    /// Processes all due timeouts in batches.
+    template<class Timer>
+    static void updateBatched(Timer& timer, uint32_t const now)
+    {
+        while (timer.processDueTimeouts(now)) {}
+    }
+
+    static void crossCheckWithSortedListTimer(bool batched);
+
+    uint32_t getNextDelta(uint32_t const now)
+    {
+        uint32_t nextDelta = 0U;
+        EXPECT_TRUE(fTimer.getNextDelta(now, nextDelta));
+        return nextDelta;
+    }
+
+    StrictMock<TimeoutMock> fTimeoutMock1;
+    StrictMock<TimeoutMock> fTimeoutMock2;
+    StrictMock<TimeoutMock> fTimeoutMock3;
+
+    Timer_t fTimer;
+};
+
+TEST_F(TimingWheelTimerTest, empty_timer_has_no_next_delta)
+{
+    uint32_t nextDelta = 17U;
+    EXPECT_FALSE(fTimer.getNextDelta(0U, nextDelta));
+    EXPECT_EQ(0U, nextDelta);
+    EXPECT_FALSE(fTimer.processNextTimeout(0U));
+}
+
+TEST_F(TimingWheelTimerTest, single_shot_timeout_expires_exactly_once)
+{
+    EXPECT_TRUE(fTimer.set(fTimeoutMock1, 100U, 0U));
+    EXPECT_TRUE(fTimer.isActive(fTimeoutMock1));
+    EXPECT_EQ(100U, getNextDelta(0U));
+    EXPECT_EQ(1U, getNextDelta(99U));
+
+    update(fTimer, 99U);
+
+    EXPECT_CALL(fTimeoutMock1, expired());
+    update(fTimer, 100U);
+    EXPECT_FALSE(fTimer.isActive(fTimeoutMock1));
+
+    update(fTimer, 200U);
+    uint32_t nextDelta = 0U;
+    EXPECT_FALSE(fTimer.getNextDelta(200U, nextDelta));
+}
+
+TEST_F(TimingWheelTimerTest, cyclic_timeout_expires_periodically)
+{
+    EXPECT_TRUE(fTimer.setCyclic(fTimeoutMock1, 1000U, 0U));
+
+    EXPECT_CALL(fTimeoutMock1, expired()).Times(3);
+    update(fTimer, 1000U);
+    EXPECT_EQ(1000U, getNextDelta(1000U));
+    update(fTimer, 2000U);
+    // jitter is compensated by the next delta
+    update(fTimer, 3010U);
+    EXPECT_EQ(990U, getNextDelta(3010U));
+}
+
+TEST_F(TimingWheelTimerTest, next_delta_is_exact_for_timeouts_on_higher_levels)
+{
+    // the timeouts are stored in the same bucket on a higher level, all in the same bucket
+    fTimer.set(fTimeoutMock1, 0x3456U, 0U);
+    fTimer.set(fTimeoutMock2, 0x3123U, 0U);
+    fTimer.set(fTimeoutMock3, 0x3FFFU, 0U);
+
+    EXPECT_EQ(0x3123U, getNextDelta(0U));
+    EXPECT_EQ(0x3123U - 0x3000U, getNextDelta(0x3000U));
+
+    // reaching the bucket moves all timeouts to lower levels
+    update(fTimer, 0x3000U);
+    EXPECT_EQ(0x3123U - 0x3001U, getNextDelta(0x3001U));
+
+    EXPECT_CALL(fTimeoutMock2, expired());
+    update(fTimer, 0x3123U);
+    EXPECT_EQ(0x3456U - 0x3123U, getNextDelta(0x3123U));
+
+    EXPECT_CALL(fTimeoutMock1, expired());
+    EXPECT_CALL(fTimeoutMock3, expired());
+    update(fTimer, 0x4000U);
+}
+
+TEST_F(TimingWheelTimerTest, set_returns_true_only_for_the_earliest_timeout)
+{
+    EXPECT_TRUE(fTimer.set(fTimeoutMock1, 300U, 0U));
+    EXPECT_FALSE(fTimer.set(fTimeoutMock2, 300U, 0U));
+    EXPECT_TRUE(fTimer.set(fTimeoutMock3, 299U, 0U));
+
+    EXPECT_CALL(fTimeoutMock1, expired());
+    EXPECT_CALL(fTimeoutMock2, expired());
+    EXPECT_CALL(fTimeoutMock3, expired());
+    update(fTimer, 300U);
+}
+
+TEST_F(TimingWheelTimerTest, timeout_is_not_added_twice)
+{
+    fTimer.set(fTimeoutMock1, 100U, 0U);
+    EXPECT_FALSE(fTimer.set(fTimeoutMock1, 200U, 0U));
+    EXPECT_FALSE(fTimer.setCyclic(fTimeoutMock1, 50U, 0U));
+
+    EXPECT_CALL(fTimeoutMock1, expired());
+    update(fTimer, 100U);
+    update(fTimer, 300U);
+}
+
+TEST_F(TimingWheelTimerTest, timeouts_with_same_expiration_time_expire_in_order_of_registration)
+{
+    fTimer.set(fTimeoutMock1, 5000U, 0U);
+    fTimer.set(fTimeoutMock2, 4000U, 1000U);
+    fTimer.set(fTimeoutMock3, 10U, 4990U);
+
+    {
+        InSequence seq;
+        EXPECT_CALL(fTimeoutMock1, expired());
+        EXPECT_CALL(fTimeoutMock2, expired());
+        EXPECT_CALL(fTimeoutMock3, expired());
+    }
+    update(fTimer, 5000U);
+}
+
+TEST_F(TimingWheelTimerTest, timeouts_can_be_canceled_on_every_level)
+{
+    fTimer.set(fTimeoutMock1, 0x5U, 0U);
+    fTimer.set(fTimeoutMock2, 0x50U, 0U);
+    fTimer.setCyclic(fTimeoutMock3, 0x50000U, 0U);
+
+    fTimer.cancel(fTimeoutMock2);
+    EXPECT_FALSE(fTimer.isActive(fTimeoutMock2));
+    fTimer.cancel(fTimeoutMock3);
+    EXPECT_FALSE(fTimer.isActive(fTimeoutMock3));
+    // cancel of inactive timeout does nothing
+    fTimer.cancel(fTimeoutMock3);
+
+    EXPECT_EQ(0x5U, getNextDelta(0U));
+    fTimer.cancel(fTimeoutMock1);
+
+    uint32_t nextDelta = 0U;
+    EXPECT_FALSE(fTimer.getNextDelta(0U, nextDelta));
+    update(fTimer, 0x100000U);
+}
+
+TEST_F(TimingWheelTimerTest, cancel_in_the_middle_of_a_bucket_keeps_remaining_timeouts)
+{
+    fTimer.set(fTimeoutMock1, 0x120U, 0U);
+    fTimer.set(fTimeoutMock2, 0x130U, 0U);
+    fTimer.set(fTimeoutMock3, 0x140U, 0U);
+
+    fTimer.cancel(fTimeoutMock2);
+
+    EXPECT_CALL(fTimeoutMock1, expired());
+    EXPECT_CALL(fTimeoutMock3, expired());
+    update(fTimer, 0x200U);
+    EXPECT_FALSE(fTimer.isActive(fTimeoutMock1));
+    EXPECT_FALSE(fTimer.isActive(fTimeoutMock3));
+}
+
+TEST_F(TimingWheelTimerTest, handles_timeouts_which_overflow_32bit_time)
+{
+    uint32_t const now = 0xFFFFFF92U; // 110 before overflow
+    fTimer.set(fTimeoutMock1, 100U, now);
+    fTimer.setCyclic(fTimeoutMock2, 0x20000U, now);
+
+    EXPECT_CALL(fTimeoutMock1, expired());
+    update(fTimer, 0xFFFFFFF6U);
+    EXPECT_EQ(0x20000U - 100U, getNextDelta(0xFFFFFFF6U));
+
+    update(fTimer, 0x1000U);
+
+    EXPECT_CALL(fTimeoutMock2, expired()).Times(2);
+    update(fTimer, now + 0x20000U);
+    update(fTimer, now + 0x40000U);
+    EXPECT_EQ(0x20000U, getNextDelta(now + 0x40000U));
+}
+
+TEST_F(TimingWheelTimerTest, timeout_set_with_outdated_time_is_due_immediately)
+{
+    fTimer.set(fTimeoutMock1, 1000U, 0U);
+    update(fTimer, 500U);
+
+    // now is older than the last processed time
+    fTimer.set(fTimeoutMock2, 10U, 100U);
+    EXPECT_EQ(0U, getNextDelta(500U));
+
+    EXPECT_CALL(fTimeoutMock2, expired());
+    update(fTimer, 500U);
+    EXPECT_EQ(500U, getNextDelta(500U));
+
+    EXPECT_CALL(fTimeoutMock1, expired());
+    update(fTimer, 1000U);
+}
+
+TEST_F(TimingWheelTimerTest, can_handle_recovery_of_cyclic_timeout_that_is_far_behind)
+{
+    fTimer.setCyclic(fTimeoutMock1, 10U, 0U);
+
+    // only a timeout expiring exactly at now requests further processing
+    EXPECT_CALL(fTimeoutMock1, expired());
+    EXPECT_FALSE(fTimer.processNextTimeout(50U));
+    EXPECT_EQ(0U, getNextDelta(50U));
+
+    EXPECT_CALL(fTimeoutMock1, expired()).Times(4);
+    for (uint8_t i = 0U; i < 3U; ++i)
+    {
+        EXPECT_FALSE(fTimer.processNextTimeout(50U));
+    }
+    EXPECT_TRUE(fTimer.processNextTimeout(50U));
+    EXPECT_EQ(10U, getNextDelta(50U));
+}
+
+TEST_F(TimingWheelTimerTest, timeout_can_be_rescheduled_in_expired_callback)
+{
+    fTimer.setCyclic(fTimeoutMock1, 100U, 0U);
+
+    EXPECT_CALL(fTimeoutMock1, expired())
+        .WillOnce(Invoke(
+            [this]()
+            {
+                fTimer.cancel(fTimeoutMock1);
+                fTimer.set(fTimeoutMock1, 50U, 100U);
+            }));
+    update(fTimer, 100U);
+    EXPECT_EQ(50U, getNextDelta(100U));
+
+    EXPECT_CALL(fTimeoutMock1, expired());
+    update(fTimer, 150U);
+    update(fTimer, 300U);
+}
+
+TEST_F(TimingWheelTimerTest, due_timeouts_expire_in_batches)
+{
+    static size_t const TIMEOUT_COUNT = ::timer::TimeoutBatch<>::CAPACITY + 1U;
+    StrictMock<TimeoutMock> timeouts[TIMEOUT_COUNT];
+    fTimer.setCyclic(fTimeoutMock1, 400U, 0U);
+    for (auto& timeout : timeouts)
+    {
+        fTimer.set(timeout, 1000U, 0U);
+    }
+
+    // the cyclic timeout is due twice and rescheduled within the first batch
+    {
+        InSequence seq;
+        EXPECT_CALL(fTimeoutMock1, expired()).Times(2U);
+        for (size_t i = 0U; i < TIMEOUT_COUNT; ++i)
+        {
+            EXPECT_CALL(timeouts[i], expired());
+        }
+    }
+    EXPECT_TRUE(fTimer.processDueTimeouts(1000U));
+    EXPECT_FALSE(fTimer.processDueTimeouts(1000U));
+    EXPECT_EQ(200U, getNextDelta(1000U));
+    fTimer.cancel(fTimeoutMock1);
+}
+
+/**
+ * Runs the same random sequence of timeout operations against the sorted list timer and the timing
+ * wheel and checks that timeouts expire in the same order.
+ */
+void TimingWheelTimerTest::crossCheckWithSortedListTimer(bool const batched)
+{
+    static size_t const TIMEOUT_COUNT = 200U;
+    ::etl::vector<RecordingTimeout const*, 1000U> wheelExpired;
+    ::etl::vector<RecordingTimeout const*, 1000U> listExpired;
+    RecordingTimeout wheelTimeouts[TIMEOUT_COUNT];
+    RecordingTimeout listTimeouts[TIMEOUT_COUNT];
+    TimingWheelTimer<NoLock, 3U> wheel;
+    ::timer::Timer<NoLock> list;
+    // the sorted list timer with batched expiry is checked against the single expiry, too
+    ::etl::vector<RecordingTimeout const*, 1000U> batchedListExpired;
+    RecordingTimeout batchedListTimeouts[TIMEOUT_COUNT];
+    ::timer::Timer<NoLock> batchedList;
+
+    uint32_t random       = 12345U;
+    auto const nextRandom = [&random]()
+    {
+        random = (random * 1103515245U) + 12345U;
+        return random >> 8U;
+    };
+
+    uint32_t now = 0xFFF00000U;
+    for (size_t i = 0U; i < TIMEOUT_COUNT; ++i)
+    {
+        wheelTimeouts[i]._expired       = &wheelExpired;
+        listTimeouts[i]._expired        = &listExpired;
+        batchedListTimeouts[i]._expired = &batchedListExpired;
+        uint32_t const delay            = nextRandom() % ((i % 2U) == 0U ? 0x400U : 0x400000U);
+        if ((i % 3U) == 0U)
+        {
+            EXPECT_EQ(
+                list.setCyclic(listTimeouts[i], delay + 0x100U, now),
+                wheel.setCyclic(wheelTimeouts[i], delay + 0x100U, now));
+            batchedList.setCyclic(batchedListTimeouts[i], delay + 0x100U, now);
+        }
+        else
+        {
+            EXPECT_EQ(
+                list.set(listTimeouts[i], delay, now), wheel.set(wheelTimeouts[i], delay, now));
+            batchedList.set(batchedListTimeouts[i], delay, now);
+        }
+    }
+
+    for (size_t step = 0U; step < 2000U; ++step)
+    {
+        now += nextRandom() % 0x400U;
+        size_t const idx = nextRandom() % TIMEOUT_COUNT;
+        if ((step % 7U) == 0U)
+        {
+            list.cancel(listTimeouts[idx]);
+            wheel.cancel(wheelTimeouts[idx]);
+            batchedList.cancel(batchedListTimeouts[idx]);
+        }
+        else if ((step % 5U) == 0U)
+        {
+            uint32_t const delay = nextRandom() % 0x10000U;
+            EXPECT_EQ(
+                list.set(listTimeouts[idx], delay, now), wheel.set(wheelTimeouts[idx], delay, now));
+            batchedList.set(batchedListTimeouts[idx], delay, now);
+        }
+        update(list, now);
+        if (batched)
+        {
+            updateBatched(wheel, now);
+            updateBatched(batchedList, now);
+        }
+        else
+        {
+            update(wheel, now);
+        }
+
+        uint32_t listDelta  = 0U;
+        uint32_t wheelDelta = 0U;
+        ASSERT_EQ(list.getNextDelta(now, listDelta), wheel.getNextDelta(now, wheelDelta));
+        ASSERT_EQ(listDelta, wheelDelta);
+        ASSERT_EQ(listExpired.size(), wheelExpired.size());
+        for (size_t i = 0U; i < listExpired.size(); ++i)
+        {
+            ASSERT_EQ(listExpired[i] - &listTimeouts[0], wheelExpired[i] - &wheelTimeouts[0]);
+        }
+        if (batched)
+        {
+            ASSERT_EQ(listExpired.size(), batchedListExpired.size());
+            for (size_t i = 0U; i < listExpired.size(); ++i)
+            {
+                ASSERT_EQ(
+                    listExpired[i] - &listTimeouts[0],
+                    batchedListExpired[i] - &batchedListTimeouts[0]);
+            }
+        }
+        listExpired.clear();
+        wheelExpired.clear();
+        batchedListExpired.clear();
+    }
+}
+
+TEST_F(TimingWheelTimerTest, behaves_like_sorted_list_timer)
+{
+    crossCheckWithSortedListTimer(false);
+}
+
+TEST_F(TimingWheelTimerTest, batched_expiry_behaves_like_single_expiry)
+{
+    crossCheckWithSortedListTimer(true);
+}
+
+} // anonymous namespace
@@ -0,0 +1,90 @@
+// Copyright 2025 Accenture.
+
+/**
+ * \ingroup transport
+ */
+#pragma once
+
+#include "transport/AbstractTransportLayer.h"
+#include "transport/ITransportMessageProcessedListener.h"
+
+#include <async/Coroutine.h>
+
+namespace transport
+{
+/**
+ * Awaitable waiting within an async::Task until a TransportMessage has been processed.
+ *
+ * The awaiter is the ITransportMessageProcessedListener passed to the send function when the task
+ * suspends. The send function returns whether the message has been accepted. The task is resumed
+ * within its context once the message has been processed, co_await returns the processing
+ * result. A message that isn't accepted results in PROCESSED_ERROR_GENERAL without suspending.
+ *
+ * \tparam SendFunction callable type with signature bool(ITransportMessageProcessedListener&)
+ */
+template<class SendFunction>
+class TransportMessageProcessedAwaiter : public ITransportMessageProcessedListener
+{
+public:
+    explicit TransportMessageProcessedAwaiter(SendFunction const& sendFunction)
+    : _sendFunction(sendFunction)
+    {}
+
+    TransportMessageProcessedAwaiter(TransportMessageProcessedAwaiter const&) = delete;
+
+    bool await_ready() const noexcept { return false; }
+
+    bool await_suspend(::async::Task::HandleType const handle)
+    {
+        _task = &handle.promise();
+        if (!_sendFunction(*this))
+        {
+            _result = ProcessingResult::PROCESSED_ERROR_GENERAL;
+            return false;
+        }
+        return true;
+    }
+
+    ProcessingResult await_resume() const { return _result; }
+
+    void transportMessageProcessed(
+        TransportMessage& /* transportMessage */, ProcessingResult const result) override
+    {
+        _result = result;
+        _task->resume();
+    }
+
+private:
+    SendFunction _sendFunction;
+    ::async::Task::promise_type* _task = nullptr;
+    ProcessingResult _result           = ProcessingResult::PROCESSED_ERROR_GENERAL;
+};
+
+/**
+ * Send a message using a custom send function and continue the awaiting task once the message
+ * has been processed.
+ * \param sendFunction function sending the message, notifying the given listener
+ */
+template<class SendFunction>
+TransportMessageProcessedAwaiter<SendFunction> processed(SendFunction const& sendFunction)
+{
+    return TransportMessageProcessedAwaiter<SendFunction>(sendFunction);
+}
+
+/**
+ * Send a message by a transport layer and continue the awaiting task once the message has been
+ * processed.
+ * \param layer transport layer to send the message
+ * \param transportMessage message to send
+ */
+inline auto send(AbstractTransportLayer& layer, TransportMessage& transportMessage)
+{
+    return processed(
+        [&layer, &transportMessage](ITransportMessageProcessedListener& listener)
+        {
+            return layer.send(transportMessage, &listener)
+                   == AbstractTransportLayer::ErrorCode::TP_OK;
+        });
+}
+
+} // namespace transport
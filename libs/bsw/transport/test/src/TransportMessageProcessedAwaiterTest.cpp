@@ -0,0 +1,84 @@
+// Copyright 2025 Accenture.
+
+#include "transport/TransportMessageProcessedAwaiter.h"
+
+#include "transport/AbstractTransportLayerMock.h"
+#include "transport/TransportMessage.h"
+
+#include <async/AsyncMock.h>
+#include <async/TestContext.h>
+
+#include <gmock/gmock.h>
+
+using namespace ::transport;
+using namespace ::testing;
+
+namespace
+{
+using ProcessingResult = ITransportMessageProcessedListener::ProcessingResult;
+
+::async::ContextType const CONTEXT = 1U;
+
+::async::Task sendMessage(
+    ::async::ContextType const /* context */,
+    AbstractTransportLayer& layer,
+    TransportMessage& message,
+    ProcessingResult& result)
+{
+    result = co_await ::transport::send(layer, message);
+}
+
+class TransportMessageProcessedAwaiterTest : public Test
+{
+public:
+    TransportMessageProcessedAwaiterTest() : _context(CONTEXT), _layer(0U), _arena(CONTEXT)
+    {
+        _context.handleAll();
+    }
+
+protected:
+    NiceMock<::async::AsyncMock> _asyncMock;
+    ::async::TestContext _context;
+    StrictMock<AbstractTransportLayerMock> _layer;
+    ::async::StaticFrameArena<256U, 1U> _arena;
+    TransportMessage _message;
+    ITransportMessageProcessedListener* _listener = nullptr;
+    ProcessingResult _result                      = ProcessingResult::PROCESSED_NO_ERROR;
+};
+
+/**
+ * \desc
+ * The task continues within its context with the result of processing the message.
+ */
+TEST_F(TransportMessageProcessedAwaiterTest, testTaskContinuesAfterMessageIsProcessed)
+{
+    sendMessage(CONTEXT, _layer, _message, _result).start();
+    EXPECT_CALL(_layer, send(Ref(_message), NotNull()))
+        .WillOnce(DoAll(
+            SaveArg<1>(&_listener), Return(AbstractTransportLayer::ErrorCode::TP_OK)));
+    _context.execute();
+    ASSERT_NE(nullptr, _listener);
+    EXPECT_EQ(ProcessingResult::PROCESSED_NO_ERROR, _result);
+
+    _listener->transportMessageProcessed(_message, ProcessingResult::PROCESSED_ERROR_TIMEOUT);
+    EXPECT_EQ(ProcessingResult::PROCESSED_NO_ERROR, _result);
+    _context.execute();
+    EXPECT_EQ(ProcessingResult::PROCESSED_ERROR_TIMEOUT, _result);
+    EXPECT_EQ(1U, _arena.getFreeCount());
+}
+
+/**
+ * \desc
+ * A message that isn't accepted by the transport layer continues the task immediately.
+ */
+TEST_F(TransportMessageProcessedAwaiterTest, testMessageNotAccepted)
+{
+    sendMessage(CONTEXT, _layer, _message, _result).start();
+    EXPECT_CALL(_layer, send(Ref(_message), NotNull()))
+        .WillOnce(Return(AbstractTransportLayer::ErrorCode::TP_QUEUE_FULL));
+    _context.execute();
+    EXPECT_EQ(ProcessingResult::PROCESSED_ERROR_GENERAL, _result);
+    EXPECT_EQ(1U, _arena.getFreeCount());
+}
+
+} // namespace
@@ -0,0 +1,50 @@
+// Copyright 2025 Accenture.
+
+#include <benchmark/benchmark.h>
+#include <etl/array.h>
+#include <util/crc/Crc16.h>
+#include <util/crc/Crc32.h>
+#include <util/crc/Crc8.h>
+
+#include <cstdint>
+
+namespace
+{
+constexpr size_t MAX_LENGTH = 4096U;
+
+::etl::array<uint8_t, MAX_LENGTH> const& data()
+{
+    static ::etl::array<uint8_t, MAX_LENGTH> buffer = []()
+    {
+        ::etl::array<uint8_t, MAX_LENGTH> b{};
+        for (size_t i = 0U; i < MAX_LENGTH; ++i)
+        {
+            b[i] = static_cast<uint8_t>(i * 31U);
+        }
+        return b;
+    }();
+    return buffer;
+}
+} // namespace
+
+/**
+ * Benchmarks the CRC calculation of a buffer of a given length.
+ */
+template<typename Crc>
+void BM_crc(benchmark::State& state)
+{
+    size_t const length = static_cast<size_t>(state.range(0));
+    Crc crc;
+    for (auto _ : state)
+    {
+        crc.init();
+        (void)crc.update(data().data(), length);
+        benchmark::DoNotOptimize(crc.digest());
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) * state.range(0));
+}
+
+BENCHMARK_TEMPLATE(BM_crc, ::util::crc::Crc8::Ccitt)->Arg(8)->Arg(64)->Arg(4096);
+BENCHMARK_TEMPLATE(BM_crc, ::util::crc::Crc8::Rohc)->Arg(8)->Arg(64)->Arg(4096);
+BENCHMARK_TEMPLATE(BM_crc, ::util::crc::Crc16::Ccitt)->Arg(8)->Arg(64)->Arg(4096);
+BENCHMARK_TEMPLATE(BM_crc, ::util::crc::Crc32::Ethernet)->Arg(8)->Arg(64)->Arg(4096);
@@ -0,0 +1,228 @@
+// Copyright 2025 Accenture.
+
+#include <benchmark/benchmark.h>
+#include <etl/array.h>
+#include <util/spsc/Queue.h>
+
+#include <atomic>
+#include <cstdint>
+#include <thread>
+
+#include <pthread.h>
+#include <sched.h>
+
+namespace
+{
+using Item  = ::etl::array<uint32_t, 4U>;
+using Queue = ::util::spsc::Queue<Item, 256U>;
+
+constexpr size_t ITEMS_PER_ITERATION = 1024U * 16U;
+constexpr size_t CACHE_LINE_SIZE     = 64U;
+constexpr size_t BATCH_SIZE          = 32U;
+
+/**
+ * Pins the calling thread to the given core, modulo the number of available cores.
+ */
+void pinToCore(unsigned const core)
+{
+    unsigned const cores = ::std::thread::hardware_concurrency();
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    CPU_SET((cores > 0U) ? (core % cores) : 0U, &set);
+    (void)pthread_setaffinity_np(pthread_self(), sizeof(set), &set);
+}
+
+/**
+ * Restores the affinity of the calling thread to all available cores.
+ */
+void unpin()
+{
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    for (unsigned i = 0U; i < ::std::thread::hardware_concurrency(); ++i)
+    {
+        CPU_SET(i, &set);
+    }
+    (void)pthread_setaffinity_np(pthread_self(), sizeof(set), &set);
+}
+
+/**
+ * Transfers ITEMS_PER_ITERATION elements from a producer thread pinned to core 1 to the calling
+ * thread pinned to core 0. A batch size of one writes and reads single elements after checking
+ * full() and empty(), larger batch sizes use write_n() and read_n().
+ */
+template<class Q>
+uint32_t pinnedTransfer(Q& q, size_t const batch)
+{
+    ::std::thread producer(
+        [&q, batch]()
+        {
+            pinToCore(1U);
+            typename Q::Sender sender(q);
+            ::etl::array<Item, BATCH_SIZE> items{};
+            size_t i = 0U;
+            while (i < ITEMS_PER_ITERATION)
+            {
+                if (batch == 1U)
+                {
+                    if (sender.full())
+                    {
+                        ::std::this_thread::yield();
+                        continue;
+                    }
+                    items[0][0] = static_cast<uint32_t>(i);
+                    sender.write(items[0]);
+                    ++i;
+                }
+                else
+                {
+                    for (size_t n = 0U; n < batch; ++n)
+                    {
+                        items[n][0] = static_cast<uint32_t>(i + n);
+                    }
+                    size_t const count
+                        = sender.write_n(::etl::span<Item const>(items.data(), batch));
+                    if (count == 0U)
+                    {
+                        ::std::this_thread::yield();
+                    }
+                    i += count;
+                }
+            }
+        });
+
+    typename Q::Receiver receiver(q);
+    ::etl::array<Item, BATCH_SIZE> items{};
+    uint32_t sum = 0U;
+    size_t i     = 0U;
+    while (i < ITEMS_PER_ITERATION)
+    {
+        if (batch == 1U)
+        {
+            if (receiver.empty())
+            {
+                ::std::this_thread::yield();
+                continue;
+            }
+            sum += receiver.read()[0];
+            ++i;
+        }
+        else
+        {
+            size_t const count = receiver.read_n(::etl::span<Item>(items.data(), batch));
+            if (count == 0U)
+            {
+                ::std::this_thread::yield();
+            }
+            for (size_t n = 0U; n < count; ++n)
+            {
+                sum += items[n][0];
+            }
+            i += count;
+        }
+    }
+    producer.join();
+    return sum;
+}
+
+template<class Q>
+void pinnedTransferBenchmark(benchmark::State& state)
+{
+    Q q;
+    size_t const batch = static_cast<size_t>(state.range(0));
+    pinToCore(0U);
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(pinnedTransfer(q, batch));
+    }
+    unpin();
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * ITEMS_PER_ITERATION));
+}
+} // namespace
+
+/**
+ * Benchmarks writing and reading a single element within one thread.
+ */
+void BM_spsc_queue_write_read(benchmark::State& state)
+{
+    Queue q;
+    Queue::Sender sender(q);
+    Queue::Receiver receiver(q);
+    Item item{};
+
+    for (auto _ : state)
+    {
+        sender.write(item);
+        item = receiver.read();
+        ++item[0];
+    }
+    benchmark::DoNotOptimize(item);
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()));
+}
+
+BENCHMARK(BM_spsc_queue_write_read);
+
+/**
+ * Benchmarks the transfer of elements from a producer thread to a consumer thread.
+ */
+void BM_spsc_queue_transfer(benchmark::State& state)
+{
+    Queue q;
+
+    for (auto _ : state)
+    {
+        std::thread producer(
+            [&q]()
+            {
+                Queue::Sender sender(q);
+                Item item{};
+                for (size_t i = 0U; i < ITEMS_PER_ITERATION; ++i)
+                {
+                    while (sender.full())
+                    {
+                        std::this_thread::yield();
+                    }
+                    item[0] = static_cast<uint32_t>(i);
+                    sender.write(item);
+                }
+            });
+
+        Queue::Receiver receiver(q);
+        uint32_t sum = 0U;
+        for (size_t i = 0U; i < ITEMS_PER_ITERATION; ++i)
+        {
+            while (receiver.empty())
+            {
+                std::this_thread::yield();
+            }
+            sum += receiver.read()[0];
+        }
+        producer.join();
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * ITEMS_PER_ITERATION));
+}
+
+BENCHMARK(BM_spsc_queue_transfer)->UseRealTime();
+
+/**
+ * Benchmarks the transfer of elements between threads pinned to different cores, with the data of
+ * both ends of the queue next to each other.
+ */
+void BM_spsc_queue_pinned_transfer(benchmark::State& state)
+{
+    pinnedTransferBenchmark<Queue>(state);
+}
+
+BENCHMARK(BM_spsc_queue_pinned_transfer)->Arg(1)->Arg(BATCH_SIZE)->UseRealTime();
+
+/**
+ * Benchmarks the transfer of elements between threads pinned to different cores, with the data of
+ * both ends of the queue on separate cache lines.
+ */
+void BM_spsc_queue_pinned_transfer_aligned(benchmark::State& state)
+{
+    pinnedTransferBenchmark<::util::spsc::Queue<Item, 256U, false, CACHE_LINE_SIZE>>(state);
+}
+
+BENCHMARK(BM_spsc_queue_pinned_transfer_aligned)->Arg(1)->Arg(BATCH_SIZE)->UseRealTime();
@@ -4,6 +4,7 @@
 
 #include <etl/array.h>
 #include <etl/atomic.h>
+#include <etl/span.h>
 
 #include <platform/estdint.h>
 
@@ -15,8 +16,20 @@ namespace internal
 {
 template<class T, size_t N, bool TrackConsumed>
 struct TxData;
+
+template<size_t N>
+inline size_t distance(size_t const from, size_t const to)
+{
+    return (to + ((to < from) ? 1U : 0U) * (2U * N)) - from;
 }
 
+template<size_t CacheLineSize>
+constexpr size_t alignment(size_t const naturalAlignment)
+{
+    return (CacheLineSize > naturalAlignment) ? CacheLineSize : naturalAlignment;
+}
+} // namespace internal
+
 /**
  * Lock-free implementation of a single-producer, single-consumer queue.
  * Provides two nested classes "Sender" and "Receiver" to be used on the sending and receiving
@@ -28,16 +41,27 @@ struct TxData;
  * will keep track of what elements have been consumed by the receiving end.
  * In this case the method Queue::Sender::checkConsumed(F) can be used with F being a callable
  * that will be called for each element that is already consumed.
+ *
+ * Optionally a fourth template parameter CacheLineSize can be provided. If it is not 0, the data
+ * of the sending and of the receiving end are aligned to separate cache lines of this size, so
+ * that writing the index of one end doesn't invalidate the cache line holding the index of the
+ * other end. Such a queue is over-aligned and must not be allocated with new before C++17.
+ *
+ * Each end caches the last index it has loaded from the other end and only loads it again when
+ * the queue appears to be full or empty, respectively.
  */
 template<
     class T,
     uint16_t N, // N is intentionally a smaller type than size_t used for storing
                 // the indices, to ensure (2*N) does never overflow.
-    bool TrackConsumed = false>
+    bool TrackConsumed   = false,
+    size_t CacheLineSize = 0U>
 class Queue
 {
     // Just make sure, in case someone ever compiles this for a 16bit or 8bit target.
     static_assert(sizeof(uint16_t) < sizeof(size_t), "");
+    static_assert(
+        (CacheLineSize & (CacheLineSize - 1U)) == 0U, "CacheLineSize must be a power of 2");
 
     // The tx.sent and rx.received variables are always in the range [0, 2*N] while the ring
     // contains N elements. This way there are two distinct constellations where
@@ -50,16 +74,18 @@ class Queue
     //
     using TxData = internal::TxData<T, N, TrackConsumed>;
 
-    TxData tx;
-
     struct RxData
     {
         ::etl::atomic<size_t> received;
+        // last value of tx.sent loaded by the receiving end. It is only accessed by the single
+        // receiving end, so refreshing it from const observers like empty() is safe.
+        mutable size_t sent;
 
-        RxData() : received(0U) {}
+        RxData() : received(0U), sent(0U) {}
     };
 
-    RxData rx;
+    alignas(internal::alignment<CacheLineSize>(alignof(TxData))) TxData tx;
+    alignas(internal::alignment<CacheLineSize>(alignof(RxData))) RxData rx;
 
 public:
     using value_type = T;
@@ -69,6 +95,7 @@ public:
     void reset()
     {
         rx.received.store(0U);
+        rx.sent = 0U;
         tx.reset();
     }
 
@@ -95,19 +122,20 @@ public:
 
         explicit Receiver(Queue& queue) : _txData(queue.tx), _rxData(queue.rx) {}
 
-        bool empty() const
-        {
-            size_t const received = _rxData.received.load();
-            size_t const sent     = _txData.sent.load();
-            return sent == received;
-        }
+        bool empty() const { return available(1U) == 0U; }
 
         T read() { return *Read(*this); }
 
         void advance()
         {
             size_t const received = _rxData.received.load();
-            _rxData.received.store((received + 1U) % (2U * static_cast<size_t>(N)));
+            size_t const next     = (received + 1U) % (2U * static_cast<size_t>(N));
+            // keep the cached index from falling behind if peek() is used without empty()
+            if (_rxData.sent == received)
+            {
+                _rxData.sent = next;
+            }
+            _rxData.received.store(next);
         }
 
         T& peek() const { return _txData.data[_rxData.received.load() % N]; }
@@ -115,8 +143,28 @@ public:
         size_t size() const
         {
             size_t const received = _rxData.received.load();
-            size_t const sent     = _txData.sent.load();
-            return (sent + ((sent < received) ? 1U : 0U) * (2U * N)) - received;
+            _rxData.sent          = _txData.sent.load();
+            return internal::distance<N>(received, _rxData.sent);
+        }
+
+        /**
+         * Reads up to values.size() elements into values and releases them at once.
+         * \return number of elements read
+         */
+        size_t read_n(::etl::span<T> const values)
+        {
+            size_t const received = _rxData.received.load();
+            size_t count          = available(values.size());
+            count                 = (count < values.size()) ? count : values.size();
+            for (size_t i = 0U; i < count; ++i)
+            {
+                values[i] = _txData.data[(received + i) % N];
+            }
+            if (count > 0U)
+            {
+                _rxData.received.store((received + count) % (2U * static_cast<size_t>(N)));
+            }
+            return count;
         }
 
         void clear()
@@ -128,6 +176,22 @@ public:
         }
 
     private:
+        /**
+         * Returns the number of elements available for reading. The index of the sending end is
+         * only loaded if less than required elements are available according to the cached one.
+         */
+        size_t available(size_t const required) const
+        {
+            size_t const received = _rxData.received.load();
+            size_t numAvailable   = internal::distance<N>(received, _rxData.sent);
+            if (numAvailable < required)
+            {
+                _rxData.sent = _txData.sent.load();
+                numAvailable = internal::distance<N>(received, _rxData.sent);
+            }
+            return numAvailable;
+        }
+
         TxData& _txData;
         RxData& _rxData;
     };
@@ -166,6 +230,7 @@ public:
         void write_next()
         {
             size_t const sent = _txData.sent.load();
+            _txData.advance(sent);
             _txData.sent.store((sent + 1U) % (2U * static_cast<size_t>(N)));
         }
 
@@ -173,10 +238,30 @@ public:
         {
             size_t const sent     = _txData.sent.load();
             size_t const received = _rxData.received.load();
-            return (sent + ((sent < received) ? 1U : 0U) * (2U * N)) - received;
+            return internal::distance<N>(received, sent);
         }
 
-        bool full() const { return _txData.full(_rxData); }
+        bool full() const { return _txData.free(_rxData, 1U) == 0U; }
+
+        /**
+         * Writes as many elements of values as there is space left and publishes them at once.
+         * \return number of elements written
+         */
+        size_t write_n(::etl::span<T const> const values)
+        {
+            size_t const sent    = _txData.sent.load();
+            size_t const numFree = _txData.free(_rxData, values.size());
+            size_t const count   = (numFree < values.size()) ? numFree : values.size();
+            for (size_t i = 0U; i < count; ++i)
+            {
+                _txData.data[(sent + i) % N] = values[i];
+            }
+            if (count > 0U)
+            {
+                _txData.sent.store((sent + count) % (2U * static_cast<size_t>(N)));
+            }
+            return count;
+        }
 
     private:
         RxData const& _rxData;
@@ -213,12 +298,16 @@ struct TxData
         }
     }
 
+    void advance(size_t /*numSent*/) {}
+
+    /**
+     * Returns the number of elements that can be written before the queue is full, i.e. before
+     * the consumed elements have been checked.
+     */
     template<class RxData>
-    bool full(RxData const& /*rxData*/) const
+    size_t free(RxData const& /*rxData*/, size_t /*required*/) const
     {
-        size_t const numSent  = sent.load();
-        size_t const numAcked = acked.load();
-        return (numSent == ((numAcked + N) % (2U * N)));
+        return N - distance<N>(acked.load(), sent.load());
     }
 };
 
@@ -226,18 +315,47 @@ template<class T, size_t N>
 struct TxData<T, N, false>
 {
     ::etl::atomic<size_t> sent;
+    // last value of rx.received loaded by the sending end. It is only accessed by the single
+    // sending end, so refreshing it from const observers like full() is safe.
+    mutable size_t received;
     ::etl::array<T, N> data;
 
-    TxData() : sent(0U), data() {}
+    TxData() : sent(0U), received(0U), data() {}
+
+    void reset()
+    {
+        sent.store(0U);
+        received = 0U;
+    }
 
-    void reset() { sent.store(0U); }
+    /**
+     * Keeps the cached index of the receiving end from falling behind if elements are written
+     * without checking full().
+     */
+    void advance(size_t const numSent)
+    {
+        if (distance<N>(received, numSent) == N)
+        {
+            received = (received + 1U) % (2U * N);
+        }
+    }
 
+    /**
+     * Returns the number of elements that can be written before the queue is full. The index of
+     * the receiving end is only loaded if less than required elements are free according to the
+     * cached one.
+     */
     template<class RxData>
-    bool full(RxData const& rxData) const
+    size_t free(RxData const& rxData, size_t const required) const
     {
-        size_t const numSent     = sent.load();
-        size_t const numReceived = rxData.received.load();
-        return (numSent == (numReceived + N) % (2U * N));
+        size_t const numSent = sent.load();
+        size_t used          = distance<N>(received, numSent);
+        if ((N - used) < required)
+        {
+            received = rxData.received.load();
+            used     = distance<N>(received, numSent);
+        }
+        return N - used;
     }
 };
 } // namespace internal
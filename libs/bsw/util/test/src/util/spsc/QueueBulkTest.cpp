@@ -0,0 +1,161 @@
+// Copyright 2025 Accenture.
+
+#include "util/spsc/Queue.h"
+
+#include <etl/span.h>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+namespace
+{
+using namespace ::testing;
+
+struct SpScBulk : public ::testing::Test
+{
+    using IntQueue = util::spsc::Queue<uint16_t, 6>;
+
+    IntQueue queue;
+    IntQueue::Sender sender;
+    IntQueue::Receiver receiver;
+
+    SpScBulk() : sender(queue), receiver(queue) {}
+};
+
+class OnConsumed
+{
+public:
+    MOCK_CONST_METHOD1(called, void(uint16_t));
+
+    void operator()(uint16_t& x) const { called(x); }
+};
+
+TEST_F(SpScBulk, write_n_and_read_n)
+{
+    uint16_t const values[] = {1, 2, 3, 4, 5, 6, 7, 8};
+    uint16_t read[8]        = {};
+
+    EXPECT_EQ(0U, receiver.read_n(read));
+    EXPECT_EQ(4U, sender.write_n(::etl::span<uint16_t const>(values, 4U)));
+    EXPECT_EQ(4U, receiver.size());
+    EXPECT_EQ(2U, sender.write_n(::etl::span<uint16_t const>(values).subspan(4U)));
+    EXPECT_TRUE(sender.full());
+    EXPECT_EQ(0U, sender.write_n(values));
+
+    EXPECT_EQ(3U, receiver.read_n(::etl::span<uint16_t>(read, 3U)));
+    EXPECT_THAT(::etl::span<uint16_t>(read, 3U), ElementsAre(1, 2, 3));
+    EXPECT_FALSE(sender.full());
+
+    // wraps around the end of the ring
+    EXPECT_EQ(3U, sender.write_n(values));
+    EXPECT_TRUE(sender.full());
+    EXPECT_EQ(6U, receiver.read_n(read));
+    EXPECT_THAT(::etl::span<uint16_t>(read, 6U), ElementsAre(4, 5, 6, 1, 2, 3));
+    EXPECT_TRUE(receiver.empty());
+    EXPECT_EQ(0U, receiver.size());
+}
+
+TEST_F(SpScBulk, write_n_and_read_n_mixed_with_single_elements)
+{
+    uint16_t const values[] = {1, 2, 3, 4, 5, 6};
+    uint16_t read[6]        = {};
+
+    for (uint16_t i = 0U; i < 20U; ++i)
+    {
+        sender.write(i);
+        EXPECT_EQ(5U, sender.write_n(values));
+        EXPECT_TRUE(sender.full());
+        EXPECT_EQ(i, receiver.read());
+        EXPECT_EQ(5U, receiver.read_n(read));
+        EXPECT_THAT(::etl::span<uint16_t>(read, 5U), ElementsAre(1, 2, 3, 4, 5));
+        EXPECT_TRUE(receiver.empty());
+    }
+}
+
+TEST_F(SpScBulk, cached_indices_are_updated_when_full_or_empty)
+{
+    IntQueue::Sender otherSender(queue);
+    IntQueue::Receiver otherReceiver(queue);
+
+    EXPECT_TRUE(otherReceiver.empty());
+    for (uint16_t i = 0U; i < 6U; ++i)
+    {
+        otherSender.write(i);
+    }
+    EXPECT_TRUE(sender.full());
+    EXPECT_FALSE(receiver.empty());
+    EXPECT_EQ(0, otherReceiver.read());
+    EXPECT_FALSE(otherSender.full());
+    receiver.clear();
+    EXPECT_TRUE(otherReceiver.empty());
+    EXPECT_EQ(0U, sender.size());
+}
+
+TEST_F(SpScBulk, cached_indices_stay_valid_without_checking_full_or_empty)
+{
+    uint16_t const values[] = {1, 2, 3, 4, 5, 6};
+    uint16_t read[6]        = {};
+
+    sender.write(0);
+    sender.write(0);
+    sender.write(0);
+    for (uint16_t i = 0U; i < 30U; ++i)
+    {
+        sender.write(i);
+        (void)receiver.read();
+    }
+    EXPECT_EQ(3U, sender.write_n(values));
+    EXPECT_EQ(6U, receiver.read_n(read));
+    EXPECT_THAT(read, ElementsAre(27, 28, 29, 1, 2, 3));
+    EXPECT_TRUE(receiver.empty());
+}
+
+TEST_F(SpScBulk, reset_resets_cached_indices)
+{
+    for (uint16_t i = 0U; i < 6U; ++i)
+    {
+        sender.write(i);
+    }
+    EXPECT_FALSE(receiver.empty());
+    queue.reset();
+    EXPECT_TRUE(receiver.empty());
+    EXPECT_FALSE(sender.full());
+    sender.write(7);
+    EXPECT_EQ(7, receiver.read());
+}
+
+TEST_F(SpScBulk, track_consumed_limits_write_n)
+{
+    using Q = util::spsc::Queue<uint16_t, 6, true>;
+    Q q;
+    Q::Sender s(q);
+    Q::Receiver r(q);
+    uint16_t const values[] = {1, 2, 3, 4, 5, 6};
+    uint16_t read[6]        = {};
+
+    EXPECT_EQ(6U, s.write_n(values));
+    EXPECT_EQ(6U, r.read_n(read));
+    EXPECT_TRUE(s.full());
+    EXPECT_EQ(0U, s.write_n(values));
+
+    OnConsumed onConsumed;
+    EXPECT_CALL(onConsumed, called(_)).Times(6);
+    s.checkConsumed(onConsumed);
+    EXPECT_EQ(6U, s.write_n(values));
+}
+
+TEST(SpScCacheLineSize, sender_and_receiver_data_on_separate_cache_lines)
+{
+    using Q = util::spsc::Queue<uint16_t, 6, false, 64U>;
+    static_assert(alignof(Q) == 64U, "");
+    static_assert(sizeof(Q) == 128U, "");
+
+    Q q;
+    Q::Sender s(q);
+    Q::Receiver r(q);
+    s.write(3);
+    EXPECT_EQ(3, r.read());
+    EXPECT_TRUE(r.empty());
+}
+
+} // namespace
@@ -0,0 +1,23 @@
+// Copyright 2025 Accenture.
+
+#include "interrupts/suspendResumeAllInterrupts.h"
+
+#include <async/Lock.h>
+
+void main_thread_setup(void) {}
+
+OldIntEnabledStatusValueType getOldIntEnabledStatusValueAndSuspendAllInterrupts(void)
+{
+    // There are no interrupts to suspend on the host, all tasks are native threads. The critical
+    // section therefore shares the mutex of the async locks to exclude all other contexts.
+    ::async::internal::getLockMutex().lock();
+    return OldIntEnabledStatusValueType(1);
+}
+
+void resumeAllInterrupts(OldIntEnabledStatusValueType const oldIntEnabledStatusValue)
+{
+    if (oldIntEnabledStatusValue != 0)
+    {
+        ::async::internal::getLockMutex().unlock();
+    }
+}
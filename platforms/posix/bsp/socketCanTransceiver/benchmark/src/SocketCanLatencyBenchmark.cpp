@@ -0,0 +1,244 @@
+// Copyright 2025 Accenture.
+
+#include <benchmark/benchmark.h>
+#include <can/SocketCanTransceiver.h>
+#include <can/framemgmt/AbstractIntervalFilteredCANFrameListener.h>
+#include <linux/can.h>
+#include <net/if.h>
+#include <sys/ioctl.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <cstring>
+#include <mutex>
+#include <thread>
+
+/**
+ * These benchmarks need the SocketCAN interface vcan0, which can be set up with
+ *
+ *     sudo ip link add dev vcan0 type vcan && sudo ip link set up vcan0
+ *
+ * They are skipped if it doesn't exist.
+ */
+
+namespace
+{
+using Clock = ::std::chrono::steady_clock;
+
+constexpr char const* INTERFACE_NAME = "vcan0";
+constexpr uint32_t FRAME_ID          = 0x123U;
+// same limits and period as the CanSystem of the posix reference application
+constexpr int MAX_SENT_PER_RUN       = 3;
+constexpr int MAX_RECEIVED_PER_RUN   = 3;
+constexpr auto POLLING_PERIOD        = ::std::chrono::milliseconds(1);
+constexpr auto RECEIVE_TIMEOUT       = ::std::chrono::seconds(1);
+
+/**
+ * Records the time at which a frame has been passed to the listener.
+ */
+class Listener : public ::can::AbstractIntervalFilteredCANFrameListener
+{
+public:
+    Listener() : _receivedAt(0) { getFilter().add(FRAME_ID); }
+
+    void frameReceived(::can::CANFrame const&) override
+    {
+        _receivedAt.store(Clock::now().time_since_epoch().count());
+    }
+
+    ::std::atomic<Clock::rep> _receivedAt;
+};
+
+/**
+ * Emulates the CAN task, which calls run() either periodically or whenever the I/O thread of the
+ * transceiver asks for it. The I/O thread is started and stopped by the task itself, because the
+ * transceiver expects all calls except write() from the same context.
+ */
+class CanTask
+{
+public:
+    CanTask(::can::SocketCanTransceiver& transceiver, bool const eventDriven)
+    : _transceiver(transceiver)
+    , _eventDriven(eventDriven)
+    , _triggered(false)
+    , _stopped(false)
+    , _thread(&CanTask::loop, this)
+    {}
+
+    ~CanTask()
+    {
+        {
+            ::std::lock_guard<::std::mutex> const lock(_mutex);
+            _stopped = true;
+        }
+        _condition.notify_one();
+        _thread.join();
+    }
+
+    void trigger()
+    {
+        {
+            ::std::lock_guard<::std::mutex> const lock(_mutex);
+            _triggered = true;
+        }
+        _condition.notify_one();
+    }
+
+private:
+    void loop()
+    {
+        if (_eventDriven)
+        {
+            using IoReadyFunctionType = ::can::SocketCanTransceiver::IoReadyFunctionType;
+            _eventDriven              = _transceiver.startIoThread(
+                IoReadyFunctionType::create<CanTask, &CanTask::trigger>(*this));
+        }
+        ::std::unique_lock<::std::mutex> lock(_mutex);
+        while (!_stopped)
+        {
+            if (_eventDriven)
+            {
+                _condition.wait(lock, [this] { return _triggered || _stopped; });
+            }
+            else
+            {
+                _condition.wait_for(lock, POLLING_PERIOD, [this] { return _stopped; });
+            }
+            _triggered = false;
+            lock.unlock();
+            _transceiver.run(MAX_SENT_PER_RUN, MAX_RECEIVED_PER_RUN);
+            lock.lock();
+        }
+        lock.unlock();
+        _transceiver.stopIoThread();
+    }
+
+    ::can::SocketCanTransceiver& _transceiver;
+    bool _eventDriven;
+    bool _triggered;
+    bool _stopped;
+    ::std::mutex _mutex;
+    ::std::condition_variable _condition;
+    ::std::thread _thread;
+};
+
+/**
+ * \return a raw CAN socket bound to the given interface, -1 on error
+ */
+int openSender(char const* const name)
+{
+    int const fd = socket(PF_CAN, SOCK_RAW, CAN_RAW);
+    if (fd < 0)
+    {
+        return -1;
+    }
+    struct ifreq ifr;
+    ::std::memset(&ifr, 0, sizeof(ifr));
+    ::std::strncpy(ifr.ifr_name, name, sizeof(ifr.ifr_name) - 1U);
+    if (ioctl(fd, SIOCGIFINDEX, &ifr) < 0)
+    {
+        (void)close(fd);
+        return -1;
+    }
+    struct sockaddr_can addr;
+    ::std::memset(&addr, 0, sizeof(addr));
+    addr.can_family  = AF_CAN;
+    addr.can_ifindex = ifr.ifr_ifindex;
+    if (bind(fd, reinterpret_cast<struct sockaddr*>(&addr), sizeof(addr)) < 0)
+    {
+        (void)close(fd);
+        return -1;
+    }
+    return fd;
+}
+
+/**
+ * Measures the time from writing a frame to another socket on the interface until the listener of
+ * the transceiver has been called, with the CAN task polling the transceiver (argument 0) or being
+ * woken by its I/O thread (argument 1).
+ */
+void measureReceiveLatency(benchmark::State& state, bool const eventDriven)
+{
+    ::can::SocketCanTransceiver::DeviceConfig const config{INTERFACE_NAME, 0U};
+    ::can::SocketCanTransceiver transceiver(config);
+    (void)transceiver.init();
+    (void)transceiver.open();
+    int const sender = openSender(INTERFACE_NAME);
+    if ((transceiver.getFileDescriptor() < 0) || (sender < 0))
+    {
+        state.SkipWithError("SocketCAN interface vcan0 isn't available");
+        (void)transceiver.close();
+        (void)close(sender);
+        return;
+    }
+    Listener listener;
+    transceiver.addCANFrameListener(listener);
+    {
+        CanTask task(transceiver, eventDriven);
+        can_frame frame;
+        ::std::memset(&frame, 0, sizeof(frame));
+        frame.can_id  = FRAME_ID;
+        frame.can_dlc = 8U;
+        uint32_t random = 1U;
+        for (auto _ : state)
+        {
+            // vary the phase of the frames relative to the polling period
+            random = (random * 1103515245U) + 12345U;
+            ::std::this_thread::sleep_for(::std::chrono::microseconds((random >> 16U) % 1000U));
+
+            listener._receivedAt.store(0);
+            Clock::time_point const sentAt = Clock::now();
+            if (::write(sender, &frame, CAN_MTU) != CAN_MTU)
+            {
+                state.SkipWithError("Failed to send frame");
+                break;
+            }
+            Clock::rep receivedAt = listener._receivedAt.load();
+            while ((receivedAt == 0) && ((Clock::now() - sentAt) < RECEIVE_TIMEOUT))
+            {
+                receivedAt = listener._receivedAt.load();
+            }
+            if (receivedAt == 0)
+            {
+                state.SkipWithError("Frame hasn't been received");
+                break;
+            }
+            state.SetIterationTime(::std::chrono::duration<double>(
+                                       Clock::time_point(Clock::duration(receivedAt)) - sentAt)
+                                       .count());
+        }
+    }
+    transceiver.removeCANFrameListener(listener);
+    (void)transceiver.close();
+    (void)close(sender);
+}
+} // namespace
+
+/**
+ * Benchmarks the receive latency with the CAN task polling the transceiver every millisecond.
+ */
+void BM_socket_can_receive_latency_polling(benchmark::State& state)
+{
+    measureReceiveLatency(state, false);
+}
+
+BENCHMARK(BM_socket_can_receive_latency_polling)
+    ->UseManualTime()
+    ->Unit(benchmark::kMicrosecond);
+
+/**
+ * Benchmarks the receive latency with the CAN task being woken by the I/O thread of the
+ * transceiver.
+ */
+void BM_socket_can_receive_latency_event_driven(benchmark::State& state)
+{
+    measureReceiveLatency(state, true);
+}
+
+BENCHMARK(BM_socket_can_receive_latency_event_driven)
+    ->UseManualTime()
+    ->Unit(benchmark::kMicrosecond);
@@ -0,0 +1,70 @@
+// Copyright 2025 Accenture.
+
+#pragma once
+
+#include <can/canframes/CANFrame.h>
+#include <linux/can.h>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace can
+{
+/**
+ * Conversion between CANFrame objects and the frames of the Linux SocketCAN stack.
+ *
+ * Ids are translated between the qualifiers of CanId and the flags of SocketCAN, so that e.g. the
+ * forceNoFd qualifier of CanId never reaches the socket.
+ */
+class SocketCanFrameMapping
+{
+    SocketCanFrameMapping();
+
+public:
+    /**
+     * \param id CanId of a frame
+     * \return the SocketCAN representation of id
+     */
+    static canid_t toSocketCanId(uint32_t id);
+
+    /**
+     * \param length payload length of a frame
+     * \return the shortest valid CAN FD payload length not smaller than length
+     */
+    static uint8_t toFdLength(uint8_t length);
+
+    /**
+     * \param frame frame to send
+     * \param fdCapable true if the interface carries CAN FD frames, i.e. has an MTU of CANFD_MTU
+     * \return true if frame can be sent on the interface
+     */
+    static bool isSendable(CANFrame const& frame, bool fdCapable);
+
+    /**
+     * Fills socketCanFrame with frame. It is a CAN FD frame if the payload of frame doesn't fit
+     * into a classic frame, or if fdMode is set and the id of frame isn't marked with
+     * CanId::forceNoFd(). The payload of CAN FD frames is padded with zeros to the next valid
+     * length.
+     * \param frame frame to send
+     * \param fdMode true if frames shall be sent as CAN FD frames by default
+     * \param bitRateSwitch true if CAN FD frames shall use bit rate switching
+     * \param socketCanFrame frame to fill
+     * \return the number of bytes of socketCanFrame to send, CAN_MTU or CANFD_MTU
+     */
+    static size_t toSocketCanFrame(
+        CANFrame const& frame, bool fdMode, bool bitRateSwitch, canfd_frame& socketCanFrame);
+
+    /**
+     * Fills frame with a received frame, except for its timestamp.
+     * \param socketCanFrame received frame
+     * \param length number of bytes received, CAN_MTU or CANFD_MTU
+     * \param frame frame to fill
+     * \return false if socketCanFrame isn't passed to the listeners, i.e. if it has an unexpected
+     *         length, is a remote or an error frame, or has more payload than
+     *         CANFrame::MAX_FRAME_LENGTH
+     */
+    static bool
+    fromSocketCanFrame(canfd_frame const& socketCanFrame, size_t length, CANFrame& frame);
+};
+
+} // namespace can
@@ -3,9 +3,13 @@
 #pragma once
 
 #include <can/transceiver/AbstractCANTransceiver.h>
+#include <etl/delegate.h>
+#include <etl/span.h>
 #include <io/MemoryQueue.h>
+#include <util/spsc/Queue.h>
 
 #include <atomic>
+#include <thread>
 
 namespace can
 {
@@ -17,10 +21,36 @@ namespace can
  * run in the same task context. The deviation from this can result in unobvious UBs.
  * The transceiver state change detection is currently not implemented,
  * the corresponding callback is never called.
+ *
+ * Frames are sent and received in batches of up to DeviceConfig::batchSize frames per system
+ * call (sendmmsg() and recvmmsg()). Received frames carry the kernel receive timestamp, converted
+ * to the time base of getSystemTimeUs32Bit(). If the kernel reports software transmit timestamps
+ * on the error queue of the socket, the ICANFrameSentListener passed to write() gets the frame
+ * with its transmit timestamp.
+ *
+ * CAN FD frames are received with up to CANFrame::MAX_FRAME_LENGTH bytes of payload, longer frames
+ * are dropped. Frames are sent as CAN FD frames if their payload doesn't fit into a classic frame,
+ * or if DeviceConfig::canFd is set and their id isn't marked with CanId::forceNoFd(). If the MTU of
+ * the interface doesn't allow CAN FD frames, DeviceConfig::canFd is ignored and write() rejects
+ * frames with more than 8 bytes of payload.
+ *
+ * By default, run() reads the socket and therefore needs to be called periodically. Alternatively,
+ * startIoThread() starts a thread which waits for the socket with epoll, reads received frames into
+ * a queue and requests a call of run() only when frames have been received or the socket accepts
+ * frames again.
+ *
+ * Frames the socket doesn't accept for now stay queued. If the socket buffer is full, they are sent
+ * as soon as the socket is writable again. If the queue of the device is full (ENOBUFS, e.g. while
+ * no other node acknowledges frames), sending is retried after TX_RETRY_TIMEOUT_US, since the
+ * socket is reported writable in this case anyway. Frames rejected with any other error are
+ * dropped and logged, so that they don't block the frames behind them.
  */
 class SocketCanTransceiver final : public AbstractCANTransceiver
 {
 public:
+    /// maximum number of frames sent or received by a single system call
+    static size_t const MAX_BATCH_SIZE = 16;
+
     /**
      * The transceiver device (static) configuration
      *
@@ -31,12 +61,22 @@ public:
     {
         char const* name; /// SocketCAN interface name
         uint8_t busId;    /// currently not used
+        /// frames per system call in run(), values above MAX_BATCH_SIZE are limited to it
+        uint8_t batchSize = MAX_BATCH_SIZE;
+        /// send frames as CAN FD frames, ignored unless the interface has CANFD_MTU
+        bool canFd         = false;
+        /// use bit rate switching for the data phase of sent CAN FD frames
+        bool bitRateSwitch = true;
     };
 
+    using TxPendingFunctionType = ::etl::delegate<void()>;
+    using IoReadyFunctionType   = ::etl::delegate<void()>;
+
     explicit SocketCanTransceiver(DeviceConfig const& config);
 
     SocketCanTransceiver(SocketCanTransceiver const&)            = delete;
     SocketCanTransceiver& operator=(SocketCanTransceiver const&) = delete;
+    ~SocketCanTransceiver();
 
     ICanTransceiver::ErrorCode init() final;
     ICanTransceiver::ErrorCode open() final;
@@ -54,13 +94,53 @@ public:
     uint16_t getHwQueueTimeout() const final;
 
     /**
-     * This function is supposed to be run periodically.
+     * This function is supposed to be run periodically, or whenever the ready function of the
+     * I/O thread has been called.
      * The callbacks registered with the ICanTransceiver will be triggered from inside this call.
+     * \param maxSentPerRun maximum number of frames to send
+     * \param maxReceivedPerRun maximum number of frames to receive
      */
     void run(int maxSentPerRun, int maxReceivedPerRun);
 
+    /**
+     * Set a function that is called by write() after a frame has been queued, e.g. to trigger
+     * run() instead of polling. It may be called from any context and shall be set before open().
+     */
+    void setTxPendingFunction(TxPendingFunctionType txPendingFunction);
+
+    /**
+     * \return true if frames are left in the write queue after run()
+     */
+    bool isTxPending() const;
+
+    /**
+     * \return the file descriptor of the open socket, -1 if it isn't open
+     */
+    int getFileDescriptor() const;
+
+    /**
+     * Start a thread which receives frames on behalf of run(). The ready function is called from
+     * this thread whenever run() has frames to pass to the listeners, or after the socket had been
+     * full and accepts frames again. It is also called by run() itself if it left work behind
+     * because of its limits. The ready function therefore must be callable from a native thread,
+     * as ::async::execute() of the asyncPosix backend is.
+     * Shall be called after open(), the thread is stopped by close().
+     * \param readyFunction function requesting a call of run()
+     * \return false if the thread couldn't be started
+     */
+    bool startIoThread(IoReadyFunctionType readyFunction);
+
+    /**
+     * Stop the I/O thread and join it, run() reads the socket itself again.
+     */
+    void stopIoThread();
+
 private:
-    static size_t const TX_QUEUE_SIZE_BYTES = 512;
+    static size_t const TX_QUEUE_SIZE_BYTES = 2048;
+    static uint16_t const RX_QUEUE_SIZE     = 64;
+    static size_t const CACHE_LINE_SIZE     = 64;
+    /// delay before frames rejected because of a full device queue are sent again
+    static uint32_t const TX_RETRY_TIMEOUT_US = 1000U;
 
     struct FrameWithListener
     {
@@ -69,21 +149,68 @@ private:
     };
 
     using TxQueue = ::io::MemoryQueue<TX_QUEUE_SIZE_BYTES, sizeof(FrameWithListener)>;
+    using RxQueue = ::util::spsc::Queue<CANFrame, RX_QUEUE_SIZE, false, CACHE_LINE_SIZE>;
+
+    /// state of the socket after frames have been sent
+    enum class TxStatus : uint8_t
+    {
+        /// further frames may be sent
+        READY,
+        /// the socket buffer is full, frames can be sent once it is writable
+        BLOCKED,
+        /// the queue of the device is full, frames can be sent after TX_RETRY_TIMEOUT_US
+        BUSY
+    };
 
     // these functions are making system calls and shall be signal-masked
     void guardedOpen();
     void guardedClose();
     void guardedRun(int maxSentPerRun, int maxReceivedPerRun);
+    size_t sendBatch(size_t count, TxStatus& status);
+    size_t receiveBatch(size_t count);
+    size_t readFrames(::etl::span<CANFrame> frames, size_t& numFrames);
+    void readTxTimestamps(::etl::span<FrameWithListener> frames, uint32_t firstKey);
+    size_t takeReceivedFrames(size_t maxReceived);
+    bool isRxQueueEmpty();
+
+    void runIoThread();
+    bool receiveIntoQueue(RxQueue::Sender& sender);
+    void wakeIoThread();
+    void startTxRetryTimer();
+
+    size_t batchSize() const;
 
     TxQueue _txQueue;
-    ::io::MemoryQueueReader<TxQueue> _txReader;
+    TxQueue::Reader _txReader;
     ::io::MemoryQueueWriter<TxQueue> _txWriter;
 
     DeviceConfig const& _config;
 
+    TxPendingFunctionType _txPendingFunction;
+
     int _fileDescriptor;
 
+    /// key the kernel assigns to the next sent frame, used to match transmit timestamps to frames
+    uint32_t _txTimestampKey;
+
+    bool _txTimestamping;
+
+    /// true if the MTU of the interface allows CAN FD frames
+    bool _fdCapable;
+
     ::std::atomic_bool _writable;
+
+    RxQueue _rxQueue;
+    ::std::thread _ioThread;
+    IoReadyFunctionType _ioReadyFunction;
+    int _ioEpollFileDescriptor;
+    int _ioEventFileDescriptor;
+    int _ioTimerFileDescriptor;
+    ::std::atomic_bool _ioStopped;
+    /// set by the I/O thread if it stopped reading because the receive queue is full
+    ::std::atomic_bool _rxQueueFull;
+    /// set by run() if the socket buffer didn't accept all frames
+    ::std::atomic_bool _txBlocked;
 };
 
 } // namespace can
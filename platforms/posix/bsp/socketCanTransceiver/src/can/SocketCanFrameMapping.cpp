@@ -0,0 +1,73 @@
+// Copyright 2025 Accenture.
+
+#include "can/SocketCanFrameMapping.h"
+
+#include <can/canframes/CanId.h>
+
+#include <cstring>
+
+namespace can
+{
+
+canid_t SocketCanFrameMapping::toSocketCanId(uint32_t const id)
+{
+    return CanId::rawId(id) | (CanId::isExtended(id) ? CAN_EFF_FLAG : 0U);
+}
+
+uint8_t SocketCanFrameMapping::toFdLength(uint8_t const length)
+{
+    static uint8_t const FD_LENGTHS[] = {12U, 16U, 20U, 24U, 32U, 48U, CANFD_MAX_DLEN};
+    if (length <= CAN_MAX_DLEN)
+    {
+        return length;
+    }
+    for (uint8_t const fdLength : FD_LENGTHS)
+    {
+        if (length <= fdLength)
+        {
+            return fdLength;
+        }
+    }
+    return CANFD_MAX_DLEN;
+}
+
+bool SocketCanFrameMapping::isSendable(CANFrame const& frame, bool const fdCapable)
+{
+    return fdCapable || (frame.getPayloadLength() <= CAN_MAX_DLEN);
+}
+
+size_t SocketCanFrameMapping::toSocketCanFrame(
+    CANFrame const& frame, bool const fdMode, bool const bitRateSwitch, canfd_frame& socketCanFrame)
+{
+    uint8_t const length = frame.getPayloadLength();
+    ::std::memset(&socketCanFrame, 0, sizeof(socketCanFrame));
+    socketCanFrame.can_id = toSocketCanId(frame.getId());
+    ::std::memcpy(socketCanFrame.data, frame.getPayload(), length);
+    if ((length > CAN_MAX_DLEN) || (fdMode && !CanId::isForceNoFd(frame.getId())))
+    {
+        // the padding bytes of the payload remain zero
+        socketCanFrame.len   = toFdLength(length);
+        socketCanFrame.flags = bitRateSwitch ? CANFD_BRS : 0U;
+        return CANFD_MTU;
+    }
+    socketCanFrame.len = length;
+    return CAN_MTU;
+}
+
+bool SocketCanFrameMapping::fromSocketCanFrame(
+    canfd_frame const& socketCanFrame, size_t const length, CANFrame& frame)
+{
+    if (((length != CAN_MTU) && (length != CANFD_MTU))
+        || ((socketCanFrame.can_id & (CAN_RTR_FLAG | CAN_ERR_FLAG)) != 0U)
+        || (socketCanFrame.len > CANFrame::MAX_FRAME_LENGTH))
+    {
+        return false;
+    }
+    frame.setId(CanId::id(
+        socketCanFrame.can_id & CAN_EFF_MASK, (socketCanFrame.can_id & CAN_EFF_FLAG) != 0U));
+    frame.setPayload(socketCanFrame.data, socketCanFrame.len);
+    frame.setPayloadLength(socketCanFrame.len);
+    return true;
+}
+
+} // namespace can
@@ -2,19 +2,31 @@
 
 #include "can/SocketCanTransceiver.h"
 
+#include "can/SocketCanFrameMapping.h"
+
+#include <bsp/timer/SystemTimer.h>
 #include <can/CanLogger.h>
 #include <can/canframes/ICANFrameSentListener.h>
 #include <linux/can.h>
 #include <linux/can/raw.h>
+#include <linux/errqueue.h>
+#include <linux/net_tstamp.h>
 #include <net/if.h>
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
 #include <sys/ioctl.h>
 #include <sys/socket.h>
+#include <sys/timerfd.h>
 
+#include <errno.h>
 #include <fcntl.h>
 #include <signal.h>
+#include <time.h>
 #include <type_traits>
 #include <unistd.h>
 
+#include <etl/algorithm.h>
+#include <etl/array.h>
 #include <etl/error_handler.h>
 #include <etl/span.h>
 
@@ -42,10 +54,123 @@ void signalGuarded(F&& function)
     pthread_sigmask(SIG_SETMASK, &oldSet, nullptr);
 }
 
+/**
+ * Buffer for the ancillary data of a single message, large enough for a timestamp and an error
+ * queue entry.
+ */
+union ControlBuffer
+{
+    cmsghdr header;
+    uint8_t data[CMSG_SPACE(sizeof(scm_timestamping))
+                 + CMSG_SPACE(sizeof(sock_extended_err) + sizeof(sockaddr_can))];
+};
+
+/**
+ * Converts the CLOCK_REALTIME timestamps reported by the kernel into the time base of
+ * getSystemTimeUs32Bit(), by subtracting their age from the current system time.
+ */
+class TimestampConverter
+{
+public:
+    TimestampConverter() : _systemTimeUs(getSystemTimeUs32Bit()), _realTimeUs(0U)
+    {
+        struct timespec now;
+        clock_gettime(CLOCK_REALTIME, &now);
+        _realTimeUs = toUs(now);
+    }
+
+    uint32_t systemTimeUs() const { return _systemTimeUs; }
+
+    uint32_t convert(struct timespec const& timestamp) const
+    {
+        return _systemTimeUs - static_cast<uint32_t>(_realTimeUs - toUs(timestamp));
+    }
+
+private:
+    static uint64_t toUs(struct timespec const& timestamp)
+    {
+        return (static_cast<uint64_t>(timestamp.tv_sec) * 1000000U)
+               + (static_cast<uint64_t>(timestamp.tv_nsec) / 1000U);
+    }
+
+    uint32_t _systemTimeUs;
+    uint64_t _realTimeUs;
+};
+
+/**
+ * \return true if the message carries a SO_TIMESTAMPING or SO_TIMESTAMP software timestamp
+ */
+bool findTimestamp(msghdr& message, struct timespec& timestamp)
+{
+    for (cmsghdr* cmsg = CMSG_FIRSTHDR(&message); cmsg != nullptr;
+         cmsg          = CMSG_NXTHDR(&message, cmsg))
+    {
+        if (cmsg->cmsg_level != SOL_SOCKET)
+        {
+            continue;
+        }
+        if (cmsg->cmsg_type == SCM_TIMESTAMPING)
+        {
+            scm_timestamping timestamps;
+            ::std::memcpy(&timestamps, CMSG_DATA(cmsg), sizeof(timestamps));
+            timestamp = timestamps.ts[0];
+            return true;
+        }
+        if (cmsg->cmsg_type == SCM_TIMESTAMP)
+        {
+            struct timeval time;
+            ::std::memcpy(&time, CMSG_DATA(cmsg), sizeof(time));
+            timestamp.tv_sec  = time.tv_sec;
+            timestamp.tv_nsec = time.tv_usec * 1000;
+            return true;
+        }
+    }
+    return false;
+}
+
+/**
+ * \return the extended error of an error queue message, nullptr if there is none
+ */
+sock_extended_err const* findExtendedError(msghdr& message)
+{
+    for (cmsghdr* cmsg = CMSG_FIRSTHDR(&message); cmsg != nullptr;
+         cmsg          = CMSG_NXTHDR(&message, cmsg))
+    {
+        if ((cmsg->cmsg_level == SOL_CAN_RAW) && (cmsg->cmsg_type == SCM_CAN_RAW_ERRQUEUE))
+        {
+            return reinterpret_cast<sock_extended_err const*>(CMSG_DATA(cmsg));
+        }
+    }
+    return nullptr;
+}
+
+/**
+ * \return true if the kernel has assigned a transmit timestamp key to a frame before rejecting it
+ * with this error, i.e. if the error didn't occur while the frame was checked and copied
+ */
+bool consumesTimestampKey(int const error)
+{
+    return (error != EAGAIN) && (error != EWOULDBLOCK) && (error != EINTR) && (error != EINVAL)
+           && (error != ENXIO) && (error != EFAULT);
+}
+
+void logReceived(CANFrame const& frame)
+{
+    Logger::debug(
+        CAN,
+        "[SocketCanTransceiver] received CAN frame, id=0x%X, length=%d",
+        (int)frame.getId(),
+        (int)frame.getPayloadLength());
+}
+
 } // namespace
 
 // needed if ODR-used
 size_t const SocketCanTransceiver::TX_QUEUE_SIZE_BYTES;
+size_t const SocketCanTransceiver::MAX_BATCH_SIZE;
+uint16_t const SocketCanTransceiver::RX_QUEUE_SIZE;
+size_t const SocketCanTransceiver::CACHE_LINE_SIZE;
+uint32_t const SocketCanTransceiver::TX_RETRY_TIMEOUT_US;
 
 SocketCanTransceiver::SocketCanTransceiver(DeviceConfig const& config)
 : AbstractCANTransceiver(config.busId)
@@ -53,10 +178,25 @@ SocketCanTransceiver::SocketCanTransceiver(DeviceConfig const& config)
 , _txReader(_txQueue)
 , _txWriter(_txQueue)
 , _config(config)
+, _txPendingFunction()
 , _fileDescriptor(-1)
+, _txTimestampKey(0U)
+, _txTimestamping(false)
+, _fdCapable(false)
 , _writable(false)
+, _rxQueue()
+, _ioThread()
+, _ioReadyFunction()
+, _ioEpollFileDescriptor(-1)
+, _ioEventFileDescriptor(-1)
+, _ioTimerFileDescriptor(-1)
+, _ioStopped(false)
+, _rxQueueFull(false)
+, _txBlocked(false)
 {}
 
+SocketCanTransceiver::~SocketCanTransceiver() { stopIoThread(); }
+
 ICanTransceiver::ErrorCode SocketCanTransceiver::init()
 {
     if (!isInState(State::CLOSED))
@@ -91,6 +231,7 @@ ICanTransceiver::ErrorCode SocketCanTransceiver::close()
     {
         return ErrorCode::CAN_ERR_ILLEGAL_STATE;
     }
+    stopIoThread();
     signalGuarded([this] { guardedClose(); });
     _writable.store(false);
     setState(State::CLOSED);
@@ -101,10 +242,14 @@ void SocketCanTransceiver::shutdown() {}
 
 ICanTransceiver::ErrorCode SocketCanTransceiver::write(CANFrame const& frame)
 {
-    if (!_writable.load(std::memory_order_relaxed))
+    if (!_writable.load(std::memory_order_acquire))
     {
         return ErrorCode::CAN_ERR_ILLEGAL_STATE;
     }
+    if (!SocketCanFrameMapping::isSendable(frame, _fdCapable))
+    {
+        return ErrorCode::CAN_ERR_TX_FAIL;
+    }
     FrameWithListener slot{frame, nullptr};
     ::etl::span<uint8_t> memory = _txWriter.allocate(sizeof(slot));
     if (memory.size() == 0)
@@ -113,16 +258,24 @@ ICanTransceiver::ErrorCode SocketCanTransceiver::write(CANFrame const& frame)
     }
     ::std::memcpy(memory.data(), &slot, sizeof(slot));
     _txWriter.commit();
+    if (_txPendingFunction.is_valid())
+    {
+        _txPendingFunction();
+    }
     return ErrorCode::CAN_ERR_OK;
 }
 
 ICanTransceiver::ErrorCode
 SocketCanTransceiver::write(CANFrame const& frame, ICANFrameSentListener& listener)
 {
-    if (!_writable.load(std::memory_order_relaxed))
+    if (!_writable.load(std::memory_order_acquire))
     {
         return ErrorCode::CAN_ERR_ILLEGAL_STATE;
     }
+    if (!SocketCanFrameMapping::isSendable(frame, _fdCapable))
+    {
+        return ErrorCode::CAN_ERR_TX_FAIL;
+    }
     FrameWithListener slot{frame, &listener};
     ::etl::span<uint8_t> memory = _txWriter.allocate(sizeof(slot));
     if (memory.size() == 0)
@@ -131,6 +284,10 @@ SocketCanTransceiver::write(CANFrame const& frame, ICANFrameSentListener& listen
     }
     ::std::memcpy(memory.data(), &slot, sizeof(slot));
     _txWriter.commit();
+    if (_txPendingFunction.is_valid())
+    {
+        _txPendingFunction();
+    }
     return ErrorCode::CAN_ERR_OK;
 }
 
@@ -166,6 +323,77 @@ void SocketCanTransceiver::run(int maxSentPerRun, int maxReceivedPerRun)
                   { guardedRun(maxSentPerRun, maxReceivedPerRun); });
 }
 
+void SocketCanTransceiver::setTxPendingFunction(TxPendingFunctionType const txPendingFunction)
+{
+    _txPendingFunction = txPendingFunction;
+}
+
+bool SocketCanTransceiver::isTxPending() const { return _txReader.peek().size() != 0U; }
+
+int SocketCanTransceiver::getFileDescriptor() const { return _fileDescriptor; }
+
+bool SocketCanTransceiver::startIoThread(IoReadyFunctionType const readyFunction)
+{
+    if ((_fileDescriptor < 0) || _ioThread.joinable())
+    {
+        return false;
+    }
+    int const epollFd = epoll_create1(EPOLL_CLOEXEC);
+    int const eventFd = eventfd(0U, EFD_CLOEXEC | EFD_NONBLOCK);
+    int const timerFd = timerfd_create(CLOCK_MONOTONIC, TFD_CLOEXEC | TFD_NONBLOCK);
+    struct epoll_event eventFdEvent;
+    eventFdEvent.events  = EPOLLIN;
+    eventFdEvent.data.fd = eventFd;
+    struct epoll_event timerFdEvent;
+    timerFdEvent.events  = EPOLLIN;
+    timerFdEvent.data.fd = timerFd;
+    // edge triggered, the I/O thread reads until the socket is empty or the queue is full
+    struct epoll_event socketEvent;
+    socketEvent.events  = EPOLLIN | EPOLLET;
+    socketEvent.data.fd = _fileDescriptor;
+    if ((epollFd < 0) || (eventFd < 0) || (timerFd < 0)
+        || (epoll_ctl(epollFd, EPOLL_CTL_ADD, eventFd, &eventFdEvent) < 0)
+        || (epoll_ctl(epollFd, EPOLL_CTL_ADD, timerFd, &timerFdEvent) < 0)
+        || (epoll_ctl(epollFd, EPOLL_CTL_ADD, _fileDescriptor, &socketEvent) < 0))
+    {
+        Logger::error(
+            CAN, "[SocketCanTransceiver] Failed to start I/O thread (node=%s)", _config.name);
+        (void)::close(epollFd);
+        (void)::close(eventFd);
+        (void)::close(timerFd);
+        return false;
+    }
+    _ioEpollFileDescriptor = epollFd;
+    _ioEventFileDescriptor = eventFd;
+    _ioTimerFileDescriptor = timerFd;
+    _rxQueue.reset();
+    _ioReadyFunction = readyFunction;
+    _ioStopped.store(false);
+    _rxQueueFull.store(false);
+    _txBlocked.store(false);
+    _ioThread = ::std::thread(&SocketCanTransceiver::runIoThread, this);
+    return true;
+}
+
+void SocketCanTransceiver::stopIoThread()
+{
+    if (!_ioThread.joinable())
+    {
+        return;
+    }
+    _ioStopped.store(true);
+    wakeIoThread();
+    _ioThread.join();
+    (void)::close(_ioEpollFileDescriptor);
+    (void)::close(_ioEventFileDescriptor);
+    (void)::close(_ioTimerFileDescriptor);
+    _ioEpollFileDescriptor = -1;
+    _ioEventFileDescriptor = -1;
+    _ioTimerFileDescriptor = -1;
+    // frames which haven't been taken by run() yet are dropped
+    _rxQueue.reset();
+}
+
 void SocketCanTransceiver::guardedOpen()
 {
     char const* const name = _config.name;
@@ -187,6 +415,18 @@ void SocketCanTransceiver::guardedOpen()
             CAN, "[SocketCanTransceiver] Failed to ioctl socket (node=%s, error=%d)", name, error);
         return;
     }
+    int const ifindex = ifr.ifr_ifindex;
+
+    // the interface rejects CAN FD frames unless its MTU allows them
+    _fdCapable = (ioctl(fd, SIOCGIFMTU, &ifr) == 0) && (ifr.ifr_mtu == CANFD_MTU);
+    if (_config.canFd && !_fdCapable)
+    {
+        Logger::warn(
+            CAN,
+            "[SocketCanTransceiver] Interface doesn't support CAN FD, sending classic frames "
+            "(node=%s)",
+            name);
+    }
 
     int const enable_canfd = 1;
     error = setsockopt(fd, SOL_CAN_RAW, CAN_RAW_FD_FRAMES, &enable_canfd, sizeof(enable_canfd));
@@ -200,6 +440,28 @@ void SocketCanTransceiver::guardedOpen()
         return;
     }
 
+    // prefer SO_TIMESTAMPING, which also reports transmit timestamps on the error queue
+    int const timestamping = SOF_TIMESTAMPING_SOFTWARE | SOF_TIMESTAMPING_RX_SOFTWARE
+                             | SOF_TIMESTAMPING_TX_SOFTWARE | SOF_TIMESTAMPING_OPT_ID
+                             | SOF_TIMESTAMPING_OPT_TSONLY;
+    _txTimestampKey = 0U;
+    _txTimestamping
+        = (setsockopt(fd, SOL_SOCKET, SO_TIMESTAMPING, &timestamping, sizeof(timestamping)) == 0);
+    if (!_txTimestamping)
+    {
+        int const enable_timestamp = 1;
+        error
+            = setsockopt(fd, SOL_SOCKET, SO_TIMESTAMP, &enable_timestamp, sizeof(enable_timestamp));
+        if (error < 0)
+        {
+            Logger::warn(
+                CAN,
+                "[SocketCanTransceiver] No kernel receive timestamps (node=%s, error=%d)",
+                name,
+                error);
+        }
+    }
+
     error = fcntl(fd, F_SETFL, O_NONBLOCK);
     if (error < 0)
     {
@@ -214,7 +476,7 @@ void SocketCanTransceiver::guardedOpen()
     struct sockaddr_can addr;
     ::std::memset(&addr, 0, sizeof(addr));
     addr.can_family  = AF_CAN;
-    addr.can_ifindex = ifr.ifr_ifindex;
+    addr.can_ifindex = ifindex;
     error            = bind(fd, (struct sockaddr*)&addr, sizeof(addr));
     if (error < 0)
     {
@@ -230,68 +492,376 @@ void SocketCanTransceiver::guardedClose()
 {
     ::close(_fileDescriptor);
     _fileDescriptor = -1;
+    _txTimestamping = false;
+    _fdCapable      = false;
 }
 
 void SocketCanTransceiver::guardedRun(int maxSentPerRun, int maxReceivedPerRun)
 {
+    size_t const batch = batchSize();
+
+    if (_txTimestamping)
+    {
+        // drop reports of frames that have been notified already
+        readTxTimestamps(::etl::span<FrameWithListener>(), _txTimestampKey);
+    }
+
     // MUTED condition does not affect the messages already in the write queue;
     // the idea is that once we confirmed that we had accepted the message for delivery,
     // we shall try to deliver it.
-    for (int count = 0; count < maxSentPerRun; ++count)
+    // frames are kept while the socket isn't open
+    size_t const maxSent = ((maxSentPerRun > 0) && (_fileDescriptor >= 0))
+                               ? static_cast<size_t>(maxSentPerRun)
+                               : 0U;
+    size_t sentCount = 0U;
+    TxStatus status  = TxStatus::READY;
+    while ((sentCount < maxSent) && (status == TxStatus::READY))
     {
-        ::etl::span<uint8_t const> canFrameSlice = _txReader.peek();
-        if (canFrameSlice.size() == 0)
+        size_t const requested = ::etl::min(batch, maxSent - sentCount);
+        size_t const sent      = sendBatch(requested, status);
+        if (sent == 0U)
         {
             break;
         }
-        FrameWithListener slot;
-        ::std::memcpy(static_cast<void*>(&slot), canFrameSlice.data(), sizeof(slot));
-        CANFrame& canFrame = slot.frame;
-        can_frame socketCanFrame;
-        ::std::memset(&socketCanFrame, 0, sizeof(socketCanFrame));
-        socketCanFrame.can_id  = canFrame.getId();
-        int length             = canFrame.getPayloadLength();
-        socketCanFrame.can_dlc = length;
-        ::std::memcpy(socketCanFrame.data, canFrame.getPayload(), length);
-        ::std::memset(socketCanFrame.data + length, 0, sizeof(socketCanFrame.data) - length);
-        length = ::write(_fileDescriptor, reinterpret_cast<char*>(&socketCanFrame), CAN_MTU);
-        if (length != CAN_MTU)
+        sentCount += sent;
+    }
+
+    size_t const maxReceived
+        = (maxReceivedPerRun > 0) ? static_cast<size_t>(maxReceivedPerRun) : 0U;
+    if (_ioThread.joinable())
+    {
+        if (status == TxStatus::BLOCKED)
+        {
+            _txBlocked.store(true);
+            wakeIoThread();
+        }
+        else if (status == TxStatus::BUSY)
+        {
+            startTxRetryTimer();
+        }
+        (void)takeReceivedFrames(maxReceived);
+        if (!isRxQueueEmpty() || ((status == TxStatus::READY) && isTxPending()))
+        {
+            _ioReadyFunction();
+        }
+        return;
+    }
+    for (size_t count = 0U; count < maxReceived;)
+    {
+        size_t const requested = ::etl::min(batch, maxReceived - count);
+        size_t const received  = receiveBatch(requested);
+        count += received;
+        if (received < requested)
         {
             break;
         }
-        _txReader.release();
-        if (slot.listener != nullptr)
+    }
+}
+
+size_t SocketCanTransceiver::sendBatch(size_t const count, TxStatus& status)
+{
+    ::etl::array<::etl::span<uint8_t>, MAX_BATCH_SIZE> slices;
+    size_t const queued
+        = _txReader.peek(::etl::span<::etl::span<uint8_t>>(slices.data(), count));
+    if (queued == 0U)
+    {
+        return 0U;
+    }
+
+    FrameWithListener slots[MAX_BATCH_SIZE];
+    canfd_frame socketCanFrames[MAX_BATCH_SIZE];
+    struct iovec iovecs[MAX_BATCH_SIZE];
+    struct mmsghdr messages[MAX_BATCH_SIZE];
+    ::std::memset(messages, 0, sizeof(messages));
+    bool const fdMode = _config.canFd && _fdCapable;
+    for (size_t i = 0U; i < queued; ++i)
+    {
+        ::std::memcpy(static_cast<void*>(&slots[i]), slices[i].data(), sizeof(slots[i]));
+        iovecs[i].iov_len = SocketCanFrameMapping::toSocketCanFrame(
+            slots[i].frame, fdMode, _config.bitRateSwitch, socketCanFrames[i]);
+        iovecs[i].iov_base             = &socketCanFrames[i];
+        messages[i].msg_hdr.msg_iov    = &iovecs[i];
+        messages[i].msg_hdr.msg_iovlen = 1U;
+    }
+
+    int const result = sendmmsg(_fileDescriptor, messages, queued, 0);
+    if (result <= 0)
+    {
+        // an error after the first frame is reported by the next call, which starts with the
+        // rejected frame
+        int const error = (result < 0) ? errno : EAGAIN;
+        if (_txTimestamping && consumesTimestampKey(error))
+        {
+            ++_txTimestampKey;
+        }
+        if ((error == EAGAIN) || (error == EWOULDBLOCK))
+        {
+            status = TxStatus::BLOCKED;
+            return 0U;
+        }
+        if ((error == ENOBUFS) || (error == EINTR))
+        {
+            status = TxStatus::BUSY;
+            return 0U;
+        }
+        Logger::error(
+            CAN,
+            "[SocketCanTransceiver] Dropped CAN frame, id=0x%X (node=%s, errno=%d)",
+            (int)slots[0].frame.getId(),
+            _config.name,
+            error);
+        _txReader.release(1U);
+        return 1U;
+    }
+    size_t const sent = static_cast<size_t>(result);
+    _txReader.release(sent);
+
+    uint32_t const sentTimestamp = getSystemTimeUs32Bit();
+    for (size_t i = 0U; i < sent; ++i)
+    {
+        slots[i].frame.setTimestamp(sentTimestamp);
+    }
+    if (_txTimestamping)
+    {
+        readTxTimestamps(::etl::span<FrameWithListener>(slots, sent), _txTimestampKey);
+    }
+    _txTimestampKey += static_cast<uint32_t>(sent);
+
+    for (size_t i = 0U; i < sent; ++i)
+    {
+        CANFrame& canFrame = slots[i].frame;
+        if (slots[i].listener != nullptr)
         {
-            slot.listener->canFrameSent(canFrame);
+            slots[i].listener->canFrameSent(canFrame);
         }
         notifySentListeners(canFrame);
     }
+    return sent;
+}
 
-    for (int count = 0; count < maxReceivedPerRun; ++count)
+void SocketCanTransceiver::readTxTimestamps(
+    ::etl::span<FrameWithListener> const frames, uint32_t const firstKey)
+{
+    TimestampConverter const converter;
+    while (true)
     {
-        alignas(can_frame) uint8_t buffer[CANFD_MTU];
-        int const length = read(_fileDescriptor, reinterpret_cast<char*>(buffer), CANFD_MTU);
-        if (length < 0)
+        ControlBuffer control;
+        struct msghdr message;
+        ::std::memset(&message, 0, sizeof(message));
+        message.msg_control    = control.data;
+        message.msg_controllen = sizeof(control.data);
+        if (recvmsg(_fileDescriptor, &message, MSG_ERRQUEUE | MSG_DONTWAIT) < 0)
         {
             break;
         }
-        if (length == CAN_MTU)
+        struct timespec timestamp;
+        sock_extended_err const* const error = findExtendedError(message);
+        if ((error == nullptr) || (error->ee_origin != SO_EE_ORIGIN_TIMESTAMPING)
+            || !findTimestamp(message, timestamp))
         {
-            can_frame const& socketCanFrame = *reinterpret_cast<can_frame const*>(buffer);
-            Logger::debug(
-                CAN,
-                "[SocketCanTransceiver] received CAN frame, id=0x%X, length=%d",
-                (int)socketCanFrame.can_id,
-                (int)socketCanFrame.can_dlc);
-            CANFrame canFrame;
-            canFrame.setId(socketCanFrame.can_id);
-            canFrame.setPayload(socketCanFrame.data, socketCanFrame.can_dlc);
-            canFrame.setPayloadLength(socketCanFrame.can_dlc);
-            canFrame.setTimestamp(0);
-
-            notifyListeners(canFrame);
+            continue;
+        }
+        // the kernel numbers the sent frames consecutively from the time the socket was opened,
+        // reports of frames outside of the batch starting with firstKey are dropped
+        uint32_t const index = error->ee_data - firstKey;
+        if (index < frames.size())
+        {
+            frames[index].frame.setTimestamp(converter.convert(timestamp));
+        }
+    }
+}
+
+size_t SocketCanTransceiver::receiveBatch(size_t const count)
+{
+    CANFrame frames[MAX_BATCH_SIZE];
+    size_t numFrames      = 0U;
+    size_t const received = readFrames(::etl::span<CANFrame>(frames, count), numFrames);
+    for (size_t i = 0U; i < numFrames; ++i)
+    {
+        logReceived(frames[i]);
+        notifyListeners(frames[i]);
+    }
+    return received;
+}
+
+size_t SocketCanTransceiver::readFrames(::etl::span<CANFrame> const frames, size_t& numFrames)
+{
+    size_t const count = frames.size();
+    canfd_frame socketCanFrames[MAX_BATCH_SIZE];
+    ControlBuffer controls[MAX_BATCH_SIZE];
+    struct iovec iovecs[MAX_BATCH_SIZE];
+    struct mmsghdr messages[MAX_BATCH_SIZE];
+    ::std::memset(messages, 0, sizeof(messages));
+    for (size_t i = 0U; i < count; ++i)
+    {
+        iovecs[i].iov_base                 = &socketCanFrames[i];
+        iovecs[i].iov_len                  = CANFD_MTU;
+        messages[i].msg_hdr.msg_iov        = &iovecs[i];
+        messages[i].msg_hdr.msg_iovlen     = 1U;
+        messages[i].msg_hdr.msg_control    = controls[i].data;
+        messages[i].msg_hdr.msg_controllen = sizeof(controls[i].data);
+    }
+
+    numFrames        = 0U;
+    int const result = recvmmsg(_fileDescriptor, messages, count, MSG_DONTWAIT, nullptr);
+    if (result <= 0)
+    {
+        return 0U;
+    }
+    size_t const received = static_cast<size_t>(result);
+
+    TimestampConverter const converter;
+    for (size_t i = 0U; i < received; ++i)
+    {
+        CANFrame& canFrame = frames[numFrames];
+        if (!SocketCanFrameMapping::fromSocketCanFrame(
+                socketCanFrames[i], messages[i].msg_len, canFrame))
+        {
+            continue;
         }
+        struct timespec timestamp;
+        canFrame.setTimestamp(
+            findTimestamp(messages[i].msg_hdr, timestamp) ? converter.convert(timestamp)
+                                                          : converter.systemTimeUs());
+        ++numFrames;
     }
+    return received;
+}
+
+size_t SocketCanTransceiver::takeReceivedFrames(size_t const maxReceived)
+{
+    RxQueue::Receiver receiver(_rxQueue);
+    size_t const batch = batchSize();
+    CANFrame frames[MAX_BATCH_SIZE];
+    size_t count = 0U;
+    while (count < maxReceived)
+    {
+        size_t const requested = ::etl::min(batch, maxReceived - count);
+        size_t const received  = receiver.read_n(::etl::span<CANFrame>(frames, requested));
+        for (size_t i = 0U; i < received; ++i)
+        {
+            logReceived(frames[i]);
+            notifyListeners(frames[i]);
+        }
+        count += received;
+        if (received < requested)
+        {
+            break;
+        }
+    }
+    if (_rxQueueFull.exchange(false))
+    {
+        // the I/O thread continues reading the socket now that the queue has space again
+        wakeIoThread();
+    }
+    return count;
+}
+
+bool SocketCanTransceiver::isRxQueueEmpty() { return RxQueue::Receiver(_rxQueue).empty(); }
+
+void SocketCanTransceiver::runIoThread()
+{
+    // signals are left to the threads of the application
+    sigset_t set;
+    sigfillset(&set);
+    (void)pthread_sigmask(SIG_SETMASK, &set, nullptr);
+
+    RxQueue::Sender sender(_rxQueue);
+    uint32_t registered = EPOLLIN | EPOLLET;
+    bool ready          = false;
+    while (!_ioStopped.load())
+    {
+        ready = receiveIntoQueue(sender) || ready;
+        if (ready)
+        {
+            ready = false;
+            _ioReadyFunction();
+        }
+
+        // watch for space in the socket only while run() is waiting for it, modifying the
+        // registration also reports the socket as writable if it already is
+        uint32_t const wanted = EPOLLIN | EPOLLET | (_txBlocked.load() ? EPOLLOUT : 0U);
+        if (wanted != registered)
+        {
+            struct epoll_event event;
+            event.events  = wanted;
+            event.data.fd = _fileDescriptor;
+            (void)epoll_ctl(_ioEpollFileDescriptor, EPOLL_CTL_MOD, _fileDescriptor, &event);
+            registered = wanted;
+        }
+
+        struct epoll_event events[3];
+        int const count = epoll_wait(_ioEpollFileDescriptor, events, 3, -1);
+        for (int i = 0; i < count; ++i)
+        {
+            if (events[i].data.fd == _ioEventFileDescriptor)
+            {
+                uint64_t value;
+                (void)::read(_ioEventFileDescriptor, &value, sizeof(value));
+            }
+            else if (events[i].data.fd == _ioTimerFileDescriptor)
+            {
+                // retry sending the frames the device queue didn't accept
+                uint64_t expirations;
+                (void)::read(_ioTimerFileDescriptor, &expirations, sizeof(expirations));
+                ready = true;
+            }
+            else if (((events[i].events & EPOLLOUT) != 0U) && _txBlocked.exchange(false))
+            {
+                ready = true;
+            }
+        }
+    }
+}
+
+bool SocketCanTransceiver::receiveIntoQueue(RxQueue::Sender& sender)
+{
+    size_t const batch = batchSize();
+    bool received      = false;
+    while (true)
+    {
+        size_t const space = RX_QUEUE_SIZE - sender.size();
+        if (space == 0U)
+        {
+            // run() wakes this thread after taking frames from the queue, unless it already has
+            // done so before the flag was set
+            _rxQueueFull.store(true);
+            if (sender.full())
+            {
+                break;
+            }
+            _rxQueueFull.store(false);
+            continue;
+        }
+        CANFrame frames[MAX_BATCH_SIZE];
+        size_t numFrames = 0U;
+        if (readFrames(::etl::span<CANFrame>(frames, ::etl::min(batch, space)), numFrames) == 0U)
+        {
+            break;
+        }
+        (void)sender.write_n(::etl::span<CANFrame const>(frames, numFrames));
+        received = received || (numFrames > 0U);
+    }
+    return received;
+}
+
+void SocketCanTransceiver::wakeIoThread()
+{
+    uint64_t const value = 1U;
+    (void)::write(_ioEventFileDescriptor, &value, sizeof(value));
+}
+
+void SocketCanTransceiver::startTxRetryTimer()
+{
+    struct itimerspec timeout;
+    ::std::memset(&timeout, 0, sizeof(timeout));
+    timeout.it_value.tv_nsec = static_cast<long>(TX_RETRY_TIMEOUT_US) * 1000L;
+    (void)timerfd_settime(_ioTimerFileDescriptor, 0, &timeout, nullptr);
+}
+
+size_t SocketCanTransceiver::batchSize() const
+{
+    return ::etl::max<size_t>(1U, ::etl::min<size_t>(_config.batchSize, MAX_BATCH_SIZE));
 }
 
 } // namespace can
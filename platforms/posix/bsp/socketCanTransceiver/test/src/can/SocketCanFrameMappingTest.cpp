@@ -0,0 +1,181 @@
+// Copyright 2025 Accenture.
+
+#include "can/SocketCanFrameMapping.h"
+
+#include <can/canframes/CanId.h>
+#include <linux/can/error.h>
+
+#include <gtest/gtest.h>
+
+#include <cstring>
+
+namespace
+{
+
+using namespace ::testing;
+using ::can::CANFrame;
+using ::can::CanId;
+using ::can::SocketCanFrameMapping;
+
+uint8_t const PAYLOAD[] = {0x11U, 0x22U, 0x33U, 0x44U, 0x55U};
+
+/**
+ * \desc
+ * Verifies that the qualifiers of CanId are translated into SocketCAN flags, in particular that
+ * the forceNoFd qualifier doesn't reach the socket as CAN_ERR_FLAG.
+ */
+TEST(SocketCanFrameMappingTest, to_socket_can_id)
+{
+    EXPECT_EQ(0x123U, SocketCanFrameMapping::toSocketCanId(CanId::base(0x123U)));
+    EXPECT_EQ(
+        0x1234567U | CAN_EFF_FLAG,
+        SocketCanFrameMapping::toSocketCanId(CanId::extended(0x1234567U)));
+    EXPECT_EQ(0x123U, SocketCanFrameMapping::toSocketCanId(CanId::forceNoFd(CanId::base(0x123U))));
+    EXPECT_EQ(
+        0x1234567U | CAN_EFF_FLAG,
+        SocketCanFrameMapping::toSocketCanId(CanId::forceNoFd(CanId::extended(0x1234567U))));
+}
+
+/**
+ * \desc
+ * Verifies that payload lengths are rounded up to the next valid CAN FD length.
+ */
+TEST(SocketCanFrameMappingTest, to_fd_length)
+{
+    for (uint8_t length = 0U; length <= CAN_MAX_DLEN; ++length)
+    {
+        EXPECT_EQ(length, SocketCanFrameMapping::toFdLength(length));
+    }
+    EXPECT_EQ(12U, SocketCanFrameMapping::toFdLength(9U));
+    EXPECT_EQ(12U, SocketCanFrameMapping::toFdLength(12U));
+    EXPECT_EQ(16U, SocketCanFrameMapping::toFdLength(13U));
+    EXPECT_EQ(20U, SocketCanFrameMapping::toFdLength(17U));
+    EXPECT_EQ(24U, SocketCanFrameMapping::toFdLength(21U));
+    EXPECT_EQ(32U, SocketCanFrameMapping::toFdLength(25U));
+    EXPECT_EQ(48U, SocketCanFrameMapping::toFdLength(33U));
+    EXPECT_EQ(64U, SocketCanFrameMapping::toFdLength(49U));
+    EXPECT_EQ(64U, SocketCanFrameMapping::toFdLength(64U));
+}
+
+/**
+ * \desc
+ * Verifies that frames are sent as classic frames unless the FD mode is selected, and that
+ * forceNoFd ids are sent as classic frames in FD mode.
+ */
+TEST(SocketCanFrameMappingTest, to_socket_can_frame)
+{
+    CANFrame const frame(CanId::extended(0x1234567U), PAYLOAD, sizeof(PAYLOAD));
+    canfd_frame socketCanFrame;
+
+    ::std::memset(&socketCanFrame, 0xFF, sizeof(socketCanFrame));
+    EXPECT_EQ(CAN_MTU, SocketCanFrameMapping::toSocketCanFrame(frame, false, true, socketCanFrame));
+    EXPECT_EQ(0x1234567U | CAN_EFF_FLAG, socketCanFrame.can_id);
+    EXPECT_EQ(sizeof(PAYLOAD), socketCanFrame.len);
+    EXPECT_EQ(0U, socketCanFrame.flags);
+    EXPECT_EQ(0, ::std::memcmp(PAYLOAD, socketCanFrame.data, sizeof(PAYLOAD)));
+    EXPECT_EQ(0U, socketCanFrame.data[sizeof(PAYLOAD)]);
+
+    ::std::memset(&socketCanFrame, 0xFF, sizeof(socketCanFrame));
+    EXPECT_EQ(
+        CANFD_MTU, SocketCanFrameMapping::toSocketCanFrame(frame, true, true, socketCanFrame));
+    EXPECT_EQ(sizeof(PAYLOAD), socketCanFrame.len);
+    EXPECT_EQ(CANFD_BRS, socketCanFrame.flags);
+    EXPECT_EQ(0, ::std::memcmp(PAYLOAD, socketCanFrame.data, sizeof(PAYLOAD)));
+
+    EXPECT_EQ(
+        CANFD_MTU, SocketCanFrameMapping::toSocketCanFrame(frame, true, false, socketCanFrame));
+    EXPECT_EQ(0U, socketCanFrame.flags);
+
+    CANFrame const noFdFrame(CanId::forceNoFd(CanId::base(0x123U)), PAYLOAD, sizeof(PAYLOAD));
+    EXPECT_EQ(
+        CAN_MTU, SocketCanFrameMapping::toSocketCanFrame(noFdFrame, true, true, socketCanFrame));
+    EXPECT_EQ(0x123U, socketCanFrame.can_id);
+}
+
+#ifdef CPP2CAN_USE_64_BYTE_FRAMES
+/**
+ * \desc
+ * Verifies that frames with more than 8 bytes of payload are sent as CAN FD frames padded with
+ * zeros, and that they are only sendable on CAN FD interfaces.
+ */
+TEST(SocketCanFrameMappingTest, fd_padding)
+{
+    uint8_t payload[13];
+    ::std::memset(payload, 0xAAU, sizeof(payload));
+    CANFrame const frame(CanId::base(0x123U), payload, sizeof(payload));
+    canfd_frame socketCanFrame;
+    ::std::memset(&socketCanFrame, 0xFF, sizeof(socketCanFrame));
+
+    EXPECT_EQ(
+        CANFD_MTU, SocketCanFrameMapping::toSocketCanFrame(frame, false, true, socketCanFrame));
+    EXPECT_EQ(16U, socketCanFrame.len);
+    EXPECT_EQ(0, ::std::memcmp(payload, socketCanFrame.data, sizeof(payload)));
+    for (size_t i = sizeof(payload); i < 16U; ++i)
+    {
+        EXPECT_EQ(0U, socketCanFrame.data[i]);
+    }
+
+    EXPECT_FALSE(SocketCanFrameMapping::isSendable(frame, false));
+    EXPECT_TRUE(SocketCanFrameMapping::isSendable(frame, true));
+}
+#endif
+
+/**
+ * \desc
+ * Verifies that classic frames are sendable on all interfaces.
+ */
+TEST(SocketCanFrameMappingTest, classic_frames_are_sendable)
+{
+    CANFrame const frame(CanId::base(0x123U), PAYLOAD, sizeof(PAYLOAD));
+    EXPECT_TRUE(SocketCanFrameMapping::isSendable(frame, false));
+    EXPECT_TRUE(SocketCanFrameMapping::isSendable(frame, true));
+}
+
+/**
+ * \desc
+ * Verifies that received data frames of both formats are mapped to CANFrame objects.
+ */
+TEST(SocketCanFrameMappingTest, from_socket_can_frame)
+{
+    canfd_frame socketCanFrame;
+    ::std::memset(&socketCanFrame, 0, sizeof(socketCanFrame));
+    socketCanFrame.can_id = 0x1234567U | CAN_EFF_FLAG;
+    socketCanFrame.len    = sizeof(PAYLOAD);
+    ::std::memcpy(socketCanFrame.data, PAYLOAD, sizeof(PAYLOAD));
+    CANFrame frame;
+
+    EXPECT_TRUE(SocketCanFrameMapping::fromSocketCanFrame(socketCanFrame, CAN_MTU, frame));
+    EXPECT_EQ(CanId::extended(0x1234567U), frame.getId());
+    EXPECT_EQ(sizeof(PAYLOAD), frame.getPayloadLength());
+    EXPECT_EQ(0, ::std::memcmp(PAYLOAD, frame.getPayload(), sizeof(PAYLOAD)));
+
+    socketCanFrame.can_id = 0x123U;
+    EXPECT_TRUE(SocketCanFrameMapping::fromSocketCanFrame(socketCanFrame, CANFD_MTU, frame));
+    EXPECT_EQ(CanId::base(0x123U), frame.getId());
+}
+
+/**
+ * \desc
+ * Verifies that remote frames, error frames, messages of unexpected length and frames with more
+ * payload than a CANFrame holds are not passed on.
+ */
+TEST(SocketCanFrameMappingTest, from_socket_can_frame_filters_frames)
+{
+    canfd_frame socketCanFrame;
+    ::std::memset(&socketCanFrame, 0, sizeof(socketCanFrame));
+    socketCanFrame.len = 2U;
+    CANFrame frame;
+
+    socketCanFrame.can_id = 0x123U | CAN_RTR_FLAG;
+    EXPECT_FALSE(SocketCanFrameMapping::fromSocketCanFrame(socketCanFrame, CAN_MTU, frame));
+    socketCanFrame.can_id = CAN_ERR_FLAG | CAN_ERR_BUSOFF;
+    EXPECT_FALSE(SocketCanFrameMapping::fromSocketCanFrame(socketCanFrame, CAN_MTU, frame));
+
+    socketCanFrame.can_id = 0x123U;
+    EXPECT_FALSE(SocketCanFrameMapping::fromSocketCanFrame(socketCanFrame, CAN_MTU - 1U, frame));
+
+    socketCanFrame.len = CANFrame::MAX_FRAME_LENGTH + 1U;
+    EXPECT_FALSE(SocketCanFrameMapping::fromSocketCanFrame(socketCanFrame, CANFD_MTU, frame));
+}
+
+} // namespace
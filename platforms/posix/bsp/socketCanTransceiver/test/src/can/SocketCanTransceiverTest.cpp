@@ -18,6 +18,105 @@ TEST(SocketCanTransceiverTest, transceiver_creation)
     ::can::SocketCanTransceiver::DeviceConfig config{"vcan0", {}};
     ::can::SocketCanTransceiver transceiver{config};
     EXPECT_EQ(transceiver.getState(), ::can::ICanTransceiver::State::CLOSED);
+    EXPECT_EQ(-1, transceiver.getFileDescriptor());
+}
+
+/**
+ * \desc
+ * Verifies that the tx pending function is called for each frame queued by write().
+ */
+TEST(SocketCanTransceiverTest, tx_pending_function)
+{
+    ::can::SocketCanTransceiver::DeviceConfig config{"vcan0", {}};
+    ::can::SocketCanTransceiver transceiver{config};
+    size_t callCount = 0U;
+    auto const txPending = [&callCount]() { ++callCount; };
+    transceiver.setTxPendingFunction(
+        ::can::SocketCanTransceiver::TxPendingFunctionType::create(txPending));
+    ::can::CANFrame const frame;
+
+    // frames are rejected while the transceiver isn't open
+    EXPECT_NE(::can::ICanTransceiver::ErrorCode::CAN_ERR_OK, transceiver.write(frame));
+    EXPECT_EQ(0U, callCount);
+    EXPECT_FALSE(transceiver.isTxPending());
+
+    transceiver.init();
+    transceiver.open();
+    EXPECT_EQ(::can::ICanTransceiver::ErrorCode::CAN_ERR_OK, transceiver.write(frame));
+    EXPECT_EQ(1U, callCount);
+    EXPECT_TRUE(transceiver.isTxPending());
+    transceiver.close();
+}
+
+/**
+ * \desc
+ * Verifies that frames stay queued if run() can't send them, e.g. because the interface doesn't
+ * exist, and that the batch size defaults to the maximum.
+ */
+TEST(SocketCanTransceiverTest, run_keeps_unsent_frames)
+{
+    ::can::SocketCanTransceiver::DeviceConfig config{"nonexistent", {}};
+    EXPECT_EQ(::can::SocketCanTransceiver::MAX_BATCH_SIZE, config.batchSize);
+    config.batchSize = 2U;
+    ::can::SocketCanTransceiver transceiver{config};
+    ::can::CANFrame const frame;
+
+    transceiver.init();
+    transceiver.open();
+    EXPECT_EQ(-1, transceiver.getFileDescriptor());
+    EXPECT_EQ(::can::ICanTransceiver::ErrorCode::CAN_ERR_OK, transceiver.write(frame));
+    EXPECT_EQ(::can::ICanTransceiver::ErrorCode::CAN_ERR_OK, transceiver.write(frame));
+    EXPECT_EQ(::can::ICanTransceiver::ErrorCode::CAN_ERR_OK, transceiver.write(frame));
+    transceiver.run(5, 5);
+    EXPECT_TRUE(transceiver.isTxPending());
+    transceiver.close();
+}
+
+#ifdef CPP2CAN_USE_64_BYTE_FRAMES
+/**
+ * \desc
+ * Verifies that write() rejects frames with more than 8 bytes of payload if the interface doesn't
+ * support CAN FD.
+ */
+TEST(SocketCanTransceiverTest, write_rejects_fd_frames_without_fd_interface)
+{
+    ::can::SocketCanTransceiver::DeviceConfig config{"nonexistent", {}};
+    config.canFd = true;
+    ::can::SocketCanTransceiver transceiver{config};
+    uint8_t const payload[12] = {};
+    ::can::CANFrame const fdFrame(0x123U, payload, sizeof(payload));
+    ::can::CANFrame const frame(0x123U, payload, 8U);
+
+    transceiver.init();
+    transceiver.open();
+    EXPECT_EQ(::can::ICanTransceiver::ErrorCode::CAN_ERR_TX_FAIL, transceiver.write(fdFrame));
+    EXPECT_FALSE(transceiver.isTxPending());
+    EXPECT_EQ(::can::ICanTransceiver::ErrorCode::CAN_ERR_OK, transceiver.write(frame));
+    EXPECT_TRUE(transceiver.isTxPending());
+    transceiver.close();
+}
+#endif
+
+/**
+ * \desc
+ * Verifies that the I/O thread can't be started without an open socket.
+ */
+TEST(SocketCanTransceiverTest, io_thread_requires_socket)
+{
+    ::can::SocketCanTransceiver::DeviceConfig config{"nonexistent", {}};
+    ::can::SocketCanTransceiver transceiver{config};
+    size_t callCount = 0U;
+    auto const ready = [&callCount]() { ++callCount; };
+    auto const readyFunction = ::can::SocketCanTransceiver::IoReadyFunctionType::create(ready);
+
+    EXPECT_FALSE(transceiver.startIoThread(readyFunction));
+    transceiver.init();
+    transceiver.open();
+    EXPECT_FALSE(transceiver.startIoThread(readyFunction));
+    transceiver.run(5, 5);
+    EXPECT_EQ(0U, callCount);
+    transceiver.stopIoThread();
+    transceiver.close();
 }
 
 } // namespace